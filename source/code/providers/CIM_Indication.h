@@ -0,0 +1,739 @@
+/* @migen@ */
+/*
+**==============================================================================
+**
+** WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. PLEASE DO NOT EDIT.
+**
+**==============================================================================
+*/
+#ifndef _CIM_Indication_h
+#define _CIM_Indication_h
+
+#include <MI.h>
+
+/*
+**==============================================================================
+**
+** CIM_Indication [CIM_Indication]
+**
+** Keys:
+**
+**==============================================================================
+*/
+
+typedef struct _CIM_Indication
+{
+    MI_Instance __instance;
+    /* CIM_Indication properties */
+    MI_ConstStringField IndicationIdentifier;
+    MI_ConstStringAField CorrelatedIndications;
+    MI_ConstDatetimeField IndicationTime;
+    MI_ConstUint16Field PerceivedSeverity;
+    MI_ConstStringField OtherSeverity;
+    MI_ConstStringField IndicationFilterName;
+    MI_ConstStringField SequenceContext;
+    MI_ConstSint64Field SequenceNumber;
+}
+CIM_Indication;
+
+typedef struct _CIM_Indication_Ref
+{
+    CIM_Indication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+CIM_Indication_Ref;
+
+typedef struct _CIM_Indication_ConstRef
+{
+    MI_CONST CIM_Indication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+CIM_Indication_ConstRef;
+
+typedef struct _CIM_Indication_Array
+{
+    struct _CIM_Indication** data;
+    MI_Uint32 size;
+}
+CIM_Indication_Array;
+
+typedef struct _CIM_Indication_ConstArray
+{
+    struct _CIM_Indication MI_CONST* MI_CONST* data;
+    MI_Uint32 size;
+}
+CIM_Indication_ConstArray;
+
+typedef struct _CIM_Indication_ArrayRef
+{
+    CIM_Indication_Array value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+CIM_Indication_ArrayRef;
+
+typedef struct _CIM_Indication_ConstArrayRef
+{
+    CIM_Indication_ConstArray value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+CIM_Indication_ConstArrayRef;
+
+MI_EXTERN_C MI_CONST MI_ClassDecl CIM_Indication_rtti;
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Construct(
+    CIM_Indication* self,
+    MI_Context* context)
+{
+    return MI_ConstructInstance(context, &CIM_Indication_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clone(
+    const CIM_Indication* self,
+    CIM_Indication** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Boolean MI_CALL CIM_Indication_IsA(
+    const MI_Instance* self)
+{
+    MI_Boolean res = MI_FALSE;
+    return MI_Instance_IsA(self, &CIM_Indication_rtti, &res) == MI_RESULT_OK && res;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Destruct(CIM_Indication* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Delete(CIM_Indication* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Post(
+    const CIM_Indication* self,
+    MI_Context* context,
+    MI_Uint32 subscriptionIDCount,
+    const MI_Char* bookmark)
+{
+    return MI_PostIndication(context, &self->__instance, subscriptionIDCount, bookmark);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_IndicationIdentifier(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_SetPtr_IndicationIdentifier(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_IndicationIdentifier(
+    CIM_Indication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_CorrelatedIndications(
+    CIM_Indication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_SetPtr_CorrelatedIndications(
+    CIM_Indication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_CorrelatedIndications(
+    CIM_Indication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_IndicationTime(
+    CIM_Indication* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->IndicationTime)->value = x;
+    ((MI_DatetimeField*)&self->IndicationTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_IndicationTime(
+    CIM_Indication* self)
+{
+    memset((void*)&self->IndicationTime, 0, sizeof(self->IndicationTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_PerceivedSeverity(
+    CIM_Indication* self,
+    MI_Uint16 x)
+{
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->value = x;
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_PerceivedSeverity(
+    CIM_Indication* self)
+{
+    memset((void*)&self->PerceivedSeverity, 0, sizeof(self->PerceivedSeverity));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_OtherSeverity(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_SetPtr_OtherSeverity(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_OtherSeverity(
+    CIM_Indication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_IndicationFilterName(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_SetPtr_IndicationFilterName(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_IndicationFilterName(
+    CIM_Indication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_SequenceContext(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_SetPtr_SequenceContext(
+    CIM_Indication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_SequenceContext(
+    CIM_Indication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Set_SequenceNumber(
+    CIM_Indication* self,
+    MI_Sint64 x)
+{
+    ((MI_Sint64Field*)&self->SequenceNumber)->value = x;
+    ((MI_Sint64Field*)&self->SequenceNumber)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL CIM_Indication_Clear_SequenceNumber(
+    CIM_Indication* self)
+{
+    memset((void*)&self->SequenceNumber, 0, sizeof(self->SequenceNumber));
+    return MI_RESULT_OK;
+}
+
+
+/*
+**==============================================================================
+**
+** CIM_Indication_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class CIM_Indication_Class : public Instance
+{
+public:
+    
+    typedef CIM_Indication Self;
+    
+    CIM_Indication_Class() :
+        Instance(&CIM_Indication_rtti)
+    {
+    }
+    
+    CIM_Indication_Class(
+        const CIM_Indication* instanceName,
+        bool keysOnly) :
+        Instance(
+            &CIM_Indication_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    CIM_Indication_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    CIM_Indication_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    CIM_Indication_Class& operator=(
+        const CIM_Indication_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    CIM_Indication_Class(
+        const CIM_Indication_Class& x) :
+        Instance(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &CIM_Indication_rtti;
+    }
+
+    //
+    // CIM_Indication_Class.IndicationIdentifier
+    //
+    
+    const Field<String>& IndicationIdentifier() const
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        return GetField<String>(n);
+    }
+    
+    void IndicationIdentifier(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        GetField<String>(n) = x;
+    }
+    
+    const String& IndicationIdentifier_value() const
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        return GetField<String>(n).value;
+    }
+    
+    void IndicationIdentifier_value(const String& x)
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool IndicationIdentifier_exists() const
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void IndicationIdentifier_clear()
+    {
+        const size_t n = offsetof(Self, IndicationIdentifier);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.CorrelatedIndications
+    //
+    
+    const Field<StringA>& CorrelatedIndications() const
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        return GetField<StringA>(n);
+    }
+    
+    void CorrelatedIndications(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& CorrelatedIndications_value() const
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        return GetField<StringA>(n).value;
+    }
+    
+    void CorrelatedIndications_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool CorrelatedIndications_exists() const
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void CorrelatedIndications_clear()
+    {
+        const size_t n = offsetof(Self, CorrelatedIndications);
+        GetField<StringA>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.IndicationTime
+    //
+    
+    const Field<Datetime>& IndicationTime() const
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        return GetField<Datetime>(n);
+    }
+    
+    void IndicationTime(const Field<Datetime>& x)
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        GetField<Datetime>(n) = x;
+    }
+    
+    const Datetime& IndicationTime_value() const
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        return GetField<Datetime>(n).value;
+    }
+    
+    void IndicationTime_value(const Datetime& x)
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        GetField<Datetime>(n).Set(x);
+    }
+    
+    bool IndicationTime_exists() const
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        return GetField<Datetime>(n).exists ? true : false;
+    }
+    
+    void IndicationTime_clear()
+    {
+        const size_t n = offsetof(Self, IndicationTime);
+        GetField<Datetime>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.PerceivedSeverity
+    //
+    
+    const Field<Uint16>& PerceivedSeverity() const
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        return GetField<Uint16>(n);
+    }
+    
+    void PerceivedSeverity(const Field<Uint16>& x)
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        GetField<Uint16>(n) = x;
+    }
+    
+    const Uint16& PerceivedSeverity_value() const
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        return GetField<Uint16>(n).value;
+    }
+    
+    void PerceivedSeverity_value(const Uint16& x)
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        GetField<Uint16>(n).Set(x);
+    }
+    
+    bool PerceivedSeverity_exists() const
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        return GetField<Uint16>(n).exists ? true : false;
+    }
+    
+    void PerceivedSeverity_clear()
+    {
+        const size_t n = offsetof(Self, PerceivedSeverity);
+        GetField<Uint16>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.OtherSeverity
+    //
+    
+    const Field<String>& OtherSeverity() const
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        return GetField<String>(n);
+    }
+    
+    void OtherSeverity(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        GetField<String>(n) = x;
+    }
+    
+    const String& OtherSeverity_value() const
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        return GetField<String>(n).value;
+    }
+    
+    void OtherSeverity_value(const String& x)
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool OtherSeverity_exists() const
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void OtherSeverity_clear()
+    {
+        const size_t n = offsetof(Self, OtherSeverity);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.IndicationFilterName
+    //
+    
+    const Field<String>& IndicationFilterName() const
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        return GetField<String>(n);
+    }
+    
+    void IndicationFilterName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& IndicationFilterName_value() const
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        return GetField<String>(n).value;
+    }
+    
+    void IndicationFilterName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool IndicationFilterName_exists() const
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void IndicationFilterName_clear()
+    {
+        const size_t n = offsetof(Self, IndicationFilterName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.SequenceContext
+    //
+    
+    const Field<String>& SequenceContext() const
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        return GetField<String>(n);
+    }
+    
+    void SequenceContext(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        GetField<String>(n) = x;
+    }
+    
+    const String& SequenceContext_value() const
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        return GetField<String>(n).value;
+    }
+    
+    void SequenceContext_value(const String& x)
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool SequenceContext_exists() const
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void SequenceContext_clear()
+    {
+        const size_t n = offsetof(Self, SequenceContext);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // CIM_Indication_Class.SequenceNumber
+    //
+    
+    const Field<Sint64>& SequenceNumber() const
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        return GetField<Sint64>(n);
+    }
+    
+    void SequenceNumber(const Field<Sint64>& x)
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        GetField<Sint64>(n) = x;
+    }
+    
+    const Sint64& SequenceNumber_value() const
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        return GetField<Sint64>(n).value;
+    }
+    
+    void SequenceNumber_value(const Sint64& x)
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        GetField<Sint64>(n).Set(x);
+    }
+    
+    bool SequenceNumber_exists() const
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        return GetField<Sint64>(n).exists ? true : false;
+    }
+    
+    void SequenceNumber_clear()
+    {
+        const size_t n = offsetof(Self, SequenceNumber);
+        GetField<Sint64>(n).Clear();
+    }
+};
+
+typedef Array<CIM_Indication_Class> CIM_Indication_ClassA;
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _CIM_Indication_h */
@@ -62,6 +62,7 @@ typedef struct _SCX_Agent /* extends CIM_LogicalElement */
     MI_ConstStringField MachineType;
     MI_ConstUint64Field PhysicalProcessors;
     MI_ConstUint64Field LogicalProcessors;
+    MI_ConstStringAField ProviderMetrics;
 }
 SCX_Agent;
 
@@ -1001,6 +1002,46 @@ MI_INLINE MI_Result MI_CALL SCX_Agent_Clear_LogicalProcessors(
     return MI_RESULT_OK;
 }
 
+MI_INLINE MI_Result MI_CALL SCX_Agent_Set_ProviderMetrics(
+    SCX_Agent* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        32,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_Agent_SetPtr_ProviderMetrics(
+    SCX_Agent* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        32,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_Agent_Clear_ProviderMetrics(
+    SCX_Agent* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        32);
+}
+
 /*
 **==============================================================================
 **
@@ -1846,6 +1887,46 @@ public:
         const size_t n = offsetof(Self, LogicalProcessors);
         GetField<Uint64>(n).Clear();
     }
+
+    //
+    // SCX_Agent_Class.ProviderMetrics
+    //
+    
+    const Field<StringA>& ProviderMetrics() const
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        return GetField<StringA>(n);
+    }
+    
+    void ProviderMetrics(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& ProviderMetrics_value() const
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        return GetField<StringA>(n).value;
+    }
+    
+    void ProviderMetrics_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool ProviderMetrics_exists() const
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void ProviderMetrics_clear()
+    {
+        const size_t n = offsetof(Self, ProviderMetrics);
+        GetField<StringA>(n).Clear();
+    }
 };
 
 typedef Array<SCX_Agent_Class> SCX_Agent_ClassA;
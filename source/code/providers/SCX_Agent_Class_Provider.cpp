@@ -30,6 +30,7 @@
 #include <errno.h>
 #include <sstream>
 #include <iostream>
+#include <vector>
 
 
 using namespace SCXCoreLib;
@@ -182,6 +183,23 @@ static void EnumerateOneInstance(
                                StrAppend(L"Can't read logical processor count because ", e.What()),
                                e.Where()));
         }
+
+        //
+        // Populate the per-operation provider metrics (one string per operation)
+        //
+        std::vector<std::wstring> metrics;
+        SCXCore::g_ProviderMetrics.GetMetrics(metrics);
+        if ( !metrics.empty() )
+        {
+            std::vector<mi::String> metricsData;
+            for (std::vector<std::wstring>::const_iterator it = metrics.begin(); it != metrics.end(); ++it)
+            {
+                metricsData.push_back( mi::String(StrToUTF8(*it).c_str()) );
+            }
+
+            StringA metricsArray(&metricsData[0], static_cast<MI_Uint32>(metricsData.size()));
+            inst.ProviderMetrics_value( metricsArray );
+        }
     }
 
     context.Post(inst);
@@ -239,16 +257,17 @@ void SCX_Agent_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_Agent_Class_Provider::EnumerateInstances" )
     {
         // Global lock for MetaProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MetaProvider::Lock"));
 
         SCX_Agent_Class inst;
         EnumerateOneInstance( context, inst, keysOnly );
+        scxPexTimer.AddInstances(1);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_Agent_Class_Provider::EnumerateInstances", SCXCore::g_MetaProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_Agent_Class_Provider::EnumerateInstances", SCXCore::g_MetaProvider.GetLogHandle() );
 }
 
 void SCX_Agent_Class_Provider::GetInstance(
@@ -257,7 +276,7 @@ void SCX_Agent_Class_Provider::GetInstance(
     const SCX_Agent_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_Agent_Class_Provider::GetInstance" )
     {
         // Global lock for MetaProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MetaProvider::Lock"));
@@ -279,7 +298,7 @@ void SCX_Agent_Class_Provider::GetInstance(
         EnumerateOneInstance( context, inst, false );
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_Agent_Class_Provider::GetInstance", SCXCore::g_MetaProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_Agent_Class_Provider::GetInstance", SCXCore::g_MetaProvider.GetLogHandle() );
 }
 
 void SCX_Agent_Class_Provider::CreateInstance(
@@ -113,7 +113,7 @@ void SCX_Application_Server_Class_Provider::EnumerateInstances(
 {
     SCXLogHandle& log = SCXCore::g_AppServerProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_Application_Server_Class_Provider::EnumerateInstances" )
     {
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::AppServerProvider::Lock"));
         SCXCoreLib::SCXHandle<SCXSystemLib::AppServerEnumeration> appServers = SCXCore::g_AppServerProvider.GetAppServers();
@@ -129,10 +129,11 @@ void SCX_Application_Server_Class_Provider::EnumerateInstances(
             SCX_Application_Server_Class inst;
             EnumerateOneInstance( context, inst, keysOnly, appServers->GetInstance(i) );
             context.Post(inst);
+            scxPexTimer.AddInstances(1);
         }
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_Application_Server_Class_Provider::EnumerateInstances", log );
+    SCX_PEX_END_TIMED( L"SCX_Application_Server_Class_Provider::EnumerateInstances", log );
 }
 
 void SCX_Application_Server_Class_Provider::GetInstance(
@@ -143,7 +144,7 @@ void SCX_Application_Server_Class_Provider::GetInstance(
 {
     SCXLogHandle& log = SCXCore::g_AppServerProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_Application_Server_Class_Provider::GetInstance" )
     {
         if ( !instanceName.Name_exists() )
         {
@@ -174,7 +175,7 @@ void SCX_Application_Server_Class_Provider::GetInstance(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_Application_Server_Class_Provider::GetInstances", log );
+    SCX_PEX_END_TIMED( L"SCX_Application_Server_Class_Provider::GetInstance", log );
 }
 
 void SCX_Application_Server_Class_Provider::CreateInstance(
@@ -210,7 +211,7 @@ void SCX_Application_Server_Class_Provider::Invoke_SetDeepMonitoring(
 {
     SCXLogHandle& log = SCXCore::g_AppServerProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_Application_Server_Class_Provider::Invoke_SetDeepMonitoring" )
     {
         // Global lock for AppServerProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::AppServerProvider::Lock"));
@@ -265,7 +266,7 @@ void SCX_Application_Server_Class_Provider::Invoke_SetDeepMonitoring(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_Application_Server_Class_Provider::Invoke_SetDeepMonitoring", log );
+    SCX_PEX_END_TIMED( L"SCX_Application_Server_Class_Provider::Invoke_SetDeepMonitoring", log );
 }
 
 
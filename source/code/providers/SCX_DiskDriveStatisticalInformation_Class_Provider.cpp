@@ -159,7 +159,7 @@ void SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -174,6 +174,7 @@ void SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances(
             SCX_DiskDriveStatisticalInformation_Class inst;
             SCXHandle<SCXSystemLib::StatisticalPhysicalDiskInstance> diskInst = diskEnum->GetInstance(i);
             EnumerateOneInstance(context, inst, keysOnly, diskInst);
+            scxPexTimer.AddInstances(1);
         }
 
         // Enumerate Total instance
@@ -183,12 +184,13 @@ void SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances(
             // There will always be one total instance
             SCX_DiskDriveStatisticalInformation_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, totalInst);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances",
-                     SCXCore::g_DiskProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_DiskDriveStatisticalInformation_Class_Provider::EnumerateInstances",
+                           SCXCore::g_DiskProvider.GetLogHandle() );
 }
 
 void SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance(
@@ -197,7 +199,7 @@ void SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance(
     const SCX_DiskDriveStatisticalInformation_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -225,8 +227,8 @@ void SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance(
         EnumerateOneInstance(context, inst, false, diskInst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance",
-                      SCXCore::g_DiskProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_DiskDriveStatisticalInformation_Class_Provider::GetInstance",
+                            SCXCore::g_DiskProvider.GetLogHandle() );
 }
 
 void SCX_DiskDriveStatisticalInformation_Class_Provider::CreateInstance(
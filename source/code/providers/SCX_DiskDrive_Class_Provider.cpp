@@ -179,7 +179,7 @@ void SCX_DiskDrive_Class_Provider::EnumerateInstances(
         bool keysOnly,
         const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_DiskDrive_Class_Provider::EnumerateInstances" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -194,6 +194,7 @@ void SCX_DiskDrive_Class_Provider::EnumerateInstances(
             SCX_DiskDrive_Class inst;
             SCXHandle<SCXSystemLib::StaticPhysicalDiskInstance> diskInst = diskEnum->GetInstance(i);
             EnumerateOneInstance(context, inst, keysOnly, diskInst);
+            scxPexTimer.AddInstances(1);
         }
 
         // Enumerate Total instance
@@ -203,12 +204,13 @@ void SCX_DiskDrive_Class_Provider::EnumerateInstances(
             // There will always be one total instance
             SCX_DiskDrive_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, totalInst);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_DiskDrive_Class_Provider::EnumerateInstances",
-                     SCXCore::g_DiskProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_DiskDrive_Class_Provider::EnumerateInstances",
+                           SCXCore::g_DiskProvider.GetLogHandle() );
 }
 
 void SCX_DiskDrive_Class_Provider::GetInstance(
@@ -217,7 +219,7 @@ void SCX_DiskDrive_Class_Provider::GetInstance(
     const SCX_DiskDrive_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_DiskDrive_Class_Provider::GetInstance" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -278,8 +280,8 @@ void SCX_DiskDrive_Class_Provider::GetInstance(
         EnumerateOneInstance(context, inst, false, diskInst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_DiskDrive_Class_Provider::GetInstance",
-                     SCXCore::g_DiskProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_DiskDrive_Class_Provider::GetInstance",
+                           SCXCore::g_DiskProvider.GetLogHandle() );
 }
 
 void SCX_DiskDrive_Class_Provider::CreateInstance(
@@ -394,7 +396,7 @@ void SCX_DiskDrive_Class_Provider::Invoke_RemoveByName(
     const SCX_DiskDrive_Class& instanceName,
     const SCX_DiskDrive_RemoveByName_Class& in)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_DiskDrive_Class_Provider::Invoke_RemoveByName" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -431,7 +433,7 @@ void SCX_DiskDrive_Class_Provider::Invoke_RemoveByName(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_DiskDrive_Class_Provider::Invoke_RemoveByName", SCXCore::g_DiskProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_DiskDrive_Class_Provider::Invoke_RemoveByName", SCXCore::g_DiskProvider.GetLogHandle() );
 }
 
 
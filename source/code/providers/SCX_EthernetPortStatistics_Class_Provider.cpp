@@ -115,7 +115,7 @@ void SCX_EthernetPortStatistics_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_EthernetPortStatistics_Class_Provider::EnumerateInstances" )
     {
         // Global lock for NetworkProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::NetworkProvider::Lock"));
@@ -134,12 +134,13 @@ void SCX_EthernetPortStatistics_Class_Provider::EnumerateInstances(
             SCXCoreLib::SCXHandle<SCXSystemLib::NetworkInterfaceInstance> intf = deps->GetIntf(i);
             SCX_EthernetPortStatistics_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, intf);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_EthernetPortStatistics_Class_Provider::EnumerateInstances",
-                 SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_EthernetPortStatistics_Class_Provider::EnumerateInstances",
+                       SCXCore::g_NetworkProvider.GetLogHandle() );
 
 }
 
@@ -149,7 +150,7 @@ void SCX_EthernetPortStatistics_Class_Provider::GetInstance(
     const SCX_EthernetPortStatistics_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_EthernetPortStatistics_Class_Provider::GetInstance" )
     {
         // Global lock for NetworkProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::NetworkProvider::Lock"));
@@ -184,7 +185,7 @@ void SCX_EthernetPortStatistics_Class_Provider::GetInstance(
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_EthernetPortStatistics_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_EthernetPortStatistics_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
 }
 
 void SCX_EthernetPortStatistics_Class_Provider::CreateInstance(
@@ -19,83 +19,146 @@
 #include <scxcorelib/scxmath.h>
 #include "support/filesystemprovider.h"
 #include "support/scxcimutils.h"
+#include "support/snapshotenumeration.h"
 
 using namespace SCXCoreLib;
 using namespace SCXSystemLib;
 
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(
-    Context& context,
-    SCX_FileSystemStatisticalInformation_Class& inst,
+/*----------------------------------------------------------------------------*/
+/**
+   Data copied out of a StatisticalLogicalDiskInstance while holding the provider lock
+*/
+struct FileSystemStatisticsSnapshot
+{
+    FileSystemStatisticsSnapshot() : isTotal(false) { }
+
+    bool isTotal;
+    SCXCore::SnapshotValue<std::wstring> name;
+    SCXCore::SnapshotValue<bool> healthy;
+    SCXCore::SnapshotValue<scxulong> ioPercentageTotal;
+    SCXCore::SnapshotValue<scxulong> bytesPerSecondTotal;
+    SCXCore::SnapshotValue<scxulong> readBytesPerSecond;
+    SCXCore::SnapshotValue<scxulong> writeBytesPerSecond;
+    SCXCore::SnapshotValue<scxulong> transfersPerSecond;
+    SCXCore::SnapshotValue<scxulong> readsPerSecond;
+    SCXCore::SnapshotValue<scxulong> writesPerSecond;
+    SCXCore::SnapshotValue<double> ioTimesTotal;
+    SCXCore::SnapshotValue<scxulong> usedMegabytes;
+    SCXCore::SnapshotValue<scxulong> freeMegabytes;
+    SCXCore::SnapshotValue<scxulong> inodesTotal;
+    SCXCore::SnapshotValue<scxulong> inodesFree;
+    SCXCore::SnapshotValue<double> diskQueueLength;
+};
+
+static void CaptureOneInstance(
+    FileSystemStatisticsSnapshot& snap,
     bool keysOnly,
     SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> diskinst)
 {
     diskinst->Update();
 
-    // Populate the key values
-    std::wstring name;
-    if (diskinst->GetDiskName(name))
+    snap.name.exists = diskinst->GetDiskName(snap.name.value);
+
+    if (!keysOnly)
     {
-        inst.Name_value(StrToMultibyte(name).c_str());
+        snap.isTotal = diskinst->IsTotal();
+        snap.healthy.exists = diskinst->GetHealthState(snap.healthy.value);
+        snap.ioPercentageTotal.exists = diskinst->GetIOPercentageTotal(snap.ioPercentageTotal.value);
+        snap.bytesPerSecondTotal.exists = diskinst->GetBytesPerSecondTotal(snap.bytesPerSecondTotal.value);
+        snap.readBytesPerSecond.exists = snap.writeBytesPerSecond.exists =
+            diskinst->GetBytesPerSecond(snap.readBytesPerSecond.value, snap.writeBytesPerSecond.value);
+        snap.transfersPerSecond.exists = diskinst->GetTransfersPerSecond(snap.transfersPerSecond.value);
+        snap.readsPerSecond.exists = diskinst->GetReadsPerSecond(snap.readsPerSecond.value);
+        snap.writesPerSecond.exists = diskinst->GetWritesPerSecond(snap.writesPerSecond.value);
+        snap.ioTimesTotal.exists = diskinst->GetIOTimesTotal(snap.ioTimesTotal.value);
+        snap.usedMegabytes.exists = snap.freeMegabytes.exists =
+            diskinst->GetDiskSize(snap.usedMegabytes.value, snap.freeMegabytes.value);
+        snap.inodesTotal.exists = snap.inodesFree.exists =
+            diskinst->GetInodeUsage(snap.inodesTotal.value, snap.inodesFree.value);
+        snap.diskQueueLength.exists = diskinst->GetDiskQueueLength(snap.diskQueueLength.value);
     }
+}
 
-    if (!keysOnly)
+/*----------------------------------------------------------------------------*/
+/**
+   Builds an SCX_FileSystemStatisticalInformation instance from a snapshot
+   (called without the lock)
+*/
+class FileSystemStatisticsBuilder
+{
+public:
+    explicit FileSystemStatisticsBuilder(bool keysOnly)
+        : m_keysOnly(keysOnly)
+    {
+    }
+
+    void operator()(const FileSystemStatisticsSnapshot& snap, SCX_FileSystemStatisticalInformation_Class& inst) const
     {
+        // Populate the key values
+        if (snap.name.exists)
+        {
+            inst.Name_value(StrToMultibyte(snap.name.value).c_str());
+        }
+
+        if (m_keysOnly)
+        {
+            return;
+        }
+
         inst.Caption_value("File system information");
         inst.Description_value("Performance statistics related to a logical unit of secondary storage");
 
-        scxulong data1;
-        scxulong data2;
-        double ddata1;
-        bool healthy;
-
-        if (diskinst->GetHealthState(healthy))
+        if (snap.healthy.exists)
         {
-            inst.IsOnline_value(healthy);
+            inst.IsOnline_value(snap.healthy.value);
         }
 
-        inst.IsAggregate_value(diskinst->IsTotal());
+        inst.IsAggregate_value(snap.isTotal);
 
-        if (diskinst->GetIOPercentageTotal(data1))
+        if (snap.ioPercentageTotal.exists)
         {
-            inst.PercentBusyTime_value((unsigned char) data1);
-            inst.PercentIdleTime_value((unsigned char) (100-data1));
+            inst.PercentBusyTime_value((unsigned char) snap.ioPercentageTotal.value);
+            inst.PercentIdleTime_value((unsigned char) (100-snap.ioPercentageTotal.value));
         }
 
-        if (diskinst->GetBytesPerSecondTotal(data1))
+        if (snap.bytesPerSecondTotal.exists)
         {
-            inst.BytesPerSecond_value(data1);
+            inst.BytesPerSecond_value(snap.bytesPerSecondTotal.value);
         }
 
-        if (diskinst->GetBytesPerSecond(data1, data2))
+        if (snap.readBytesPerSecond.exists)
         {
-            inst.ReadBytesPerSecond_value(data1);
-            inst.WriteBytesPerSecond_value(data2);
+            inst.ReadBytesPerSecond_value(snap.readBytesPerSecond.value);
+            inst.WriteBytesPerSecond_value(snap.writeBytesPerSecond.value);
         }
 
-        if (diskinst->GetTransfersPerSecond(data1))
+        if (snap.transfersPerSecond.exists)
         {
-            inst.TransfersPerSecond_value(data1);
+            inst.TransfersPerSecond_value(snap.transfersPerSecond.value);
         }
 
-        if (diskinst->GetReadsPerSecond(data1))
+        if (snap.readsPerSecond.exists)
         {
-            inst.ReadsPerSecond_value(data1);
+            inst.ReadsPerSecond_value(snap.readsPerSecond.value);
         }
 
-        if (diskinst->GetWritesPerSecond(data1))
+        if (snap.writesPerSecond.exists)
         {
-            inst.WritesPerSecond_value(data1);
+            inst.WritesPerSecond_value(snap.writesPerSecond.value);
         }
 
-        if (diskinst->GetIOTimesTotal(ddata1))
+        if (snap.ioTimesTotal.exists)
         {
-            inst.AverageTransferTime_value(ddata1);
+            inst.AverageTransferTime_value(snap.ioTimesTotal.value);
         }
 
-        if (diskinst->GetDiskSize(data1, data2))
+        if (snap.usedMegabytes.exists)
         {
+            scxulong data1 = snap.usedMegabytes.value;
+            scxulong data2 = snap.freeMegabytes.value;
+
             inst.FreeMegabytes_value(data2);
             inst.UsedMegabytes_value(data1);
             unsigned char freeSpace = 100;
@@ -111,9 +174,11 @@ static void EnumerateOneInstance(
 
         // Report percentages for inodes even if inode data is not known
         {
-            if (!diskinst->GetInodeUsage(data1, data2))
+            scxulong data1 = 0, data2 = 0;
+            if (snap.inodesTotal.exists)
             {
-                data1 = data2 = 0;
+                data1 = snap.inodesTotal.value;
+                data2 = snap.inodesFree.value;
             }
             unsigned char freeInodes = 100;
             unsigned char usedInodes = 0;
@@ -128,13 +193,15 @@ static void EnumerateOneInstance(
             inst.PercentUsedInodes_value(usedInodes);
         }
 
-        if (diskinst->GetDiskQueueLength(ddata1))
+        if (snap.diskQueueLength.exists)
         {
-            inst.AverageDiskQueueLength_value(ddata1);
+            inst.AverageDiskQueueLength_value(snap.diskQueueLength.value);
         }
     }
-    context.Post(inst);
-}
+
+private:
+    bool m_keysOnly;
+};
 
 SCX_FileSystemStatisticalInformation_Class_Provider::SCX_FileSystemStatisticalInformation_Class_Provider(
     Module* module) :
@@ -188,35 +255,39 @@ void SCX_FileSystemStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_FileSystemStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
-        // Global lock for DiskProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+        SCXCore::SnapshotEnumeration<FileSystemStatisticsSnapshot> snapshots;
 
-        //  Prepare FIle System Enumeration
-        // (Note: Only do full update if we're not enumerating keys)
-        SCXHandle<SCXSystemLib::StatisticalLogicalDiskEnumeration> diskEnum = SCXCore::g_FileSystemProvider.getEnumstatisticalLogicalDisks();
-        diskEnum->Update(!keysOnly);
-
-        for(size_t i = 0; i < diskEnum->Size(); i++)
         {
-            SCX_FileSystemStatisticalInformation_Class inst;
-            SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> diskInst = diskEnum->GetInstance(i);
-            EnumerateOneInstance(context, inst, keysOnly, diskInst);
-        }
+            // Global lock for DiskProvider class (only held while copying the data)
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
 
-        SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> totalInst= diskEnum->GetTotalInstance();
-        if (totalInst != NULL)
-        {
-            // There will always be one total instance
-            SCX_FileSystemStatisticalInformation_Class inst;
-            EnumerateOneInstance(context, inst, keysOnly, totalInst);
+            //  Prepare FIle System Enumeration
+            // (Note: Only do full update if we're not enumerating keys)
+            SCXHandle<SCXSystemLib::StatisticalLogicalDiskEnumeration> diskEnum = SCXCore::g_FileSystemProvider.getEnumstatisticalLogicalDisks();
+            diskEnum->Update(!keysOnly);
+
+            for(size_t i = 0; i < diskEnum->Size(); i++)
+            {
+                SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> diskInst = diskEnum->GetInstance(i);
+                CaptureOneInstance(snapshots.Add(), keysOnly, diskInst);
+            }
+
+            SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> totalInst= diskEnum->GetTotalInstance();
+            if (totalInst != NULL)
+            {
+                // There will always be one total instance
+                CaptureOneInstance(snapshots.Add(), keysOnly, totalInst);
+            }
         }
 
+        scxPexTimer.AddInstances(snapshots.Post<SCX_FileSystemStatisticalInformation_Class>(context, FileSystemStatisticsBuilder(keysOnly)));
+
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_FileSystemStatisticalInformation_Class_Provider::EnumerateInstances",
-                      SCXCore::g_FileSystemProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_FileSystemStatisticalInformation_Class_Provider::EnumerateInstances",
+                            SCXCore::g_FileSystemProvider.GetLogHandle() );
 }
 
 void SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance(
@@ -225,7 +296,7 @@ void SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance(
     const SCX_FileSystemStatisticalInformation_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -250,12 +321,16 @@ void SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance(
             return;
         }
 
+        FileSystemStatisticsSnapshot snap;
+        CaptureOneInstance(snap, false, diskInst);
+
         SCX_FileSystemStatisticalInformation_Class inst;
-        EnumerateOneInstance(context, inst, false, diskInst);
+        FileSystemStatisticsBuilder(false)(snap, inst);
+        context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance", 
-                      SCXCore::g_FileSystemProvider.GetLogHandle() )
+    SCX_PEX_END_TIMED( L"SCX_FileSystemStatisticalInformation_Class_Provider::GetInstance", 
+                            SCXCore::g_FileSystemProvider.GetLogHandle() )
 }
 
 void SCX_FileSystemStatisticalInformation_Class_Provider::CreateInstance(
@@ -20,127 +20,174 @@
 #include <scxcorelib/scxnameresolver.h>
 #include "support/filesystemprovider.h"
 #include "support/scxcimutils.h"
+#include "support/snapshotenumeration.h"
 
 using namespace SCXSystemLib;
 using namespace SCXCoreLib;
 
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(
-    Context& context,
-    SCX_FileSystem_Class& inst,
+/*----------------------------------------------------------------------------*/
+/**
+   Data copied out of a StaticLogicalDiskInstance while holding the provider lock
+*/
+struct FileSystemSnapshot
+{
+    SCXCore::SnapshotValue<std::wstring> name;
+    SCXCore::SnapshotValue<bool> healthState;
+    SCXCore::SnapshotValue<std::wstring> mountpoint;
+    SCXCore::SnapshotValue<std::wstring> fileSystemType;
+    SCXCore::SnapshotValue<scxulong> sizeInBytes;
+    SCXCore::SnapshotValue<std::wstring> compressionMethod;
+    SCXCore::SnapshotValue<bool> isReadOnly;
+    SCXCore::SnapshotValue<std::wstring> encryptionMethod;
+    SCXCore::SnapshotValue<int> persistenceType;
+    SCXCore::SnapshotValue<scxulong> blockSize;
+    SCXCore::SnapshotValue<scxulong> availableSpace;
+    SCXCore::SnapshotValue<scxulong> totalInodes;
+    SCXCore::SnapshotValue<scxulong> availableInodes;
+    SCXCore::SnapshotValue<bool> isCaseSensitive;
+    SCXCore::SnapshotValue<bool> isCasePreserved;
+    SCXCore::SnapshotValue<scxulong> maxFilenameLen;
+};
+
+static void CaptureOneInstance(
+    FileSystemSnapshot& snap,
     bool keysOnly,
     SCXHandle<SCXSystemLib::StaticLogicalDiskInstance> diskinst)
 {
-    SCXCoreLib::NameResolver nr;
-    std::wstring hostname = nr.GetHostDomainname();
-
     diskinst->Update();
 
-    std::wstring name;
-    if (diskinst->GetDeviceName(name)) 
+    snap.name.exists = diskinst->GetDeviceName(snap.name.value);
+
+    if (!keysOnly)
     {
-        inst.Name_value(StrToMultibyte(name).c_str());
+        snap.healthState.exists = diskinst->GetHealthState(snap.healthState.value);
+        snap.mountpoint.exists = diskinst->GetMountpoint(snap.mountpoint.value);
+        snap.fileSystemType.exists = diskinst->GetFileSystemType(snap.fileSystemType.value);
+        snap.sizeInBytes.exists = diskinst->GetSizeInBytes(snap.sizeInBytes.value);
+        snap.compressionMethod.exists = diskinst->GetCompressionMethod(snap.compressionMethod.value);
+        snap.isReadOnly.exists = diskinst->GetIsReadOnly(snap.isReadOnly.value);
+        snap.encryptionMethod.exists = diskinst->GetEncryptionMethod(snap.encryptionMethod.value);
+        snap.persistenceType.exists = diskinst->GetPersistenceType(snap.persistenceType.value);
+        snap.blockSize.exists = diskinst->GetBlockSize(snap.blockSize.value);
+        snap.availableSpace.exists = diskinst->GetAvailableSpaceInBytes(snap.availableSpace.value);
+        snap.totalInodes.exists = diskinst->GetTotalInodes(snap.totalInodes.value);
+        snap.availableInodes.exists = snap.totalInodes.exists && diskinst->GetAvailableInodes(snap.availableInodes.value);
+        snap.isCaseSensitive.exists = diskinst->GetIsCaseSensitive(snap.isCaseSensitive.value);
+        snap.isCasePreserved.exists = diskinst->GetIsCasePreserved(snap.isCasePreserved.value);
+        snap.maxFilenameLen.exists = diskinst->GetMaxFilenameLen(snap.maxFilenameLen.value);
     }
+}
 
-    inst.CreationClassName_value("SCX_FileSystem");
-    inst.CSCreationClassName_value("SCX_ComputerSystem");
-    inst.CSName_value(StrToMultibyte(hostname).c_str());
+/*----------------------------------------------------------------------------*/
+/**
+   Builds an SCX_FileSystem instance from a snapshot (called without the lock)
+*/
+class FileSystemBuilder
+{
+public:
+    FileSystemBuilder(bool keysOnly, const std::wstring& hostname)
+        : m_keysOnly(keysOnly), m_hostname(StrToMultibyte(hostname))
+    {
+    }
 
-    if (!keysOnly) 
+    void operator()(const FileSystemSnapshot& snap, SCX_FileSystem_Class& inst) const
     {
+        if (snap.name.exists)
+        {
+            inst.Name_value(StrToMultibyte(snap.name.value).c_str());
+        }
+
+        inst.CreationClassName_value("SCX_FileSystem");
+        inst.CSCreationClassName_value("SCX_ComputerSystem");
+        inst.CSName_value(m_hostname.c_str());
+
+        if (m_keysOnly)
+        {
+            return;
+        }
+
         inst.Caption_value("File system information");
         inst.Description_value("Information about a logical unit of secondary storage");
 
-        scxulong data;
-        std::wstring sdata;
-        bool bdata;
-
-        if (diskinst->GetHealthState(bdata)) 
+        if (snap.healthState.exists)
         {
-            inst.IsOnline_value(bdata);
+            inst.IsOnline_value(snap.healthState.value);
         }
 
-        if (diskinst->GetMountpoint(sdata)) 
+        if (snap.mountpoint.exists)
         {
-            inst.Root_value(StrToMultibyte(sdata).c_str());
+            inst.Root_value(StrToMultibyte(snap.mountpoint.value).c_str());
         }
 
-        if (diskinst->GetFileSystemType(sdata)) 
+        if (snap.fileSystemType.exists)
         {
-            inst.FileSystemType_value(StrToMultibyte(sdata).c_str());
+            inst.FileSystemType_value(StrToMultibyte(snap.fileSystemType.value).c_str());
         }
 
-        if (diskinst->GetSizeInBytes(data)) 
+        if (snap.sizeInBytes.exists)
         {
-            inst.FileSystemSize_value(data);
+            inst.FileSystemSize_value(snap.sizeInBytes.value);
         }
 
-        if (diskinst->GetCompressionMethod(sdata)) 
+        if (snap.compressionMethod.exists)
         {
-            inst.CompressionMethod_value(StrToMultibyte(sdata).c_str());
+            inst.CompressionMethod_value(StrToMultibyte(snap.compressionMethod.value).c_str());
         }
 
-        if (diskinst->GetIsReadOnly(bdata)) 
+        if (snap.isReadOnly.exists)
         {
-            inst.ReadOnly_value(bdata);
+            inst.ReadOnly_value(snap.isReadOnly.value);
         }
 
-        if (diskinst->GetEncryptionMethod(sdata)) 
+        if (snap.encryptionMethod.exists)
         {
-            inst.EncryptionMethod_value(StrToMultibyte(sdata).c_str());
+            inst.EncryptionMethod_value(StrToMultibyte(snap.encryptionMethod.value).c_str());
         }
 
-        int idata;
-        if (diskinst->GetPersistenceType(idata)) 
+        if (snap.persistenceType.exists)
         {
-            inst.PersistenceType_value(static_cast<unsigned short>(idata));
+            inst.PersistenceType_value(static_cast<unsigned short>(snap.persistenceType.value));
         }
 
-        if (diskinst->GetBlockSize(data)) 
+        if (snap.blockSize.exists)
         {
-            inst.BlockSize_value(data);
+            inst.BlockSize_value(snap.blockSize.value);
         }
 
-        if (diskinst->GetAvailableSpaceInBytes(data)) 
+        if (snap.availableSpace.exists)
         {
-            inst.AvailableSpace_value(data);
+            inst.AvailableSpace_value(snap.availableSpace.value);
         }
-                         
-        scxulong inodesTotal, inodesFree;
-        if (diskinst->GetTotalInodes(inodesTotal) && diskinst->GetAvailableInodes(inodesFree)) 
+
+        if (snap.totalInodes.exists && snap.availableInodes.exists)
         {
-            inst.TotalInodes_value(inodesTotal);
-            inst.FreeInodes_value(inodesFree);
-            inst.NumberOfFiles_value(inodesTotal - inodesFree);
+            inst.TotalInodes_value(snap.totalInodes.value);
+            inst.FreeInodes_value(snap.availableInodes.value);
+            inst.NumberOfFiles_value(snap.totalInodes.value - snap.availableInodes.value);
         }
 
-        if (diskinst->GetIsCaseSensitive(bdata)) 
+        if (snap.isCaseSensitive.exists)
         {
-            inst.CaseSensitive_value(bdata);
+            inst.CaseSensitive_value(snap.isCaseSensitive.value);
         }
 
-        if (diskinst->GetIsCasePreserved(bdata)) 
+        if (snap.isCasePreserved.exists)
         {
-            inst.CasePreserved_value(bdata);
+            inst.CasePreserved_value(snap.isCasePreserved.value);
         }
-        
-        /*
-          if (diskinst->GetCodeSet(idata))
-          {
-          Uint16A tmp;
-          tmp[0] = (Uint16)idata;
-          inst.CodeSet_value(tmp);
-          }
-        */
-
-        if (diskinst->GetMaxFilenameLen(data)) 
+
+        if (snap.maxFilenameLen.exists)
         {
-            inst.MaxFileNameLength_value(static_cast<unsigned int>(data));
+            inst.MaxFileNameLength_value(static_cast<unsigned int>(snap.maxFilenameLen.value));
         }
     }
-    context.Post(inst);
-}
+
+private:
+    bool m_keysOnly;
+    std::string m_hostname;
+};
 
 SCX_FileSystem_Class_Provider::SCX_FileSystem_Class_Provider(
     Module* module) :
@@ -194,34 +241,39 @@ void SCX_FileSystem_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-   SCX_PEX_BEGIN
+   SCX_PEX_BEGIN_TIMED( L"SCX_FileSystem_Class_Provider::EnumerateInstances" )
    {
-       // Global lock for DiskProvider class
-       SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
-
-       // (Note: Only do full update if we're not enumerating keys) 
-       SCXHandle<SCXSystemLib::StaticLogicalDiskEnumeration> staticLogicalDisksEnum = SCXCore::g_FileSystemProvider.getEnumstaticLogicalDisks();
-       staticLogicalDisksEnum->Update(!keysOnly);
+       SCXCore::SnapshotEnumeration<FileSystemSnapshot> snapshots;
 
-       for(size_t i = 0; i < staticLogicalDisksEnum->Size(); i++) 
        {
-           SCX_FileSystem_Class inst;
-           SCXHandle<SCXSystemLib::StaticLogicalDiskInstance> diskinst = staticLogicalDisksEnum->GetInstance(i);
-           EnumerateOneInstance(context, inst, keysOnly, diskinst);
+           // Global lock for DiskProvider class (only held while copying the data)
+           SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+
+           // (Note: Only do full update if we're not enumerating keys)
+           SCXHandle<SCXSystemLib::StaticLogicalDiskEnumeration> staticLogicalDisksEnum = SCXCore::g_FileSystemProvider.getEnumstaticLogicalDisks();
+           staticLogicalDisksEnum->Update(!keysOnly);
+
+           for(size_t i = 0; i < staticLogicalDisksEnum->Size(); i++)
+           {
+               SCXHandle<SCXSystemLib::StaticLogicalDiskInstance> diskinst = staticLogicalDisksEnum->GetInstance(i);
+               CaptureOneInstance(snapshots.Add(), keysOnly, diskinst);
+           }
+
+           // Enumerate Total instance
+           SCXHandle<SCXSystemLib::StaticLogicalDiskInstance> totalInst = staticLogicalDisksEnum->GetTotalInstance();
+           if (totalInst != NULL)
+           {
+               // There will always be one total instance
+               CaptureOneInstance(snapshots.Add(), keysOnly, totalInst);
+           }
        }
 
-       // Enumerate Total instance
-       SCXHandle<SCXSystemLib::StaticLogicalDiskInstance> totalInst = staticLogicalDisksEnum->GetTotalInstance();
-       if (totalInst != NULL)
-       {
-           // There will always be one total instance
-           SCX_FileSystem_Class inst;
-           EnumerateOneInstance(context, inst, keysOnly, totalInst);
-       }
+       SCXCoreLib::NameResolver nr;
+       scxPexTimer.AddInstances(snapshots.Post<SCX_FileSystem_Class>(context, FileSystemBuilder(keysOnly, nr.GetHostDomainname())));
 
        context.Post(MI_RESULT_OK);
    }
-   SCX_PEX_END( L"SCX_FileSystem_Class_Provider::EnumerateInstances", SCXCore::g_FileSystemProvider.GetLogHandle() );
+   SCX_PEX_END_TIMED( L"SCX_FileSystem_Class_Provider::EnumerateInstances", SCXCore::g_FileSystemProvider.GetLogHandle() );
 }
 
 void SCX_FileSystem_Class_Provider::GetInstance(
@@ -230,7 +282,7 @@ void SCX_FileSystem_Class_Provider::GetInstance(
     const SCX_FileSystem_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_FileSystem_Class_Provider::GetInstance" )
     {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -286,12 +338,17 @@ void SCX_FileSystem_Class_Provider::GetInstance(
             return;
         }
 
+        FileSystemSnapshot snap;
+        CaptureOneInstance(snap, false, diskinst);
+
+        SCXCoreLib::NameResolver nr;
         SCX_FileSystem_Class inst;
-        EnumerateOneInstance(context, inst, false, diskinst);
+        FileSystemBuilder(false, nr.GetHostDomainname())(snap, inst);
+        context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_FileSystem_Class_Provider::GetInstance",
-                   SCXCore::g_FileSystemProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_FileSystem_Class_Provider::GetInstance",
+                         SCXCore::g_FileSystemProvider.GetLogHandle() );
 }
 
 void SCX_FileSystem_Class_Provider::CreateInstance(
@@ -334,7 +391,7 @@ void SCX_FileSystem_Class_Provider::Invoke_RemoveByName(
     const SCX_FileSystem_Class& instanceName,
     const SCX_FileSystem_RemoveByName_Class& in)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_FileSystem_Class_Provider::Invoke_RemoveByName" )
         {
         // Global lock for DiskProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
@@ -371,7 +428,7 @@ void SCX_FileSystem_Class_Provider::Invoke_RemoveByName(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
         }
-        SCX_PEX_END( L"SCX_FileSystem_Class_Provider::Invoke_RemoveByName", SCXCore::g_FileSystemProvider.GetLogHandle() );
+        SCX_PEX_END_TIMED( L"SCX_FileSystem_Class_Provider::Invoke_RemoveByName", SCXCore::g_FileSystemProvider.GetLogHandle() );
 }
 
 
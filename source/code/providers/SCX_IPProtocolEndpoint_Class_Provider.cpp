@@ -143,7 +143,7 @@ void SCX_IPProtocolEndpoint_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_IPProtocolEndpoint_Class_Provider::EnumerateInstances" )
     {
         SCX_LOGTRACE(SCXCore::g_NetworkProvider.GetLogHandle(), L"SCXCore::NetworkProvider::Enumerate entry");
         // Global lock for NetworkProvider class
@@ -163,10 +163,11 @@ void SCX_IPProtocolEndpoint_Class_Provider::EnumerateInstances(
             SCXCoreLib::SCXHandle<SCXSystemLib::NetworkInterfaceInstance> intf = deps->GetIntf(i);
             SCX_IPProtocolEndpoint_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, intf);
+            scxPexTimer.AddInstances(1);
         }
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_IPProtocolEndpoint_Class_Provider::EnumerateInstances", SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_IPProtocolEndpoint_Class_Provider::EnumerateInstances", SCXCore::g_NetworkProvider.GetLogHandle() );
 }
 
 void SCX_IPProtocolEndpoint_Class_Provider::GetInstance(
@@ -175,7 +176,7 @@ void SCX_IPProtocolEndpoint_Class_Provider::GetInstance(
     const SCX_IPProtocolEndpoint_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_IPProtocolEndpoint_Class_Provider::GetInstance" )
     {
         // Global lock for NetworkProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::NetworkProvider::Lock"));
@@ -242,7 +243,7 @@ void SCX_IPProtocolEndpoint_Class_Provider::GetInstance(
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_IPProtocolEndpoint_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_IPProtocolEndpoint_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
 }
 
 void SCX_IPProtocolEndpoint_Class_Provider::CreateInstance(
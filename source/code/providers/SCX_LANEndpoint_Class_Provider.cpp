@@ -114,7 +114,7 @@ void SCX_LANEndpoint_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_LANEndpoint_Class_Provider::EnumerateInstances" )
     {
         // Global lock for NetworkProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::NetworkProvider::Lock"));
@@ -133,10 +133,11 @@ void SCX_LANEndpoint_Class_Provider::EnumerateInstances(
             SCXCoreLib::SCXHandle<SCXSystemLib::NetworkInterfaceInstance> intf = deps->GetIntf(i);
             SCX_LANEndpoint_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, intf);
+            scxPexTimer.AddInstances(1);
         }
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_LANEndpoint_Class_Provider::EnumerateInstances", SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_LANEndpoint_Class_Provider::EnumerateInstances", SCXCore::g_NetworkProvider.GetLogHandle() );
 
 }
 
@@ -146,7 +147,7 @@ void SCX_LANEndpoint_Class_Provider::GetInstance(
     const SCX_LANEndpoint_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_LANEndpoint_Class_Provider::GetInstance" )
     {
         // Global lock for NetworkProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::NetworkProvider::Lock"));
@@ -213,7 +214,7 @@ void SCX_LANEndpoint_Class_Provider::GetInstance(
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_LANEndpoint_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_LANEndpoint_Class_Provider::GetInstance", SCXCore::g_NetworkProvider.GetLogHandle() );
 }
 
 void SCX_LANEndpoint_Class_Provider::CreateInstance(
@@ -893,6 +893,7 @@ typedef struct _SCX_LogFile_GetMatchedRows
     /*IN*/ MI_ConstStringField qid;
     /*OUT*/ MI_ConstStringAField rows;
     /*IN*/ MI_ConstStringField elevationType;
+    /*IN*/ MI_ConstUint32Field scanTimeBudget;
 }
 SCX_LogFile_GetMatchedRows;
 
@@ -1125,6 +1126,22 @@ MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRows_Clear_elevationType(
         5);
 }
 
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRows_Set_scanTimeBudget(
+    SCX_LogFile_GetMatchedRows* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->scanTimeBudget)->value = x;
+    ((MI_Uint32Field*)&self->scanTimeBudget)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRows_Clear_scanTimeBudget(
+    SCX_LogFile_GetMatchedRows* self)
+{
+    memset((void*)&self->scanTimeBudget, 0, sizeof(self->scanTimeBudget));
+    return MI_RESULT_OK;
+}
+
 /*
 **==============================================================================
 **
@@ -1309,6 +1326,321 @@ MI_INLINE MI_Result MI_CALL SCX_LogFile_ResetStateFile_Clear_elevationType(
         4);
 }
 
+/*
+**==============================================================================
+**
+** SCX_LogFile.GetMatchedRowsBatch()
+**
+**==============================================================================
+*/
+
+typedef struct _SCX_LogFile_GetMatchedRowsBatch
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstUint32Field MIReturn;
+    /*IN*/ MI_ConstStringField filename;
+    /*IN*/ MI_ConstStringAField qids;
+    /*IN*/ MI_ConstStringAField regexps;
+    /*IN*/ MI_ConstUint32AField regexpQids;
+    /*OUT*/ MI_ConstStringAField rows;
+    /*IN*/ MI_ConstStringField elevationType;
+    /*IN*/ MI_ConstUint32Field scanTimeBudget;
+}
+SCX_LogFile_GetMatchedRowsBatch;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl SCX_LogFile_GetMatchedRowsBatch_rtti;
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Construct(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &SCX_LogFile_GetMatchedRowsBatch_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clone(
+    const SCX_LogFile_GetMatchedRowsBatch* self,
+    SCX_LogFile_GetMatchedRowsBatch** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Destruct(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Delete(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Post(
+    const SCX_LogFile_GetMatchedRowsBatch* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_MIReturn(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->MIReturn)->value = x;
+    ((MI_Uint32Field*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_MIReturn(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_filename(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_filename(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_filename(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_qids(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_qids(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_qids(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_regexps(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_regexps(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_regexps(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        3);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_regexpQids(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Uint32* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT32A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_regexpQids(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Uint32* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT32A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_regexpQids(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_rows(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_rows(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_rows(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_elevationType(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_SetPtr_elevationType(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_elevationType(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Set_scanTimeBudget(
+    SCX_LogFile_GetMatchedRowsBatch* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->scanTimeBudget)->value = x;
+    ((MI_Uint32Field*)&self->scanTimeBudget)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFile_GetMatchedRowsBatch_Clear_scanTimeBudget(
+    SCX_LogFile_GetMatchedRowsBatch* self)
+{
+    memset((void*)&self->scanTimeBudget, 0, sizeof(self->scanTimeBudget));
+    return MI_RESULT_OK;
+}
+
 /*
 **==============================================================================
 **
@@ -1386,6 +1718,15 @@ MI_EXTERN_C void MI_CALL SCX_LogFile_Invoke_ResetStateFile(
     const SCX_LogFile* instanceName,
     const SCX_LogFile_ResetStateFile* in);
 
+MI_EXTERN_C void MI_CALL SCX_LogFile_Invoke_GetMatchedRowsBatch(
+    SCX_LogFile_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_LogFile* instanceName,
+    const SCX_LogFile_GetMatchedRowsBatch* in);
+
 
 /*
 **==============================================================================
@@ -1506,7 +1847,338 @@ public:
     }
 
     //
-    // SCX_LogFile_GetMatchedRows_Class.MIReturn
+    // SCX_LogFile_GetMatchedRows_Class.MIReturn
+    //
+    
+    const Field<Uint32>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n);
+    }
+    
+    void MIReturn(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void MIReturn_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.filename
+    //
+    
+    const Field<String>& filename() const
+    {
+        const size_t n = offsetof(Self, filename);
+        return GetField<String>(n);
+    }
+    
+    void filename(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, filename);
+        GetField<String>(n) = x;
+    }
+    
+    const String& filename_value() const
+    {
+        const size_t n = offsetof(Self, filename);
+        return GetField<String>(n).value;
+    }
+    
+    void filename_value(const String& x)
+    {
+        const size_t n = offsetof(Self, filename);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool filename_exists() const
+    {
+        const size_t n = offsetof(Self, filename);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void filename_clear()
+    {
+        const size_t n = offsetof(Self, filename);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.regexps
+    //
+    
+    const Field<StringA>& regexps() const
+    {
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n);
+    }
+    
+    void regexps(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& regexps_value() const
+    {
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n).value;
+    }
+    
+    void regexps_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool regexps_exists() const
+    {
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void regexps_clear()
+    {
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.qid
+    //
+    
+    const Field<String>& qid() const
+    {
+        const size_t n = offsetof(Self, qid);
+        return GetField<String>(n);
+    }
+    
+    void qid(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, qid);
+        GetField<String>(n) = x;
+    }
+    
+    const String& qid_value() const
+    {
+        const size_t n = offsetof(Self, qid);
+        return GetField<String>(n).value;
+    }
+    
+    void qid_value(const String& x)
+    {
+        const size_t n = offsetof(Self, qid);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool qid_exists() const
+    {
+        const size_t n = offsetof(Self, qid);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void qid_clear()
+    {
+        const size_t n = offsetof(Self, qid);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.rows
+    //
+    
+    const Field<StringA>& rows() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n);
+    }
+    
+    void rows(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& rows_value() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n).value;
+    }
+    
+    void rows_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool rows_exists() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void rows_clear()
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.elevationType
+    //
+    
+    const Field<String>& elevationType() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n);
+    }
+    
+    void elevationType(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n) = x;
+    }
+    
+    const String& elevationType_value() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n).value;
+    }
+    
+    void elevationType_value(const String& x)
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool elevationType_exists() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void elevationType_clear()
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRows_Class.scanTimeBudget
+    //
+    
+    const Field<Uint32>& scanTimeBudget() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n);
+    }
+    
+    void scanTimeBudget(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& scanTimeBudget_value() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void scanTimeBudget_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool scanTimeBudget_exists() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void scanTimeBudget_clear()
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n).Clear();
+    }
+};
+
+typedef Array<SCX_LogFile_GetMatchedRows_Class> SCX_LogFile_GetMatchedRows_ClassA;
+
+class SCX_LogFile_ResetStateFile_Class : public Instance
+{
+public:
+    
+    typedef SCX_LogFile_ResetStateFile Self;
+    
+    SCX_LogFile_ResetStateFile_Class() :
+        Instance(&SCX_LogFile_ResetStateFile_rtti)
+    {
+    }
+    
+    SCX_LogFile_ResetStateFile_Class(
+        const SCX_LogFile_ResetStateFile* instanceName,
+        bool keysOnly) :
+        Instance(
+            &SCX_LogFile_ResetStateFile_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_LogFile_ResetStateFile_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_LogFile_ResetStateFile_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    SCX_LogFile_ResetStateFile_Class& operator=(
+        const SCX_LogFile_ResetStateFile_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_LogFile_ResetStateFile_Class(
+        const SCX_LogFile_ResetStateFile_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_LogFile_ResetStateFile_Class.MIReturn
     //
     
     const Field<Uint32>& MIReturn() const
@@ -1546,7 +2218,7 @@ public:
     }
 
     //
-    // SCX_LogFile_GetMatchedRows_Class.filename
+    // SCX_LogFile_ResetStateFile_Class.filename
     //
     
     const Field<String>& filename() const
@@ -1586,47 +2258,7 @@ public:
     }
 
     //
-    // SCX_LogFile_GetMatchedRows_Class.regexps
-    //
-    
-    const Field<StringA>& regexps() const
-    {
-        const size_t n = offsetof(Self, regexps);
-        return GetField<StringA>(n);
-    }
-    
-    void regexps(const Field<StringA>& x)
-    {
-        const size_t n = offsetof(Self, regexps);
-        GetField<StringA>(n) = x;
-    }
-    
-    const StringA& regexps_value() const
-    {
-        const size_t n = offsetof(Self, regexps);
-        return GetField<StringA>(n).value;
-    }
-    
-    void regexps_value(const StringA& x)
-    {
-        const size_t n = offsetof(Self, regexps);
-        GetField<StringA>(n).Set(x);
-    }
-    
-    bool regexps_exists() const
-    {
-        const size_t n = offsetof(Self, regexps);
-        return GetField<StringA>(n).exists ? true : false;
-    }
-    
-    void regexps_clear()
-    {
-        const size_t n = offsetof(Self, regexps);
-        GetField<StringA>(n).Clear();
-    }
-
-    //
-    // SCX_LogFile_GetMatchedRows_Class.qid
+    // SCX_LogFile_ResetStateFile_Class.qid
     //
     
     const Field<String>& qid() const
@@ -1666,47 +2298,47 @@ public:
     }
 
     //
-    // SCX_LogFile_GetMatchedRows_Class.rows
+    // SCX_LogFile_ResetStateFile_Class.resetOnRead
     //
     
-    const Field<StringA>& rows() const
+    const Field<Boolean>& resetOnRead() const
     {
-        const size_t n = offsetof(Self, rows);
-        return GetField<StringA>(n);
+        const size_t n = offsetof(Self, resetOnRead);
+        return GetField<Boolean>(n);
     }
     
-    void rows(const Field<StringA>& x)
+    void resetOnRead(const Field<Boolean>& x)
     {
-        const size_t n = offsetof(Self, rows);
-        GetField<StringA>(n) = x;
+        const size_t n = offsetof(Self, resetOnRead);
+        GetField<Boolean>(n) = x;
     }
     
-    const StringA& rows_value() const
+    const Boolean& resetOnRead_value() const
     {
-        const size_t n = offsetof(Self, rows);
-        return GetField<StringA>(n).value;
+        const size_t n = offsetof(Self, resetOnRead);
+        return GetField<Boolean>(n).value;
     }
     
-    void rows_value(const StringA& x)
+    void resetOnRead_value(const Boolean& x)
     {
-        const size_t n = offsetof(Self, rows);
-        GetField<StringA>(n).Set(x);
+        const size_t n = offsetof(Self, resetOnRead);
+        GetField<Boolean>(n).Set(x);
     }
     
-    bool rows_exists() const
+    bool resetOnRead_exists() const
     {
-        const size_t n = offsetof(Self, rows);
-        return GetField<StringA>(n).exists ? true : false;
+        const size_t n = offsetof(Self, resetOnRead);
+        return GetField<Boolean>(n).exists ? true : false;
     }
     
-    void rows_clear()
+    void resetOnRead_clear()
     {
-        const size_t n = offsetof(Self, rows);
-        GetField<StringA>(n).Clear();
+        const size_t n = offsetof(Self, resetOnRead);
+        GetField<Boolean>(n).Clear();
     }
 
     //
-    // SCX_LogFile_GetMatchedRows_Class.elevationType
+    // SCX_LogFile_ResetStateFile_Class.elevationType
     //
     
     const Field<String>& elevationType() const
@@ -1746,30 +2378,30 @@ public:
     }
 };
 
-typedef Array<SCX_LogFile_GetMatchedRows_Class> SCX_LogFile_GetMatchedRows_ClassA;
+typedef Array<SCX_LogFile_ResetStateFile_Class> SCX_LogFile_ResetStateFile_ClassA;
 
-class SCX_LogFile_ResetStateFile_Class : public Instance
+class SCX_LogFile_GetMatchedRowsBatch_Class : public Instance
 {
 public:
     
-    typedef SCX_LogFile_ResetStateFile Self;
+    typedef SCX_LogFile_GetMatchedRowsBatch Self;
     
-    SCX_LogFile_ResetStateFile_Class() :
-        Instance(&SCX_LogFile_ResetStateFile_rtti)
+    SCX_LogFile_GetMatchedRowsBatch_Class() :
+        Instance(&SCX_LogFile_GetMatchedRowsBatch_rtti)
     {
     }
     
-    SCX_LogFile_ResetStateFile_Class(
-        const SCX_LogFile_ResetStateFile* instanceName,
+    SCX_LogFile_GetMatchedRowsBatch_Class(
+        const SCX_LogFile_GetMatchedRowsBatch* instanceName,
         bool keysOnly) :
         Instance(
-            &SCX_LogFile_ResetStateFile_rtti,
+            &SCX_LogFile_GetMatchedRowsBatch_rtti,
             &instanceName->__instance,
             keysOnly)
     {
     }
     
-    SCX_LogFile_ResetStateFile_Class(
+    SCX_LogFile_GetMatchedRowsBatch_Class(
         const MI_ClassDecl* clDecl,
         const MI_Instance* instance,
         bool keysOnly) :
@@ -1777,27 +2409,27 @@ public:
     {
     }
     
-    SCX_LogFile_ResetStateFile_Class(
+    SCX_LogFile_GetMatchedRowsBatch_Class(
         const MI_ClassDecl* clDecl) :
         Instance(clDecl)
     {
     }
     
-    SCX_LogFile_ResetStateFile_Class& operator=(
-        const SCX_LogFile_ResetStateFile_Class& x)
+    SCX_LogFile_GetMatchedRowsBatch_Class& operator=(
+        const SCX_LogFile_GetMatchedRowsBatch_Class& x)
     {
         CopyRef(x);
         return *this;
     }
     
-    SCX_LogFile_ResetStateFile_Class(
-        const SCX_LogFile_ResetStateFile_Class& x) :
+    SCX_LogFile_GetMatchedRowsBatch_Class(
+        const SCX_LogFile_GetMatchedRowsBatch_Class& x) :
         Instance(x)
     {
     }
 
     //
-    // SCX_LogFile_ResetStateFile_Class.MIReturn
+    // SCX_LogFile_GetMatchedRowsBatch_Class.MIReturn
     //
     
     const Field<Uint32>& MIReturn() const
@@ -1837,7 +2469,7 @@ public:
     }
 
     //
-    // SCX_LogFile_ResetStateFile_Class.filename
+    // SCX_LogFile_GetMatchedRowsBatch_Class.filename
     //
     
     const Field<String>& filename() const
@@ -1877,87 +2509,167 @@ public:
     }
 
     //
-    // SCX_LogFile_ResetStateFile_Class.qid
+    // SCX_LogFile_GetMatchedRowsBatch_Class.qids
     //
     
-    const Field<String>& qid() const
+    const Field<StringA>& qids() const
     {
-        const size_t n = offsetof(Self, qid);
-        return GetField<String>(n);
+        const size_t n = offsetof(Self, qids);
+        return GetField<StringA>(n);
     }
     
-    void qid(const Field<String>& x)
+    void qids(const Field<StringA>& x)
     {
-        const size_t n = offsetof(Self, qid);
-        GetField<String>(n) = x;
+        const size_t n = offsetof(Self, qids);
+        GetField<StringA>(n) = x;
     }
     
-    const String& qid_value() const
+    const StringA& qids_value() const
     {
-        const size_t n = offsetof(Self, qid);
-        return GetField<String>(n).value;
+        const size_t n = offsetof(Self, qids);
+        return GetField<StringA>(n).value;
     }
     
-    void qid_value(const String& x)
+    void qids_value(const StringA& x)
     {
-        const size_t n = offsetof(Self, qid);
-        GetField<String>(n).Set(x);
+        const size_t n = offsetof(Self, qids);
+        GetField<StringA>(n).Set(x);
     }
     
-    bool qid_exists() const
+    bool qids_exists() const
     {
-        const size_t n = offsetof(Self, qid);
-        return GetField<String>(n).exists ? true : false;
+        const size_t n = offsetof(Self, qids);
+        return GetField<StringA>(n).exists ? true : false;
     }
     
-    void qid_clear()
+    void qids_clear()
     {
-        const size_t n = offsetof(Self, qid);
-        GetField<String>(n).Clear();
+        const size_t n = offsetof(Self, qids);
+        GetField<StringA>(n).Clear();
     }
 
     //
-    // SCX_LogFile_ResetStateFile_Class.resetOnRead
+    // SCX_LogFile_GetMatchedRowsBatch_Class.regexps
     //
     
-    const Field<Boolean>& resetOnRead() const
+    const Field<StringA>& regexps() const
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        return GetField<Boolean>(n);
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n);
     }
     
-    void resetOnRead(const Field<Boolean>& x)
+    void regexps(const Field<StringA>& x)
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        GetField<Boolean>(n) = x;
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n) = x;
     }
     
-    const Boolean& resetOnRead_value() const
+    const StringA& regexps_value() const
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        return GetField<Boolean>(n).value;
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n).value;
     }
     
-    void resetOnRead_value(const Boolean& x)
+    void regexps_value(const StringA& x)
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        GetField<Boolean>(n).Set(x);
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n).Set(x);
     }
     
-    bool resetOnRead_exists() const
+    bool regexps_exists() const
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        return GetField<Boolean>(n).exists ? true : false;
+        const size_t n = offsetof(Self, regexps);
+        return GetField<StringA>(n).exists ? true : false;
     }
     
-    void resetOnRead_clear()
+    void regexps_clear()
     {
-        const size_t n = offsetof(Self, resetOnRead);
-        GetField<Boolean>(n).Clear();
+        const size_t n = offsetof(Self, regexps);
+        GetField<StringA>(n).Clear();
     }
 
     //
-    // SCX_LogFile_ResetStateFile_Class.elevationType
+    // SCX_LogFile_GetMatchedRowsBatch_Class.regexpQids
+    //
+    
+    const Field<Uint32A>& regexpQids() const
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        return GetField<Uint32A>(n);
+    }
+    
+    void regexpQids(const Field<Uint32A>& x)
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        GetField<Uint32A>(n) = x;
+    }
+    
+    const Uint32A& regexpQids_value() const
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        return GetField<Uint32A>(n).value;
+    }
+    
+    void regexpQids_value(const Uint32A& x)
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        GetField<Uint32A>(n).Set(x);
+    }
+    
+    bool regexpQids_exists() const
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        return GetField<Uint32A>(n).exists ? true : false;
+    }
+    
+    void regexpQids_clear()
+    {
+        const size_t n = offsetof(Self, regexpQids);
+        GetField<Uint32A>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRowsBatch_Class.rows
+    //
+    
+    const Field<StringA>& rows() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n);
+    }
+    
+    void rows(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& rows_value() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n).value;
+    }
+    
+    void rows_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool rows_exists() const
+    {
+        const size_t n = offsetof(Self, rows);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void rows_clear()
+    {
+        const size_t n = offsetof(Self, rows);
+        GetField<StringA>(n).Clear();
+    }
+
+    //
+    // SCX_LogFile_GetMatchedRowsBatch_Class.elevationType
     //
     
     const Field<String>& elevationType() const
@@ -1995,9 +2707,49 @@ public:
         const size_t n = offsetof(Self, elevationType);
         GetField<String>(n).Clear();
     }
+
+    //
+    // SCX_LogFile_GetMatchedRowsBatch_Class.scanTimeBudget
+    //
+    
+    const Field<Uint32>& scanTimeBudget() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n);
+    }
+    
+    void scanTimeBudget(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& scanTimeBudget_value() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void scanTimeBudget_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool scanTimeBudget_exists() const
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void scanTimeBudget_clear()
+    {
+        const size_t n = offsetof(Self, scanTimeBudget);
+        GetField<Uint32>(n).Clear();
+    }
 };
 
-typedef Array<SCX_LogFile_ResetStateFile_Class> SCX_LogFile_ResetStateFile_ClassA;
+typedef Array<SCX_LogFile_GetMatchedRowsBatch_Class> SCX_LogFile_GetMatchedRowsBatch_ClassA;
 
 MI_END_NAMESPACE
 
@@ -0,0 +1,747 @@
+/* @migen@ */
+/*
+**==============================================================================
+**
+** WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. PLEASE DO NOT EDIT.
+**
+**==============================================================================
+*/
+#ifndef _SCX_LogFileMatchIndication_h
+#define _SCX_LogFileMatchIndication_h
+
+#include <MI.h>
+#include "CIM_Indication.h"
+
+/*
+**==============================================================================
+**
+** SCX_LogFileMatchIndication [SCX_LogFileMatchIndication]
+**
+** Keys:
+**
+**==============================================================================
+*/
+
+typedef struct _SCX_LogFileMatchIndication /* extends CIM_Indication */
+{
+    MI_Instance __instance;
+    /* CIM_Indication properties */
+    MI_ConstStringField IndicationIdentifier;
+    MI_ConstStringAField CorrelatedIndications;
+    MI_ConstDatetimeField IndicationTime;
+    MI_ConstUint16Field PerceivedSeverity;
+    MI_ConstStringField OtherSeverity;
+    MI_ConstStringField IndicationFilterName;
+    MI_ConstStringField SequenceContext;
+    MI_ConstSint64Field SequenceNumber;
+    /* SCX_LogFileMatchIndication properties */
+    MI_ConstStringField FileName;
+    MI_ConstUint64Field FilePosition;
+    MI_ConstStringField Regexp;
+    MI_ConstStringField RecordData;
+}
+SCX_LogFileMatchIndication;
+
+typedef struct _SCX_LogFileMatchIndication_Ref
+{
+    SCX_LogFileMatchIndication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_LogFileMatchIndication_Ref;
+
+typedef struct _SCX_LogFileMatchIndication_ConstRef
+{
+    MI_CONST SCX_LogFileMatchIndication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_LogFileMatchIndication_ConstRef;
+
+typedef struct _SCX_LogFileMatchIndication_Array
+{
+    struct _SCX_LogFileMatchIndication** data;
+    MI_Uint32 size;
+}
+SCX_LogFileMatchIndication_Array;
+
+typedef struct _SCX_LogFileMatchIndication_ConstArray
+{
+    struct _SCX_LogFileMatchIndication MI_CONST* MI_CONST* data;
+    MI_Uint32 size;
+}
+SCX_LogFileMatchIndication_ConstArray;
+
+typedef struct _SCX_LogFileMatchIndication_ArrayRef
+{
+    SCX_LogFileMatchIndication_Array value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_LogFileMatchIndication_ArrayRef;
+
+typedef struct _SCX_LogFileMatchIndication_ConstArrayRef
+{
+    SCX_LogFileMatchIndication_ConstArray value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_LogFileMatchIndication_ConstArrayRef;
+
+MI_EXTERN_C MI_CONST MI_ClassDecl SCX_LogFileMatchIndication_rtti;
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Construct(
+    SCX_LogFileMatchIndication* self,
+    MI_Context* context)
+{
+    return MI_ConstructInstance(context, &SCX_LogFileMatchIndication_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clone(
+    const SCX_LogFileMatchIndication* self,
+    SCX_LogFileMatchIndication** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Boolean MI_CALL SCX_LogFileMatchIndication_IsA(
+    const MI_Instance* self)
+{
+    MI_Boolean res = MI_FALSE;
+    return MI_Instance_IsA(self, &SCX_LogFileMatchIndication_rtti, &res) == MI_RESULT_OK && res;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Destruct(SCX_LogFileMatchIndication* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Delete(SCX_LogFileMatchIndication* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Post(
+    const SCX_LogFileMatchIndication* self,
+    MI_Context* context,
+    MI_Uint32 subscriptionIDCount,
+    const MI_Char* bookmark)
+{
+    return MI_PostIndication(context, &self->__instance, subscriptionIDCount, bookmark);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_IndicationIdentifier(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_IndicationIdentifier(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_IndicationIdentifier(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_CorrelatedIndications(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_CorrelatedIndications(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_CorrelatedIndications(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_IndicationTime(
+    SCX_LogFileMatchIndication* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->IndicationTime)->value = x;
+    ((MI_DatetimeField*)&self->IndicationTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_IndicationTime(
+    SCX_LogFileMatchIndication* self)
+{
+    memset((void*)&self->IndicationTime, 0, sizeof(self->IndicationTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_PerceivedSeverity(
+    SCX_LogFileMatchIndication* self,
+    MI_Uint16 x)
+{
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->value = x;
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_PerceivedSeverity(
+    SCX_LogFileMatchIndication* self)
+{
+    memset((void*)&self->PerceivedSeverity, 0, sizeof(self->PerceivedSeverity));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_OtherSeverity(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_OtherSeverity(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_OtherSeverity(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_IndicationFilterName(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_IndicationFilterName(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_IndicationFilterName(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_SequenceContext(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_SequenceContext(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_SequenceContext(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_SequenceNumber(
+    SCX_LogFileMatchIndication* self,
+    MI_Sint64 x)
+{
+    ((MI_Sint64Field*)&self->SequenceNumber)->value = x;
+    ((MI_Sint64Field*)&self->SequenceNumber)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_SequenceNumber(
+    SCX_LogFileMatchIndication* self)
+{
+    memset((void*)&self->SequenceNumber, 0, sizeof(self->SequenceNumber));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_FileName(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_FileName(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_FileName(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_FilePosition(
+    SCX_LogFileMatchIndication* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->FilePosition)->value = x;
+    ((MI_Uint64Field*)&self->FilePosition)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_FilePosition(
+    SCX_LogFileMatchIndication* self)
+{
+    memset((void*)&self->FilePosition, 0, sizeof(self->FilePosition));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_Regexp(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        10,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_Regexp(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        10,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_Regexp(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        10);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Set_RecordData(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        11,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_SetPtr_RecordData(
+    SCX_LogFileMatchIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        11,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_LogFileMatchIndication_Clear_RecordData(
+    SCX_LogFileMatchIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        11);
+}
+
+/*
+**==============================================================================
+**
+** SCX_LogFileMatchIndication provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _SCX_LogFileMatchIndication_Self SCX_LogFileMatchIndication_Self;
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Load(
+    SCX_LogFileMatchIndication_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Unload(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_EnableIndications(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className);
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_DisableIndications(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className);
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Subscribe(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Filter* filter,
+    const MI_Char* bookmark,
+    MI_Uint64  subscriptionID,
+    void** subscriptionSelf);
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Unsubscribe(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    MI_Uint64  subscriptionID,
+    void* subscriptionSelf);
+
+
+/*
+**==============================================================================
+**
+** SCX_LogFileMatchIndication_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class SCX_LogFileMatchIndication_Class : public CIM_Indication_Class
+{
+public:
+    
+    typedef SCX_LogFileMatchIndication Self;
+    
+    SCX_LogFileMatchIndication_Class() :
+        CIM_Indication_Class(&SCX_LogFileMatchIndication_rtti)
+    {
+    }
+    
+    SCX_LogFileMatchIndication_Class(
+        const SCX_LogFileMatchIndication* instanceName,
+        bool keysOnly) :
+        CIM_Indication_Class(
+            &SCX_LogFileMatchIndication_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_LogFileMatchIndication_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_Indication_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_LogFileMatchIndication_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_Indication_Class(clDecl)
+    {
+    }
+    
+    SCX_LogFileMatchIndication_Class& operator=(
+        const SCX_LogFileMatchIndication_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_LogFileMatchIndication_Class(
+        const SCX_LogFileMatchIndication_Class& x) :
+        CIM_Indication_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &SCX_LogFileMatchIndication_rtti;
+    }
+
+    //
+    // SCX_LogFileMatchIndication_Class.FileName
+    //
+    
+    const Field<String>& FileName() const
+    {
+        const size_t n = offsetof(Self, FileName);
+        return GetField<String>(n);
+    }
+    
+    void FileName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, FileName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& FileName_value() const
+    {
+        const size_t n = offsetof(Self, FileName);
+        return GetField<String>(n).value;
+    }
+    
+    void FileName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, FileName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool FileName_exists() const
+    {
+        const size_t n = offsetof(Self, FileName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void FileName_clear()
+    {
+        const size_t n = offsetof(Self, FileName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_LogFileMatchIndication_Class.FilePosition
+    //
+    
+    const Field<Uint64>& FilePosition() const
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        return GetField<Uint64>(n);
+    }
+    
+    void FilePosition(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& FilePosition_value() const
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void FilePosition_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool FilePosition_exists() const
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void FilePosition_clear()
+    {
+        const size_t n = offsetof(Self, FilePosition);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // SCX_LogFileMatchIndication_Class.Regexp
+    //
+    
+    const Field<String>& Regexp() const
+    {
+        const size_t n = offsetof(Self, Regexp);
+        return GetField<String>(n);
+    }
+    
+    void Regexp(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, Regexp);
+        GetField<String>(n) = x;
+    }
+    
+    const String& Regexp_value() const
+    {
+        const size_t n = offsetof(Self, Regexp);
+        return GetField<String>(n).value;
+    }
+    
+    void Regexp_value(const String& x)
+    {
+        const size_t n = offsetof(Self, Regexp);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool Regexp_exists() const
+    {
+        const size_t n = offsetof(Self, Regexp);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void Regexp_clear()
+    {
+        const size_t n = offsetof(Self, Regexp);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_LogFileMatchIndication_Class.RecordData
+    //
+    
+    const Field<String>& RecordData() const
+    {
+        const size_t n = offsetof(Self, RecordData);
+        return GetField<String>(n);
+    }
+    
+    void RecordData(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, RecordData);
+        GetField<String>(n) = x;
+    }
+    
+    const String& RecordData_value() const
+    {
+        const size_t n = offsetof(Self, RecordData);
+        return GetField<String>(n).value;
+    }
+    
+    void RecordData_value(const String& x)
+    {
+        const size_t n = offsetof(Self, RecordData);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool RecordData_exists() const
+    {
+        const size_t n = offsetof(Self, RecordData);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void RecordData_clear()
+    {
+        const size_t n = offsetof(Self, RecordData);
+        GetField<String>(n).Clear();
+    }
+};
+
+typedef Array<SCX_LogFileMatchIndication_Class> SCX_LogFileMatchIndication_ClassA;
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _SCX_LogFileMatchIndication_h */
@@ -0,0 +1,222 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        SCX_LogFileMatchIndication_Class_Provider.cpp
+
+    \brief       Provider support using OMI framework.
+
+    \date        2026-10-19 22:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+/* @migen@ */
+#include <MI.h>
+#include "SCX_LogFileMatchIndication_Class_Provider.h"
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxregex.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "support/indicationsubscriptions.h"
+#include "support/logfileprovider.h"
+#include "support/logfilewatcher.h"
+#include "support/scxcimutils.h"
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    /**
+       Sets the properties of a match on an SCX_LogFileMatchIndication, and posts it.
+    */
+    class LogFileMatchIndicationBuilder : public SCXCore::IndicationBuilder
+    {
+    public:
+        LogFileMatchIndicationBuilder(const SCXCore::LogFileMatch& match) : m_match(match) { }
+
+        virtual MI_Result Post(MI_Context* context, const MI_Datetime& indicationTime, MI_Sint64 sequenceNumber)
+        {
+            SCX_LogFileMatchIndication inst;
+            MI_Result r = SCX_LogFileMatchIndication_Construct(&inst, context);
+            if (MI_RESULT_OK != r)
+            {
+                return r;
+            }
+
+            SCX_LogFileMatchIndication_Set_IndicationTime(&inst, indicationTime);
+            SCX_LogFileMatchIndication_Set_SequenceNumber(&inst, sequenceNumber);
+            SCX_LogFileMatchIndication_Set_FileName(&inst, StrToUTF8(m_match.filename).c_str());
+            SCX_LogFileMatchIndication_Set_FilePosition(&inst, m_match.position);
+            SCX_LogFileMatchIndication_Set_Regexp(&inst, StrToUTF8(m_match.regexp).c_str());
+            SCX_LogFileMatchIndication_Set_RecordData(&inst, StrToUTF8(m_match.row).c_str());
+
+            r = SCX_LogFileMatchIndication_Post(&inst, context, 0, NULL);
+            SCX_LogFileMatchIndication_Destruct(&inst);
+            return r;
+        }
+
+    private:
+        const SCXCore::LogFileMatch& m_match;   //!< The match
+    };
+
+    SCXCore::IndicationSubscriptions s_subscriptions(L"SCX_LogFileMatchIndication");
+
+    /**
+       Posts the matches of the log file watcher, each on the context of its subscription.
+    */
+    class LogFileMatchPoster : public SCXCore::LogFileMatchSink
+    {
+    public:
+        virtual void PostMatch(scxulong subscriptionID, const SCXCore::LogFileMatch& match)
+        {
+            LogFileMatchIndicationBuilder builder(match);
+            s_subscriptions.Post(subscriptionID, builder);
+        }
+    };
+
+    LogFileMatchPoster s_poster;
+    SCXCore::LogFileWatcher s_watcher(&s_poster);
+}
+
+MI_BEGIN_NAMESPACE
+
+SCX_LogFileMatchIndication_Class_Provider::SCX_LogFileMatchIndication_Class_Provider(
+    Module* module) :
+    m_Module(module)
+{
+}
+
+SCX_LogFileMatchIndication_Class_Provider::~SCX_LogFileMatchIndication_Class_Provider()
+{
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::Load(
+        Context& context)
+{
+    SCX_PEX_BEGIN
+    {
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::LogFileProvider::Lock"));
+        SCXCore::g_LogFileProvider.Load();
+
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::Load", SCXCore::g_LogFileProvider.GetLogHandle() );
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::Unload(
+        Context& context)
+{
+    SCX_PEX_BEGIN
+    {
+        s_watcher.Stop();
+
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::LogFileProvider::Lock"));
+        SCXCore::g_LogFileProvider.Unload();
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::Unload", SCXCore::g_LogFileProvider.GetLogHandle() );
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::EnableIndications(
+    MI_Context* indicationsContext,
+    const String& nameSpace,
+    const String& className)
+{
+    Context context(indicationsContext);
+
+    SCX_PEX_BEGIN
+    {
+        // The indications context stays open until DisableIndications
+        s_subscriptions.Enable(s_watcher);
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::EnableIndications", SCXCore::g_LogFileProvider.GetLogHandle() );
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::DisableIndications(
+    MI_Context* indicationsContext,
+    const String& nameSpace,
+    const String& className)
+{
+    Context context(indicationsContext);
+
+    SCX_PEX_BEGIN
+    {
+        s_subscriptions.Disable(s_watcher);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::DisableIndications", SCXCore::g_LogFileProvider.GetLogHandle() );
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::Subscribe(
+    MI_Context* subscriptionContext,
+    const String& nameSpace,
+    const MI_Filter* filter,
+    const String& bookmark,
+    MI_Uint64 subscriptionID,
+    void** subscriptionSelf)
+{
+    Context context(subscriptionContext);
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_LogFileProvider.GetLogHandle();
+
+    SCX_PEX_BEGIN
+    {
+        std::wstring expression;
+        MI_Result r = s_subscriptions.GetFilterExpression(filter, expression);
+        if (MI_RESULT_OK != r)
+        {
+            context.Post(r);
+            return;
+        }
+
+        std::wstring filename;
+        std::vector<std::wstring> regexps;
+        try
+        {
+            SCXCore::LogFileWatcher::ParseFilter(expression, filename, regexps);
+        }
+        catch (SCXNotSupportedException& e)
+        {
+            SCX_LOGWARNING(log, L"SCX_LogFileMatchIndication_Class_Provider::Subscribe - " + e.What());
+            context.Post(MI_RESULT_INVALID_QUERY);
+            return;
+        }
+
+        s_subscriptions.Add(subscriptionID, subscriptionContext);
+        try
+        {
+            s_watcher.Subscribe(subscriptionID, filename, regexps);
+        }
+        catch (SCXInvalidRegexException& e)
+        {
+            s_subscriptions.Remove(subscriptionID);
+            SCX_LOGWARNING(log, L"SCX_LogFileMatchIndication_Class_Provider::Subscribe - " + e.What());
+            context.Post(MI_RESULT_INVALID_QUERY);
+            return;
+        }
+
+        // The subscription context stays open: matches are posted on it until Unsubscribe
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::Subscribe", log );
+}
+
+void SCX_LogFileMatchIndication_Class_Provider::Unsubscribe(
+    MI_Context* unsubscribeContext,
+    const String& nameSpace,
+    MI_Uint64 subscriptionID,
+    void* subscriptionSelf)
+{
+    Context context(unsubscribeContext);
+
+    SCX_PEX_BEGIN
+    {
+        s_subscriptions.Unsubscribe(s_watcher, subscriptionID);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_LogFileMatchIndication_Class_Provider::Unsubscribe", SCXCore::g_LogFileProvider.GetLogHandle() );
+}
+
+MI_END_NAMESPACE
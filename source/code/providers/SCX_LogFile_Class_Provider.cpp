@@ -78,7 +78,7 @@ void SCX_LogFile_Class_Provider::Unload(
         SCXCore::g_LogFileProvider.Unload();
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_LogFile_Class_Provider::Load", SCXCore::g_LogFileProvider.GetLogHandle() );
+    SCX_PEX_END( L"SCX_LogFile_Class_Provider::Unload", SCXCore::g_LogFileProvider.GetLogHandle() );
 }
 
 void SCX_LogFile_Class_Provider::EnumerateInstances(
@@ -152,7 +152,7 @@ void SCX_LogFile_Class_Provider::Invoke_GetMatchedRows(
 
     SCXCoreLib::SCXLogHandle log = SCXCore::g_LogFileProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_LogFile_Class_Provider::Invoke_GetMatchedRows" )
     {
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::LogFileProvider::Lock"));
 
@@ -168,11 +168,14 @@ void SCX_LogFile_Class_Provider::Invoke_GetMatchedRows(
         //   regexps       : string array
         //   qid           : string
         //   elevationType : [Optional] string
+        //   scanTimeBudget: [Optional] uint32 (milliseconds, 0 means no limit)
 
         std::wstring filename = SCXCoreLib::StrFromMultibyte( in.filename_value().Str() );
         const StringA regexps_sa = in.regexps_value();
         std::wstring qid = SCXCoreLib::StrFromMultibyte( in.qid_value().Str() );
         std::wstring elevationType = SCXCoreLib::StrFromMultibyte( in.elevationType_value().Str() );
+        unsigned int scanTimeBudget = in.scanTimeBudget_exists() ? in.scanTimeBudget_value()
+                                                                 : SCXCore::g_LogFileProvider.GetScanTimeBudget();
 
         bool fPerformElevation = false;
         if ( elevationType.length() )
@@ -190,6 +193,7 @@ void SCX_LogFile_Class_Provider::Invoke_GetMatchedRows(
         SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRows - qid = ", qid));
         SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRows - regexp count = ", regexps_sa.GetSize()));
         SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRows - elevate = ", elevationType));
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRows - scan time budget = ", scanTimeBudget));
 
         // Extract and parse the regular expressions
 
@@ -232,7 +236,7 @@ void SCX_LogFile_Class_Provider::Invoke_GetMatchedRows(
             // Call helper function to get the data
             std::vector<std::wstring> matchedLines;
             bool bWasPartialRead = SCXCore::g_LogFileProvider.InvokeLogFileReader(
-                filename, qid, regexps, fPerformElevation, matchedLines);
+                filename, qid, regexps, fPerformElevation, matchedLines, scanTimeBudget);
 
             // Add each match to the result property set
             //
@@ -266,7 +270,7 @@ void SCX_LogFile_Class_Provider::Invoke_GetMatchedRows(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_LogFile_Class_Provider::Load", log );
+    SCX_PEX_END_TIMED( L"SCX_LogFile_Class_Provider::Invoke_GetMatchedRows", log );
 }
 
 void SCX_LogFile_Class_Provider::Invoke_ResetStateFile(
@@ -277,7 +281,7 @@ void SCX_LogFile_Class_Provider::Invoke_ResetStateFile(
 {
     SCXCoreLib::SCXLogHandle log = SCXCore::g_LogFileProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_LogFile_Class_Provider::Invoke_ResetStateFile" )
     {
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::LogFileProvider::Lock"));
 
@@ -334,7 +338,161 @@ void SCX_LogFile_Class_Provider::Invoke_ResetStateFile(
         inst.MIReturn_value( returnStatus );
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_LogFile_Class_Provider::Load", log );
+    SCX_PEX_END_TIMED( L"SCX_LogFile_Class_Provider::Invoke_ResetStateFile", log );
+}
+
+void SCX_LogFile_Class_Provider::Invoke_GetMatchedRowsBatch(
+    Context& context,
+    const String& nameSpace,
+    const SCX_LogFile_Class& instanceName,
+    const SCX_LogFile_GetMatchedRowsBatch_Class& in)
+{
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_LogFileProvider.GetLogHandle();
+
+    SCX_PEX_BEGIN_TIMED( L"SCX_LogFile_Class_Provider::Invoke_GetMatchedRowsBatch" )
+    {
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::LogFileProvider::Lock"));
+
+        // Validate that we have mandatory arguments
+        if ( !in.filename_exists() || !in.qids_exists() || !in.regexps_exists() || !in.regexpQids_exists() )
+        {
+            context.Post(MI_RESULT_INVALID_PARAMETER);
+            return;
+        }
+
+        // Get the arguments:
+        //   filename      : string
+        //   qids          : string array
+        //   regexps       : string array
+        //   regexpQids    : uint32 array (index into qids for each regexp)
+        //   elevationType : [Optional] string
+        //   scanTimeBudget: [Optional] uint32 (milliseconds, 0 means no limit)
+
+        std::wstring filename = SCXCoreLib::StrFromMultibyte( in.filename_value().Str() );
+        const StringA qids_sa = in.qids_value();
+        const StringA regexps_sa = in.regexps_value();
+        const Uint32A regexpQids_ua = in.regexpQids_value();
+        std::wstring elevationType = SCXCoreLib::StrFromMultibyte( in.elevationType_value().Str() );
+        unsigned int scanTimeBudget = in.scanTimeBudget_exists() ? in.scanTimeBudget_value()
+                                                                 : SCXCore::g_LogFileProvider.GetScanTimeBudget();
+
+        if ( regexps_sa.GetSize() != regexpQids_ua.GetSize() )
+        {
+            context.Post(MI_RESULT_INVALID_PARAMETER);
+            return;
+        }
+
+        bool fPerformElevation = false;
+        if ( elevationType.length() )
+        {
+            if ( SCXCoreLib::StrToLower(elevationType) != L"sudo" )
+            {
+                context.Post(MI_RESULT_INVALID_PARAMETER);
+                return;
+            }
+
+            fPerformElevation = true;
+        }
+
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - filename = ", filename));
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - qid count = ", qids_sa.GetSize()));
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - regexp count = ", regexps_sa.GetSize()));
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - elevate = ", elevationType));
+        SCX_LOGTRACE(log, SCXCoreLib::StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - scan time budget = ", scanTimeBudget));
+
+        // Extract and parse the regular expressions of each QID; within a QID, regular
+        // expressions are numbered in order, just like for GetMatchedRows
+
+        std::vector<SCXCore::LogFileQuery> queries(qids_sa.GetSize());
+        std::vector<std::wstring> invalid_regex(qids_sa.GetSize());
+        std::vector<int> regexCount(qids_sa.GetSize(), 0);
+
+        for (size_t i=0; i<queries.size(); i++)
+        {
+            queries[i].qid = SCXCoreLib::StrFromMultibyte(qids_sa[static_cast<MI_Uint32>(i)].Str());
+        }
+
+        for (size_t i=0; i<regexps_sa.GetSize(); i++)
+        {
+            size_t q = regexpQids_ua[static_cast<MI_Uint32>(i)];
+            if ( q >= queries.size() )
+            {
+                context.Post(MI_RESULT_INVALID_PARAMETER);
+                return;
+            }
+
+            std::wstring regexp = SCXCoreLib::StrFromMultibyte(regexps_sa[static_cast<MI_Uint32>(i)].Str());
+            int index = regexCount[q]++;
+
+            SCX_LOGTRACE(log, StrAppend(StrAppend(L"SCXLogFileProvider::InvokeMatchedRowsBatch - qid = ", queries[q].qid),
+                                        StrAppend(L", regexp = ", regexp)));
+
+            try
+            {
+                SCXRegexWithIndex regind;
+                regind.regex = new SCXRegex(regexp);
+                regind.index = index;
+                queries[q].regexps.push_back(regind);
+            }
+            catch (SCXInvalidRegexException& e)
+            {
+                SCX_LOGWARNING(log, StrAppend(L"SCXLogFileProvider DoInvokeMethod - invalid regexp : ", regexp));
+                invalid_regex[q] = StrAppend(StrAppend(invalid_regex[q], invalid_regex[q].length()>0?L" ":L""), index);
+            }
+        }
+
+        // We have to post a single instance that contains an array of strings
+        // MOF format: [OUT, ArrayType("Ordered")] string rows[]
+        std::vector<mi::String> returnData;
+
+        SCX_LogFile_GetMatchedRowsBatch_Class inst;
+        try
+        {
+            // Call helper function to get the data (for all QIDs in one read where possible)
+            SCXCore::g_LogFileProvider.InvokeLogFileReader(filename, queries, fPerformElevation, scanTimeBudget);
+        }
+        catch (SCXCoreLib::SCXFilePathNotFoundException& e)
+        {
+            SCX_LOGWARNING(log, SCXCoreLib::StrAppend(L"LogFileProvider DoInvokeMethod - File not found: ", filename).append(e.What()));
+        }
+
+        // Add the rows of each QID, prefixed with the QID, just as GetMatchedRows returns them
+        for (size_t i=0; i<queries.size(); i++)
+        {
+            std::wstring prefix = queries[i].qid + L";";
+
+            if (invalid_regex[i].length() > 0)
+            {
+                InsertOneString( context, returnData, prefix + StrAppend(L"InvalidRegexp;", invalid_regex[i]));
+            }
+
+            for (std::vector<std::wstring>::const_iterator it = queries[i].matchedLines.begin();
+                 it != queries[i].matchedLines.end();
+                 it++)
+            {
+                InsertOneString( context, returnData, prefix + *it );
+            }
+
+            // Set "MoreRowsAvailable" if we terminated early
+            if (queries[i].partialRead)
+            {
+                InsertOneString( context, returnData, prefix + L"MoreRowsAvailable;true" );
+            }
+        }
+
+        if ( ! returnData.empty() )
+        {
+            StringA rows(&returnData[0], static_cast<MI_Uint32>(returnData.size()));
+            inst.rows_value( rows );
+        }
+
+        // Set the return value (the number of lines returned)
+        inst.MIReturn_value( static_cast<MI_Uint32> (returnData.size()) );
+
+        context.Post(inst);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END_TIMED( L"SCX_LogFile_Class_Provider::Invoke_GetMatchedRowsBatch", log );
 }
 
 
@@ -76,6 +76,12 @@ public:
         const SCX_LogFile_Class& instanceName,
         const SCX_LogFile_ResetStateFile_Class& in);
 
+    void Invoke_GetMatchedRowsBatch(
+        Context& context,
+        const String& nameSpace,
+        const SCX_LogFile_Class& instanceName,
+        const SCX_LogFile_GetMatchedRowsBatch_Class& in);
+
 /* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
 };
 
@@ -216,7 +216,7 @@ void SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
         // Global lock for MemoryProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
@@ -226,7 +226,7 @@ void SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances(
 
         if ( !keysOnly )
         {
-            memEnum->Update();
+            SCXCore::g_MemoryProvider.UpdateMemoryEnumeration();
         }
 
         // There should be only one instance.
@@ -235,12 +235,13 @@ void SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances(
         {
             SCX_MemoryStatisticalInformation_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, meminst);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances",
-                       SCXCore::g_MemoryProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_MemoryStatisticalInformation_Class_Provider::EnumerateInstances",
+                             SCXCore::g_MemoryProvider.GetLogHandle() );
 }
 
 void SCX_MemoryStatisticalInformation_Class_Provider::GetInstance(
@@ -249,7 +250,7 @@ void SCX_MemoryStatisticalInformation_Class_Provider::GetInstance(
     const SCX_MemoryStatisticalInformation_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_MemoryStatisticalInformation_Class_Provider::GetInstance" )
     {
         // Global lock for MemoryProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
@@ -266,8 +267,8 @@ void SCX_MemoryStatisticalInformation_Class_Provider::GetInstance(
             return;
         }
 
+        SCXCore::g_MemoryProvider.UpdateMemoryEnumeration();
         SCXCoreLib::SCXHandle<SCXSystemLib::MemoryEnumeration> memEnum = SCXCore::g_MemoryProvider.GetMemoryEnumeration();
-        memEnum->Update();
 
         // There should be only one instance.
         SCXCoreLib::SCXHandle<SCXSystemLib::MemoryInstance> meminst = memEnum->GetTotalInstance();
@@ -281,8 +282,8 @@ void SCX_MemoryStatisticalInformation_Class_Provider::GetInstance(
         EnumerateOneInstance(context, inst, false, meminst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_MemoryStatisticalInformation_Class_Provider::GetInstance",
-                      SCXCore::g_MemoryProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_MemoryStatisticalInformation_Class_Provider::GetInstance",
+                            SCXCore::g_MemoryProvider.GetLogHandle() );
 }
 
 void SCX_MemoryStatisticalInformation_Class_Provider::CreateInstance(
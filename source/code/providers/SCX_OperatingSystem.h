@@ -12,6 +12,10 @@
 #include <MI.h>
 #include "CIM_OperatingSystem.h"
 #include "CIM_ConcreteJob.h"
+#include "SCX_MemoryStatisticalInformation.h"
+#include "SCX_ProcessorStatisticalInformation.h"
+#include "SCX_DiskDriveStatisticalInformation.h"
+#include "SCX_FileSystemStatisticalInformation.h"
 
 /*
 **==============================================================================
@@ -1478,6 +1482,8 @@ typedef struct _SCX_OperatingSystem_ExecuteCommand
     /*OUT*/ MI_ConstStringField StdErr;
     /*IN*/ MI_ConstUint32Field timeout;
     /*IN*/ MI_ConstStringField ElevationType;
+    /*IN*/ MI_ConstUint32Field MaxResultAge;
+    /*OUT*/ MI_ConstStringField ResourceUsage;
 }
 SCX_OperatingSystem_ExecuteCommand;
 
@@ -1694,6 +1700,54 @@ MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_Clear_ElevationTy
         6);
 }
 
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_Set_MaxResultAge(
+    SCX_OperatingSystem_ExecuteCommand* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->MaxResultAge)->value = x;
+    ((MI_Uint32Field*)&self->MaxResultAge)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_Clear_MaxResultAge(
+    SCX_OperatingSystem_ExecuteCommand* self)
+{
+    memset((void*)&self->MaxResultAge, 0, sizeof(self->MaxResultAge));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_Set_ResourceUsage(
+    SCX_OperatingSystem_ExecuteCommand* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_SetPtr_ResourceUsage(
+    SCX_OperatingSystem_ExecuteCommand* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteCommand_Clear_ResourceUsage(
+    SCX_OperatingSystem_ExecuteCommand* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
 /*
 **==============================================================================
 **
@@ -1713,6 +1767,7 @@ typedef struct _SCX_OperatingSystem_ExecuteShellCommand
     /*IN*/ MI_ConstUint32Field timeout;
     /*IN*/ MI_ConstStringField ElevationType;
     /*IN*/ MI_ConstBooleanField b64encoded;
+    /*OUT*/ MI_ConstStringField ResourceUsage;
 }
 SCX_OperatingSystem_ExecuteShellCommand;
 
@@ -1945,6 +2000,38 @@ MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteShellCommand_Clear_b64enc
     return MI_RESULT_OK;
 }
 
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteShellCommand_Set_ResourceUsage(
+    SCX_OperatingSystem_ExecuteShellCommand* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteShellCommand_SetPtr_ResourceUsage(
+    SCX_OperatingSystem_ExecuteShellCommand* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteShellCommand_Clear_ResourceUsage(
+    SCX_OperatingSystem_ExecuteShellCommand* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
 /*
 **==============================================================================
 **
@@ -1965,6 +2052,7 @@ typedef struct _SCX_OperatingSystem_ExecuteScript
     /*IN*/ MI_ConstUint32Field timeout;
     /*IN*/ MI_ConstStringField ElevationType;
     /*IN*/ MI_ConstBooleanField b64encoded;
+    /*OUT*/ MI_ConstStringField ResourceUsage;
 }
 SCX_OperatingSystem_ExecuteScript;
 
@@ -2229,118 +2317,449 @@ MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteScript_Clear_b64encoded(
     return MI_RESULT_OK;
 }
 
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteScript_Set_ResourceUsage(
+    SCX_OperatingSystem_ExecuteScript* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        9,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteScript_SetPtr_ResourceUsage(
+    SCX_OperatingSystem_ExecuteScript* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        9,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_ExecuteScript_Clear_ResourceUsage(
+    SCX_OperatingSystem_ExecuteScript* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        9);
+}
+
 /*
 **==============================================================================
 **
-** SCX_OperatingSystem provider function prototypes
+** SCX_OperatingSystem.GetSystemSnapshot()
 **
 **==============================================================================
 */
 
-/* The developer may optionally define this structure */
-typedef struct _SCX_OperatingSystem_Self SCX_OperatingSystem_Self;
+typedef struct _SCX_OperatingSystem_GetSystemSnapshot
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstBooleanField MIReturn;
+    /*OUT*/ MI_ConstStringField Timestamp;
+    /*OUT*/ SCX_OperatingSystem_ConstRef OperatingSystem;
+    /*OUT*/ SCX_MemoryStatisticalInformation_ConstRef Memory;
+    /*OUT*/ SCX_ProcessorStatisticalInformation_ConstArrayRef Processors;
+    /*OUT*/ SCX_DiskDriveStatisticalInformation_ConstArrayRef DiskDrives;
+    /*OUT*/ SCX_FileSystemStatisticalInformation_ConstArrayRef FileSystems;
+}
+SCX_OperatingSystem_GetSystemSnapshot;
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Load(
-    SCX_OperatingSystem_Self** self,
-    MI_Module_Self* selfModule,
-    MI_Context* context);
+MI_EXTERN_C MI_CONST MI_MethodDecl SCX_OperatingSystem_GetSystemSnapshot_rtti;
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Unload(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Construct(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &SCX_OperatingSystem_GetSystemSnapshot_rtti,
+        (MI_Instance*)&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_EnumerateInstances(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_PropertySet* propertySet,
-    MI_Boolean keysOnly,
-    const MI_Filter* filter);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clone(
+    const SCX_OperatingSystem_GetSystemSnapshot* self,
+    SCX_OperatingSystem_GetSystemSnapshot** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_GetInstance(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_OperatingSystem* instanceName,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Destruct(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_CreateInstance(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_OperatingSystem* newInstance);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Delete(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_ModifyInstance(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_OperatingSystem* modifiedInstance,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Post(
+    const SCX_OperatingSystem_GetSystemSnapshot* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_DeleteInstance(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_OperatingSystem* instanceName);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_MIReturn(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->MIReturn)->value = x;
+    ((MI_BooleanField*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_RequestStateChange(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_RequestStateChange* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_MIReturn(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_Reboot(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_Reboot* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_Timestamp(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_Shutdown(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_Shutdown* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_Timestamp(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteCommand(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_ExecuteCommand* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_Timestamp(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteShellCommand(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_ExecuteShellCommand* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_OperatingSystem(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_OperatingSystem* x)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&x,
+        MI_INSTANCE,
+        0);
+}
 
-MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteScript(
-    SCX_OperatingSystem_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_OperatingSystem* instanceName,
-    const SCX_OperatingSystem_ExecuteScript* in);
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_OperatingSystem(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_OperatingSystem* x)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&x,
+        MI_INSTANCE,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_OperatingSystem(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_Memory(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_MemoryStatisticalInformation* x)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&x,
+        MI_INSTANCE,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_Memory(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_MemoryStatisticalInformation* x)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&x,
+        MI_INSTANCE,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_Memory(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        3);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_Processors(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_ProcessorStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_Processors(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_ProcessorStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_Processors(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_DiskDrives(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_DiskDriveStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_DiskDrives(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_DiskDriveStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_DiskDrives(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Set_FileSystems(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_FileSystemStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_SetPtr_FileSystems(
+    SCX_OperatingSystem_GetSystemSnapshot* self,
+    const SCX_FileSystemStatisticalInformation * const * data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_INSTANCEA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_OperatingSystem_GetSystemSnapshot_Clear_FileSystems(
+    SCX_OperatingSystem_GetSystemSnapshot* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+/*
+**==============================================================================
+**
+** SCX_OperatingSystem provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _SCX_OperatingSystem_Self SCX_OperatingSystem_Self;
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Load(
+    SCX_OperatingSystem_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Unload(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_EnumerateInstances(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_GetInstance(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_OperatingSystem* instanceName,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_CreateInstance(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_OperatingSystem* newInstance);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_ModifyInstance(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_OperatingSystem* modifiedInstance,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_DeleteInstance(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_OperatingSystem* instanceName);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_RequestStateChange(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_RequestStateChange* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_Reboot(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_Reboot* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_Shutdown(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_Shutdown* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteCommand(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_ExecuteCommand* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteShellCommand(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_ExecuteShellCommand* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteScript(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_ExecuteScript* in);
+
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_GetSystemSnapshot(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_GetSystemSnapshot* in);
 
 
 /*
@@ -3212,24 +3631,104 @@ public:
         const size_t n = offsetof(Self, ElevationType);
         GetField<String>(n).Clear();
     }
-};
-
-typedef Array<SCX_OperatingSystem_ExecuteCommand_Class> SCX_OperatingSystem_ExecuteCommand_ClassA;
 
-class SCX_OperatingSystem_ExecuteShellCommand_Class : public Instance
-{
-public:
+    //
+    // SCX_OperatingSystem_ExecuteCommand_Class.MaxResultAge
+    //
     
-    typedef SCX_OperatingSystem_ExecuteShellCommand Self;
+    const Field<Uint32>& MaxResultAge() const
+    {
+        const size_t n = offsetof(Self, MaxResultAge);
+        return GetField<Uint32>(n);
+    }
     
-    SCX_OperatingSystem_ExecuteShellCommand_Class() :
-        Instance(&SCX_OperatingSystem_ExecuteShellCommand_rtti)
+    void MaxResultAge(const Field<Uint32>& x)
     {
+        const size_t n = offsetof(Self, MaxResultAge);
+        GetField<Uint32>(n) = x;
     }
     
-    SCX_OperatingSystem_ExecuteShellCommand_Class(
-        const SCX_OperatingSystem_ExecuteShellCommand* instanceName,
-        bool keysOnly) :
+    const Uint32& MaxResultAge_value() const
+    {
+        const size_t n = offsetof(Self, MaxResultAge);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void MaxResultAge_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, MaxResultAge);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool MaxResultAge_exists() const
+    {
+        const size_t n = offsetof(Self, MaxResultAge);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void MaxResultAge_clear()
+    {
+        const size_t n = offsetof(Self, MaxResultAge);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_ExecuteCommand_Class.ResourceUsage
+    //
+    
+    const Field<String>& ResourceUsage() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n);
+    }
+    
+    void ResourceUsage(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ResourceUsage_value() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).value;
+    }
+    
+    void ResourceUsage_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ResourceUsage_exists() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ResourceUsage_clear()
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Clear();
+    }
+};
+
+typedef Array<SCX_OperatingSystem_ExecuteCommand_Class> SCX_OperatingSystem_ExecuteCommand_ClassA;
+
+class SCX_OperatingSystem_ExecuteShellCommand_Class : public Instance
+{
+public:
+    
+    typedef SCX_OperatingSystem_ExecuteShellCommand Self;
+    
+    SCX_OperatingSystem_ExecuteShellCommand_Class() :
+        Instance(&SCX_OperatingSystem_ExecuteShellCommand_rtti)
+    {
+    }
+    
+    SCX_OperatingSystem_ExecuteShellCommand_Class(
+        const SCX_OperatingSystem_ExecuteShellCommand* instanceName,
+        bool keysOnly) :
         Instance(
             &SCX_OperatingSystem_ExecuteShellCommand_rtti,
             &instanceName->__instance,
@@ -3583,6 +4082,46 @@ public:
         const size_t n = offsetof(Self, b64encoded);
         GetField<Boolean>(n).Clear();
     }
+
+    //
+    // SCX_OperatingSystem_ExecuteShellCommand_Class.ResourceUsage
+    //
+    
+    const Field<String>& ResourceUsage() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n);
+    }
+    
+    void ResourceUsage(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ResourceUsage_value() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).value;
+    }
+    
+    void ResourceUsage_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ResourceUsage_exists() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ResourceUsage_clear()
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Clear();
+    }
 };
 
 typedef Array<SCX_OperatingSystem_ExecuteShellCommand_Class> SCX_OperatingSystem_ExecuteShellCommand_ClassA;
@@ -3994,10 +4533,381 @@ public:
         const size_t n = offsetof(Self, b64encoded);
         GetField<Boolean>(n).Clear();
     }
+
+    //
+    // SCX_OperatingSystem_ExecuteScript_Class.ResourceUsage
+    //
+    
+    const Field<String>& ResourceUsage() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n);
+    }
+    
+    void ResourceUsage(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ResourceUsage_value() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).value;
+    }
+    
+    void ResourceUsage_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ResourceUsage_exists() const
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ResourceUsage_clear()
+    {
+        const size_t n = offsetof(Self, ResourceUsage);
+        GetField<String>(n).Clear();
+    }
 };
 
 typedef Array<SCX_OperatingSystem_ExecuteScript_Class> SCX_OperatingSystem_ExecuteScript_ClassA;
 
+class SCX_OperatingSystem_GetSystemSnapshot_Class : public Instance
+{
+public:
+    
+    typedef SCX_OperatingSystem_GetSystemSnapshot Self;
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class() :
+        Instance(&SCX_OperatingSystem_GetSystemSnapshot_rtti)
+    {
+    }
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class(
+        const SCX_OperatingSystem_GetSystemSnapshot* instanceName,
+        bool keysOnly) :
+        Instance(
+            &SCX_OperatingSystem_GetSystemSnapshot_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class& operator=(
+        const SCX_OperatingSystem_GetSystemSnapshot_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_OperatingSystem_GetSystemSnapshot_Class(
+        const SCX_OperatingSystem_GetSystemSnapshot_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.MIReturn
+    //
+    
+    const Field<Boolean>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n);
+    }
+    
+    void MIReturn(const Field<Boolean>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n) = x;
+    }
+    
+    const Boolean& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).value;
+    }
+    
+    void MIReturn_value(const Boolean& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.Timestamp
+    //
+    
+    const Field<String>& Timestamp() const
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        return GetField<String>(n);
+    }
+    
+    void Timestamp(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        GetField<String>(n) = x;
+    }
+    
+    const String& Timestamp_value() const
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        return GetField<String>(n).value;
+    }
+    
+    void Timestamp_value(const String& x)
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool Timestamp_exists() const
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void Timestamp_clear()
+    {
+        const size_t n = offsetof(Self, Timestamp);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.OperatingSystem
+    //
+    
+    const Field<SCX_OperatingSystem_Class>& OperatingSystem() const
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        return GetField<SCX_OperatingSystem_Class>(n);
+    }
+    
+    void OperatingSystem(const Field<SCX_OperatingSystem_Class>& x)
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        GetField<SCX_OperatingSystem_Class>(n) = x;
+    }
+    
+    const SCX_OperatingSystem_Class& OperatingSystem_value() const
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        return GetField<SCX_OperatingSystem_Class>(n).value;
+    }
+    
+    void OperatingSystem_value(const SCX_OperatingSystem_Class& x)
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        GetField<SCX_OperatingSystem_Class>(n).Set(x);
+    }
+    
+    bool OperatingSystem_exists() const
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        return GetField<SCX_OperatingSystem_Class>(n).exists ? true : false;
+    }
+    
+    void OperatingSystem_clear()
+    {
+        const size_t n = offsetof(Self, OperatingSystem);
+        GetField<SCX_OperatingSystem_Class>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.Memory
+    //
+    
+    const Field<SCX_MemoryStatisticalInformation_Class>& Memory() const
+    {
+        const size_t n = offsetof(Self, Memory);
+        return GetField<SCX_MemoryStatisticalInformation_Class>(n);
+    }
+    
+    void Memory(const Field<SCX_MemoryStatisticalInformation_Class>& x)
+    {
+        const size_t n = offsetof(Self, Memory);
+        GetField<SCX_MemoryStatisticalInformation_Class>(n) = x;
+    }
+    
+    const SCX_MemoryStatisticalInformation_Class& Memory_value() const
+    {
+        const size_t n = offsetof(Self, Memory);
+        return GetField<SCX_MemoryStatisticalInformation_Class>(n).value;
+    }
+    
+    void Memory_value(const SCX_MemoryStatisticalInformation_Class& x)
+    {
+        const size_t n = offsetof(Self, Memory);
+        GetField<SCX_MemoryStatisticalInformation_Class>(n).Set(x);
+    }
+    
+    bool Memory_exists() const
+    {
+        const size_t n = offsetof(Self, Memory);
+        return GetField<SCX_MemoryStatisticalInformation_Class>(n).exists ? true : false;
+    }
+    
+    void Memory_clear()
+    {
+        const size_t n = offsetof(Self, Memory);
+        GetField<SCX_MemoryStatisticalInformation_Class>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.Processors
+    //
+    
+    const Field<SCX_ProcessorStatisticalInformation_ClassA>& Processors() const
+    {
+        const size_t n = offsetof(Self, Processors);
+        return GetField<SCX_ProcessorStatisticalInformation_ClassA>(n);
+    }
+    
+    void Processors(const Field<SCX_ProcessorStatisticalInformation_ClassA>& x)
+    {
+        const size_t n = offsetof(Self, Processors);
+        GetField<SCX_ProcessorStatisticalInformation_ClassA>(n) = x;
+    }
+    
+    const SCX_ProcessorStatisticalInformation_ClassA& Processors_value() const
+    {
+        const size_t n = offsetof(Self, Processors);
+        return GetField<SCX_ProcessorStatisticalInformation_ClassA>(n).value;
+    }
+    
+    void Processors_value(const SCX_ProcessorStatisticalInformation_ClassA& x)
+    {
+        const size_t n = offsetof(Self, Processors);
+        GetField<SCX_ProcessorStatisticalInformation_ClassA>(n).Set(x);
+    }
+    
+    bool Processors_exists() const
+    {
+        const size_t n = offsetof(Self, Processors);
+        return GetField<SCX_ProcessorStatisticalInformation_ClassA>(n).exists ? true : false;
+    }
+    
+    void Processors_clear()
+    {
+        const size_t n = offsetof(Self, Processors);
+        GetField<SCX_ProcessorStatisticalInformation_ClassA>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.DiskDrives
+    //
+    
+    const Field<SCX_DiskDriveStatisticalInformation_ClassA>& DiskDrives() const
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        return GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n);
+    }
+    
+    void DiskDrives(const Field<SCX_DiskDriveStatisticalInformation_ClassA>& x)
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n) = x;
+    }
+    
+    const SCX_DiskDriveStatisticalInformation_ClassA& DiskDrives_value() const
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        return GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n).value;
+    }
+    
+    void DiskDrives_value(const SCX_DiskDriveStatisticalInformation_ClassA& x)
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n).Set(x);
+    }
+    
+    bool DiskDrives_exists() const
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        return GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n).exists ? true : false;
+    }
+    
+    void DiskDrives_clear()
+    {
+        const size_t n = offsetof(Self, DiskDrives);
+        GetField<SCX_DiskDriveStatisticalInformation_ClassA>(n).Clear();
+    }
+
+    //
+    // SCX_OperatingSystem_GetSystemSnapshot_Class.FileSystems
+    //
+    
+    const Field<SCX_FileSystemStatisticalInformation_ClassA>& FileSystems() const
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        return GetField<SCX_FileSystemStatisticalInformation_ClassA>(n);
+    }
+    
+    void FileSystems(const Field<SCX_FileSystemStatisticalInformation_ClassA>& x)
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        GetField<SCX_FileSystemStatisticalInformation_ClassA>(n) = x;
+    }
+    
+    const SCX_FileSystemStatisticalInformation_ClassA& FileSystems_value() const
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        return GetField<SCX_FileSystemStatisticalInformation_ClassA>(n).value;
+    }
+    
+    void FileSystems_value(const SCX_FileSystemStatisticalInformation_ClassA& x)
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        GetField<SCX_FileSystemStatisticalInformation_ClassA>(n).Set(x);
+    }
+    
+    bool FileSystems_exists() const
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        return GetField<SCX_FileSystemStatisticalInformation_ClassA>(n).exists ? true : false;
+    }
+    
+    void FileSystems_clear()
+    {
+        const size_t n = offsetof(Self, FileSystems);
+        GetField<SCX_FileSystemStatisticalInformation_ClassA>(n).Clear();
+    }
+};
+
+typedef Array<SCX_OperatingSystem_GetSystemSnapshot_Class> SCX_OperatingSystem_GetSystemSnapshot_ClassA;
+
 MI_END_NAMESPACE
 
 #endif /* __cplusplus */
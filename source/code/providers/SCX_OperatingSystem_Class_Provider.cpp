@@ -32,8 +32,11 @@
 #include "support/scxcimutils.h"
 #include "support/scxrunasconfigurator.h"
 #include "support/startuplog.h"
+#include "support/memoryprovider.h"
 #include "support/osprovider.h"
 #include "support/runasprovider.h"
+#include "support/childprocessengine.h"
+#include "support/systemsnapshot.h"
 
 using namespace SCXSystemLib;
 using namespace SCXCoreLib;
@@ -117,8 +120,7 @@ private:
     const SCX_OperatingSystem_ExecuteScript_Class m_input;
 };
 
-static void EnumerateOneInstance(
-    Context& context,
+static void FillOneInstance(
     SCX_OperatingSystem_Class& inst,
     bool keysOnly,
     SCXHandle<OSInstance> osinst,
@@ -128,7 +130,7 @@ static void EnumerateOneInstance(
     SCXHandle<SCXOSTypeInfo> osTypeInfo = SCXCore::g_OSProvider.GetOSTypeInfo();
     SCXLogHandle& log = SCXCore::g_OSProvider.GetLogHandle();
 
-    SCX_LOGTRACE(log, L"OSProvider EnumerateOneInstance()");
+    SCX_LOGTRACE(log, L"OSProvider FillOneInstance()");
 
     // Fill in the keys
     inst.Name_value( StrToMultibyte(osTypeInfo->GetOSName(true)).c_str() );
@@ -289,10 +291,189 @@ static void EnumerateOneInstance(
         if (osinst->GetSystemUpTime(Ascxulong))
             inst.SystemUpTime_value( Ascxulong );
     }
+}
 
+static void EnumerateOneInstance(
+    Context& context,
+    SCX_OperatingSystem_Class& inst,
+    bool keysOnly,
+    SCXHandle<OSInstance> osinst,
+    SCXHandle<MemoryInstance> meminst)
+{
+    FillOneInstance( inst, keysOnly, osinst, meminst );
     context.Post(inst);
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+   Builds the embedded instances returned by GetSystemSnapshot
+
+   The sink is called with the provider locks held, so it only copies values
+   into the MI instances; they are posted once SystemSnapshot::Take() returns.
+*/
+class SystemSnapshotInstances : public SCXCore::SystemSnapshotSink
+{
+public:
+    void AddOperatingSystem(SCXHandle<OSInstance> osinst, SCXHandle<MemoryInstance> meminst)
+    {
+        FillOneInstance( m_os, osinst == NULL || meminst == NULL, osinst, meminst );
+    }
+
+    void AddMemory(SCXHandle<MemoryInstance> meminst)
+    {
+        scxulong data, data2;
+
+        m_memory.Name_value( "Memory" );
+        m_memory.IsAggregate_value( meminst->IsTotal() );
+
+        if (meminst->GetAvailableMemory(data))
+            m_memory.AvailableMemory_value( BytesToMegaBytes(data) );
+
+        if (meminst->GetUsedMemory(data))
+            m_memory.UsedMemory_value( BytesToMegaBytes(data) );
+
+        if (meminst->GetPageReads(data) && meminst->GetPageWrites(data2))
+            m_memory.PagesPerSec_value( data + data2 );
+
+        if (meminst->GetAvailableSwap(data))
+            m_memory.AvailableSwap_value( BytesToMegaBytes(data) );
+
+        if (meminst->GetUsedSwap(data))
+            m_memory.UsedSwap_value( BytesToMegaBytes(data) );
+    }
+
+    void AddProcessor(SCXHandle<CPUInstance> cpuinst)
+    {
+        SCX_ProcessorStatisticalInformation_Class inst;
+        scxulong data;
+
+        inst.Name_value( StrToMultibyte(cpuinst->GetProcName()).c_str() );
+        inst.IsAggregate_value( cpuinst->IsTotal() );
+
+        if (cpuinst->GetProcessorTime(data))
+            inst.PercentProcessorTime_value( (unsigned char) data );
+
+        if (cpuinst->GetIdleTime(data))
+            inst.PercentIdleTime_value( (unsigned char) data );
+
+        if (cpuinst->GetUserTime(data))
+            inst.PercentUserTime_value( (unsigned char) data );
+
+        if (cpuinst->GetPrivilegedTime(data))
+            inst.PercentPrivilegedTime_value( (unsigned char) data );
+
+        if (cpuinst->GetIowaitTime(data))
+            inst.PercentIOWaitTime_value( (unsigned char) data );
+
+        m_processors.push_back(inst);
+    }
+
+    void AddDiskDrive(SCXHandle<StatisticalPhysicalDiskInstance> diskinst)
+    {
+        SCX_DiskDriveStatisticalInformation_Class inst;
+        std::wstring name;
+        scxulong data, data2;
+        double ddata;
+
+        if (diskinst->GetDiskName(name))
+            inst.Name_value( StrToMultibyte(name).c_str() );
+        inst.IsAggregate_value( diskinst->IsTotal() );
+
+        if (diskinst->GetIOPercentageTotal(data))
+        {
+            inst.PercentBusyTime_value( (unsigned char) data );
+            inst.PercentIdleTime_value( (unsigned char) (100-data) );
+        }
+
+        if (diskinst->GetBytesPerSecond(data, data2))
+        {
+            inst.ReadBytesPerSecond_value( data );
+            inst.WriteBytesPerSecond_value( data2 );
+        }
+
+        if (diskinst->GetTransfersPerSecond(data))
+            inst.TransfersPerSecond_value( data );
+
+        if (diskinst->GetReadsPerSecond(data))
+            inst.ReadsPerSecond_value( data );
+
+        if (diskinst->GetWritesPerSecond(data))
+            inst.WritesPerSecond_value( data );
+
+        if (diskinst->GetIOTimesTotal(ddata))
+            inst.AverageTransferTime_value( ddata );
+
+        if (diskinst->GetDiskQueueLength(ddata))
+            inst.AverageDiskQueueLength_value( ddata );
+
+        m_diskDrives.push_back(inst);
+    }
+
+    void AddFileSystem(SCXHandle<StatisticalLogicalDiskInstance> diskinst)
+    {
+        SCX_FileSystemStatisticalInformation_Class inst;
+        std::wstring name;
+        scxulong data, data2;
+
+        if (diskinst->GetDiskName(name))
+            inst.Name_value( StrToMultibyte(name).c_str() );
+        inst.IsAggregate_value( diskinst->IsTotal() );
+
+        if (diskinst->GetIOPercentageTotal(data))
+        {
+            inst.PercentBusyTime_value( (unsigned char) data );
+            inst.PercentIdleTime_value( (unsigned char) (100-data) );
+        }
+
+        if (diskinst->GetTransfersPerSecond(data))
+            inst.TransfersPerSecond_value( data );
+
+        if (diskinst->GetDiskSize(data, data2))
+        {
+            inst.UsedMegabytes_value( data );
+            inst.FreeMegabytes_value( data2 );
+            if (0 < data + data2)
+                inst.PercentFreeSpace_value( (unsigned char) GetPercentage(0, data2, 0, data + data2) );
+        }
+
+        if (diskinst->GetInodeUsage(data, data2) && 0 < data)
+            inst.PercentFreeInodes_value( (unsigned char) GetPercentage(0, data2, 0, data) );
+
+        m_fileSystems.push_back(inst);
+    }
+
+    void SetOutputs(SCX_OperatingSystem_GetSystemSnapshot_Class& out) const
+    {
+        out.OperatingSystem_value( m_os );
+        if ( m_memory.Name_exists() )
+        {
+            out.Memory_value( m_memory );
+        }
+        if ( !m_processors.empty() )
+        {
+            out.Processors_value( SCX_ProcessorStatisticalInformation_ClassA(
+                &m_processors[0], static_cast<MI_Uint32>(m_processors.size())) );
+        }
+        if ( !m_diskDrives.empty() )
+        {
+            out.DiskDrives_value( SCX_DiskDriveStatisticalInformation_ClassA(
+                &m_diskDrives[0], static_cast<MI_Uint32>(m_diskDrives.size())) );
+        }
+        if ( !m_fileSystems.empty() )
+        {
+            out.FileSystems_value( SCX_FileSystemStatisticalInformation_ClassA(
+                &m_fileSystems[0], static_cast<MI_Uint32>(m_fileSystems.size())) );
+        }
+    }
+
+private:
+    SCX_OperatingSystem_Class m_os;
+    SCX_MemoryStatisticalInformation_Class m_memory;
+    std::vector<SCX_ProcessorStatisticalInformation_Class> m_processors;
+    std::vector<SCX_DiskDriveStatisticalInformation_Class> m_diskDrives;
+    std::vector<SCX_FileSystemStatisticalInformation_Class> m_fileSystems;
+};
+
 SCX_OperatingSystem_Class_Provider::SCX_OperatingSystem_Class_Provider(
     Module* module) :
     m_Module(module)
@@ -311,6 +492,7 @@ void SCX_OperatingSystem_Class_Provider::Load(
         SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
         SCXCore::g_OSProvider.Load();
         SCXCore::g_RunAsProvider.Load();
+        SCXCore::g_SystemSnapshot.Load();
 
         // Notify that we don't wish to unload
         MI_Result r = context.RefuseUnload();
@@ -331,6 +513,7 @@ void SCX_OperatingSystem_Class_Provider::Unload(
     SCX_PEX_BEGIN
     {
         SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
+        SCXCore::g_SystemSnapshot.Unload();
         SCXCore::g_OSProvider.Unload();
         SCXCore::g_RunAsProvider.Unload();
         context.Post(MI_RESULT_OK);
@@ -345,21 +528,25 @@ void SCX_OperatingSystem_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::EnumerateInstances" )
     {
         SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
 
         // Refresh the collection
         SCXHandle<OSEnumeration> osEnum = SCXCore::g_OSProvider.GetOS_Enumerator();
-        SCXHandle<MemoryEnumeration> memEnum = SCXCore::g_OSProvider.GetMemory_Enumerator();
         osEnum->Update();
-        memEnum->Update();
+
+        // The memory enumeration is shared with SCX_MemoryStatisticalInformation
+        SCXThreadLock memLock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+        SCXCore::g_MemoryProvider.UpdateMemoryEnumeration();
+        SCXHandle<MemoryEnumeration> memEnum = SCXCore::g_MemoryProvider.GetMemoryEnumeration();
 
         SCX_OperatingSystem_Class inst;
         EnumerateOneInstance( context, inst, keysOnly, osEnum->GetTotalInstance(), memEnum->GetTotalInstance() );
+        scxPexTimer.AddInstances(1);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::EnumerateInstances", SCXCore::g_OSProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::EnumerateInstances", SCXCore::g_OSProvider.GetLogHandle() );
 }
 
 void SCX_OperatingSystem_Class_Provider::GetInstance(
@@ -368,7 +555,7 @@ void SCX_OperatingSystem_Class_Provider::GetInstance(
     const SCX_OperatingSystem_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::GetInstance" )
     {
         SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
 
@@ -415,15 +602,18 @@ void SCX_OperatingSystem_Class_Provider::GetInstance(
 
         // Refresh the collection
         SCXHandle<OSEnumeration> osEnum = SCXCore::g_OSProvider.GetOS_Enumerator();
-        SCXHandle<MemoryEnumeration> memEnum = SCXCore::g_OSProvider.GetMemory_Enumerator();
         osEnum->Update();
-        memEnum->Update();
+
+        // The memory enumeration is shared with SCX_MemoryStatisticalInformation
+        SCXThreadLock memLock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+        SCXCore::g_MemoryProvider.UpdateMemoryEnumeration();
+        SCXHandle<MemoryEnumeration> memEnum = SCXCore::g_MemoryProvider.GetMemoryEnumeration();
 
         SCX_OperatingSystem_Class inst;
         EnumerateOneInstance( context, inst, false, osEnum->GetTotalInstance(), memEnum->GetTotalInstance() );
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::GetInstance", SCXCore::g_OSProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::GetInstance", SCXCore::g_OSProvider.GetLogHandle() );
 }
 
 void SCX_OperatingSystem_Class_Provider::CreateInstance(
@@ -497,7 +687,7 @@ static void Invoke_ExecuteCommand_ThreadBody(SCXCoreLib::SCXThreadParamHandle& p
     Context& context = params->GetContext();
     const SCX_OperatingSystem_ExecuteCommand_Class& in = params->GetInput();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand" )
     {
         // We specifically do not lock here; we want multiple instances to run
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand" )
@@ -509,6 +699,7 @@ static void Invoke_ExecuteCommand_ThreadBody(SCXCoreLib::SCXThreadParamHandle& p
         //   [OUT] string StdErr, 
         //   [IN] uint32 timeout,
         //   [IN] string ElevationType (optional)
+        //   [IN] uint32 MaxResultAge (optional)
 
         // Validate that we have mandatory arguments
         if ( !in.Command_exists() || 0 == strlen(in.Command_value().Str()) || !in.timeout_exists() )
@@ -539,7 +730,10 @@ static void Invoke_ExecuteCommand_ThreadBody(SCXCoreLib::SCXThreadParamHandle& p
         bool cmdok;
 
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand - Executing command: " + command);
-        cmdok = SCXCore::g_RunAsProvider.ExecuteCommand(command, returnOut, returnErr, returnCode, in.timeout_value(), elevation);
+        unsigned maxResultAge = in.MaxResultAge_exists() ? in.MaxResultAge_value() : 0;
+        SCXCore::ChildResourceUsage usage;
+        cmdok = SCXCore::g_RunAsProvider.ExecuteCommand(command, returnOut, returnErr, returnCode, in.timeout_value(), elevation,
+                                                        maxResultAge, &usage);
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand - Finished executing: " + command);
 
         // Pass the results back up the chain
@@ -549,11 +743,12 @@ static void Invoke_ExecuteCommand_ThreadBody(SCXCoreLib::SCXThreadParamHandle& p
         inst.ReturnCode_value( returnCode );
         inst.StdOut_value( StrToMultibyte(returnOut).c_str() );
         inst.StdErr_value( StrToMultibyte(returnErr).c_str() );
+        inst.ResourceUsage_value( StrToMultibyte(usage.Format()).c_str() );
         inst.MIReturn_value( cmdok );
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     } 
-    SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand", log );
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand", log );
 }
 
 void SCX_OperatingSystem_Class_Provider::Invoke_ExecuteCommand(
@@ -591,7 +786,7 @@ static void Invoke_ExecuteShellCommand_ThreadBody(SCXCoreLib::SCXThreadParamHand
     Context& context = params->GetContext();
     const SCX_OperatingSystem_ExecuteShellCommand_Class& in = params->GetInput();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand" )
     {
         // We specifically do not lock here; we want multiple instances to run
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand" )
@@ -646,7 +841,9 @@ static void Invoke_ExecuteShellCommand_ThreadBody(SCXCoreLib::SCXThreadParamHand
         bool cmdok;
 
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand - Executing command: " + command);
-        cmdok = SCXCore::g_RunAsProvider.ExecuteShellCommand(command, returnOut, returnErr, returnCode, in.timeout_value(), elevation);
+        SCXCore::ChildResourceUsage usage;
+        cmdok = SCXCore::g_RunAsProvider.ExecuteShellCommand(command, returnOut, returnErr, returnCode, in.timeout_value(), elevation,
+                                                             &usage);
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand - Finished executing: " + command);
 
         // Pass the results back up the chain
@@ -656,11 +853,12 @@ static void Invoke_ExecuteShellCommand_ThreadBody(SCXCoreLib::SCXThreadParamHand
         inst.ReturnCode_value( returnCode );
         inst.StdOut_value( StrToMultibyte(returnOut).c_str() );
         inst.StdErr_value( StrToMultibyte(returnErr).c_str() );
+        inst.ResourceUsage_value( StrToMultibyte(usage.Format()).c_str() );
         inst.MIReturn_value( cmdok );
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand", log );
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand", log );
 }
 
 void SCX_OperatingSystem_Class_Provider::Invoke_ExecuteShellCommand(
@@ -696,7 +894,7 @@ static void Invoke_ExecuteScript_ThreadBody(SCXCoreLib::SCXThreadParamHandle& pa
     Context& context = params->GetContext();
     const SCX_OperatingSystem_ExecuteScript_Class& in = params->GetInput();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript" )
     {
         // We specifically do not lock here; we want multiple instances to run
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript" )
@@ -763,7 +961,9 @@ static void Invoke_ExecuteScript_ThreadBody(SCXCoreLib::SCXThreadParamHandle& pa
         }
 
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript - Executing script: " + strScript);
-        bool cmdok = SCXCore::g_RunAsProvider.ExecuteScript(strScript, strArgs, returnOut, returnErr, returnCode, in.timeout_value(), elevation);
+        SCXCore::ChildResourceUsage usage;
+        bool cmdok = SCXCore::g_RunAsProvider.ExecuteScript(strScript, strArgs, returnOut, returnErr, returnCode, in.timeout_value(), elevation,
+                                                            &usage);
         SCX_LOGTRACE( log, L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript - Finshed executing: " + strScript);
 
         SCX_OperatingSystem_ExecuteScript_Class inst;
@@ -771,11 +971,12 @@ static void Invoke_ExecuteScript_ThreadBody(SCXCoreLib::SCXThreadParamHandle& pa
         inst.ReturnCode_value( returnCode );
         inst.StdOut_value( StrToMultibyte(returnOut).c_str() );
         inst.StdErr_value( StrToMultibyte(returnErr).c_str() );
+        inst.ResourceUsage_value( StrToMultibyte(usage.Format()).c_str() );
         inst.MIReturn_value( cmdok );
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript", log );
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript", log );
 }
 
 void SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript(
@@ -794,4 +995,28 @@ void SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript(
     SCX_PEX_END( L"SCX_OperatingSystem_Class_Provider::Invoke_ExecuteScript", log );
 }
 
+void SCX_OperatingSystem_Class_Provider::Invoke_GetSystemSnapshot(
+    Context& context,
+    const String& nameSpace,
+    const SCX_OperatingSystem_Class& instanceName,
+    const SCX_OperatingSystem_GetSystemSnapshot_Class& in)
+{
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_SystemSnapshot.GetLogHandle();
+
+    SCX_PEX_BEGIN_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_GetSystemSnapshot" )
+    {
+        // Takes the provider locks itself (in a fixed order)
+        SystemSnapshotInstances instances;
+        SCXCalendarTime timestamp = SCXCore::g_SystemSnapshot.Take(L"SCX_OperatingSystem", instances);
+
+        SCX_OperatingSystem_GetSystemSnapshot_Class inst;
+        inst.Timestamp_value( StrToUTF8(timestamp.ToExtendedISO8601()).c_str() );
+        instances.SetOutputs( inst );
+        inst.MIReturn_value( true );
+        context.Post(inst);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END_TIMED( L"SCX_OperatingSystem_Class_Provider::Invoke_GetSystemSnapshot", log );
+}
+
 MI_END_NAMESPACE
@@ -100,6 +100,12 @@ public:
         const SCX_OperatingSystem_Class& instanceName,
         const SCX_OperatingSystem_ExecuteScript_Class& in);
 
+    void Invoke_GetSystemSnapshot(
+        Context& context,
+        const String& nameSpace,
+        const SCX_OperatingSystem_Class& instanceName,
+        const SCX_OperatingSystem_GetSystemSnapshot_Class& in);
+
 /* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
 };
 
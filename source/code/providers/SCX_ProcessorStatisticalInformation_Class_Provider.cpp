@@ -19,62 +19,12 @@
 #include <scxcorelib/stringaid.h>
 #include <scxsystemlib/cpuenumeration.h>
 
-#include "support/startuplog.h"
+#include "support/cpuprovider.h"
 #include "support/scxcimutils.h"
 
 using namespace SCXSystemLib;
 using namespace SCXCoreLib;
 
-namespace
-{
-    class CPUProvider
-    {
-    public:
-        virtual ~CPUProvider() { };
-        void Load()
-        {
-            if ( 1 == ++ms_loadCount )
-            {
-                m_log = SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.cpuprovider");
-                SCXCore::LogStartup();
-                SCX_LOGTRACE(m_log, L"CPUProvider::Load()");
-
-                m_cpusEnum = new CPUEnumeration();
-                m_cpusEnum->Init();
-            }
-        }
-
-        void Unload()
-        {
-            SCX_LOGTRACE(m_log, L"CPUProvider::Unload()");
-            if (0 == --ms_loadCount)
-            {
-                if (m_cpusEnum != NULL)
-                {
-                    m_cpusEnum->CleanUp();
-                    m_cpusEnum == NULL;
-                }
-            }
-        }
-
-        SCXCoreLib::SCXHandle<SCXSystemLib::CPUEnumeration> GetEnumCPUs() const
-        {
-            return m_cpusEnum;
-        }
-
-        SCXLogHandle& GetLogHandle() { return m_log; }
-
-    private:
-        //! PAL implementation retrieving CPU information for local host
-        SCXCoreLib::SCXHandle<SCXSystemLib::CPUEnumeration> m_cpusEnum;
-        SCXCoreLib::SCXLogHandle m_log;
-        static int ms_loadCount;
-    };
-    CPUProvider g_CPUProvider;
-    int CPUProvider::ms_loadCount = 0;
-
-}
-
 MI_BEGIN_NAMESPACE
 
 static void EnumerateOneInstance(
@@ -156,19 +106,19 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::Load(
     {
         // Global lock for CPUProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
-        g_CPUProvider.Load();
+        SCXCore::g_CPUProvider.Load();
 
         // Notify that we don't wish to unload
         MI_Result r = context.RefuseUnload();
         if ( MI_RESULT_OK != r )
         {
-            SCX_LOGWARNING(g_CPUProvider.GetLogHandle(),
+            SCX_LOGWARNING(SCXCore::g_CPUProvider.GetLogHandle(),
                 SCXCoreLib::StrAppend(L"SCX_ProcessorStatisticalInformation_Class_Provider::Load() refuses to not unload, error = ", r));
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider::Load", g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider::Load", SCXCore::g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_ProcessorStatisticalInformation_Class_Provider::Unload(
@@ -177,11 +127,11 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::Unload(
     SCX_PEX_BEGIN
     {
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
-        g_CPUProvider.Unload();
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+        SCXCore::g_CPUProvider.Unload();
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider:::Unload", g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider::Unload", SCXCore::g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
@@ -191,14 +141,17 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_CPUProvider.WarmUp(L"SCX_ProcessorStatisticalInformation");
+
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
 
         // Prepare ProcessorStatisticalInformation Enumeration
         // (Note: Only do full update if we're not enumerating keys)
-        SCXHandle<SCXSystemLib::CPUEnumeration> cpuEnum = g_CPUProvider.GetEnumCPUs();
+        SCXHandle<SCXSystemLib::CPUEnumeration> cpuEnum = SCXCore::g_CPUProvider.GetEnumCPUs(L"SCX_ProcessorStatisticalInformation");
         cpuEnum->Update(!keysOnly);
 
         for(size_t i = 0; i < cpuEnum->Size(); i++)
@@ -206,6 +159,7 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
             SCX_ProcessorStatisticalInformation_Class inst;
             SCXHandle<SCXSystemLib::CPUInstance> cpuInst = cpuEnum->GetInstance(i);
             EnumerateOneInstance(context, inst, keysOnly, cpuInst);
+            scxPexTimer.AddInstances(1);
         }
 
         // Enumerate Total instance
@@ -215,12 +169,13 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
             // There will always be one total instance
             SCX_ProcessorStatisticalInformation_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, totalInst);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances",
-                     g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_ProcessorStatisticalInformation_Class_Provider::EnumerateInstances",
+                           SCXCore::g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance(
@@ -229,12 +184,15 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance(
     const SCX_ProcessorStatisticalInformation_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance" )
     {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_CPUProvider.WarmUp(L"SCX_ProcessorStatisticalInformation");
+
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
 
-        SCXHandle<SCXSystemLib::CPUEnumeration> cpuEnum = g_CPUProvider.GetEnumCPUs();
+        SCXHandle<SCXSystemLib::CPUEnumeration> cpuEnum = SCXCore::g_CPUProvider.GetEnumCPUs(L"SCX_ProcessorStatisticalInformation");
         cpuEnum->Update(true);
 
         const std::string name = instanceName.Name_value().Str();
@@ -282,8 +240,8 @@ void SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance(
         EnumerateOneInstance(context, inst, false, cpuInst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance",
-                    g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_ProcessorStatisticalInformation_Class_Provider::GetInstance",
+                          SCXCore::g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_ProcessorStatisticalInformation_Class_Provider::CreateInstance(
@@ -190,7 +190,7 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::Load(
     SCX_PEX_BEGIN
     {
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
         g_CPUProvider.Load();
 
         // Notify that we don't wish to unload
@@ -212,11 +212,11 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::Unload(
     SCX_PEX_BEGIN
     {
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
         g_CPUProvider.Unload();
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_RTProcessorStatisticalInformation_Class_Provider:::Unload", g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END( L"SCX_RTProcessorStatisticalInformation_Class_Provider::Unload", g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
@@ -226,10 +226,10 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
 
         // Prepare ProcessorStatisticalInformation Enumeration
         // (Note: Only do full update if we're not enumerating keys)
@@ -241,6 +241,7 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
             SCX_RTProcessorStatisticalInformation_Class inst;
             SCXHandle<SCXSystemLib::CPUInstance> cpuInst = cpuEnum->GetInstance(i);
             EnumerateOneInstance(context, inst, keysOnly, cpuInst);
+            scxPexTimer.AddInstances(1);
         }
 
         // Enumerate Total instance
@@ -250,12 +251,13 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances(
             // There will always be one total instance
             SCX_RTProcessorStatisticalInformation_Class inst;
             EnumerateOneInstance(context, inst, keysOnly, totalInst);
+            scxPexTimer.AddInstances(1);
         }
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances",
-                     g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_RTProcessorStatisticalInformation_Class_Provider::EnumerateInstances",
+                           g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance(
@@ -264,10 +266,10 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance(
     const SCX_RTProcessorStatisticalInformation_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance" )
     {
         // Global lock for CPUProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"CPUProvider::Lock"));
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
 
         SCXHandle<SCXSystemLib::CPUEnumeration> cpuEnum = g_CPUProvider.GetEnumCPUs();
         cpuEnum->Update(true);
@@ -317,8 +319,8 @@ void SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance(
         EnumerateOneInstance(context, inst, false, cpuInst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance",
-                    g_CPUProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_RTProcessorStatisticalInformation_Class_Provider::GetInstance",
+                          g_CPUProvider.GetLogHandle() );
 }
 
 void SCX_RTProcessorStatisticalInformation_Class_Provider::CreateInstance(
@@ -0,0 +1,918 @@
+/* @migen@ */
+/*
+**==============================================================================
+**
+** WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. PLEASE DO NOT EDIT.
+**
+**==============================================================================
+*/
+#ifndef _SCX_StatisticalThresholdIndication_h
+#define _SCX_StatisticalThresholdIndication_h
+
+#include <MI.h>
+#include "CIM_Indication.h"
+
+/*
+**==============================================================================
+**
+** SCX_StatisticalThresholdIndication [SCX_StatisticalThresholdIndication]
+**
+** Keys:
+**
+**==============================================================================
+*/
+
+typedef struct _SCX_StatisticalThresholdIndication /* extends CIM_Indication */
+{
+    MI_Instance __instance;
+    /* CIM_Indication properties */
+    MI_ConstStringField IndicationIdentifier;
+    MI_ConstStringAField CorrelatedIndications;
+    MI_ConstDatetimeField IndicationTime;
+    MI_ConstUint16Field PerceivedSeverity;
+    MI_ConstStringField OtherSeverity;
+    MI_ConstStringField IndicationFilterName;
+    MI_ConstStringField SequenceContext;
+    MI_ConstSint64Field SequenceNumber;
+    /* SCX_StatisticalThresholdIndication properties */
+    MI_ConstStringField SourceClass;
+    MI_ConstStringField Name;
+    MI_ConstStringField PropertyName;
+    MI_ConstReal64Field Threshold;
+    MI_ConstReal64Field Value;
+    MI_ConstUint32Field Samples;
+    MI_ConstBooleanField Exceeded;
+}
+SCX_StatisticalThresholdIndication;
+
+typedef struct _SCX_StatisticalThresholdIndication_Ref
+{
+    SCX_StatisticalThresholdIndication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_StatisticalThresholdIndication_Ref;
+
+typedef struct _SCX_StatisticalThresholdIndication_ConstRef
+{
+    MI_CONST SCX_StatisticalThresholdIndication* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_StatisticalThresholdIndication_ConstRef;
+
+typedef struct _SCX_StatisticalThresholdIndication_Array
+{
+    struct _SCX_StatisticalThresholdIndication** data;
+    MI_Uint32 size;
+}
+SCX_StatisticalThresholdIndication_Array;
+
+typedef struct _SCX_StatisticalThresholdIndication_ConstArray
+{
+    struct _SCX_StatisticalThresholdIndication MI_CONST* MI_CONST* data;
+    MI_Uint32 size;
+}
+SCX_StatisticalThresholdIndication_ConstArray;
+
+typedef struct _SCX_StatisticalThresholdIndication_ArrayRef
+{
+    SCX_StatisticalThresholdIndication_Array value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_StatisticalThresholdIndication_ArrayRef;
+
+typedef struct _SCX_StatisticalThresholdIndication_ConstArrayRef
+{
+    SCX_StatisticalThresholdIndication_ConstArray value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+SCX_StatisticalThresholdIndication_ConstArrayRef;
+
+MI_EXTERN_C MI_CONST MI_ClassDecl SCX_StatisticalThresholdIndication_rtti;
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Construct(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Context* context)
+{
+    return MI_ConstructInstance(context, &SCX_StatisticalThresholdIndication_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clone(
+    const SCX_StatisticalThresholdIndication* self,
+    SCX_StatisticalThresholdIndication** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Boolean MI_CALL SCX_StatisticalThresholdIndication_IsA(
+    const MI_Instance* self)
+{
+    MI_Boolean res = MI_FALSE;
+    return MI_Instance_IsA(self, &SCX_StatisticalThresholdIndication_rtti, &res) == MI_RESULT_OK && res;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Destruct(SCX_StatisticalThresholdIndication* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Delete(SCX_StatisticalThresholdIndication* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Post(
+    const SCX_StatisticalThresholdIndication* self,
+    MI_Context* context,
+    MI_Uint32 subscriptionIDCount,
+    const MI_Char* bookmark)
+{
+    return MI_PostIndication(context, &self->__instance, subscriptionIDCount, bookmark);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_IndicationIdentifier(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_IndicationIdentifier(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_IndicationIdentifier(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_CorrelatedIndications(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_CorrelatedIndications(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_CorrelatedIndications(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_IndicationTime(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->IndicationTime)->value = x;
+    ((MI_DatetimeField*)&self->IndicationTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_IndicationTime(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->IndicationTime, 0, sizeof(self->IndicationTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_PerceivedSeverity(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Uint16 x)
+{
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->value = x;
+    ((MI_Uint16Field*)&self->PerceivedSeverity)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_PerceivedSeverity(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->PerceivedSeverity, 0, sizeof(self->PerceivedSeverity));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_OtherSeverity(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_OtherSeverity(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_OtherSeverity(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_IndicationFilterName(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_IndicationFilterName(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_IndicationFilterName(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_SequenceContext(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_SequenceContext(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_SequenceContext(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_SequenceNumber(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Sint64 x)
+{
+    ((MI_Sint64Field*)&self->SequenceNumber)->value = x;
+    ((MI_Sint64Field*)&self->SequenceNumber)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_SequenceNumber(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->SequenceNumber, 0, sizeof(self->SequenceNumber));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_SourceClass(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_SourceClass(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_SourceClass(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_Name(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        9,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_Name(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        9,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_Name(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        9);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_PropertyName(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        10,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_SetPtr_PropertyName(
+    SCX_StatisticalThresholdIndication* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        10,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_PropertyName(
+    SCX_StatisticalThresholdIndication* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        10);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_Threshold(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Real64 x)
+{
+    ((MI_Real64Field*)&self->Threshold)->value = x;
+    ((MI_Real64Field*)&self->Threshold)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_Threshold(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->Threshold, 0, sizeof(self->Threshold));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_Value(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Real64 x)
+{
+    ((MI_Real64Field*)&self->Value)->value = x;
+    ((MI_Real64Field*)&self->Value)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_Value(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->Value, 0, sizeof(self->Value));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_Samples(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->Samples)->value = x;
+    ((MI_Uint32Field*)&self->Samples)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_Samples(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->Samples, 0, sizeof(self->Samples));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Set_Exceeded(
+    SCX_StatisticalThresholdIndication* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->Exceeded)->value = x;
+    ((MI_BooleanField*)&self->Exceeded)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_StatisticalThresholdIndication_Clear_Exceeded(
+    SCX_StatisticalThresholdIndication* self)
+{
+    memset((void*)&self->Exceeded, 0, sizeof(self->Exceeded));
+    return MI_RESULT_OK;
+}
+
+/*
+**==============================================================================
+**
+** SCX_StatisticalThresholdIndication provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _SCX_StatisticalThresholdIndication_Self SCX_StatisticalThresholdIndication_Self;
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Load(
+    SCX_StatisticalThresholdIndication_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Unload(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_EnableIndications(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className);
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_DisableIndications(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className);
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Subscribe(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Filter* filter,
+    const MI_Char* bookmark,
+    MI_Uint64  subscriptionID,
+    void** subscriptionSelf);
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Unsubscribe(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    MI_Uint64  subscriptionID,
+    void* subscriptionSelf);
+
+
+/*
+**==============================================================================
+**
+** SCX_StatisticalThresholdIndication_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class SCX_StatisticalThresholdIndication_Class : public CIM_Indication_Class
+{
+public:
+    
+    typedef SCX_StatisticalThresholdIndication Self;
+    
+    SCX_StatisticalThresholdIndication_Class() :
+        CIM_Indication_Class(&SCX_StatisticalThresholdIndication_rtti)
+    {
+    }
+    
+    SCX_StatisticalThresholdIndication_Class(
+        const SCX_StatisticalThresholdIndication* instanceName,
+        bool keysOnly) :
+        CIM_Indication_Class(
+            &SCX_StatisticalThresholdIndication_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_StatisticalThresholdIndication_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_Indication_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_StatisticalThresholdIndication_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_Indication_Class(clDecl)
+    {
+    }
+    
+    SCX_StatisticalThresholdIndication_Class& operator=(
+        const SCX_StatisticalThresholdIndication_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_StatisticalThresholdIndication_Class(
+        const SCX_StatisticalThresholdIndication_Class& x) :
+        CIM_Indication_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &SCX_StatisticalThresholdIndication_rtti;
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.SourceClass
+    //
+    
+    const Field<String>& SourceClass() const
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        return GetField<String>(n);
+    }
+    
+    void SourceClass(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        GetField<String>(n) = x;
+    }
+    
+    const String& SourceClass_value() const
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        return GetField<String>(n).value;
+    }
+    
+    void SourceClass_value(const String& x)
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool SourceClass_exists() const
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void SourceClass_clear()
+    {
+        const size_t n = offsetof(Self, SourceClass);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.Name
+    //
+    
+    const Field<String>& Name() const
+    {
+        const size_t n = offsetof(Self, Name);
+        return GetField<String>(n);
+    }
+    
+    void Name(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, Name);
+        GetField<String>(n) = x;
+    }
+    
+    const String& Name_value() const
+    {
+        const size_t n = offsetof(Self, Name);
+        return GetField<String>(n).value;
+    }
+    
+    void Name_value(const String& x)
+    {
+        const size_t n = offsetof(Self, Name);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool Name_exists() const
+    {
+        const size_t n = offsetof(Self, Name);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void Name_clear()
+    {
+        const size_t n = offsetof(Self, Name);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.PropertyName
+    //
+    
+    const Field<String>& PropertyName() const
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        return GetField<String>(n);
+    }
+    
+    void PropertyName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& PropertyName_value() const
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        return GetField<String>(n).value;
+    }
+    
+    void PropertyName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool PropertyName_exists() const
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void PropertyName_clear()
+    {
+        const size_t n = offsetof(Self, PropertyName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.Threshold
+    //
+    
+    const Field<Real64>& Threshold() const
+    {
+        const size_t n = offsetof(Self, Threshold);
+        return GetField<Real64>(n);
+    }
+    
+    void Threshold(const Field<Real64>& x)
+    {
+        const size_t n = offsetof(Self, Threshold);
+        GetField<Real64>(n) = x;
+    }
+    
+    const Real64& Threshold_value() const
+    {
+        const size_t n = offsetof(Self, Threshold);
+        return GetField<Real64>(n).value;
+    }
+    
+    void Threshold_value(const Real64& x)
+    {
+        const size_t n = offsetof(Self, Threshold);
+        GetField<Real64>(n).Set(x);
+    }
+    
+    bool Threshold_exists() const
+    {
+        const size_t n = offsetof(Self, Threshold);
+        return GetField<Real64>(n).exists ? true : false;
+    }
+    
+    void Threshold_clear()
+    {
+        const size_t n = offsetof(Self, Threshold);
+        GetField<Real64>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.Value
+    //
+    
+    const Field<Real64>& Value() const
+    {
+        const size_t n = offsetof(Self, Value);
+        return GetField<Real64>(n);
+    }
+    
+    void Value(const Field<Real64>& x)
+    {
+        const size_t n = offsetof(Self, Value);
+        GetField<Real64>(n) = x;
+    }
+    
+    const Real64& Value_value() const
+    {
+        const size_t n = offsetof(Self, Value);
+        return GetField<Real64>(n).value;
+    }
+    
+    void Value_value(const Real64& x)
+    {
+        const size_t n = offsetof(Self, Value);
+        GetField<Real64>(n).Set(x);
+    }
+    
+    bool Value_exists() const
+    {
+        const size_t n = offsetof(Self, Value);
+        return GetField<Real64>(n).exists ? true : false;
+    }
+    
+    void Value_clear()
+    {
+        const size_t n = offsetof(Self, Value);
+        GetField<Real64>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.Samples
+    //
+    
+    const Field<Uint32>& Samples() const
+    {
+        const size_t n = offsetof(Self, Samples);
+        return GetField<Uint32>(n);
+    }
+    
+    void Samples(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, Samples);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& Samples_value() const
+    {
+        const size_t n = offsetof(Self, Samples);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void Samples_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, Samples);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool Samples_exists() const
+    {
+        const size_t n = offsetof(Self, Samples);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void Samples_clear()
+    {
+        const size_t n = offsetof(Self, Samples);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // SCX_StatisticalThresholdIndication_Class.Exceeded
+    //
+    
+    const Field<Boolean>& Exceeded() const
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        return GetField<Boolean>(n);
+    }
+    
+    void Exceeded(const Field<Boolean>& x)
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        GetField<Boolean>(n) = x;
+    }
+    
+    const Boolean& Exceeded_value() const
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        return GetField<Boolean>(n).value;
+    }
+    
+    void Exceeded_value(const Boolean& x)
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        GetField<Boolean>(n).Set(x);
+    }
+    
+    bool Exceeded_exists() const
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        return GetField<Boolean>(n).exists ? true : false;
+    }
+    
+    void Exceeded_clear()
+    {
+        const size_t n = offsetof(Self, Exceeded);
+        GetField<Boolean>(n).Clear();
+    }
+};
+
+typedef Array<SCX_StatisticalThresholdIndication_Class> SCX_StatisticalThresholdIndication_ClassA;
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _SCX_StatisticalThresholdIndication_h */
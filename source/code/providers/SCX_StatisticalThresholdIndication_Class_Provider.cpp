@@ -0,0 +1,219 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        SCX_StatisticalThresholdIndication_Class_Provider.cpp
+
+    \brief       Provider support using OMI framework.
+
+    \date        2026-10-19 23:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+/* @migen@ */
+#include <MI.h>
+#include "SCX_StatisticalThresholdIndication_Class_Provider.h"
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "support/indicationsubscriptions.h"
+#include "support/osprovider.h"
+#include "support/scxcimutils.h"
+#include "support/systemsnapshot.h"
+#include "support/thresholdmonitor.h"
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    /**
+       Sets the properties of a state change on an
+       SCX_StatisticalThresholdIndication, and posts it.
+    */
+    class ThresholdChangeIndicationBuilder : public SCXCore::IndicationBuilder
+    {
+    public:
+        ThresholdChangeIndicationBuilder(const SCXCore::ThresholdChange& change) : m_change(change) { }
+
+        virtual MI_Result Post(MI_Context* context, const MI_Datetime& indicationTime, MI_Sint64 sequenceNumber)
+        {
+            SCX_StatisticalThresholdIndication inst;
+            MI_Result r = SCX_StatisticalThresholdIndication_Construct(&inst, context);
+            if (MI_RESULT_OK != r)
+            {
+                return r;
+            }
+
+            SCX_StatisticalThresholdIndication_Set_IndicationTime(&inst, indicationTime);
+            SCX_StatisticalThresholdIndication_Set_SequenceNumber(&inst, sequenceNumber);
+            SCX_StatisticalThresholdIndication_Set_SourceClass(&inst, StrToUTF8(m_change.sourceClass).c_str());
+            SCX_StatisticalThresholdIndication_Set_Name(&inst, StrToUTF8(m_change.name).c_str());
+            SCX_StatisticalThresholdIndication_Set_PropertyName(&inst, StrToUTF8(m_change.property).c_str());
+            SCX_StatisticalThresholdIndication_Set_Threshold(&inst, m_change.threshold);
+            SCX_StatisticalThresholdIndication_Set_Value(&inst, m_change.value);
+            SCX_StatisticalThresholdIndication_Set_Samples(&inst, m_change.samples);
+            SCX_StatisticalThresholdIndication_Set_Exceeded(&inst, m_change.exceeded ? MI_TRUE : MI_FALSE);
+
+            r = SCX_StatisticalThresholdIndication_Post(&inst, context, 0, NULL);
+            SCX_StatisticalThresholdIndication_Destruct(&inst);
+            return r;
+        }
+
+    private:
+        const SCXCore::ThresholdChange& m_change;   //!< The state change
+    };
+
+    SCXCore::IndicationSubscriptions s_subscriptions(L"SCX_StatisticalThresholdIndication");
+
+    /**
+       Posts the state changes of the threshold monitor, each on the context
+       of its subscription.
+    */
+    class ThresholdChangePoster : public SCXCore::ThresholdSink
+    {
+    public:
+        virtual void PostChange(scxulong subscriptionID, const SCXCore::ThresholdChange& change)
+        {
+            ThresholdChangeIndicationBuilder builder(change);
+            s_subscriptions.Post(subscriptionID, builder);
+        }
+    };
+
+    ThresholdChangePoster s_poster;
+    SCXCore::ThresholdMonitor s_monitor(&s_poster);
+}
+
+MI_BEGIN_NAMESPACE
+
+SCX_StatisticalThresholdIndication_Class_Provider::SCX_StatisticalThresholdIndication_Class_Provider(
+    Module* module) :
+    m_Module(module)
+{
+}
+
+SCX_StatisticalThresholdIndication_Class_Provider::~SCX_StatisticalThresholdIndication_Class_Provider()
+{
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::Load(
+        Context& context)
+{
+    SCX_PEX_BEGIN
+    {
+        // The classes sampled are those of the system snapshot, SCX_OperatingSystem included
+        SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
+        SCXCore::g_OSProvider.Load();
+        SCXCore::g_SystemSnapshot.Load();
+
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::Load", SCXCore::g_SystemSnapshot.GetLogHandle() );
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::Unload(
+        Context& context)
+{
+    SCX_PEX_BEGIN
+    {
+        s_monitor.Stop();
+
+        SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
+        SCXCore::g_SystemSnapshot.Unload();
+        SCXCore::g_OSProvider.Unload();
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::Unload", SCXCore::g_SystemSnapshot.GetLogHandle() );
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::EnableIndications(
+    MI_Context* indicationsContext,
+    const String& nameSpace,
+    const String& className)
+{
+    Context context(indicationsContext);
+
+    SCX_PEX_BEGIN
+    {
+        // The indications context stays open until DisableIndications
+        s_subscriptions.Enable(s_monitor);
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::EnableIndications", SCXCore::g_SystemSnapshot.GetLogHandle() );
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::DisableIndications(
+    MI_Context* indicationsContext,
+    const String& nameSpace,
+    const String& className)
+{
+    Context context(indicationsContext);
+
+    SCX_PEX_BEGIN
+    {
+        s_subscriptions.Disable(s_monitor);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::DisableIndications", SCXCore::g_SystemSnapshot.GetLogHandle() );
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::Subscribe(
+    MI_Context* subscriptionContext,
+    const String& nameSpace,
+    const MI_Filter* filter,
+    const String& bookmark,
+    MI_Uint64 subscriptionID,
+    void** subscriptionSelf)
+{
+    Context context(subscriptionContext);
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_SystemSnapshot.GetLogHandle();
+
+    SCX_PEX_BEGIN
+    {
+        std::wstring expression;
+        MI_Result r = s_subscriptions.GetFilterExpression(filter, expression);
+        if (MI_RESULT_OK != r)
+        {
+            context.Post(r);
+            return;
+        }
+
+        SCXCore::ThresholdCondition condition;
+        try
+        {
+            SCXCore::ThresholdMonitor::ParseFilter(expression, condition);
+        }
+        catch (SCXNotSupportedException& e)
+        {
+            SCX_LOGWARNING(log, L"SCX_StatisticalThresholdIndication_Class_Provider::Subscribe - " + e.What());
+            context.Post(MI_RESULT_INVALID_QUERY);
+            return;
+        }
+
+        s_subscriptions.Add(subscriptionID, subscriptionContext);
+        s_monitor.Subscribe(subscriptionID, condition);
+
+        // The subscription context stays open: state changes are posted on it until Unsubscribe
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::Subscribe", log );
+}
+
+void SCX_StatisticalThresholdIndication_Class_Provider::Unsubscribe(
+    MI_Context* unsubscribeContext,
+    const String& nameSpace,
+    MI_Uint64 subscriptionID,
+    void* subscriptionSelf)
+{
+    Context context(unsubscribeContext);
+
+    SCX_PEX_BEGIN
+    {
+        s_subscriptions.Unsubscribe(s_monitor, subscriptionID);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END( L"SCX_StatisticalThresholdIndication_Class_Provider::Unsubscribe", SCXCore::g_SystemSnapshot.GetLogHandle() );
+}
+
+MI_END_NAMESPACE
@@ -0,0 +1,69 @@
+/* @migen@ */
+#ifndef _SCX_StatisticalThresholdIndication_Class_Provider_h
+#define _SCX_StatisticalThresholdIndication_Class_Provider_h
+
+#include "SCX_StatisticalThresholdIndication.h"
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+# include "module.h"
+
+MI_BEGIN_NAMESPACE
+
+/*
+**==============================================================================
+**
+** SCX_StatisticalThresholdIndication provider class declaration
+**
+**==============================================================================
+*/
+
+class SCX_StatisticalThresholdIndication_Class_Provider
+{
+/* @MIGEN.BEGIN@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+private:
+    Module* m_Module;
+
+public:
+    SCX_StatisticalThresholdIndication_Class_Provider(
+        Module* module);
+
+    ~SCX_StatisticalThresholdIndication_Class_Provider();
+
+    void Load(
+        Context& context);
+
+    void Unload(
+        Context& context);
+
+    void EnableIndications(
+        MI_Context* indicationsContext,
+        const String& nameSpace,
+        const String& className);
+
+    void DisableIndications(
+        MI_Context* indicationsContext,
+        const String& nameSpace,
+        const String& className);
+
+    void Subscribe(
+        MI_Context* context,
+        const String& nameSpace,
+        const MI_Filter* filter,
+        const String& bookmark,
+        MI_Uint64 subscriptionID,
+        void** subscriptionSelf);
+
+    void Unsubscribe(
+        MI_Context* context,
+        const String& nameSpace,
+        MI_Uint64 subscriptionID,
+        void* subscriptionSelf);
+
+/* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+};
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _SCX_StatisticalThresholdIndication_Class_Provider_h */
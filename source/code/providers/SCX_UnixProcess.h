@@ -1601,252 +1601,2364 @@ MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumers_Clear_elevation
 /*
 **==============================================================================
 **
-** SCX_UnixProcess provider function prototypes
+** SCX_UnixProcess.TopResourceConsumerValues()
 **
 **==============================================================================
 */
 
-/* The developer may optionally define this structure */
-typedef struct _SCX_UnixProcess_Self SCX_UnixProcess_Self;
+typedef struct _SCX_UnixProcess_TopResourceConsumerValues
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstBooleanField MIReturn;
+    /*IN*/ MI_ConstStringField resource;
+    /*IN*/ MI_ConstUint16Field count;
+    /*IN*/ MI_ConstUint64Field threshold;
+    /*OUT*/ MI_ConstUint64AField PIDs;
+    /*OUT*/ MI_ConstStringAField Names;
+    /*OUT*/ MI_ConstUint64AField Values;
+}
+SCX_UnixProcess_TopResourceConsumerValues;
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_Load(
-    SCX_UnixProcess_Self** self,
-    MI_Module_Self* selfModule,
-    MI_Context* context);
+MI_EXTERN_C MI_CONST MI_MethodDecl SCX_UnixProcess_TopResourceConsumerValues_rtti;
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_Unload(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Construct(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &SCX_UnixProcess_TopResourceConsumerValues_rtti,
+        (MI_Instance*)&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_EnumerateInstances(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_PropertySet* propertySet,
-    MI_Boolean keysOnly,
-    const MI_Filter* filter);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clone(
+    const SCX_UnixProcess_TopResourceConsumerValues* self,
+    SCX_UnixProcess_TopResourceConsumerValues** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_GetInstance(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_UnixProcess* instanceName,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Destruct(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_CreateInstance(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_UnixProcess* newInstance);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Delete(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_ModifyInstance(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_UnixProcess* modifiedInstance,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Post(
+    const SCX_UnixProcess_TopResourceConsumerValues* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_DeleteInstance(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const SCX_UnixProcess* instanceName);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_MIReturn(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->MIReturn)->value = x;
+    ((MI_BooleanField*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_RequestStateChange(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_UnixProcess* instanceName,
-    const SCX_UnixProcess_RequestStateChange* in);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_MIReturn(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_TopResourceConsumers(
-    SCX_UnixProcess_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const SCX_UnixProcess* instanceName,
-    const SCX_UnixProcess_TopResourceConsumers* in);
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_resource(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_SetPtr_resource(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_resource(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_count(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    MI_Uint16 x)
+{
+    ((MI_Uint16Field*)&self->count)->value = x;
+    ((MI_Uint16Field*)&self->count)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_count(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    memset((void*)&self->count, 0, sizeof(self->count));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_threshold(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->threshold)->value = x;
+    ((MI_Uint64Field*)&self->threshold)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_threshold(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    memset((void*)&self->threshold, 0, sizeof(self->threshold));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_PIDs(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_SetPtr_PIDs(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_PIDs(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_Names(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_SetPtr_Names(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_Names(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Set_Values(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_SetPtr_Values(
+    SCX_UnixProcess_TopResourceConsumerValues* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_TopResourceConsumerValues_Clear_Values(
+    SCX_UnixProcess_TopResourceConsumerValues* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+/*
+**==============================================================================
+**
+** SCX_UnixProcess.AggregateProcesses()
+**
+**==============================================================================
+*/
+
+typedef struct _SCX_UnixProcess_AggregateProcesses
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstBooleanField MIReturn;
+    /*IN*/ MI_ConstStringField groupBy;
+    /*OUT*/ MI_ConstStringAField Groups;
+    /*OUT*/ MI_ConstUint64AField Counts;
+    /*OUT*/ MI_ConstUint64AField PercentBusyTimes;
+    /*OUT*/ MI_ConstUint64AField UsedMemory;
+    /*OUT*/ MI_ConstUint64AField BlockReadsPerSecond;
+    /*OUT*/ MI_ConstUint64AField BlockWritesPerSecond;
+}
+SCX_UnixProcess_AggregateProcesses;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl SCX_UnixProcess_AggregateProcesses_rtti;
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Construct(
+    SCX_UnixProcess_AggregateProcesses* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &SCX_UnixProcess_AggregateProcesses_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clone(
+    const SCX_UnixProcess_AggregateProcesses* self,
+    SCX_UnixProcess_AggregateProcesses** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Destruct(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Delete(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Post(
+    const SCX_UnixProcess_AggregateProcesses* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_MIReturn(
+    SCX_UnixProcess_AggregateProcesses* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->MIReturn)->value = x;
+    ((MI_BooleanField*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_MIReturn(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_groupBy(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_groupBy(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_groupBy(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_Groups(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_Groups(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_Groups(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_Counts(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_Counts(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_Counts(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        3);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_PercentBusyTimes(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_PercentBusyTimes(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_PercentBusyTimes(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_UsedMemory(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_UsedMemory(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_UsedMemory(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_BlockReadsPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_BlockReadsPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_BlockReadsPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Set_BlockWritesPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_SetPtr_BlockWritesPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_AggregateProcesses_Clear_BlockWritesPerSecond(
+    SCX_UnixProcess_AggregateProcesses* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        7);
+}
+
+/*
+**==============================================================================
+**
+** SCX_UnixProcess.EnumerateChanges()
+**
+**==============================================================================
+*/
+
+typedef struct _SCX_UnixProcess_EnumerateChanges
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstBooleanField MIReturn;
+    /*IN*/ MI_ConstStringField token;
+    /*OUT*/ MI_ConstStringField NextToken;
+    /*OUT*/ MI_ConstBooleanField FullResync;
+    /*OUT*/ MI_ConstUint16AField Changes;
+    /*OUT*/ MI_ConstUint64AField PIDs;
+    /*OUT*/ MI_ConstStringAField StartTimes;
+    /*OUT*/ MI_ConstStringAField Names;
+    /*OUT*/ MI_ConstUint16AField ExecutionStates;
+}
+SCX_UnixProcess_EnumerateChanges;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl SCX_UnixProcess_EnumerateChanges_rtti;
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Construct(
+    SCX_UnixProcess_EnumerateChanges* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &SCX_UnixProcess_EnumerateChanges_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clone(
+    const SCX_UnixProcess_EnumerateChanges* self,
+    SCX_UnixProcess_EnumerateChanges** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Destruct(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Delete(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Post(
+    const SCX_UnixProcess_EnumerateChanges* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_MIReturn(
+    SCX_UnixProcess_EnumerateChanges* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->MIReturn)->value = x;
+    ((MI_BooleanField*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_MIReturn(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_token(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_token(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_token(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_NextToken(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_NextToken(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_NextToken(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_FullResync(
+    SCX_UnixProcess_EnumerateChanges* self,
+    MI_Boolean x)
+{
+    ((MI_BooleanField*)&self->FullResync)->value = x;
+    ((MI_BooleanField*)&self->FullResync)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_FullResync(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    memset((void*)&self->FullResync, 0, sizeof(self->FullResync));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_Changes(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint16* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT16A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_Changes(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint16* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        4,
+        (MI_Value*)&arr,
+        MI_UINT16A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_Changes(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        4);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_PIDs(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_PIDs(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint64* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        5,
+        (MI_Value*)&arr,
+        MI_UINT64A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_PIDs(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        5);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_StartTimes(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_StartTimes(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        6,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_StartTimes(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        6);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_Names(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_Names(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_Names(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        7);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Set_ExecutionStates(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint16* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&arr,
+        MI_UINT16A,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_SetPtr_ExecutionStates(
+    SCX_UnixProcess_EnumerateChanges* self,
+    const MI_Uint16* data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&arr,
+        MI_UINT16A,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL SCX_UnixProcess_EnumerateChanges_Clear_ExecutionStates(
+    SCX_UnixProcess_EnumerateChanges* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
+/*
+**==============================================================================
+**
+** SCX_UnixProcess provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _SCX_UnixProcess_Self SCX_UnixProcess_Self;
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Load(
+    SCX_UnixProcess_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Unload(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_EnumerateInstances(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_GetInstance(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_UnixProcess* instanceName,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_CreateInstance(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_UnixProcess* newInstance);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_ModifyInstance(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_UnixProcess* modifiedInstance,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_DeleteInstance(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const SCX_UnixProcess* instanceName);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_RequestStateChange(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_RequestStateChange* in);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_TopResourceConsumers(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_TopResourceConsumers* in);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_TopResourceConsumerValues(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_TopResourceConsumerValues* in);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_AggregateProcesses(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_AggregateProcesses* in);
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_EnumerateChanges(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_EnumerateChanges* in);
+
+
+/*
+**==============================================================================
+**
+** SCX_UnixProcess_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class SCX_UnixProcess_Class : public CIM_UnixProcess_Class
+{
+public:
+    
+    typedef SCX_UnixProcess Self;
+    
+    SCX_UnixProcess_Class() :
+        CIM_UnixProcess_Class(&SCX_UnixProcess_rtti)
+    {
+    }
+    
+    SCX_UnixProcess_Class(
+        const SCX_UnixProcess* instanceName,
+        bool keysOnly) :
+        CIM_UnixProcess_Class(
+            &SCX_UnixProcess_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_UnixProcess_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_UnixProcess_Class(clDecl)
+    {
+    }
+    
+    SCX_UnixProcess_Class& operator=(
+        const SCX_UnixProcess_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_UnixProcess_Class(
+        const SCX_UnixProcess_Class& x) :
+        CIM_UnixProcess_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &SCX_UnixProcess_rtti;
+    }
+
+    //
+    // SCX_UnixProcess_Class.PercentBusyTime
+    //
+    
+    const Field<Uint8>& PercentBusyTime() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        return GetField<Uint8>(n);
+    }
+    
+    void PercentBusyTime(const Field<Uint8>& x)
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        GetField<Uint8>(n) = x;
+    }
+    
+    const Uint8& PercentBusyTime_value() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        return GetField<Uint8>(n).value;
+    }
+    
+    void PercentBusyTime_value(const Uint8& x)
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        GetField<Uint8>(n).Set(x);
+    }
+    
+    bool PercentBusyTime_exists() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        return GetField<Uint8>(n).exists ? true : false;
+    }
+    
+    void PercentBusyTime_clear()
+    {
+        const size_t n = offsetof(Self, PercentBusyTime);
+        GetField<Uint8>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_Class.UsedMemory
+    //
+    
+    const Field<Uint64>& UsedMemory() const
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64>(n);
+    }
+    
+    void UsedMemory(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& UsedMemory_value() const
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void UsedMemory_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool UsedMemory_exists() const
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void UsedMemory_clear()
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64>(n).Clear();
+    }
+};
+
+typedef Array<SCX_UnixProcess_Class> SCX_UnixProcess_ClassA;
+
+class SCX_UnixProcess_RequestStateChange_Class : public Instance
+{
+public:
+    
+    typedef SCX_UnixProcess_RequestStateChange Self;
+    
+    SCX_UnixProcess_RequestStateChange_Class() :
+        Instance(&SCX_UnixProcess_RequestStateChange_rtti)
+    {
+    }
+    
+    SCX_UnixProcess_RequestStateChange_Class(
+        const SCX_UnixProcess_RequestStateChange* instanceName,
+        bool keysOnly) :
+        Instance(
+            &SCX_UnixProcess_RequestStateChange_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_RequestStateChange_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_RequestStateChange_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    SCX_UnixProcess_RequestStateChange_Class& operator=(
+        const SCX_UnixProcess_RequestStateChange_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_UnixProcess_RequestStateChange_Class(
+        const SCX_UnixProcess_RequestStateChange_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_UnixProcess_RequestStateChange_Class.MIReturn
+    //
+    
+    const Field<Uint32>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n);
+    }
+    
+    void MIReturn(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void MIReturn_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_RequestStateChange_Class.RequestedState
+    //
+    
+    const Field<Uint16>& RequestedState() const
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        return GetField<Uint16>(n);
+    }
+    
+    void RequestedState(const Field<Uint16>& x)
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        GetField<Uint16>(n) = x;
+    }
+    
+    const Uint16& RequestedState_value() const
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        return GetField<Uint16>(n).value;
+    }
+    
+    void RequestedState_value(const Uint16& x)
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        GetField<Uint16>(n).Set(x);
+    }
+    
+    bool RequestedState_exists() const
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        return GetField<Uint16>(n).exists ? true : false;
+    }
+    
+    void RequestedState_clear()
+    {
+        const size_t n = offsetof(Self, RequestedState);
+        GetField<Uint16>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_RequestStateChange_Class.Job
+    //
+    
+    const Field<CIM_ConcreteJob_Class>& Job() const
+    {
+        const size_t n = offsetof(Self, Job);
+        return GetField<CIM_ConcreteJob_Class>(n);
+    }
+    
+    void Job(const Field<CIM_ConcreteJob_Class>& x)
+    {
+        const size_t n = offsetof(Self, Job);
+        GetField<CIM_ConcreteJob_Class>(n) = x;
+    }
+    
+    const CIM_ConcreteJob_Class& Job_value() const
+    {
+        const size_t n = offsetof(Self, Job);
+        return GetField<CIM_ConcreteJob_Class>(n).value;
+    }
+    
+    void Job_value(const CIM_ConcreteJob_Class& x)
+    {
+        const size_t n = offsetof(Self, Job);
+        GetField<CIM_ConcreteJob_Class>(n).Set(x);
+    }
+    
+    bool Job_exists() const
+    {
+        const size_t n = offsetof(Self, Job);
+        return GetField<CIM_ConcreteJob_Class>(n).exists ? true : false;
+    }
+    
+    void Job_clear()
+    {
+        const size_t n = offsetof(Self, Job);
+        GetField<CIM_ConcreteJob_Class>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_RequestStateChange_Class.TimeoutPeriod
+    //
+    
+    const Field<Datetime>& TimeoutPeriod() const
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        return GetField<Datetime>(n);
+    }
+    
+    void TimeoutPeriod(const Field<Datetime>& x)
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        GetField<Datetime>(n) = x;
+    }
+    
+    const Datetime& TimeoutPeriod_value() const
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        return GetField<Datetime>(n).value;
+    }
+    
+    void TimeoutPeriod_value(const Datetime& x)
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        GetField<Datetime>(n).Set(x);
+    }
+    
+    bool TimeoutPeriod_exists() const
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        return GetField<Datetime>(n).exists ? true : false;
+    }
+    
+    void TimeoutPeriod_clear()
+    {
+        const size_t n = offsetof(Self, TimeoutPeriod);
+        GetField<Datetime>(n).Clear();
+    }
+};
+
+typedef Array<SCX_UnixProcess_RequestStateChange_Class> SCX_UnixProcess_RequestStateChange_ClassA;
+
+class SCX_UnixProcess_TopResourceConsumers_Class : public Instance
+{
+public:
+    
+    typedef SCX_UnixProcess_TopResourceConsumers Self;
+    
+    SCX_UnixProcess_TopResourceConsumers_Class() :
+        Instance(&SCX_UnixProcess_TopResourceConsumers_rtti)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumers_Class(
+        const SCX_UnixProcess_TopResourceConsumers* instanceName,
+        bool keysOnly) :
+        Instance(
+            &SCX_UnixProcess_TopResourceConsumers_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumers_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumers_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumers_Class& operator=(
+        const SCX_UnixProcess_TopResourceConsumers_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_UnixProcess_TopResourceConsumers_Class(
+        const SCX_UnixProcess_TopResourceConsumers_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumers_Class.MIReturn
+    //
+    
+    const Field<String>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<String>(n);
+    }
+    
+    void MIReturn(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<String>(n) = x;
+    }
+    
+    const String& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<String>(n).value;
+    }
+    
+    void MIReturn_value(const String& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumers_Class.resource
+    //
+    
+    const Field<String>& resource() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n);
+    }
+    
+    void resource(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n) = x;
+    }
+    
+    const String& resource_value() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n).value;
+    }
+    
+    void resource_value(const String& x)
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool resource_exists() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void resource_clear()
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumers_Class.count
+    //
+    
+    const Field<Uint16>& count() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n);
+    }
+    
+    void count(const Field<Uint16>& x)
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n) = x;
+    }
+    
+    const Uint16& count_value() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n).value;
+    }
+    
+    void count_value(const Uint16& x)
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n).Set(x);
+    }
+    
+    bool count_exists() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n).exists ? true : false;
+    }
+    
+    void count_clear()
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumers_Class.elevationType
+    //
+    
+    const Field<String>& elevationType() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n);
+    }
+    
+    void elevationType(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n) = x;
+    }
+    
+    const String& elevationType_value() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n).value;
+    }
+    
+    void elevationType_value(const String& x)
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool elevationType_exists() const
+    {
+        const size_t n = offsetof(Self, elevationType);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void elevationType_clear()
+    {
+        const size_t n = offsetof(Self, elevationType);
+        GetField<String>(n).Clear();
+    }
+};
+
+typedef Array<SCX_UnixProcess_TopResourceConsumers_Class> SCX_UnixProcess_TopResourceConsumers_ClassA;
+
+class SCX_UnixProcess_TopResourceConsumerValues_Class : public Instance
+{
+public:
+    
+    typedef SCX_UnixProcess_TopResourceConsumerValues Self;
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class() :
+        Instance(&SCX_UnixProcess_TopResourceConsumerValues_rtti)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class(
+        const SCX_UnixProcess_TopResourceConsumerValues* instanceName,
+        bool keysOnly) :
+        Instance(
+            &SCX_UnixProcess_TopResourceConsumerValues_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class& operator=(
+        const SCX_UnixProcess_TopResourceConsumerValues_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    SCX_UnixProcess_TopResourceConsumerValues_Class(
+        const SCX_UnixProcess_TopResourceConsumerValues_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.MIReturn
+    //
+    
+    const Field<Boolean>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n);
+    }
+    
+    void MIReturn(const Field<Boolean>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n) = x;
+    }
+    
+    const Boolean& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).value;
+    }
+    
+    void MIReturn_value(const Boolean& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.resource
+    //
+    
+    const Field<String>& resource() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n);
+    }
+    
+    void resource(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n) = x;
+    }
+    
+    const String& resource_value() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n).value;
+    }
+    
+    void resource_value(const String& x)
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool resource_exists() const
+    {
+        const size_t n = offsetof(Self, resource);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void resource_clear()
+    {
+        const size_t n = offsetof(Self, resource);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.count
+    //
+    
+    const Field<Uint16>& count() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n);
+    }
+    
+    void count(const Field<Uint16>& x)
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n) = x;
+    }
+    
+    const Uint16& count_value() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n).value;
+    }
+    
+    void count_value(const Uint16& x)
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n).Set(x);
+    }
+    
+    bool count_exists() const
+    {
+        const size_t n = offsetof(Self, count);
+        return GetField<Uint16>(n).exists ? true : false;
+    }
+    
+    void count_clear()
+    {
+        const size_t n = offsetof(Self, count);
+        GetField<Uint16>(n).Clear();
+    }
 
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.threshold
+    //
+    
+    const Field<Uint64>& threshold() const
+    {
+        const size_t n = offsetof(Self, threshold);
+        return GetField<Uint64>(n);
+    }
+    
+    void threshold(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, threshold);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& threshold_value() const
+    {
+        const size_t n = offsetof(Self, threshold);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void threshold_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, threshold);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool threshold_exists() const
+    {
+        const size_t n = offsetof(Self, threshold);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void threshold_clear()
+    {
+        const size_t n = offsetof(Self, threshold);
+        GetField<Uint64>(n).Clear();
+    }
 
-/*
-**==============================================================================
-**
-** SCX_UnixProcess_Class
-**
-**==============================================================================
-*/
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.PIDs
+    //
+    
+    const Field<Uint64A>& PIDs() const
+    {
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n);
+    }
+    
+    void PIDs(const Field<Uint64A>& x)
+    {
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n) = x;
+    }
+    
+    const Uint64A& PIDs_value() const
+    {
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n).value;
+    }
+    
+    void PIDs_value(const Uint64A& x)
+    {
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n).Set(x);
+    }
+    
+    bool PIDs_exists() const
+    {
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n).exists ? true : false;
+    }
+    
+    void PIDs_clear()
+    {
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n).Clear();
+    }
 
-#ifdef __cplusplus
-# include <micxx/micxx.h>
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.Names
+    //
+    
+    const Field<StringA>& Names() const
+    {
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n);
+    }
+    
+    void Names(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& Names_value() const
+    {
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n).value;
+    }
+    
+    void Names_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool Names_exists() const
+    {
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void Names_clear()
+    {
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n).Clear();
+    }
 
-MI_BEGIN_NAMESPACE
+    //
+    // SCX_UnixProcess_TopResourceConsumerValues_Class.Values
+    //
+    
+    const Field<Uint64A>& Values() const
+    {
+        const size_t n = offsetof(Self, Values);
+        return GetField<Uint64A>(n);
+    }
+    
+    void Values(const Field<Uint64A>& x)
+    {
+        const size_t n = offsetof(Self, Values);
+        GetField<Uint64A>(n) = x;
+    }
+    
+    const Uint64A& Values_value() const
+    {
+        const size_t n = offsetof(Self, Values);
+        return GetField<Uint64A>(n).value;
+    }
+    
+    void Values_value(const Uint64A& x)
+    {
+        const size_t n = offsetof(Self, Values);
+        GetField<Uint64A>(n).Set(x);
+    }
+    
+    bool Values_exists() const
+    {
+        const size_t n = offsetof(Self, Values);
+        return GetField<Uint64A>(n).exists ? true : false;
+    }
+    
+    void Values_clear()
+    {
+        const size_t n = offsetof(Self, Values);
+        GetField<Uint64A>(n).Clear();
+    }
+};
 
-class SCX_UnixProcess_Class : public CIM_UnixProcess_Class
+typedef Array<SCX_UnixProcess_TopResourceConsumerValues_Class> SCX_UnixProcess_TopResourceConsumerValues_ClassA;
+
+class SCX_UnixProcess_AggregateProcesses_Class : public Instance
 {
 public:
     
-    typedef SCX_UnixProcess Self;
+    typedef SCX_UnixProcess_AggregateProcesses Self;
     
-    SCX_UnixProcess_Class() :
-        CIM_UnixProcess_Class(&SCX_UnixProcess_rtti)
+    SCX_UnixProcess_AggregateProcesses_Class() :
+        Instance(&SCX_UnixProcess_AggregateProcesses_rtti)
     {
     }
     
-    SCX_UnixProcess_Class(
-        const SCX_UnixProcess* instanceName,
+    SCX_UnixProcess_AggregateProcesses_Class(
+        const SCX_UnixProcess_AggregateProcesses* instanceName,
         bool keysOnly) :
-        CIM_UnixProcess_Class(
-            &SCX_UnixProcess_rtti,
+        Instance(
+            &SCX_UnixProcess_AggregateProcesses_rtti,
             &instanceName->__instance,
             keysOnly)
     {
     }
     
-    SCX_UnixProcess_Class(
+    SCX_UnixProcess_AggregateProcesses_Class(
         const MI_ClassDecl* clDecl,
         const MI_Instance* instance,
         bool keysOnly) :
-        CIM_UnixProcess_Class(clDecl, instance, keysOnly)
+        Instance(clDecl, instance, keysOnly)
     {
     }
     
-    SCX_UnixProcess_Class(
+    SCX_UnixProcess_AggregateProcesses_Class(
         const MI_ClassDecl* clDecl) :
-        CIM_UnixProcess_Class(clDecl)
+        Instance(clDecl)
     {
     }
     
-    SCX_UnixProcess_Class& operator=(
-        const SCX_UnixProcess_Class& x)
+    SCX_UnixProcess_AggregateProcesses_Class& operator=(
+        const SCX_UnixProcess_AggregateProcesses_Class& x)
     {
         CopyRef(x);
         return *this;
     }
     
-    SCX_UnixProcess_Class(
-        const SCX_UnixProcess_Class& x) :
-        CIM_UnixProcess_Class(x)
+    SCX_UnixProcess_AggregateProcesses_Class(
+        const SCX_UnixProcess_AggregateProcesses_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.MIReturn
+    //
+    
+    const Field<Boolean>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n);
+    }
+    
+    void MIReturn(const Field<Boolean>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n) = x;
+    }
+    
+    const Boolean& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).value;
+    }
+    
+    void MIReturn_value(const Boolean& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Boolean>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Boolean>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.groupBy
+    //
+    
+    const Field<String>& groupBy() const
+    {
+        const size_t n = offsetof(Self, groupBy);
+        return GetField<String>(n);
+    }
+    
+    void groupBy(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, groupBy);
+        GetField<String>(n) = x;
+    }
+    
+    const String& groupBy_value() const
+    {
+        const size_t n = offsetof(Self, groupBy);
+        return GetField<String>(n).value;
+    }
+    
+    void groupBy_value(const String& x)
+    {
+        const size_t n = offsetof(Self, groupBy);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool groupBy_exists() const
+    {
+        const size_t n = offsetof(Self, groupBy);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void groupBy_clear()
+    {
+        const size_t n = offsetof(Self, groupBy);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.Groups
+    //
+    
+    const Field<StringA>& Groups() const
+    {
+        const size_t n = offsetof(Self, Groups);
+        return GetField<StringA>(n);
+    }
+    
+    void Groups(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, Groups);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& Groups_value() const
+    {
+        const size_t n = offsetof(Self, Groups);
+        return GetField<StringA>(n).value;
+    }
+    
+    void Groups_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, Groups);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool Groups_exists() const
+    {
+        const size_t n = offsetof(Self, Groups);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void Groups_clear()
+    {
+        const size_t n = offsetof(Self, Groups);
+        GetField<StringA>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.Counts
+    //
+    
+    const Field<Uint64A>& Counts() const
+    {
+        const size_t n = offsetof(Self, Counts);
+        return GetField<Uint64A>(n);
+    }
+    
+    void Counts(const Field<Uint64A>& x)
+    {
+        const size_t n = offsetof(Self, Counts);
+        GetField<Uint64A>(n) = x;
+    }
+    
+    const Uint64A& Counts_value() const
+    {
+        const size_t n = offsetof(Self, Counts);
+        return GetField<Uint64A>(n).value;
+    }
+    
+    void Counts_value(const Uint64A& x)
+    {
+        const size_t n = offsetof(Self, Counts);
+        GetField<Uint64A>(n).Set(x);
+    }
+    
+    bool Counts_exists() const
+    {
+        const size_t n = offsetof(Self, Counts);
+        return GetField<Uint64A>(n).exists ? true : false;
+    }
+    
+    void Counts_clear()
+    {
+        const size_t n = offsetof(Self, Counts);
+        GetField<Uint64A>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.PercentBusyTimes
+    //
+    
+    const Field<Uint64A>& PercentBusyTimes() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        return GetField<Uint64A>(n);
+    }
+    
+    void PercentBusyTimes(const Field<Uint64A>& x)
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        GetField<Uint64A>(n) = x;
+    }
+    
+    const Uint64A& PercentBusyTimes_value() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        return GetField<Uint64A>(n).value;
+    }
+    
+    void PercentBusyTimes_value(const Uint64A& x)
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        GetField<Uint64A>(n).Set(x);
+    }
+    
+    bool PercentBusyTimes_exists() const
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        return GetField<Uint64A>(n).exists ? true : false;
+    }
+    
+    void PercentBusyTimes_clear()
+    {
+        const size_t n = offsetof(Self, PercentBusyTimes);
+        GetField<Uint64A>(n).Clear();
+    }
+
+    //
+    // SCX_UnixProcess_AggregateProcesses_Class.UsedMemory
+    //
+    
+    const Field<Uint64A>& UsedMemory() const
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64A>(n);
+    }
+    
+    void UsedMemory(const Field<Uint64A>& x)
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64A>(n) = x;
+    }
+    
+    const Uint64A& UsedMemory_value() const
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64A>(n).value;
+    }
+    
+    void UsedMemory_value(const Uint64A& x)
+    {
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64A>(n).Set(x);
+    }
+    
+    bool UsedMemory_exists() const
     {
+        const size_t n = offsetof(Self, UsedMemory);
+        return GetField<Uint64A>(n).exists ? true : false;
     }
-
-    static const MI_ClassDecl* GetClassDecl()
+    
+    void UsedMemory_clear()
     {
-        return &SCX_UnixProcess_rtti;
+        const size_t n = offsetof(Self, UsedMemory);
+        GetField<Uint64A>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_Class.PercentBusyTime
+    // SCX_UnixProcess_AggregateProcesses_Class.BlockReadsPerSecond
     //
     
-    const Field<Uint8>& PercentBusyTime() const
+    const Field<Uint64A>& BlockReadsPerSecond() const
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        return GetField<Uint8>(n);
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        return GetField<Uint64A>(n);
     }
     
-    void PercentBusyTime(const Field<Uint8>& x)
+    void BlockReadsPerSecond(const Field<Uint64A>& x)
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        GetField<Uint8>(n) = x;
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        GetField<Uint64A>(n) = x;
     }
     
-    const Uint8& PercentBusyTime_value() const
+    const Uint64A& BlockReadsPerSecond_value() const
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        return GetField<Uint8>(n).value;
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        return GetField<Uint64A>(n).value;
     }
     
-    void PercentBusyTime_value(const Uint8& x)
+    void BlockReadsPerSecond_value(const Uint64A& x)
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        GetField<Uint8>(n).Set(x);
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        GetField<Uint64A>(n).Set(x);
     }
     
-    bool PercentBusyTime_exists() const
+    bool BlockReadsPerSecond_exists() const
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        return GetField<Uint8>(n).exists ? true : false;
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        return GetField<Uint64A>(n).exists ? true : false;
     }
     
-    void PercentBusyTime_clear()
+    void BlockReadsPerSecond_clear()
     {
-        const size_t n = offsetof(Self, PercentBusyTime);
-        GetField<Uint8>(n).Clear();
+        const size_t n = offsetof(Self, BlockReadsPerSecond);
+        GetField<Uint64A>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_Class.UsedMemory
+    // SCX_UnixProcess_AggregateProcesses_Class.BlockWritesPerSecond
     //
     
-    const Field<Uint64>& UsedMemory() const
+    const Field<Uint64A>& BlockWritesPerSecond() const
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        return GetField<Uint64>(n);
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        return GetField<Uint64A>(n);
     }
     
-    void UsedMemory(const Field<Uint64>& x)
+    void BlockWritesPerSecond(const Field<Uint64A>& x)
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        GetField<Uint64>(n) = x;
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        GetField<Uint64A>(n) = x;
     }
     
-    const Uint64& UsedMemory_value() const
+    const Uint64A& BlockWritesPerSecond_value() const
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        return GetField<Uint64>(n).value;
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        return GetField<Uint64A>(n).value;
     }
     
-    void UsedMemory_value(const Uint64& x)
+    void BlockWritesPerSecond_value(const Uint64A& x)
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        GetField<Uint64>(n).Set(x);
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        GetField<Uint64A>(n).Set(x);
     }
     
-    bool UsedMemory_exists() const
+    bool BlockWritesPerSecond_exists() const
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        return GetField<Uint64>(n).exists ? true : false;
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        return GetField<Uint64A>(n).exists ? true : false;
     }
     
-    void UsedMemory_clear()
+    void BlockWritesPerSecond_clear()
     {
-        const size_t n = offsetof(Self, UsedMemory);
-        GetField<Uint64>(n).Clear();
+        const size_t n = offsetof(Self, BlockWritesPerSecond);
+        GetField<Uint64A>(n).Clear();
     }
 };
 
-typedef Array<SCX_UnixProcess_Class> SCX_UnixProcess_ClassA;
+typedef Array<SCX_UnixProcess_AggregateProcesses_Class> SCX_UnixProcess_AggregateProcesses_ClassA;
 
-class SCX_UnixProcess_RequestStateChange_Class : public Instance
+class SCX_UnixProcess_EnumerateChanges_Class : public Instance
 {
 public:
     
-    typedef SCX_UnixProcess_RequestStateChange Self;
+    typedef SCX_UnixProcess_EnumerateChanges Self;
     
-    SCX_UnixProcess_RequestStateChange_Class() :
-        Instance(&SCX_UnixProcess_RequestStateChange_rtti)
+    SCX_UnixProcess_EnumerateChanges_Class() :
+        Instance(&SCX_UnixProcess_EnumerateChanges_rtti)
     {
     }
     
-    SCX_UnixProcess_RequestStateChange_Class(
-        const SCX_UnixProcess_RequestStateChange* instanceName,
+    SCX_UnixProcess_EnumerateChanges_Class(
+        const SCX_UnixProcess_EnumerateChanges* instanceName,
         bool keysOnly) :
         Instance(
-            &SCX_UnixProcess_RequestStateChange_rtti,
+            &SCX_UnixProcess_EnumerateChanges_rtti,
             &instanceName->__instance,
             keysOnly)
     {
     }
     
-    SCX_UnixProcess_RequestStateChange_Class(
+    SCX_UnixProcess_EnumerateChanges_Class(
         const MI_ClassDecl* clDecl,
         const MI_Instance* instance,
         bool keysOnly) :
@@ -1854,398 +3966,387 @@ public:
     {
     }
     
-    SCX_UnixProcess_RequestStateChange_Class(
+    SCX_UnixProcess_EnumerateChanges_Class(
         const MI_ClassDecl* clDecl) :
         Instance(clDecl)
     {
     }
     
-    SCX_UnixProcess_RequestStateChange_Class& operator=(
-        const SCX_UnixProcess_RequestStateChange_Class& x)
+    SCX_UnixProcess_EnumerateChanges_Class& operator=(
+        const SCX_UnixProcess_EnumerateChanges_Class& x)
     {
         CopyRef(x);
         return *this;
     }
     
-    SCX_UnixProcess_RequestStateChange_Class(
-        const SCX_UnixProcess_RequestStateChange_Class& x) :
+    SCX_UnixProcess_EnumerateChanges_Class(
+        const SCX_UnixProcess_EnumerateChanges_Class& x) :
         Instance(x)
     {
     }
 
     //
-    // SCX_UnixProcess_RequestStateChange_Class.MIReturn
+    // SCX_UnixProcess_EnumerateChanges_Class.MIReturn
     //
     
-    const Field<Uint32>& MIReturn() const
+    const Field<Boolean>& MIReturn() const
     {
         const size_t n = offsetof(Self, MIReturn);
-        return GetField<Uint32>(n);
+        return GetField<Boolean>(n);
     }
     
-    void MIReturn(const Field<Uint32>& x)
+    void MIReturn(const Field<Boolean>& x)
     {
         const size_t n = offsetof(Self, MIReturn);
-        GetField<Uint32>(n) = x;
+        GetField<Boolean>(n) = x;
     }
     
-    const Uint32& MIReturn_value() const
+    const Boolean& MIReturn_value() const
     {
         const size_t n = offsetof(Self, MIReturn);
-        return GetField<Uint32>(n).value;
+        return GetField<Boolean>(n).value;
     }
     
-    void MIReturn_value(const Uint32& x)
+    void MIReturn_value(const Boolean& x)
     {
         const size_t n = offsetof(Self, MIReturn);
-        GetField<Uint32>(n).Set(x);
+        GetField<Boolean>(n).Set(x);
     }
     
     bool MIReturn_exists() const
     {
         const size_t n = offsetof(Self, MIReturn);
-        return GetField<Uint32>(n).exists ? true : false;
+        return GetField<Boolean>(n).exists ? true : false;
     }
     
     void MIReturn_clear()
     {
         const size_t n = offsetof(Self, MIReturn);
-        GetField<Uint32>(n).Clear();
+        GetField<Boolean>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_RequestStateChange_Class.RequestedState
+    // SCX_UnixProcess_EnumerateChanges_Class.token
     //
     
-    const Field<Uint16>& RequestedState() const
+    const Field<String>& token() const
     {
-        const size_t n = offsetof(Self, RequestedState);
-        return GetField<Uint16>(n);
+        const size_t n = offsetof(Self, token);
+        return GetField<String>(n);
     }
     
-    void RequestedState(const Field<Uint16>& x)
+    void token(const Field<String>& x)
     {
-        const size_t n = offsetof(Self, RequestedState);
-        GetField<Uint16>(n) = x;
+        const size_t n = offsetof(Self, token);
+        GetField<String>(n) = x;
     }
     
-    const Uint16& RequestedState_value() const
+    const String& token_value() const
     {
-        const size_t n = offsetof(Self, RequestedState);
-        return GetField<Uint16>(n).value;
+        const size_t n = offsetof(Self, token);
+        return GetField<String>(n).value;
     }
     
-    void RequestedState_value(const Uint16& x)
+    void token_value(const String& x)
     {
-        const size_t n = offsetof(Self, RequestedState);
-        GetField<Uint16>(n).Set(x);
+        const size_t n = offsetof(Self, token);
+        GetField<String>(n).Set(x);
     }
     
-    bool RequestedState_exists() const
+    bool token_exists() const
     {
-        const size_t n = offsetof(Self, RequestedState);
-        return GetField<Uint16>(n).exists ? true : false;
+        const size_t n = offsetof(Self, token);
+        return GetField<String>(n).exists ? true : false;
     }
     
-    void RequestedState_clear()
+    void token_clear()
     {
-        const size_t n = offsetof(Self, RequestedState);
-        GetField<Uint16>(n).Clear();
+        const size_t n = offsetof(Self, token);
+        GetField<String>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_RequestStateChange_Class.Job
+    // SCX_UnixProcess_EnumerateChanges_Class.NextToken
     //
     
-    const Field<CIM_ConcreteJob_Class>& Job() const
+    const Field<String>& NextToken() const
     {
-        const size_t n = offsetof(Self, Job);
-        return GetField<CIM_ConcreteJob_Class>(n);
+        const size_t n = offsetof(Self, NextToken);
+        return GetField<String>(n);
     }
     
-    void Job(const Field<CIM_ConcreteJob_Class>& x)
+    void NextToken(const Field<String>& x)
     {
-        const size_t n = offsetof(Self, Job);
-        GetField<CIM_ConcreteJob_Class>(n) = x;
+        const size_t n = offsetof(Self, NextToken);
+        GetField<String>(n) = x;
     }
     
-    const CIM_ConcreteJob_Class& Job_value() const
+    const String& NextToken_value() const
     {
-        const size_t n = offsetof(Self, Job);
-        return GetField<CIM_ConcreteJob_Class>(n).value;
+        const size_t n = offsetof(Self, NextToken);
+        return GetField<String>(n).value;
     }
     
-    void Job_value(const CIM_ConcreteJob_Class& x)
+    void NextToken_value(const String& x)
     {
-        const size_t n = offsetof(Self, Job);
-        GetField<CIM_ConcreteJob_Class>(n).Set(x);
+        const size_t n = offsetof(Self, NextToken);
+        GetField<String>(n).Set(x);
     }
     
-    bool Job_exists() const
+    bool NextToken_exists() const
     {
-        const size_t n = offsetof(Self, Job);
-        return GetField<CIM_ConcreteJob_Class>(n).exists ? true : false;
+        const size_t n = offsetof(Self, NextToken);
+        return GetField<String>(n).exists ? true : false;
     }
     
-    void Job_clear()
+    void NextToken_clear()
     {
-        const size_t n = offsetof(Self, Job);
-        GetField<CIM_ConcreteJob_Class>(n).Clear();
+        const size_t n = offsetof(Self, NextToken);
+        GetField<String>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_RequestStateChange_Class.TimeoutPeriod
+    // SCX_UnixProcess_EnumerateChanges_Class.FullResync
     //
     
-    const Field<Datetime>& TimeoutPeriod() const
+    const Field<Boolean>& FullResync() const
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        return GetField<Datetime>(n);
+        const size_t n = offsetof(Self, FullResync);
+        return GetField<Boolean>(n);
     }
     
-    void TimeoutPeriod(const Field<Datetime>& x)
+    void FullResync(const Field<Boolean>& x)
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        GetField<Datetime>(n) = x;
+        const size_t n = offsetof(Self, FullResync);
+        GetField<Boolean>(n) = x;
     }
     
-    const Datetime& TimeoutPeriod_value() const
+    const Boolean& FullResync_value() const
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        return GetField<Datetime>(n).value;
+        const size_t n = offsetof(Self, FullResync);
+        return GetField<Boolean>(n).value;
     }
     
-    void TimeoutPeriod_value(const Datetime& x)
+    void FullResync_value(const Boolean& x)
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        GetField<Datetime>(n).Set(x);
+        const size_t n = offsetof(Self, FullResync);
+        GetField<Boolean>(n).Set(x);
     }
     
-    bool TimeoutPeriod_exists() const
+    bool FullResync_exists() const
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        return GetField<Datetime>(n).exists ? true : false;
+        const size_t n = offsetof(Self, FullResync);
+        return GetField<Boolean>(n).exists ? true : false;
     }
     
-    void TimeoutPeriod_clear()
+    void FullResync_clear()
     {
-        const size_t n = offsetof(Self, TimeoutPeriod);
-        GetField<Datetime>(n).Clear();
+        const size_t n = offsetof(Self, FullResync);
+        GetField<Boolean>(n).Clear();
     }
-};
-
-typedef Array<SCX_UnixProcess_RequestStateChange_Class> SCX_UnixProcess_RequestStateChange_ClassA;
 
-class SCX_UnixProcess_TopResourceConsumers_Class : public Instance
-{
-public:
-    
-    typedef SCX_UnixProcess_TopResourceConsumers Self;
+    //
+    // SCX_UnixProcess_EnumerateChanges_Class.Changes
+    //
     
-    SCX_UnixProcess_TopResourceConsumers_Class() :
-        Instance(&SCX_UnixProcess_TopResourceConsumers_rtti)
+    const Field<Uint16A>& Changes() const
     {
+        const size_t n = offsetof(Self, Changes);
+        return GetField<Uint16A>(n);
     }
     
-    SCX_UnixProcess_TopResourceConsumers_Class(
-        const SCX_UnixProcess_TopResourceConsumers* instanceName,
-        bool keysOnly) :
-        Instance(
-            &SCX_UnixProcess_TopResourceConsumers_rtti,
-            &instanceName->__instance,
-            keysOnly)
+    void Changes(const Field<Uint16A>& x)
     {
+        const size_t n = offsetof(Self, Changes);
+        GetField<Uint16A>(n) = x;
     }
     
-    SCX_UnixProcess_TopResourceConsumers_Class(
-        const MI_ClassDecl* clDecl,
-        const MI_Instance* instance,
-        bool keysOnly) :
-        Instance(clDecl, instance, keysOnly)
+    const Uint16A& Changes_value() const
     {
+        const size_t n = offsetof(Self, Changes);
+        return GetField<Uint16A>(n).value;
     }
     
-    SCX_UnixProcess_TopResourceConsumers_Class(
-        const MI_ClassDecl* clDecl) :
-        Instance(clDecl)
+    void Changes_value(const Uint16A& x)
     {
+        const size_t n = offsetof(Self, Changes);
+        GetField<Uint16A>(n).Set(x);
     }
     
-    SCX_UnixProcess_TopResourceConsumers_Class& operator=(
-        const SCX_UnixProcess_TopResourceConsumers_Class& x)
+    bool Changes_exists() const
     {
-        CopyRef(x);
-        return *this;
+        const size_t n = offsetof(Self, Changes);
+        return GetField<Uint16A>(n).exists ? true : false;
     }
     
-    SCX_UnixProcess_TopResourceConsumers_Class(
-        const SCX_UnixProcess_TopResourceConsumers_Class& x) :
-        Instance(x)
+    void Changes_clear()
     {
+        const size_t n = offsetof(Self, Changes);
+        GetField<Uint16A>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_TopResourceConsumers_Class.MIReturn
+    // SCX_UnixProcess_EnumerateChanges_Class.PIDs
     //
     
-    const Field<String>& MIReturn() const
+    const Field<Uint64A>& PIDs() const
     {
-        const size_t n = offsetof(Self, MIReturn);
-        return GetField<String>(n);
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n);
     }
     
-    void MIReturn(const Field<String>& x)
+    void PIDs(const Field<Uint64A>& x)
     {
-        const size_t n = offsetof(Self, MIReturn);
-        GetField<String>(n) = x;
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n) = x;
     }
     
-    const String& MIReturn_value() const
+    const Uint64A& PIDs_value() const
     {
-        const size_t n = offsetof(Self, MIReturn);
-        return GetField<String>(n).value;
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n).value;
     }
     
-    void MIReturn_value(const String& x)
+    void PIDs_value(const Uint64A& x)
     {
-        const size_t n = offsetof(Self, MIReturn);
-        GetField<String>(n).Set(x);
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n).Set(x);
     }
     
-    bool MIReturn_exists() const
+    bool PIDs_exists() const
     {
-        const size_t n = offsetof(Self, MIReturn);
-        return GetField<String>(n).exists ? true : false;
+        const size_t n = offsetof(Self, PIDs);
+        return GetField<Uint64A>(n).exists ? true : false;
     }
     
-    void MIReturn_clear()
+    void PIDs_clear()
     {
-        const size_t n = offsetof(Self, MIReturn);
-        GetField<String>(n).Clear();
+        const size_t n = offsetof(Self, PIDs);
+        GetField<Uint64A>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_TopResourceConsumers_Class.resource
+    // SCX_UnixProcess_EnumerateChanges_Class.StartTimes
     //
     
-    const Field<String>& resource() const
+    const Field<StringA>& StartTimes() const
     {
-        const size_t n = offsetof(Self, resource);
-        return GetField<String>(n);
+        const size_t n = offsetof(Self, StartTimes);
+        return GetField<StringA>(n);
     }
     
-    void resource(const Field<String>& x)
+    void StartTimes(const Field<StringA>& x)
     {
-        const size_t n = offsetof(Self, resource);
-        GetField<String>(n) = x;
+        const size_t n = offsetof(Self, StartTimes);
+        GetField<StringA>(n) = x;
     }
     
-    const String& resource_value() const
+    const StringA& StartTimes_value() const
     {
-        const size_t n = offsetof(Self, resource);
-        return GetField<String>(n).value;
+        const size_t n = offsetof(Self, StartTimes);
+        return GetField<StringA>(n).value;
     }
     
-    void resource_value(const String& x)
+    void StartTimes_value(const StringA& x)
     {
-        const size_t n = offsetof(Self, resource);
-        GetField<String>(n).Set(x);
+        const size_t n = offsetof(Self, StartTimes);
+        GetField<StringA>(n).Set(x);
     }
     
-    bool resource_exists() const
+    bool StartTimes_exists() const
     {
-        const size_t n = offsetof(Self, resource);
-        return GetField<String>(n).exists ? true : false;
+        const size_t n = offsetof(Self, StartTimes);
+        return GetField<StringA>(n).exists ? true : false;
     }
     
-    void resource_clear()
+    void StartTimes_clear()
     {
-        const size_t n = offsetof(Self, resource);
-        GetField<String>(n).Clear();
+        const size_t n = offsetof(Self, StartTimes);
+        GetField<StringA>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_TopResourceConsumers_Class.count
+    // SCX_UnixProcess_EnumerateChanges_Class.Names
     //
     
-    const Field<Uint16>& count() const
+    const Field<StringA>& Names() const
     {
-        const size_t n = offsetof(Self, count);
-        return GetField<Uint16>(n);
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n);
     }
     
-    void count(const Field<Uint16>& x)
+    void Names(const Field<StringA>& x)
     {
-        const size_t n = offsetof(Self, count);
-        GetField<Uint16>(n) = x;
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n) = x;
     }
     
-    const Uint16& count_value() const
+    const StringA& Names_value() const
     {
-        const size_t n = offsetof(Self, count);
-        return GetField<Uint16>(n).value;
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n).value;
     }
     
-    void count_value(const Uint16& x)
+    void Names_value(const StringA& x)
     {
-        const size_t n = offsetof(Self, count);
-        GetField<Uint16>(n).Set(x);
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n).Set(x);
     }
     
-    bool count_exists() const
+    bool Names_exists() const
     {
-        const size_t n = offsetof(Self, count);
-        return GetField<Uint16>(n).exists ? true : false;
+        const size_t n = offsetof(Self, Names);
+        return GetField<StringA>(n).exists ? true : false;
     }
     
-    void count_clear()
+    void Names_clear()
     {
-        const size_t n = offsetof(Self, count);
-        GetField<Uint16>(n).Clear();
+        const size_t n = offsetof(Self, Names);
+        GetField<StringA>(n).Clear();
     }
 
     //
-    // SCX_UnixProcess_TopResourceConsumers_Class.elevationType
+    // SCX_UnixProcess_EnumerateChanges_Class.ExecutionStates
     //
     
-    const Field<String>& elevationType() const
+    const Field<Uint16A>& ExecutionStates() const
     {
-        const size_t n = offsetof(Self, elevationType);
-        return GetField<String>(n);
+        const size_t n = offsetof(Self, ExecutionStates);
+        return GetField<Uint16A>(n);
     }
     
-    void elevationType(const Field<String>& x)
+    void ExecutionStates(const Field<Uint16A>& x)
     {
-        const size_t n = offsetof(Self, elevationType);
-        GetField<String>(n) = x;
+        const size_t n = offsetof(Self, ExecutionStates);
+        GetField<Uint16A>(n) = x;
     }
     
-    const String& elevationType_value() const
+    const Uint16A& ExecutionStates_value() const
     {
-        const size_t n = offsetof(Self, elevationType);
-        return GetField<String>(n).value;
+        const size_t n = offsetof(Self, ExecutionStates);
+        return GetField<Uint16A>(n).value;
     }
     
-    void elevationType_value(const String& x)
+    void ExecutionStates_value(const Uint16A& x)
     {
-        const size_t n = offsetof(Self, elevationType);
-        GetField<String>(n).Set(x);
+        const size_t n = offsetof(Self, ExecutionStates);
+        GetField<Uint16A>(n).Set(x);
     }
     
-    bool elevationType_exists() const
+    bool ExecutionStates_exists() const
     {
-        const size_t n = offsetof(Self, elevationType);
-        return GetField<String>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ExecutionStates);
+        return GetField<Uint16A>(n).exists ? true : false;
     }
     
-    void elevationType_clear()
+    void ExecutionStates_clear()
     {
-        const size_t n = offsetof(Self, elevationType);
-        GetField<String>(n).Clear();
+        const size_t n = offsetof(Self, ExecutionStates);
+        GetField<Uint16A>(n).Clear();
     }
 };
 
-typedef Array<SCX_UnixProcess_TopResourceConsumers_Class> SCX_UnixProcess_TopResourceConsumers_ClassA;
+typedef Array<SCX_UnixProcess_EnumerateChanges_Class> SCX_UnixProcess_EnumerateChanges_ClassA;
 
 MI_END_NAMESPACE
 
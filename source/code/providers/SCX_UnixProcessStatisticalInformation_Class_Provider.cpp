@@ -23,6 +23,7 @@
 #include <scxsystemlib/processinstance.h>
 #include "support/scxcimutils.h"
 #include "support/processprovider.h"
+#include "support/snapshotenumeration.h"
 #include <sstream>
 
 using namespace SCXSystemLib;
@@ -30,23 +31,73 @@ using namespace SCXCoreLib;
 
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(Context& context,
-        SCX_UnixProcessStatisticalInformation_Class& inst, bool keysOnly,
+/*----------------------------------------------------------------------------*/
+/**
+   Data copied out of a ProcessInstance while holding the provider lock
+*/
+struct UnixProcessStatisticsSnapshot
+{
+    SCXCore::SnapshotValue<scxulong> pid;
+    SCXCore::SnapshotValue<std::string> name;
+    SCXCore::SnapshotValue<scxulong> realData;
+    SCXCore::SnapshotValue<scxulong> realStack;
+    SCXCore::SnapshotValue<scxulong> virtualText;
+    SCXCore::SnapshotValue<scxulong> virtualData;
+    SCXCore::SnapshotValue<scxulong> virtualStack;
+    SCXCore::SnapshotValue<scxulong> virtualMemoryMappedFileSize;
+    SCXCore::SnapshotValue<scxulong> virtualSharedMemory;
+    SCXCore::SnapshotValue<scxulong> cpuTimeDeadChildren;
+    SCXCore::SnapshotValue<scxulong> systemTimeDeadChildren;
+    SCXCore::SnapshotValue<scxulong> realText;
+    SCXCore::SnapshotValue<unsigned int> cpuTime;
+    SCXCore::SnapshotValue<scxulong> blockWritesPerSecond;
+    SCXCore::SnapshotValue<scxulong> blockReadsPerSecond;
+    SCXCore::SnapshotValue<scxulong> blockTransfersPerSecond;
+    SCXCore::SnapshotValue<scxulong> percentUserTime;
+    SCXCore::SnapshotValue<scxulong> percentPrivilegedTime;
+    SCXCore::SnapshotValue<scxulong> usedMemory;
+    SCXCore::SnapshotValue<scxulong> percentUsedMemory;
+    SCXCore::SnapshotValue<scxulong> pagesReadPerSec;
+};
+
+static void CaptureOneInstance(
+        UnixProcessStatisticsSnapshot& snap, bool keysOnly,
         SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst)
 {
-    SCXLogHandle& log = SCXCore::g_ProcessProvider.GetLogHandle();
+    snap.pid.exists = processinst->GetPID(snap.pid.value);
+    snap.name.exists = processinst->GetName(snap.name.value);
 
-    // Add the key properties first.
-    scxulong pid;
-    if (processinst->GetPID(pid))
+    if (!keysOnly)
     {
-        inst.Handle_value(StrToUTF8(StrFrom(pid)).c_str());
+        snap.realData.exists = processinst->GetRealData(snap.realData.value);
+        snap.realStack.exists = processinst->GetRealStack(snap.realStack.value);
+        snap.virtualText.exists = processinst->GetVirtualText(snap.virtualText.value);
+        snap.virtualData.exists = processinst->GetVirtualData(snap.virtualData.value);
+        snap.virtualStack.exists = processinst->GetVirtualStack(snap.virtualStack.value);
+        snap.virtualMemoryMappedFileSize.exists = processinst->GetVirtualMemoryMappedFileSize(snap.virtualMemoryMappedFileSize.value);
+        snap.virtualSharedMemory.exists = processinst->GetVirtualSharedMemory(snap.virtualSharedMemory.value);
+        snap.cpuTimeDeadChildren.exists = processinst->GetCpuTimeDeadChildren(snap.cpuTimeDeadChildren.value);
+        snap.systemTimeDeadChildren.exists = processinst->GetSystemTimeDeadChildren(snap.systemTimeDeadChildren.value);
+        snap.realText.exists = processinst->GetRealText(snap.realText.value);
+        snap.cpuTime.exists = processinst->GetCPUTime(snap.cpuTime.value);
+        snap.blockWritesPerSecond.exists = processinst->GetBlockWritesPerSecond(snap.blockWritesPerSecond.value);
+        snap.blockReadsPerSecond.exists = processinst->GetBlockReadsPerSecond(snap.blockReadsPerSecond.value);
+        snap.blockTransfersPerSecond.exists = processinst->GetBlockTransfersPerSecond(snap.blockTransfersPerSecond.value);
+        snap.percentUserTime.exists = processinst->GetPercentUserTime(snap.percentUserTime.value);
+        snap.percentPrivilegedTime.exists = processinst->GetPercentPrivilegedTime(snap.percentPrivilegedTime.value);
+        snap.usedMemory.exists = processinst->GetUsedMemory(snap.usedMemory.value);
+        snap.percentUsedMemory.exists = processinst->GetPercentUsedMemory(snap.percentUsedMemory.value);
+        snap.pagesReadPerSec.exists = processinst->GetPagesReadPerSec(snap.pagesReadPerSec.value);
     }
+}
+
+static void GetScopingNames(std::string& csName, std::string& osName)
+{
+    SCXLogHandle& log = SCXCore::g_ProcessProvider.GetLogHandle();
 
-    // Add keys of scoping operating system
     try {
         SCXCoreLib::NameResolver mi;
-        inst.CSName_value(StrToMultibyte(mi.GetHostDomainname()).c_str());
+        csName = StrToMultibyte(mi.GetHostDomainname());
     } catch (SCXException& e){
         SCX_LOGWARNING(log, StrAppend(
                     StrAppend(L"Can't read host/domainname because ", e.What()),
@@ -55,128 +106,163 @@ static void EnumerateOneInstance(Context& context,
 
     try {
         SCXSystemLib::SCXOSTypeInfo osinfo;
-        inst.OSName_value(StrToMultibyte(osinfo.GetOSName(true)).c_str());
+        osName = StrToMultibyte(osinfo.GetOSName(true));
     } catch (SCXException& e){
         SCX_LOGWARNING(log, StrAppend(
                     StrAppend(L"Can't read OS name because ", e.What()),
                     e.Where()));
     }
+}
 
-    inst.CSCreationClassName_value("SCX_ComputerSystem");
-    inst.OSCreationClassName_value("SCX_OperatingSystem");
-    inst.ProcessCreationClassName_value("SCX_UnixProcessStatisticalInformation");
-
-    std::string name;
-    if (processinst->GetName(name))
+/*----------------------------------------------------------------------------*/
+/**
+   Builds an SCX_UnixProcessStatisticalInformation instance from a snapshot
+   (called without the lock)
+*/
+class UnixProcessStatisticsBuilder
+{
+public:
+    UnixProcessStatisticsBuilder(bool keysOnly, const std::string& csName, const std::string& osName)
+        : m_keysOnly(keysOnly), m_csName(csName), m_osName(osName)
     {
-        inst.Name_value(name.c_str());
     }
 
-    if (!keysOnly)
+    void operator()(const UnixProcessStatisticsSnapshot& snap, SCX_UnixProcessStatisticalInformation_Class& inst) const
     {
-        unsigned int uint = 0;
-        scxulong ulong = 0;
+        // Add the key properties first.
+        if (snap.pid.exists)
+        {
+            inst.Handle_value(StrToUTF8(StrFrom(snap.pid.value)).c_str());
+        }
+
+        // Add keys of scoping operating system
+        if (!m_csName.empty())
+        {
+            inst.CSName_value(m_csName.c_str());
+        }
+        if (!m_osName.empty())
+        {
+            inst.OSName_value(m_osName.c_str());
+        }
+
+        inst.CSCreationClassName_value("SCX_ComputerSystem");
+        inst.OSCreationClassName_value("SCX_OperatingSystem");
+        inst.ProcessCreationClassName_value("SCX_UnixProcessStatisticalInformation");
+
+        if (snap.name.exists)
+        {
+            inst.Name_value(snap.name.value.c_str());
+        }
+
+        if (m_keysOnly)
+        {
+            return;
+        }
 
         inst.Description_value("A snapshot of a current process");
         inst.Caption_value("Unix process information");
 
-        if (processinst->GetRealData(ulong))
+        if (snap.realData.exists)
         {
-            inst.RealData_value(ulong);
+            inst.RealData_value(snap.realData.value);
         }
 
-        if (processinst->GetRealStack(ulong))
+        if (snap.realStack.exists)
         {
-            inst.RealStack_value(ulong);
+            inst.RealStack_value(snap.realStack.value);
         }
 
-        if (processinst->GetVirtualText(ulong))
+        if (snap.virtualText.exists)
         {
-            inst.VirtualText_value(ulong);
+            inst.VirtualText_value(snap.virtualText.value);
         }
 
-        if (processinst->GetVirtualData(ulong))
+        if (snap.virtualData.exists)
         {
-            inst.VirtualData_value(ulong);
+            inst.VirtualData_value(snap.virtualData.value);
         }
 
-        if (processinst->GetVirtualStack(ulong))
+        if (snap.virtualStack.exists)
         {
-            inst.VirtualStack_value(ulong);
+            inst.VirtualStack_value(snap.virtualStack.value);
         }
 
-        if (processinst->GetVirtualMemoryMappedFileSize(ulong))
+        if (snap.virtualMemoryMappedFileSize.exists)
         {
-            inst.VirtualMemoryMappedFileSize_value(ulong);
+            inst.VirtualMemoryMappedFileSize_value(snap.virtualMemoryMappedFileSize.value);
         }
 
-        if (processinst->GetVirtualSharedMemory(ulong))
+        if (snap.virtualSharedMemory.exists)
         {
-            inst.VirtualSharedMemory_value(ulong);
+            inst.VirtualSharedMemory_value(snap.virtualSharedMemory.value);
         }
 
-        if (processinst->GetCpuTimeDeadChildren(ulong))
+        if (snap.cpuTimeDeadChildren.exists)
         {
-            inst.CpuTimeDeadChildren_value(ulong);
+            inst.CpuTimeDeadChildren_value(snap.cpuTimeDeadChildren.value);
         }
 
-        if (processinst->GetSystemTimeDeadChildren(ulong))
+        if (snap.systemTimeDeadChildren.exists)
         {
-            inst.SystemTimeDeadChildren_value(ulong);
+            inst.SystemTimeDeadChildren_value(snap.systemTimeDeadChildren.value);
         }
 
-        if (processinst->GetRealText(ulong))
+        if (snap.realText.exists)
         {
-            inst.RealText_value(ulong);
+            inst.RealText_value(snap.realText.value);
         }
 
-        if (processinst->GetCPUTime(uint))
+        if (snap.cpuTime.exists)
         {
-            inst.CPUTime_value(uint);
+            inst.CPUTime_value(snap.cpuTime.value);
         }
 
-        if (processinst->GetBlockWritesPerSecond(ulong))
+        if (snap.blockWritesPerSecond.exists)
         {
-            inst.BlockWritesPerSecond_value(ulong);
+            inst.BlockWritesPerSecond_value(snap.blockWritesPerSecond.value);
         }
 
-        if (processinst->GetBlockReadsPerSecond(ulong))
+        if (snap.blockReadsPerSecond.exists)
         {
-            inst.BlockReadsPerSecond_value(ulong);
+            inst.BlockReadsPerSecond_value(snap.blockReadsPerSecond.value);
         }
 
-        if (processinst->GetBlockTransfersPerSecond(ulong))
+        if (snap.blockTransfersPerSecond.exists)
         {
-            inst.BlockTransfersPerSecond_value(ulong);
+            inst.BlockTransfersPerSecond_value(snap.blockTransfersPerSecond.value);
         }
 
-        if (processinst->GetPercentUserTime(ulong))
+        if (snap.percentUserTime.exists)
         {
-            inst.PercentUserTime_value((unsigned char) ulong);
+            inst.PercentUserTime_value((unsigned char) snap.percentUserTime.value);
         }
 
-        if (processinst->GetPercentPrivilegedTime(ulong))
+        if (snap.percentPrivilegedTime.exists)
         {
-            inst.PercentPrivilegedTime_value((unsigned char) ulong);
+            inst.PercentPrivilegedTime_value((unsigned char) snap.percentPrivilegedTime.value);
         }
 
-        if (processinst->GetUsedMemory(ulong))
+        if (snap.usedMemory.exists)
         {
-            inst.UsedMemory_value(ulong);
+            inst.UsedMemory_value(snap.usedMemory.value);
         }
 
-        if (processinst->GetPercentUsedMemory(ulong))
+        if (snap.percentUsedMemory.exists)
         {
-            inst.PercentUsedMemory_value((unsigned char) ulong);
+            inst.PercentUsedMemory_value((unsigned char) snap.percentUsedMemory.value);
         }
 
-        if (processinst->GetPagesReadPerSec(ulong))
+        if (snap.pagesReadPerSec.exists)
         {
-            inst.PagesReadPerSec_value(ulong);
+            inst.PagesReadPerSec_value(snap.pagesReadPerSec.value);
         }
     }
-    context.Post(inst);
-}
+
+private:
+    bool m_keysOnly;
+    std::string m_csName;
+    std::string m_osName;
+};
 
 SCX_UnixProcessStatisticalInformation_Class_Provider::SCX_UnixProcessStatisticalInformation_Class_Provider(
     Module* module) :
@@ -231,25 +317,37 @@ void SCX_UnixProcessStatisticalInformation_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcessStatisticalInformation_Class_Provider::EnumerateInstances" )
     {
-        // Global lock for ProcessProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
-
-        SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), L"Process Provider EnumerateInstances");
-        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator();
-        processEnum->Update();
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_ProcessProvider.WarmUp(L"SCX_UnixProcessStatisticalInformation");
 
-        SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(L"Number of Processes = ", processEnum->Size()));
+        SCXCore::SnapshotEnumeration<UnixProcessStatisticsSnapshot> snapshots;
 
-        for(size_t i = 0; i < processEnum->Size(); i++)
         {
-            SCX_UnixProcessStatisticalInformation_Class proc;
-            EnumerateOneInstance(context, proc, keysOnly, processEnum->GetInstance(i));
+            // Global lock for ProcessProvider class (only held while copying the data)
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+
+            SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), L"Process Provider EnumerateInstances");
+            SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcessStatisticalInformation");
+            SCXCore::g_ProcessProvider.UpdateProcesses(false);
+
+            SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(L"Number of Processes = ", processEnum->Size()));
+
+            for(size_t i = 0; i < processEnum->Size(); i++)
+            {
+                CaptureOneInstance(snapshots.Add(), keysOnly, processEnum->GetInstance(i));
+            }
         }
+
+        std::string csName, osName;
+        GetScopingNames(csName, osName);
+        scxPexTimer.AddInstances(snapshots.Post<SCX_UnixProcessStatisticalInformation_Class>(context,
+            UnixProcessStatisticsBuilder(keysOnly, csName, osName)));
+
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_UnixProcessStatisticalInformation_Class_Provider::EnumerateInstances", SCXCore::g_ProcessProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_UnixProcessStatisticalInformation_Class_Provider::EnumerateInstances", SCXCore::g_ProcessProvider.GetLogHandle() );
 }
 
 void SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance(
@@ -260,8 +358,11 @@ void SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance(
 {
     SCXLogHandle& log = SCXCore::g_ProcessProvider.GetLogHandle();
 
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance" )
     {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_ProcessProvider.WarmUp(L"SCX_UnixProcessStatisticalInformation");
+
         // Global lock for ProcessProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
 
@@ -286,29 +387,12 @@ void SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance(
             return;
         }
 
-        SCXCoreLib::NameResolver mi;
-        std::string csName;
-        try {
-            csName = StrToMultibyte(mi.GetHostDomainname()).c_str();
-        } catch (SCXException& e){
-            SCX_LOGWARNING(log, StrAppend(
-                        StrAppend(L"Can't read host/domainname because ", e.What()),
-                        e.Where()));
-        }
-
-        SCXSystemLib::SCXOSTypeInfo osinfo;
-        std::string osName;
-        try {
-            osName = StrToMultibyte(osinfo.GetOSName(true)).c_str();
-        } catch (SCXException& e){
-            SCX_LOGWARNING(log, StrAppend(
-                        StrAppend(L"Can't read OS name because ", e.What()),
-                        e.Where()));
-        }
+        std::string csName, osName;
+        GetScopingNames(csName, osName);
 
         SCX_LOGTRACE(log, L"Process Provider GetInstances");
-        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator();
-        processEnum->Update();
+        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcessStatisticalInformation");
+        SCXCore::g_ProcessProvider.UpdateProcesses(false);
 
         SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processInst =
             processEnum->GetInstance(StrFromMultibyte(instanceName.Handle_value().Str()));
@@ -333,12 +417,16 @@ void SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance(
         }
 
         // Found a Match. Enumerate the properties for the instance.
+        UnixProcessStatisticsSnapshot snap;
+        CaptureOneInstance(snap, false, processInst);
+
         SCX_UnixProcessStatisticalInformation_Class proc;
-        EnumerateOneInstance(context, proc, false, processInst);
+        UnixProcessStatisticsBuilder(false, csName, osName)(snap, proc);
+        context.Post(proc);
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstances", log );
+    SCX_PEX_END_TIMED( L"SCX_UnixProcessStatisticalInformation_Class_Provider::GetInstance", log );
 }
 
 void SCX_UnixProcessStatisticalInformation_Class_Provider::CreateInstance(
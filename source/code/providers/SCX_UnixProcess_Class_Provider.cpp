@@ -23,6 +23,7 @@
 #include <scxsystemlib/processinstance.h>
 #include "support/scxcimutils.h"
 #include "support/processprovider.h"
+#include "support/snapshotenumeration.h"
 #include <sstream>
 
 using namespace SCXSystemLib;
@@ -36,23 +37,75 @@ namespace SCXCore
 
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(Context& context,
-        SCX_UnixProcess_Class& inst, bool keysOnly,
+/*----------------------------------------------------------------------------*/
+/**
+   Data copied out of a ProcessInstance while holding the provider lock
+*/
+struct UnixProcessSnapshot
+{
+    SCXCore::SnapshotValue<scxulong> pid;
+    SCXCore::SnapshotValue<std::wstring> otherExecutionDescription;
+    SCXCore::SnapshotValue<scxulong> kernelModeTime;
+    SCXCore::SnapshotValue<scxulong> userModeTime;
+    SCXCore::SnapshotValue<scxulong> workingSetSize;
+    SCXCore::SnapshotValue<scxulong> processSessionID;
+    SCXCore::SnapshotValue<std::string> processTTY;
+    SCXCore::SnapshotValue<std::string> modulePath;
+    SCXCore::SnapshotValue<std::vector<std::string> > parameters;
+    SCXCore::SnapshotValue<std::string> processWaitingForEvent;
+    SCXCore::SnapshotValue<std::string> name;
+    SCXCore::SnapshotValue<unsigned int> priority;
+    SCXCore::SnapshotValue<unsigned short> executionState;
+    SCXCore::SnapshotValue<SCXCoreLib::SCXCalendarTime> creationDate;
+    SCXCore::SnapshotValue<SCXCoreLib::SCXCalendarTime> terminationDate;
+    SCXCore::SnapshotValue<int> parentProcessID;
+    SCXCore::SnapshotValue<scxulong> realUserID;
+    SCXCore::SnapshotValue<scxulong> processGroupID;
+    SCXCore::SnapshotValue<unsigned int> processNiceValue;
+    SCXCore::SnapshotValue<scxulong> percentUserTime;
+    SCXCore::SnapshotValue<scxulong> percentPrivilegedTime;
+    SCXCore::SnapshotValue<scxulong> usedMemory;
+};
+
+static void CaptureOneInstance(
+        UnixProcessSnapshot& snap, bool keysOnly,
         SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst)
 {
-    SCXLogHandle& log = SCXCore::g_ProcessProvider.GetLogHandle();
+    snap.pid.exists = processinst->GetPID(snap.pid.value);
 
-    // Add the key properties first.
-    scxulong pid;
-    if (processinst->GetPID(pid))
+    if (!keysOnly)
     {
-        inst.Handle_value(StrToUTF8(StrFrom(pid)).c_str());
+        snap.otherExecutionDescription.exists = processinst->GetOtherExecutionDescription(snap.otherExecutionDescription.value);
+        snap.kernelModeTime.exists = processinst->GetKernelModeTime(snap.kernelModeTime.value);
+        snap.userModeTime.exists = processinst->GetUserModeTime(snap.userModeTime.value);
+        snap.workingSetSize.exists = processinst->GetWorkingSetSize(snap.workingSetSize.value);
+        snap.processSessionID.exists = processinst->GetProcessSessionID(snap.processSessionID.value);
+        snap.processTTY.exists = processinst->GetProcessTTY(snap.processTTY.value);
+        snap.modulePath.exists = processinst->GetModulePath(snap.modulePath.value);
+        snap.parameters.exists = processinst->GetParameters(snap.parameters.value);
+        snap.processWaitingForEvent.exists = processinst->GetProcessWaitingForEvent(snap.processWaitingForEvent.value);
+        snap.name.exists = processinst->GetName(snap.name.value);
+        snap.priority.exists = processinst->GetNormalizedWin32Priority(snap.priority.value);
+        snap.executionState.exists = processinst->GetExecutionState(snap.executionState.value);
+        snap.creationDate.exists = processinst->GetCreationDate(snap.creationDate.value);
+        snap.terminationDate.exists = processinst->GetTerminationDate(snap.terminationDate.value);
+        snap.parentProcessID.exists = processinst->GetParentProcessID(snap.parentProcessID.value);
+        snap.realUserID.exists = processinst->GetRealUserID(snap.realUserID.value);
+        snap.processGroupID.exists = processinst->GetProcessGroupID(snap.processGroupID.value);
+        snap.processNiceValue.exists = processinst->GetProcessNiceValue(snap.processNiceValue.value);
+        snap.percentUserTime.exists = processinst->GetPercentUserTime(snap.percentUserTime.value);
+        snap.percentPrivilegedTime.exists = processinst->GetPercentPrivilegedTime(snap.percentPrivilegedTime.value);
+        snap.usedMemory.exists = processinst->GetUsedMemory(snap.usedMemory.value);
     }
-    
-    // Add keys of scoping operating system
+}
+
+static void GetScopingNames(std::string& csName, std::string& osName)
+{
+    SCXLogHandle& log = SCXCore::g_ProcessProvider.GetLogHandle();
+
     try {
         SCXCoreLib::NameResolver mi;
-        inst.CSName_value(StrToMultibyte(mi.GetHostDomainname()).c_str());
+        csName = StrToMultibyte(mi.GetHostDomainname());
     } catch (SCXException& e){
         SCX_LOGWARNING(log, StrAppend(
                     StrAppend(L"Can't read host/domainname because ", e.What()),
@@ -61,69 +114,94 @@ static void EnumerateOneInstance(Context& context,
 
     try {
         SCXSystemLib::SCXOSTypeInfo osinfo;
-        inst.OSName_value(StrToMultibyte(osinfo.GetOSName(true)).c_str());
+        osName = StrToMultibyte(osinfo.GetOSName(true));
     } catch (SCXException& e){
         SCX_LOGWARNING(log, StrAppend(
                     StrAppend(L"Can't read OS name because ", e.What()),
                     e.Where()));
     }
+}
 
-    inst.CSCreationClassName_value("SCX_ComputerSystem");
-    inst.OSCreationClassName_value("SCX_OperatingSystem");
-    inst.CreationClassName_value("SCX_UnixProcess");
-
+/*----------------------------------------------------------------------------*/
+/**
+   Builds an SCX_UnixProcess instance from a snapshot (called without the lock)
+*/
+class UnixProcessBuilder
+{
+public:
+    UnixProcessBuilder(bool keysOnly, const std::string& csName, const std::string& osName)
+        : m_keysOnly(keysOnly), m_csName(csName), m_osName(osName)
+    {
+    }
 
-    if (!keysOnly)
+    void operator()(const UnixProcessSnapshot& snap, SCX_UnixProcess_Class& inst) const
     {
-        std::string name("");
-        std::vector<std::string> params;
-        std::wstring str(L"");
-        unsigned int uint = 0;
-        unsigned short ushort = 0;
-        scxulong ulong = 0, ulong1 = 0;
-        SCXCoreLib::SCXCalendarTime ctime;
-        int ppid = 0;
+        // Add the key properties first.
+        if (snap.pid.exists)
+        {
+            inst.Handle_value(StrToUTF8(StrFrom(snap.pid.value)).c_str());
+        }
+
+        // Add keys of scoping operating system
+        if (!m_csName.empty())
+        {
+            inst.CSName_value(m_csName.c_str());
+        }
+        if (!m_osName.empty())
+        {
+            inst.OSName_value(m_osName.c_str());
+        }
+
+        inst.CSCreationClassName_value("SCX_ComputerSystem");
+        inst.OSCreationClassName_value("SCX_OperatingSystem");
+        inst.CreationClassName_value("SCX_UnixProcess");
+
+        if (m_keysOnly)
+        {
+            return;
+        }
 
         inst.Description_value("A snapshot of a current process");
         inst.Caption_value("Unix process information");
 
-        if (processinst->GetOtherExecutionDescription(str))
+        if (snap.otherExecutionDescription.exists)
         {
-            inst.OtherExecutionDescription_value(StrToUTF8(str).c_str());
+            inst.OtherExecutionDescription_value(StrToUTF8(snap.otherExecutionDescription.value).c_str());
         }
 
-        if (processinst->GetKernelModeTime(ulong))
+        if (snap.kernelModeTime.exists)
         {
-            inst.KernelModeTime_value(ulong);
+            inst.KernelModeTime_value(snap.kernelModeTime.value);
         }
 
-        if (processinst->GetUserModeTime(ulong))
+        if (snap.userModeTime.exists)
         {
-            inst.UserModeTime_value(ulong);
+            inst.UserModeTime_value(snap.userModeTime.value);
         }
 
-        if (processinst->GetWorkingSetSize(ulong))
+        if (snap.workingSetSize.exists)
         {
-            inst.WorkingSetSize_value(ulong);
+            inst.WorkingSetSize_value(snap.workingSetSize.value);
         }
 
-        if (processinst->GetProcessSessionID(ulong))
+        if (snap.processSessionID.exists)
         {
-            inst.ProcessSessionID_value(ulong);
+            inst.ProcessSessionID_value(snap.processSessionID.value);
         }
 
-        if (processinst->GetProcessTTY(name))
+        if (snap.processTTY.exists)
         {
-            inst.ProcessTTY_value(name.c_str());
+            inst.ProcessTTY_value(snap.processTTY.value.c_str());
         }
 
-        if (processinst->GetModulePath(name))
+        if (snap.modulePath.exists)
         {
-            inst.ModulePath_value(name.c_str());
+            inst.ModulePath_value(snap.modulePath.value.c_str());
         }
 
-        if (processinst->GetParameters(params))
+        if (snap.parameters.exists && !snap.parameters.value.empty())
         {
+            const std::vector<std::string>& params = snap.parameters.value;
             std::vector<mi::String> strArrary;
             for (std::vector<std::string>::const_iterator iter = params.begin();
                     iter != params.end(); ++iter)
@@ -132,74 +210,80 @@ static void EnumerateOneInstance(Context& context,
             }
             mi::StringA props(&strArrary[0], static_cast<MI_Uint32>(params.size()));
             inst.Parameters_value(props);
-        } 
+        }
 
-        if (processinst->GetProcessWaitingForEvent(name))
+        if (snap.processWaitingForEvent.exists)
         {
-            inst.ProcessWaitingForEvent_value(name.c_str());
+            inst.ProcessWaitingForEvent_value(snap.processWaitingForEvent.value.c_str());
         }
 
-        if (processinst->GetName(name))
+        if (snap.name.exists)
         {
-            inst.Name_value(name.c_str());
+            inst.Name_value(snap.name.value.c_str());
         }
 
-        if (processinst->GetNormalizedWin32Priority(uint))
+        if (snap.priority.exists)
         {
-            inst.Priority_value(uint);
+            inst.Priority_value(snap.priority.value);
         }
 
-        if (processinst->GetExecutionState(ushort))
+        if (snap.executionState.exists)
         {
-            inst.ExecutionState_value(ushort);
+            inst.ExecutionState_value(snap.executionState.value);
         }
 
-        if (processinst->GetCreationDate(ctime))
+        if (snap.creationDate.exists)
         {
-            MI_Datetime creationDate; 
+            MI_Datetime creationDate;
+            SCXCoreLib::SCXCalendarTime ctime(snap.creationDate.value);
             CIMUtils::ConvertToCIMDatetime(creationDate, ctime);
             inst.CreationDate_value(creationDate);
         }
 
-        if (processinst->GetTerminationDate(ctime))
+        if (snap.terminationDate.exists)
         {
-            MI_Datetime terminationDate; 
+            MI_Datetime terminationDate;
+            SCXCoreLib::SCXCalendarTime ctime(snap.terminationDate.value);
             CIMUtils::ConvertToCIMDatetime(terminationDate, ctime);
             inst.TerminationDate_value(terminationDate);
         }
 
-        if (processinst->GetParentProcessID(ppid))
+        if (snap.parentProcessID.exists)
         {
-            inst.ParentProcessID_value(StrToUTF8(StrFrom(ppid)).c_str());
+            inst.ParentProcessID_value(StrToUTF8(StrFrom(snap.parentProcessID.value)).c_str());
         }
 
-        if (processinst->GetRealUserID(ulong))
+        if (snap.realUserID.exists)
         {
-            inst.RealUserID_value(ulong);
+            inst.RealUserID_value(snap.realUserID.value);
         }
 
-        if (processinst->GetProcessGroupID(ulong))
+        if (snap.processGroupID.exists)
         {
-            inst.ProcessGroupID_value( ulong);
+            inst.ProcessGroupID_value(snap.processGroupID.value);
         }
 
-        if (processinst->GetProcessNiceValue(uint))
+        if (snap.processNiceValue.exists)
         {
-            inst.ProcessNiceValue_value(uint);
+            inst.ProcessNiceValue_value(snap.processNiceValue.value);
         }
 
-        if (processinst->GetPercentUserTime(ulong) && processinst->GetPercentPrivilegedTime(ulong1))
+        if (snap.percentUserTime.exists && snap.percentPrivilegedTime.exists)
         {
-            inst.PercentBusyTime_value((unsigned char) (ulong + ulong1));
+            inst.PercentBusyTime_value((unsigned char) (snap.percentUserTime.value + snap.percentPrivilegedTime.value));
         }
 
-        if (processinst->GetUsedMemory(ulong))
+        if (snap.usedMemory.exists)
         {
-            inst.UsedMemory_value(ulong);
+            inst.UsedMemory_value(snap.usedMemory.value);
         }
     }
-    context.Post(inst);
-}
+
+private:
+    bool m_keysOnly;
+    std::string m_csName;
+    std::string m_osName;
+};
 
 SCX_UnixProcess_Class_Provider::SCX_UnixProcess_Class_Provider(
     Module* module) :
@@ -254,25 +338,33 @@ void SCX_UnixProcess_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::EnumerateInstances" )
     {
-        // Global lock for ProcessProvider class
-        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        SCXCore::SnapshotEnumeration<UnixProcessSnapshot> snapshots;
+
+        {
+            // Global lock for ProcessProvider class (only held while copying the data)
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
 
-        SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), L"Process Provider EnumerateInstances");
-        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator();
-        processEnum->Update();
+            SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), L"Process Provider EnumerateInstances");
+            SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcess");
+            SCXCore::g_ProcessProvider.UpdateProcesses(true);
 
-        SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(L"Number of Processes = ", processEnum->Size()));
+            SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(L"Number of Processes = ", processEnum->Size()));
 
-        for(size_t i = 0; i < processEnum->Size(); i++)
-        {
-            SCX_UnixProcess_Class proc;
-            EnumerateOneInstance(context, proc, keysOnly, processEnum->GetInstance(i));
+            for(size_t i = 0; i < processEnum->Size(); i++)
+            {
+                CaptureOneInstance(snapshots.Add(), keysOnly, processEnum->GetInstance(i));
+            }
         }
+
+        std::string csName, osName;
+        GetScopingNames(csName, osName);
+        scxPexTimer.AddInstances(snapshots.Post<SCX_UnixProcess_Class>(context, UnixProcessBuilder(keysOnly, csName, osName)));
+
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_UnixProcess_Class_Provider::EnumerateInstances", SCXCore::g_ProcessProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::EnumerateInstances", SCXCore::g_ProcessProvider.GetLogHandle() );
 }
 
 void SCX_UnixProcess_Class_Provider::GetInstance(
@@ -281,7 +373,7 @@ void SCX_UnixProcess_Class_Provider::GetInstance(
     const SCX_UnixProcess_Class& instanceName,
     const PropertySet& propertySet)
 {
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::GetInstance" )
     {
         // Global lock for ProcessProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
@@ -302,25 +394,8 @@ void SCX_UnixProcess_Class_Provider::GetInstance(
             return;
         }
 
-        std::string csName;
-        try {
-            NameResolver mi;
-            csName = StrToMultibyte(mi.GetHostDomainname()).c_str();
-        } catch (SCXException& e) {
-            SCX_LOGWARNING(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(
-                               StrAppend(L"Can't read host/domainname because ", e.What()),
-                               e.Where()));
-        }
-
-        std::string osName;
-        try {
-            SCXSystemLib::SCXOSTypeInfo osinfo;
-            osName = StrToMultibyte(osinfo.GetOSName(true)).c_str();
-        } catch (SCXException& e){
-            SCX_LOGWARNING(SCXCore::g_ProcessProvider.GetLogHandle(), StrAppend(
-                        StrAppend(L"Can't read OS name because ", e.What()),
-                        e.Where()));
-        }
+        std::string csName, osName;
+        GetScopingNames(csName, osName);
 
         // Now compare (case insensitive for the class names, case sensitive for the others)
         if ( 0 != strcasecmp("SCX_ComputerSystem", instanceName.CSCreationClassName_value().Str())
@@ -340,8 +415,8 @@ void SCX_UnixProcess_Class_Provider::GetInstance(
         }
 
         SCX_LOGTRACE(SCXCore::g_ProcessProvider.GetLogHandle(), L"Process Provider GetInstances");
-        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator();
-        processEnum->Update();
+        SCXHandle<SCXSystemLib::ProcessEnumeration> processEnum = SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcess");
+        SCXCore::g_ProcessProvider.UpdateProcesses(true);
 
         SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processInst = processEnum->GetInstance(
             StrFromMultibyte(instanceName.Handle_value().Str()));
@@ -354,12 +429,16 @@ void SCX_UnixProcess_Class_Provider::GetInstance(
         }
 
         // Found a Match. Enumerate the properties for the instance.
+        UnixProcessSnapshot snap;
+        CaptureOneInstance(snap, false, processInst);
+
         SCX_UnixProcess_Class proc;
-        EnumerateOneInstance(context, proc, false, processInst);
+        UnixProcessBuilder(false, csName, osName)(snap, proc);
+        context.Post(proc);
 
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_UnixProcess_Class_Provider::GetInstances", SCXCore::g_ProcessProvider.GetLogHandle() );
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::GetInstance", SCXCore::g_ProcessProvider.GetLogHandle() );
 
 
 }
@@ -405,8 +484,11 @@ void SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers(
     const SCX_UnixProcess_TopResourceConsumers_Class& in)
 {
     SCXCoreLib::SCXLogHandle log = SCXCore::g_ProcessProvider.GetLogHandle();
-    SCX_PEX_BEGIN
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers" )
     {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_ProcessProvider.WarmUp(L"SCX_UnixProcess");
+
         // Global lock for ProcessProvider class
         SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
         SCX_LOGTRACE( log, L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers" );
@@ -428,7 +510,189 @@ void SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers(
         context.Post(inst);
         context.Post(MI_RESULT_OK);
     }
-    SCX_PEX_END( L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers", log );
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumers", log );
+}
+
+void SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumerValues(
+    Context& context,
+    const String& nameSpace,
+    const SCX_UnixProcess_Class& instanceName,
+    const SCX_UnixProcess_TopResourceConsumerValues_Class& in)
+{
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_ProcessProvider.GetLogHandle();
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumerValues" )
+    {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_ProcessProvider.WarmUp(L"SCX_UnixProcess");
+
+        // Global lock for ProcessProvider class
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        SCX_LOGTRACE( log, L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumerValues" );
+
+        // Validate that we have mandatory arguments
+        if ( !in.count_exists() || !in.resource_exists() )
+        {
+            SCX_LOGTRACE( log, L"Missing arguments to Invoke_TopResourceConsumerValues method" );
+            context.Post(MI_RESULT_INVALID_PARAMETER);
+            return;
+        }
+        std::wstring resourceStr = StrFromUTF8(in.resource_value().Str());
+        scxulong threshold = in.threshold_exists() ? in.threshold_value() : 0;
+
+        std::vector<SCXCore::ProcessProvider::ResourceConsumer> consumers;
+        SCXCore::g_ProcessProvider.GetTopResourceConsumers(resourceStr, in.count_value(), threshold, consumers);
+        scxPexTimer.AddInstances(consumers.size());
+
+        std::vector<Uint64> pids, values;
+        std::vector<mi::String> names;
+        pids.reserve(consumers.size());
+        values.reserve(consumers.size());
+        names.reserve(consumers.size());
+        for (size_t i = 0; i < consumers.size(); i++)
+        {
+            pids.push_back(consumers[i].hasPID ? consumers[i].pid : 0);
+            names.push_back(consumers[i].hasName ? mi::String(consumers[i].name.c_str()) : mi::String("<unknown>"));
+            values.push_back(consumers[i].value);
+        }
+
+        SCX_UnixProcess_TopResourceConsumerValues_Class inst;
+        if ( ! consumers.empty() )
+        {
+            inst.PIDs_value(Uint64A(&pids[0], static_cast<MI_Uint32>(pids.size())));
+            inst.Names_value(StringA(&names[0], static_cast<MI_Uint32>(names.size())));
+            inst.Values_value(Uint64A(&values[0], static_cast<MI_Uint32>(values.size())));
+        }
+        inst.MIReturn_value(true);
+
+        context.Post(inst);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_TopResourceConsumerValues", log );
+}
+
+void SCX_UnixProcess_Class_Provider::Invoke_AggregateProcesses(
+    Context& context,
+    const String& nameSpace,
+    const SCX_UnixProcess_Class& instanceName,
+    const SCX_UnixProcess_AggregateProcesses_Class& in)
+{
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_ProcessProvider.GetLogHandle();
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_AggregateProcesses" )
+    {
+        // Waits (without the lock) if sampling resumes for this query
+        SCXCore::g_ProcessProvider.WarmUp(L"SCX_UnixProcess");
+
+        // Global lock for ProcessProvider class
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        SCX_LOGTRACE( log, L"SCX_UnixProcess_Class_Provider::Invoke_AggregateProcesses" );
+
+        // Validate that we have mandatory arguments
+        if ( !in.groupBy_exists() )
+        {
+            SCX_LOGTRACE( log, L"Missing arguments to Invoke_AggregateProcesses method" );
+            context.Post(MI_RESULT_INVALID_PARAMETER);
+            return;
+        }
+        std::wstring groupByStr = StrFromUTF8(in.groupBy_value().Str());
+
+        std::vector<SCXCore::ProcessProvider::ProcessGroup> groups;
+        SCXCore::g_ProcessProvider.AggregateProcesses(groupByStr, groups);
+        scxPexTimer.AddInstances(groups.size());
+
+        std::vector<mi::String> keys;
+        std::vector<Uint64> counts, busyTimes, usedMemory, blockReads, blockWrites;
+        keys.reserve(groups.size());
+        counts.reserve(groups.size());
+        busyTimes.reserve(groups.size());
+        usedMemory.reserve(groups.size());
+        blockReads.reserve(groups.size());
+        blockWrites.reserve(groups.size());
+        for (size_t i = 0; i < groups.size(); i++)
+        {
+            keys.push_back(mi::String(groups[i].key.c_str()));
+            counts.push_back(groups[i].count);
+            busyTimes.push_back(groups[i].percentBusyTime);
+            usedMemory.push_back(groups[i].usedMemory);
+            blockReads.push_back(groups[i].blockReadsPerSecond);
+            blockWrites.push_back(groups[i].blockWritesPerSecond);
+        }
+
+        SCX_UnixProcess_AggregateProcesses_Class inst;
+        if ( ! groups.empty() )
+        {
+            MI_Uint32 size = static_cast<MI_Uint32>(groups.size());
+            inst.Groups_value(StringA(&keys[0], size));
+            inst.Counts_value(Uint64A(&counts[0], size));
+            inst.PercentBusyTimes_value(Uint64A(&busyTimes[0], size));
+            inst.UsedMemory_value(Uint64A(&usedMemory[0], size));
+            inst.BlockReadsPerSecond_value(Uint64A(&blockReads[0], size));
+            inst.BlockWritesPerSecond_value(Uint64A(&blockWrites[0], size));
+        }
+        inst.MIReturn_value(true);
+
+        context.Post(inst);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_AggregateProcesses", log );
+}
+
+void SCX_UnixProcess_Class_Provider::Invoke_EnumerateChanges(
+    Context& context,
+    const String& nameSpace,
+    const SCX_UnixProcess_Class& instanceName,
+    const SCX_UnixProcess_EnumerateChanges_Class& in)
+{
+    SCXCoreLib::SCXLogHandle log = SCXCore::g_ProcessProvider.GetLogHandle();
+    SCX_PEX_BEGIN_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_EnumerateChanges" )
+    {
+        // Global lock for ProcessProvider class
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        SCX_LOGTRACE( log, L"SCX_UnixProcess_Class_Provider::Invoke_EnumerateChanges" );
+
+        // A missing token asks for a full resync, like an empty one
+        std::wstring token = in.token_exists() ? StrFromUTF8(in.token_value().Str()) : L"";
+
+        std::vector<SCXCore::ProcessChange> changes;
+        std::wstring nextToken;
+        bool fullResync = SCXCore::g_ProcessProvider.GetProcessChanges(token, changes, nextToken);
+        scxPexTimer.AddInstances(changes.size());
+
+        std::vector<Uint16> types, states;
+        std::vector<Uint64> pids;
+        std::vector<mi::String> startTimes, names;
+        types.reserve(changes.size());
+        states.reserve(changes.size());
+        pids.reserve(changes.size());
+        startTimes.reserve(changes.size());
+        names.reserve(changes.size());
+        for (size_t i = 0; i < changes.size(); i++)
+        {
+            const SCXCore::ProcessRecord& process = changes[i].process;
+            types.push_back(static_cast<Uint16>(changes[i].type));
+            pids.push_back(process.pid);
+            startTimes.push_back(mi::String(StrToUTF8(process.startTime).c_str()));
+            names.push_back(mi::String(process.name.c_str()));
+            states.push_back(process.executionState);
+        }
+
+        SCX_UnixProcess_EnumerateChanges_Class inst;
+        inst.NextToken_value(StrToUTF8(nextToken).c_str());
+        inst.FullResync_value(fullResync);
+        if ( ! changes.empty() )
+        {
+            MI_Uint32 size = static_cast<MI_Uint32>(changes.size());
+            inst.Changes_value(Uint16A(&types[0], size));
+            inst.PIDs_value(Uint64A(&pids[0], size));
+            inst.StartTimes_value(StringA(&startTimes[0], size));
+            inst.Names_value(StringA(&names[0], size));
+            inst.ExecutionStates_value(Uint16A(&states[0], size));
+        }
+        inst.MIReturn_value(true);
+
+        context.Post(inst);
+        context.Post(MI_RESULT_OK);
+    }
+    SCX_PEX_END_TIMED( L"SCX_UnixProcess_Class_Provider::Invoke_EnumerateChanges", log );
 }
 
 
@@ -76,6 +76,24 @@ public:
         const SCX_UnixProcess_Class& instanceName,
         const SCX_UnixProcess_TopResourceConsumers_Class& in);
 
+    void Invoke_TopResourceConsumerValues(
+        Context& context,
+        const String& nameSpace,
+        const SCX_UnixProcess_Class& instanceName,
+        const SCX_UnixProcess_TopResourceConsumerValues_Class& in);
+
+    void Invoke_AggregateProcesses(
+        Context& context,
+        const String& nameSpace,
+        const SCX_UnixProcess_Class& instanceName,
+        const SCX_UnixProcess_AggregateProcesses_Class& in);
+
+    void Invoke_EnumerateChanges(
+        Context& context,
+        const String& nameSpace,
+        const SCX_UnixProcess_Class& instanceName,
+        const SCX_UnixProcess_EnumerateChanges_Class& in);
+
 /* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
 };
 
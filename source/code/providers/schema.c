@@ -18,10 +18,12 @@
 #include "SCX_LANEndpoint.h"
 #include "SCX_IPProtocolEndpoint.h"
 #include "SCX_LogFile.h"
+#include "SCX_LogFileMatchIndication.h"
 #include "SCX_MemoryStatisticalInformation.h"
 #include "SCX_OperatingSystem.h"
 #include "SCX_ProcessorStatisticalInformation.h"
 #include "SCX_RTProcessorStatisticalInformation.h"
+#include "SCX_StatisticalThresholdIndication.h"
 #include "SCX_UnixProcess.h"
 #include "SCX_UnixProcessStatisticalInformation.h"
 
@@ -992,6 +994,23 @@ static MI_CONST MI_PropertyDecl SCX_Agent_LogicalProcessors_prop =
     NULL,
 };
 
+/* property SCX_Agent.ProviderMetrics */
+static MI_CONST MI_PropertyDecl SCX_Agent_ProviderMetrics_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0070730F, /* code */
+    MI_T("ProviderMetrics"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_Agent, ProviderMetrics), /* offset */
+    MI_T("SCX_Agent"), /* origin */
+    MI_T("SCX_Agent"), /* propagator */
+    NULL,
+};
+
 static MI_PropertyDecl MI_CONST* MI_CONST SCX_Agent_props[] =
 {
     &CIM_ManagedElement_InstanceID_prop,
@@ -1026,6 +1045,7 @@ static MI_PropertyDecl MI_CONST* MI_CONST SCX_Agent_props[] =
     &SCX_Agent_MachineType_prop,
     &SCX_Agent_PhysicalProcessors_prop,
     &SCX_Agent_LogicalProcessors_prop,
+    &SCX_Agent_ProviderMetrics_prop,
 };
 
 static MI_CONST MI_ProviderFT SCX_Agent_funcs =
@@ -12721,6 +12741,20 @@ static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRows_elevationType_param
     offsetof(SCX_LogFile_GetMatchedRows, elevationType), /* offset */
 };
 
+/* parameter SCX_LogFile.GetMatchedRows(): scanTimeBudget */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRows_scanTimeBudget_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x0073740E, /* code */
+    MI_T("scanTimeBudget"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRows, scanTimeBudget), /* offset */
+};
+
 /* parameter SCX_LogFile.GetMatchedRows(): MIReturn */
 static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRows_MIReturn_param =
 {
@@ -12743,6 +12777,7 @@ static MI_ParameterDecl MI_CONST* MI_CONST SCX_LogFile_GetMatchedRows_params[] =
     &SCX_LogFile_GetMatchedRows_qid_param,
     &SCX_LogFile_GetMatchedRows_rows_param,
     &SCX_LogFile_GetMatchedRows_elevationType_param,
+    &SCX_LogFile_GetMatchedRows_scanTimeBudget_param,
 };
 
 /* method SCX_LogFile.GetMatchedRows() */
@@ -12860,10 +12895,168 @@ MI_CONST MI_MethodDecl SCX_LogFile_ResetStateFile_rtti =
     (MI_ProviderFT_Invoke)SCX_LogFile_Invoke_ResetStateFile, /* method */
 };
 
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): filename */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_filename_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00666508, /* code */
+    MI_T("filename"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, filename), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): qids */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_qids_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00717304, /* code */
+    MI_T("qids"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, qids), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): regexps */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_regexps_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00727307, /* code */
+    MI_T("regexps"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, regexps), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): regexpQids */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_regexpQids_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x0072730A, /* code */
+    MI_T("regexpQids"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, regexpQids), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_LogFile_GetMatchedRowsBatch_rows_ArrayType_qual_value = MI_T("Ordered");
+
+static MI_CONST MI_Qualifier SCX_LogFile_GetMatchedRowsBatch_rows_ArrayType_qual =
+{
+    MI_T("ArrayType"),
+    MI_STRING,
+    MI_FLAG_DISABLEOVERRIDE|MI_FLAG_TOSUBCLASS,
+    &SCX_LogFile_GetMatchedRowsBatch_rows_ArrayType_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_LogFile_GetMatchedRowsBatch_rows_quals[] =
+{
+    &SCX_LogFile_GetMatchedRowsBatch_rows_ArrayType_qual,
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): rows */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_rows_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00727304, /* code */
+    MI_T("rows"), /* name */
+    SCX_LogFile_GetMatchedRowsBatch_rows_quals, /* qualifiers */
+    MI_COUNT(SCX_LogFile_GetMatchedRowsBatch_rows_quals), /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, rows), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): elevationType */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_elevationType_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x0065650D, /* code */
+    MI_T("elevationType"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, elevationType), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): scanTimeBudget */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_scanTimeBudget_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x0073740E, /* code */
+    MI_T("scanTimeBudget"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, scanTimeBudget), /* offset */
+};
+
+/* parameter SCX_LogFile.GetMatchedRowsBatch(): MIReturn */
+static MI_CONST MI_ParameterDecl SCX_LogFile_GetMatchedRowsBatch_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFile_GetMatchedRowsBatch, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST SCX_LogFile_GetMatchedRowsBatch_params[] =
+{
+    &SCX_LogFile_GetMatchedRowsBatch_MIReturn_param,
+    &SCX_LogFile_GetMatchedRowsBatch_filename_param,
+    &SCX_LogFile_GetMatchedRowsBatch_qids_param,
+    &SCX_LogFile_GetMatchedRowsBatch_regexps_param,
+    &SCX_LogFile_GetMatchedRowsBatch_regexpQids_param,
+    &SCX_LogFile_GetMatchedRowsBatch_rows_param,
+    &SCX_LogFile_GetMatchedRowsBatch_elevationType_param,
+    &SCX_LogFile_GetMatchedRowsBatch_scanTimeBudget_param,
+};
+
+/* method SCX_LogFile.GetMatchedRowsBatch() */
+MI_CONST MI_MethodDecl SCX_LogFile_GetMatchedRowsBatch_rtti =
+{
+    MI_FLAG_METHOD|MI_FLAG_STATIC, /* flags */
+    0x00676813, /* code */
+    MI_T("GetMatchedRowsBatch"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    SCX_LogFile_GetMatchedRowsBatch_params, /* parameters */
+    MI_COUNT(SCX_LogFile_GetMatchedRowsBatch_params), /* numParameters */
+    sizeof(SCX_LogFile_GetMatchedRowsBatch), /* size */
+    MI_UINT32, /* returnType */
+    MI_T("SCX_LogFile"), /* origin */
+    MI_T("SCX_LogFile"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)SCX_LogFile_Invoke_GetMatchedRowsBatch, /* method */
+};
+
 static MI_MethodDecl MI_CONST* MI_CONST SCX_LogFile_meths[] =
 {
     &SCX_LogFile_GetMatchedRows_rtti,
     &SCX_LogFile_ResetStateFile_rtti,
+    &SCX_LogFile_GetMatchedRowsBatch_rtti,
 };
 
 static MI_CONST MI_ProviderFT SCX_LogFile_funcs =
@@ -12933,130 +13126,488 @@ MI_CONST MI_ClassDecl SCX_LogFile_rtti =
 /*
 **==============================================================================
 **
-** SCX_MemoryStatisticalInformation
+** CIM_Indication
 **
 **==============================================================================
 */
 
-static MI_CONST MI_Uint32 SCX_MemoryStatisticalInformation_Caption_MaxLen_qual_value = 64U;
+/* property CIM_Indication.IndicationIdentifier */
+static MI_CONST MI_PropertyDecl CIM_Indication_IndicationIdentifier_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00697214, /* code */
+    MI_T("IndicationIdentifier"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, IndicationIdentifier), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
+};
 
-static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Caption_MaxLen_qual =
+/* property CIM_Indication.CorrelatedIndications */
+static MI_CONST MI_PropertyDecl CIM_Indication_CorrelatedIndications_prop =
 {
-    MI_T("MaxLen"),
-    MI_UINT32,
-    0,
-    &SCX_MemoryStatisticalInformation_Caption_MaxLen_qual_value
+    MI_FLAG_PROPERTY, /* flags */
+    0x00637315, /* code */
+    MI_T("CorrelatedIndications"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, CorrelatedIndications), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_Caption_quals[] =
+/* property CIM_Indication.IndicationTime */
+static MI_CONST MI_PropertyDecl CIM_Indication_IndicationTime_prop =
 {
-    &SCX_MemoryStatisticalInformation_Caption_MaxLen_qual,
+    MI_FLAG_PROPERTY, /* flags */
+    0x0069650E, /* code */
+    MI_T("IndicationTime"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_DATETIME, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, IndicationTime), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Caption_value = MI_T("Memory information");
+/* property CIM_Indication.PerceivedSeverity */
+static MI_CONST MI_PropertyDecl CIM_Indication_PerceivedSeverity_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00707911, /* code */
+    MI_T("PerceivedSeverity"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT16, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, PerceivedSeverity), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
+};
 
-/* property SCX_MemoryStatisticalInformation.Caption */
-static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Caption_prop =
+/* property CIM_Indication.OtherSeverity */
+static MI_CONST MI_PropertyDecl CIM_Indication_OtherSeverity_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00636E07, /* code */
-    MI_T("Caption"), /* name */
-    SCX_MemoryStatisticalInformation_Caption_quals, /* qualifiers */
-    MI_COUNT(SCX_MemoryStatisticalInformation_Caption_quals), /* numQualifiers */
+    0x006F790D, /* code */
+    MI_T("OtherSeverity"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
     MI_STRING, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(SCX_MemoryStatisticalInformation, Caption), /* offset */
-    MI_T("CIM_ManagedElement"), /* origin */
-    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
-    &SCX_MemoryStatisticalInformation_Caption_value,
+    offsetof(CIM_Indication, OtherSeverity), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Description_value = MI_T("Memory usage and performance statistics");
-
-/* property SCX_MemoryStatisticalInformation.Description */
-static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Description_prop =
+/* property CIM_Indication.IndicationFilterName */
+static MI_CONST MI_PropertyDecl CIM_Indication_IndicationFilterName_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00646E0B, /* code */
-    MI_T("Description"), /* name */
+    0x00696514, /* code */
+    MI_T("IndicationFilterName"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_STRING, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(SCX_MemoryStatisticalInformation, Description), /* offset */
-    MI_T("CIM_ManagedElement"), /* origin */
-    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
-    &SCX_MemoryStatisticalInformation_Description_value,
+    offsetof(CIM_Indication, IndicationFilterName), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_CONST MI_Uint32 SCX_MemoryStatisticalInformation_Name_MaxLen_qual_value = 256U;
-
-static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Name_MaxLen_qual =
+/* property CIM_Indication.SequenceContext */
+static MI_CONST MI_PropertyDecl CIM_Indication_SequenceContext_prop =
 {
-    MI_T("MaxLen"),
-    MI_UINT32,
-    0,
-    &SCX_MemoryStatisticalInformation_Name_MaxLen_qual_value
+    MI_FLAG_PROPERTY, /* flags */
+    0x0073740F, /* code */
+    MI_T("SequenceContext"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, SequenceContext), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Name_Override_qual_value = MI_T("Name");
-
-static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Name_Override_qual =
+/* property CIM_Indication.SequenceNumber */
+static MI_CONST MI_PropertyDecl CIM_Indication_SequenceNumber_prop =
 {
-    MI_T("Override"),
-    MI_STRING,
-    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_RESTRICTED,
-    &SCX_MemoryStatisticalInformation_Name_Override_qual_value
+    MI_FLAG_PROPERTY, /* flags */
+    0x0073720E, /* code */
+    MI_T("SequenceNumber"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_SINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(CIM_Indication, SequenceNumber), /* offset */
+    MI_T("CIM_Indication"), /* origin */
+    MI_T("CIM_Indication"), /* propagator */
+    NULL,
 };
 
-static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_Name_quals[] =
+static MI_PropertyDecl MI_CONST* MI_CONST CIM_Indication_props[] =
 {
-    &SCX_MemoryStatisticalInformation_Name_MaxLen_qual,
-    &SCX_MemoryStatisticalInformation_Name_Override_qual,
+    &CIM_Indication_IndicationIdentifier_prop,
+    &CIM_Indication_CorrelatedIndications_prop,
+    &CIM_Indication_IndicationTime_prop,
+    &CIM_Indication_PerceivedSeverity_prop,
+    &CIM_Indication_OtherSeverity_prop,
+    &CIM_Indication_IndicationFilterName_prop,
+    &CIM_Indication_SequenceContext_prop,
+    &CIM_Indication_SequenceNumber_prop,
 };
 
-/* property SCX_MemoryStatisticalInformation.Name */
-static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Name_prop =
+static MI_CONST MI_Char* CIM_Indication_Version_qual_value = MI_T("2.29.0");
+
+static MI_CONST MI_Qualifier CIM_Indication_Version_qual =
 {
-    MI_FLAG_PROPERTY|MI_FLAG_KEY, /* flags */
-    0x006E6504, /* code */
-    MI_T("Name"), /* name */
-    SCX_MemoryStatisticalInformation_Name_quals, /* qualifiers */
-    MI_COUNT(SCX_MemoryStatisticalInformation_Name_quals), /* numQualifiers */
-    MI_STRING, /* type */
-    NULL, /* className */
-    0, /* subscript */
-    offsetof(SCX_MemoryStatisticalInformation, Name), /* offset */
-    MI_T("CIM_StatisticalInformation"), /* origin */
-    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
-    NULL,
+    MI_T("Version"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TRANSLATABLE|MI_FLAG_RESTRICTED,
+    &CIM_Indication_Version_qual_value
 };
 
-static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual_value = MI_T("MegaBytes");
+static MI_CONST MI_Char* CIM_Indication_UMLPackagePath_qual_value = MI_T("CIM::Event");
 
-static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual =
+static MI_CONST MI_Qualifier CIM_Indication_UMLPackagePath_qual =
 {
-    MI_T("Units"),
+    MI_T("UMLPackagePath"),
     MI_STRING,
-    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TOSUBCLASS|MI_FLAG_TRANSLATABLE,
-    &SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual_value
+    0,
+    &CIM_Indication_UMLPackagePath_qual_value
 };
 
-static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_AvailableMemory_quals[] =
+static MI_Qualifier MI_CONST* MI_CONST CIM_Indication_quals[] =
 {
-    &SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual,
+    &CIM_Indication_Version_qual,
+    &CIM_Indication_UMLPackagePath_qual,
 };
 
-/* property SCX_MemoryStatisticalInformation.AvailableMemory */
-static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_AvailableMemory_prop =
+/* class CIM_Indication */
+MI_CONST MI_ClassDecl CIM_Indication_rtti =
 {
-    MI_FLAG_PROPERTY, /* flags */
-    0x0061790F, /* code */
-    MI_T("AvailableMemory"), /* name */
-    SCX_MemoryStatisticalInformation_AvailableMemory_quals, /* qualifiers */
-    MI_COUNT(SCX_MemoryStatisticalInformation_AvailableMemory_quals), /* numQualifiers */
+    MI_FLAG_CLASS|MI_FLAG_INDICATION|MI_FLAG_ABSTRACT, /* flags */
+    0x00636E0E, /* code */
+    MI_T("CIM_Indication"), /* name */
+    CIM_Indication_quals, /* qualifiers */
+    MI_COUNT(CIM_Indication_quals), /* numQualifiers */
+    CIM_Indication_props, /* properties */
+    MI_COUNT(CIM_Indication_props), /* numProperties */
+    sizeof(CIM_Indication), /* size */
+    NULL, /* superClass */
+    NULL, /* superClassDecl */
+    NULL, /* methods */
+    0, /* numMethods */
+    &schemaDecl, /* schema */
+    NULL, /* functions */
+    NULL, /* owningClass */
+};
+
+/*
+**==============================================================================
+**
+** SCX_LogFileMatchIndication
+**
+**==============================================================================
+*/
+
+/* property SCX_LogFileMatchIndication.FileName */
+static MI_CONST MI_PropertyDecl SCX_LogFileMatchIndication_FileName_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00666508, /* code */
+    MI_T("FileName"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFileMatchIndication, FileName), /* offset */
+    MI_T("SCX_LogFileMatchIndication"), /* origin */
+    MI_T("SCX_LogFileMatchIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_LogFileMatchIndication.FilePosition */
+static MI_CONST MI_PropertyDecl SCX_LogFileMatchIndication_FilePosition_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00666E0C, /* code */
+    MI_T("FilePosition"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFileMatchIndication, FilePosition), /* offset */
+    MI_T("SCX_LogFileMatchIndication"), /* origin */
+    MI_T("SCX_LogFileMatchIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_LogFileMatchIndication.Regexp */
+static MI_CONST MI_PropertyDecl SCX_LogFileMatchIndication_Regexp_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727006, /* code */
+    MI_T("Regexp"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFileMatchIndication, Regexp), /* offset */
+    MI_T("SCX_LogFileMatchIndication"), /* origin */
+    MI_T("SCX_LogFileMatchIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_LogFileMatchIndication.RecordData */
+static MI_CONST MI_PropertyDecl SCX_LogFileMatchIndication_RecordData_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0072610A, /* code */
+    MI_T("RecordData"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_LogFileMatchIndication, RecordData), /* offset */
+    MI_T("SCX_LogFileMatchIndication"), /* origin */
+    MI_T("SCX_LogFileMatchIndication"), /* propagator */
+    NULL,
+};
+
+static MI_PropertyDecl MI_CONST* MI_CONST SCX_LogFileMatchIndication_props[] =
+{
+    &CIM_Indication_IndicationIdentifier_prop,
+    &CIM_Indication_CorrelatedIndications_prop,
+    &CIM_Indication_IndicationTime_prop,
+    &CIM_Indication_PerceivedSeverity_prop,
+    &CIM_Indication_OtherSeverity_prop,
+    &CIM_Indication_IndicationFilterName_prop,
+    &CIM_Indication_SequenceContext_prop,
+    &CIM_Indication_SequenceNumber_prop,
+    &SCX_LogFileMatchIndication_FileName_prop,
+    &SCX_LogFileMatchIndication_FilePosition_prop,
+    &SCX_LogFileMatchIndication_Regexp_prop,
+    &SCX_LogFileMatchIndication_RecordData_prop,
+};
+
+static MI_CONST MI_ProviderFT SCX_LogFileMatchIndication_funcs =
+{
+  (MI_ProviderFT_Load)SCX_LogFileMatchIndication_Load,
+  (MI_ProviderFT_Unload)SCX_LogFileMatchIndication_Unload,
+  (MI_ProviderFT_GetInstance)NULL,
+  (MI_ProviderFT_EnumerateInstances)NULL,
+  (MI_ProviderFT_CreateInstance)NULL,
+  (MI_ProviderFT_ModifyInstance)NULL,
+  (MI_ProviderFT_DeleteInstance)NULL,
+  (MI_ProviderFT_AssociatorInstances)NULL,
+  (MI_ProviderFT_ReferenceInstances)NULL,
+  (MI_ProviderFT_EnableIndications)SCX_LogFileMatchIndication_EnableIndications,
+  (MI_ProviderFT_DisableIndications)SCX_LogFileMatchIndication_DisableIndications,
+  (MI_ProviderFT_Subscribe)SCX_LogFileMatchIndication_Subscribe,
+  (MI_ProviderFT_Unsubscribe)SCX_LogFileMatchIndication_Unsubscribe,
+  (MI_ProviderFT_Invoke)NULL,
+};
+
+static MI_CONST MI_Char* SCX_LogFileMatchIndication_UMLPackagePath_qual_value = MI_T("CIM::Event");
+
+static MI_CONST MI_Qualifier SCX_LogFileMatchIndication_UMLPackagePath_qual =
+{
+    MI_T("UMLPackagePath"),
+    MI_STRING,
+    0,
+    &SCX_LogFileMatchIndication_UMLPackagePath_qual_value
+};
+
+static MI_CONST MI_Char* SCX_LogFileMatchIndication_Version_qual_value = MI_T("1.4.18");
+
+static MI_CONST MI_Qualifier SCX_LogFileMatchIndication_Version_qual =
+{
+    MI_T("Version"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TRANSLATABLE|MI_FLAG_RESTRICTED,
+    &SCX_LogFileMatchIndication_Version_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_LogFileMatchIndication_quals[] =
+{
+    &SCX_LogFileMatchIndication_UMLPackagePath_qual,
+    &SCX_LogFileMatchIndication_Version_qual,
+};
+
+/* class SCX_LogFileMatchIndication */
+MI_CONST MI_ClassDecl SCX_LogFileMatchIndication_rtti =
+{
+    MI_FLAG_CLASS|MI_FLAG_INDICATION, /* flags */
+    0x00736E1A, /* code */
+    MI_T("SCX_LogFileMatchIndication"), /* name */
+    SCX_LogFileMatchIndication_quals, /* qualifiers */
+    MI_COUNT(SCX_LogFileMatchIndication_quals), /* numQualifiers */
+    SCX_LogFileMatchIndication_props, /* properties */
+    MI_COUNT(SCX_LogFileMatchIndication_props), /* numProperties */
+    sizeof(SCX_LogFileMatchIndication), /* size */
+    MI_T("CIM_Indication"), /* superClass */
+    &CIM_Indication_rtti, /* superClassDecl */
+    NULL, /* methods */
+    0, /* numMethods */
+    &schemaDecl, /* schema */
+    &SCX_LogFileMatchIndication_funcs, /* functions */
+    NULL, /* owningClass */
+};
+
+/*
+**==============================================================================
+**
+** SCX_MemoryStatisticalInformation
+**
+**==============================================================================
+*/
+
+static MI_CONST MI_Uint32 SCX_MemoryStatisticalInformation_Caption_MaxLen_qual_value = 64U;
+
+static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Caption_MaxLen_qual =
+{
+    MI_T("MaxLen"),
+    MI_UINT32,
+    0,
+    &SCX_MemoryStatisticalInformation_Caption_MaxLen_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_Caption_quals[] =
+{
+    &SCX_MemoryStatisticalInformation_Caption_MaxLen_qual,
+};
+
+static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Caption_value = MI_T("Memory information");
+
+/* property SCX_MemoryStatisticalInformation.Caption */
+static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Caption_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00636E07, /* code */
+    MI_T("Caption"), /* name */
+    SCX_MemoryStatisticalInformation_Caption_quals, /* qualifiers */
+    MI_COUNT(SCX_MemoryStatisticalInformation_Caption_quals), /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_MemoryStatisticalInformation, Caption), /* offset */
+    MI_T("CIM_ManagedElement"), /* origin */
+    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
+    &SCX_MemoryStatisticalInformation_Caption_value,
+};
+
+static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Description_value = MI_T("Memory usage and performance statistics");
+
+/* property SCX_MemoryStatisticalInformation.Description */
+static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Description_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00646E0B, /* code */
+    MI_T("Description"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_MemoryStatisticalInformation, Description), /* offset */
+    MI_T("CIM_ManagedElement"), /* origin */
+    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
+    &SCX_MemoryStatisticalInformation_Description_value,
+};
+
+static MI_CONST MI_Uint32 SCX_MemoryStatisticalInformation_Name_MaxLen_qual_value = 256U;
+
+static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Name_MaxLen_qual =
+{
+    MI_T("MaxLen"),
+    MI_UINT32,
+    0,
+    &SCX_MemoryStatisticalInformation_Name_MaxLen_qual_value
+};
+
+static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_Name_Override_qual_value = MI_T("Name");
+
+static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_Name_Override_qual =
+{
+    MI_T("Override"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_RESTRICTED,
+    &SCX_MemoryStatisticalInformation_Name_Override_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_Name_quals[] =
+{
+    &SCX_MemoryStatisticalInformation_Name_MaxLen_qual,
+    &SCX_MemoryStatisticalInformation_Name_Override_qual,
+};
+
+/* property SCX_MemoryStatisticalInformation.Name */
+static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_Name_prop =
+{
+    MI_FLAG_PROPERTY|MI_FLAG_KEY, /* flags */
+    0x006E6504, /* code */
+    MI_T("Name"), /* name */
+    SCX_MemoryStatisticalInformation_Name_quals, /* qualifiers */
+    MI_COUNT(SCX_MemoryStatisticalInformation_Name_quals), /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_MemoryStatisticalInformation, Name), /* offset */
+    MI_T("CIM_StatisticalInformation"), /* origin */
+    MI_T("SCX_MemoryStatisticalInformation"), /* propagator */
+    NULL,
+};
+
+static MI_CONST MI_Char* SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual_value = MI_T("MegaBytes");
+
+static MI_CONST MI_Qualifier SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual =
+{
+    MI_T("Units"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TOSUBCLASS|MI_FLAG_TRANSLATABLE,
+    &SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_MemoryStatisticalInformation_AvailableMemory_quals[] =
+{
+    &SCX_MemoryStatisticalInformation_AvailableMemory_Units_qual,
+};
+
+/* property SCX_MemoryStatisticalInformation.AvailableMemory */
+static MI_CONST MI_PropertyDecl SCX_MemoryStatisticalInformation_AvailableMemory_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0061790F, /* code */
+    MI_T("AvailableMemory"), /* name */
+    SCX_MemoryStatisticalInformation_AvailableMemory_quals, /* qualifiers */
+    MI_COUNT(SCX_MemoryStatisticalInformation_AvailableMemory_quals), /* numQualifiers */
     MI_UINT64, /* type */
     NULL, /* className */
     0, /* subscript */
@@ -14685,6 +15236,34 @@ static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteCommand_ElevationTyp
     offsetof(SCX_OperatingSystem_ExecuteCommand, ElevationType), /* offset */
 };
 
+/* parameter SCX_OperatingSystem.ExecuteCommand(): MaxResultAge */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteCommand_MaxResultAge_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x006D650C, /* code */
+    MI_T("MaxResultAge"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_ExecuteCommand, MaxResultAge), /* offset */
+};
+
+/* parameter SCX_OperatingSystem.ExecuteCommand(): ResourceUsage */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteCommand_ResourceUsage_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0072650D, /* code */
+    MI_T("ResourceUsage"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_ExecuteCommand, ResourceUsage), /* offset */
+};
+
 /* parameter SCX_OperatingSystem.ExecuteCommand(): MIReturn */
 static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteCommand_MIReturn_param =
 {
@@ -14708,6 +15287,8 @@ static MI_ParameterDecl MI_CONST* MI_CONST SCX_OperatingSystem_ExecuteCommand_pa
     &SCX_OperatingSystem_ExecuteCommand_StdErr_param,
     &SCX_OperatingSystem_ExecuteCommand_timeout_param,
     &SCX_OperatingSystem_ExecuteCommand_ElevationType_param,
+    &SCX_OperatingSystem_ExecuteCommand_MaxResultAge_param,
+    &SCX_OperatingSystem_ExecuteCommand_ResourceUsage_param,
 };
 
 /* method SCX_OperatingSystem.ExecuteCommand() */
@@ -14826,6 +15407,20 @@ static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteShellCommand_b64enco
     offsetof(SCX_OperatingSystem_ExecuteShellCommand, b64encoded), /* offset */
 };
 
+/* parameter SCX_OperatingSystem.ExecuteShellCommand(): ResourceUsage */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteShellCommand_ResourceUsage_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0072650D, /* code */
+    MI_T("ResourceUsage"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_ExecuteShellCommand, ResourceUsage), /* offset */
+};
+
 /* parameter SCX_OperatingSystem.ExecuteShellCommand(): MIReturn */
 static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteShellCommand_MIReturn_param =
 {
@@ -14850,6 +15445,7 @@ static MI_ParameterDecl MI_CONST* MI_CONST SCX_OperatingSystem_ExecuteShellComma
     &SCX_OperatingSystem_ExecuteShellCommand_timeout_param,
     &SCX_OperatingSystem_ExecuteShellCommand_ElevationType_param,
     &SCX_OperatingSystem_ExecuteShellCommand_b64encoded_param,
+    &SCX_OperatingSystem_ExecuteShellCommand_ResourceUsage_param,
 };
 
 /* method SCX_OperatingSystem.ExecuteShellCommand() */
@@ -14982,6 +15578,20 @@ static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteScript_b64encoded_pa
     offsetof(SCX_OperatingSystem_ExecuteScript, b64encoded), /* offset */
 };
 
+/* parameter SCX_OperatingSystem.ExecuteScript(): ResourceUsage */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteScript_ResourceUsage_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0072650D, /* code */
+    MI_T("ResourceUsage"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_ExecuteScript, ResourceUsage), /* offset */
+};
+
 /* parameter SCX_OperatingSystem.ExecuteScript(): MIReturn */
 static MI_CONST MI_ParameterDecl SCX_OperatingSystem_ExecuteScript_MIReturn_param =
 {
@@ -15007,6 +15617,7 @@ static MI_ParameterDecl MI_CONST* MI_CONST SCX_OperatingSystem_ExecuteScript_par
     &SCX_OperatingSystem_ExecuteScript_timeout_param,
     &SCX_OperatingSystem_ExecuteScript_ElevationType_param,
     &SCX_OperatingSystem_ExecuteScript_b64encoded_param,
+    &SCX_OperatingSystem_ExecuteScript_ResourceUsage_param,
 };
 
 /* method SCX_OperatingSystem.ExecuteScript() */
@@ -15027,6 +15638,208 @@ MI_CONST MI_MethodDecl SCX_OperatingSystem_ExecuteScript_rtti =
     (MI_ProviderFT_Invoke)SCX_OperatingSystem_Invoke_ExecuteScript, /* method */
 };
 
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): Timestamp */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_Timestamp_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00747009, /* code */
+    MI_T("Timestamp"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, Timestamp), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_EmbeddedInstance_qual_value = MI_T("SCX_OperatingSystem");
+
+static MI_CONST MI_Qualifier SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_EmbeddedInstance_qual =
+{
+    MI_T("EmbeddedInstance"),
+    MI_STRING,
+    0,
+    &SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_EmbeddedInstance_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_quals[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_EmbeddedInstance_qual,
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): OperatingSystem */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006F6D0F, /* code */
+    MI_T("OperatingSystem"), /* name */
+    SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_quals, /* qualifiers */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_quals), /* numQualifiers */
+    MI_INSTANCE, /* type */
+    MI_T("SCX_OperatingSystem"), /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, OperatingSystem), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_OperatingSystem_GetSystemSnapshot_Memory_EmbeddedInstance_qual_value = MI_T("SCX_MemoryStatisticalInformation");
+
+static MI_CONST MI_Qualifier SCX_OperatingSystem_GetSystemSnapshot_Memory_EmbeddedInstance_qual =
+{
+    MI_T("EmbeddedInstance"),
+    MI_STRING,
+    0,
+    &SCX_OperatingSystem_GetSystemSnapshot_Memory_EmbeddedInstance_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_Memory_quals[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_Memory_EmbeddedInstance_qual,
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): Memory */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_Memory_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D7906, /* code */
+    MI_T("Memory"), /* name */
+    SCX_OperatingSystem_GetSystemSnapshot_Memory_quals, /* qualifiers */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_Memory_quals), /* numQualifiers */
+    MI_INSTANCE, /* type */
+    MI_T("SCX_MemoryStatisticalInformation"), /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, Memory), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_OperatingSystem_GetSystemSnapshot_Processors_EmbeddedInstance_qual_value = MI_T("SCX_ProcessorStatisticalInformation");
+
+static MI_CONST MI_Qualifier SCX_OperatingSystem_GetSystemSnapshot_Processors_EmbeddedInstance_qual =
+{
+    MI_T("EmbeddedInstance"),
+    MI_STRING,
+    0,
+    &SCX_OperatingSystem_GetSystemSnapshot_Processors_EmbeddedInstance_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_Processors_quals[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_Processors_EmbeddedInstance_qual,
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): Processors */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_Processors_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0070730A, /* code */
+    MI_T("Processors"), /* name */
+    SCX_OperatingSystem_GetSystemSnapshot_Processors_quals, /* qualifiers */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_Processors_quals), /* numQualifiers */
+    MI_INSTANCEA, /* type */
+    MI_T("SCX_ProcessorStatisticalInformation"), /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, Processors), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_EmbeddedInstance_qual_value = MI_T("SCX_DiskDriveStatisticalInformation");
+
+static MI_CONST MI_Qualifier SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_EmbeddedInstance_qual =
+{
+    MI_T("EmbeddedInstance"),
+    MI_STRING,
+    0,
+    &SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_EmbeddedInstance_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_quals[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_EmbeddedInstance_qual,
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): DiskDrives */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0064730A, /* code */
+    MI_T("DiskDrives"), /* name */
+    SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_quals, /* qualifiers */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_quals), /* numQualifiers */
+    MI_INSTANCEA, /* type */
+    MI_T("SCX_DiskDriveStatisticalInformation"), /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, DiskDrives), /* offset */
+};
+
+static MI_CONST MI_Char* SCX_OperatingSystem_GetSystemSnapshot_FileSystems_EmbeddedInstance_qual_value = MI_T("SCX_FileSystemStatisticalInformation");
+
+static MI_CONST MI_Qualifier SCX_OperatingSystem_GetSystemSnapshot_FileSystems_EmbeddedInstance_qual =
+{
+    MI_T("EmbeddedInstance"),
+    MI_STRING,
+    0,
+    &SCX_OperatingSystem_GetSystemSnapshot_FileSystems_EmbeddedInstance_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_FileSystems_quals[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_FileSystems_EmbeddedInstance_qual,
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): FileSystems */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_FileSystems_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0066730B, /* code */
+    MI_T("FileSystems"), /* name */
+    SCX_OperatingSystem_GetSystemSnapshot_FileSystems_quals, /* qualifiers */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_FileSystems_quals), /* numQualifiers */
+    MI_INSTANCEA, /* type */
+    MI_T("SCX_FileSystemStatisticalInformation"), /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, FileSystems), /* offset */
+};
+
+/* parameter SCX_OperatingSystem.GetSystemSnapshot(): MIReturn */
+static MI_CONST MI_ParameterDecl SCX_OperatingSystem_GetSystemSnapshot_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_OperatingSystem_GetSystemSnapshot, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST SCX_OperatingSystem_GetSystemSnapshot_params[] =
+{
+    &SCX_OperatingSystem_GetSystemSnapshot_MIReturn_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_Timestamp_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_OperatingSystem_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_Memory_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_Processors_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_DiskDrives_param,
+    &SCX_OperatingSystem_GetSystemSnapshot_FileSystems_param,
+};
+
+/* method SCX_OperatingSystem.GetSystemSnapshot() */
+MI_CONST MI_MethodDecl SCX_OperatingSystem_GetSystemSnapshot_rtti =
+{
+    MI_FLAG_METHOD|MI_FLAG_STATIC, /* flags */
+    0x00677411, /* code */
+    MI_T("GetSystemSnapshot"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    SCX_OperatingSystem_GetSystemSnapshot_params, /* parameters */
+    MI_COUNT(SCX_OperatingSystem_GetSystemSnapshot_params), /* numParameters */
+    sizeof(SCX_OperatingSystem_GetSystemSnapshot), /* size */
+    MI_BOOLEAN, /* returnType */
+    MI_T("SCX_OperatingSystem"), /* origin */
+    MI_T("SCX_OperatingSystem"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)SCX_OperatingSystem_Invoke_GetSystemSnapshot, /* method */
+};
+
 static MI_MethodDecl MI_CONST* MI_CONST SCX_OperatingSystem_meths[] =
 {
     &SCX_OperatingSystem_RequestStateChange_rtti,
@@ -15035,6 +15848,7 @@ static MI_MethodDecl MI_CONST* MI_CONST SCX_OperatingSystem_meths[] =
     &SCX_OperatingSystem_ExecuteCommand_rtti,
     &SCX_OperatingSystem_ExecuteShellCommand_rtti,
     &SCX_OperatingSystem_ExecuteScript_rtti,
+    &SCX_OperatingSystem_GetSystemSnapshot_rtti,
 };
 
 static MI_CONST MI_ProviderFT SCX_OperatingSystem_funcs =
@@ -15985,6 +16799,216 @@ MI_CONST MI_ClassDecl SCX_RTProcessorStatisticalInformation_rtti =
     NULL, /* owningClass */
 };
 
+/*
+**==============================================================================
+**
+** SCX_StatisticalThresholdIndication
+**
+**==============================================================================
+*/
+
+/* property SCX_StatisticalThresholdIndication.SourceClass */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_SourceClass_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0073730B, /* code */
+    MI_T("SourceClass"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, SourceClass), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.Name */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_Name_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006E6504, /* code */
+    MI_T("Name"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, Name), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.PropertyName */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_PropertyName_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0070650C, /* code */
+    MI_T("PropertyName"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, PropertyName), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.Threshold */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_Threshold_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746409, /* code */
+    MI_T("Threshold"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_REAL64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, Threshold), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.Value */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_Value_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00766505, /* code */
+    MI_T("Value"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_REAL64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, Value), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.Samples */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_Samples_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00737307, /* code */
+    MI_T("Samples"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, Samples), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+/* property SCX_StatisticalThresholdIndication.Exceeded */
+static MI_CONST MI_PropertyDecl SCX_StatisticalThresholdIndication_Exceeded_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656408, /* code */
+    MI_T("Exceeded"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_StatisticalThresholdIndication, Exceeded), /* offset */
+    MI_T("SCX_StatisticalThresholdIndication"), /* origin */
+    MI_T("SCX_StatisticalThresholdIndication"), /* propagator */
+    NULL,
+};
+
+static MI_PropertyDecl MI_CONST* MI_CONST SCX_StatisticalThresholdIndication_props[] =
+{
+    &CIM_Indication_IndicationIdentifier_prop,
+    &CIM_Indication_CorrelatedIndications_prop,
+    &CIM_Indication_IndicationTime_prop,
+    &CIM_Indication_PerceivedSeverity_prop,
+    &CIM_Indication_OtherSeverity_prop,
+    &CIM_Indication_IndicationFilterName_prop,
+    &CIM_Indication_SequenceContext_prop,
+    &CIM_Indication_SequenceNumber_prop,
+    &SCX_StatisticalThresholdIndication_SourceClass_prop,
+    &SCX_StatisticalThresholdIndication_Name_prop,
+    &SCX_StatisticalThresholdIndication_PropertyName_prop,
+    &SCX_StatisticalThresholdIndication_Threshold_prop,
+    &SCX_StatisticalThresholdIndication_Value_prop,
+    &SCX_StatisticalThresholdIndication_Samples_prop,
+    &SCX_StatisticalThresholdIndication_Exceeded_prop,
+};
+
+static MI_CONST MI_ProviderFT SCX_StatisticalThresholdIndication_funcs =
+{
+  (MI_ProviderFT_Load)SCX_StatisticalThresholdIndication_Load,
+  (MI_ProviderFT_Unload)SCX_StatisticalThresholdIndication_Unload,
+  (MI_ProviderFT_GetInstance)NULL,
+  (MI_ProviderFT_EnumerateInstances)NULL,
+  (MI_ProviderFT_CreateInstance)NULL,
+  (MI_ProviderFT_ModifyInstance)NULL,
+  (MI_ProviderFT_DeleteInstance)NULL,
+  (MI_ProviderFT_AssociatorInstances)NULL,
+  (MI_ProviderFT_ReferenceInstances)NULL,
+  (MI_ProviderFT_EnableIndications)SCX_StatisticalThresholdIndication_EnableIndications,
+  (MI_ProviderFT_DisableIndications)SCX_StatisticalThresholdIndication_DisableIndications,
+  (MI_ProviderFT_Subscribe)SCX_StatisticalThresholdIndication_Subscribe,
+  (MI_ProviderFT_Unsubscribe)SCX_StatisticalThresholdIndication_Unsubscribe,
+  (MI_ProviderFT_Invoke)NULL,
+};
+
+static MI_CONST MI_Char* SCX_StatisticalThresholdIndication_UMLPackagePath_qual_value = MI_T("CIM::Event");
+
+static MI_CONST MI_Qualifier SCX_StatisticalThresholdIndication_UMLPackagePath_qual =
+{
+    MI_T("UMLPackagePath"),
+    MI_STRING,
+    0,
+    &SCX_StatisticalThresholdIndication_UMLPackagePath_qual_value
+};
+
+static MI_CONST MI_Char* SCX_StatisticalThresholdIndication_Version_qual_value = MI_T("1.4.19");
+
+static MI_CONST MI_Qualifier SCX_StatisticalThresholdIndication_Version_qual =
+{
+    MI_T("Version"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TRANSLATABLE|MI_FLAG_RESTRICTED,
+    &SCX_StatisticalThresholdIndication_Version_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST SCX_StatisticalThresholdIndication_quals[] =
+{
+    &SCX_StatisticalThresholdIndication_UMLPackagePath_qual,
+    &SCX_StatisticalThresholdIndication_Version_qual,
+};
+
+/* class SCX_StatisticalThresholdIndication */
+MI_CONST MI_ClassDecl SCX_StatisticalThresholdIndication_rtti =
+{
+    MI_FLAG_CLASS|MI_FLAG_INDICATION, /* flags */
+    0x00736E22, /* code */
+    MI_T("SCX_StatisticalThresholdIndication"), /* name */
+    SCX_StatisticalThresholdIndication_quals, /* qualifiers */
+    MI_COUNT(SCX_StatisticalThresholdIndication_quals), /* numQualifiers */
+    SCX_StatisticalThresholdIndication_props, /* properties */
+    MI_COUNT(SCX_StatisticalThresholdIndication_props), /* numProperties */
+    sizeof(SCX_StatisticalThresholdIndication), /* size */
+    MI_T("CIM_Indication"), /* superClass */
+    &CIM_Indication_rtti, /* superClassDecl */
+    NULL, /* methods */
+    0, /* numMethods */
+    &schemaDecl, /* schema */
+    &SCX_StatisticalThresholdIndication_funcs, /* functions */
+    NULL, /* owningClass */
+};
+
 /*
 **==============================================================================
 **
@@ -17142,10 +18166,439 @@ MI_CONST MI_MethodDecl SCX_UnixProcess_TopResourceConsumers_rtti =
     (MI_ProviderFT_Invoke)SCX_UnixProcess_Invoke_TopResourceConsumers, /* method */
 };
 
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): resource */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_resource_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00726508, /* code */
+    MI_T("resource"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, resource), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): count */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_count_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00637405, /* code */
+    MI_T("count"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT16, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, count), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): threshold */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_threshold_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00746409, /* code */
+    MI_T("threshold"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, threshold), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): PIDs */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_PIDs_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00707304, /* code */
+    MI_T("PIDs"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, PIDs), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): Names */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_Names_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006E7305, /* code */
+    MI_T("Names"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, Names), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): Values */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_Values_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00767306, /* code */
+    MI_T("Values"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, Values), /* offset */
+};
+
+/* parameter SCX_UnixProcess.TopResourceConsumerValues(): MIReturn */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_TopResourceConsumerValues_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_TopResourceConsumerValues, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST SCX_UnixProcess_TopResourceConsumerValues_params[] =
+{
+    &SCX_UnixProcess_TopResourceConsumerValues_MIReturn_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_resource_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_count_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_threshold_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_PIDs_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_Names_param,
+    &SCX_UnixProcess_TopResourceConsumerValues_Values_param,
+};
+
+/* method SCX_UnixProcess.TopResourceConsumerValues() */
+MI_CONST MI_MethodDecl SCX_UnixProcess_TopResourceConsumerValues_rtti =
+{
+    MI_FLAG_METHOD|MI_FLAG_STATIC, /* flags */
+    0x00747319, /* code */
+    MI_T("TopResourceConsumerValues"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    SCX_UnixProcess_TopResourceConsumerValues_params, /* parameters */
+    MI_COUNT(SCX_UnixProcess_TopResourceConsumerValues_params), /* numParameters */
+    sizeof(SCX_UnixProcess_TopResourceConsumerValues), /* size */
+    MI_BOOLEAN, /* returnType */
+    MI_T("SCX_UnixProcess"), /* origin */
+    MI_T("SCX_UnixProcess"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)SCX_UnixProcess_Invoke_TopResourceConsumerValues, /* method */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): groupBy */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_groupBy_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00677907, /* code */
+    MI_T("groupBy"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, groupBy), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): Groups */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_Groups_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00677306, /* code */
+    MI_T("Groups"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, Groups), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): Counts */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_Counts_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00637306, /* code */
+    MI_T("Counts"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, Counts), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): PercentBusyTimes */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_PercentBusyTimes_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00707310, /* code */
+    MI_T("PercentBusyTimes"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, PercentBusyTimes), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): UsedMemory */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_UsedMemory_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0075790A, /* code */
+    MI_T("UsedMemory"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, UsedMemory), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): BlockReadsPerSecond */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_BlockReadsPerSecond_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00626413, /* code */
+    MI_T("BlockReadsPerSecond"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, BlockReadsPerSecond), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): BlockWritesPerSecond */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_BlockWritesPerSecond_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00626414, /* code */
+    MI_T("BlockWritesPerSecond"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, BlockWritesPerSecond), /* offset */
+};
+
+/* parameter SCX_UnixProcess.AggregateProcesses(): MIReturn */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_AggregateProcesses_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_AggregateProcesses, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST SCX_UnixProcess_AggregateProcesses_params[] =
+{
+    &SCX_UnixProcess_AggregateProcesses_MIReturn_param,
+    &SCX_UnixProcess_AggregateProcesses_groupBy_param,
+    &SCX_UnixProcess_AggregateProcesses_Groups_param,
+    &SCX_UnixProcess_AggregateProcesses_Counts_param,
+    &SCX_UnixProcess_AggregateProcesses_PercentBusyTimes_param,
+    &SCX_UnixProcess_AggregateProcesses_UsedMemory_param,
+    &SCX_UnixProcess_AggregateProcesses_BlockReadsPerSecond_param,
+    &SCX_UnixProcess_AggregateProcesses_BlockWritesPerSecond_param,
+};
+
+/* method SCX_UnixProcess.AggregateProcesses() */
+MI_CONST MI_MethodDecl SCX_UnixProcess_AggregateProcesses_rtti =
+{
+    MI_FLAG_METHOD|MI_FLAG_STATIC, /* flags */
+    0x00617312, /* code */
+    MI_T("AggregateProcesses"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    SCX_UnixProcess_AggregateProcesses_params, /* parameters */
+    MI_COUNT(SCX_UnixProcess_AggregateProcesses_params), /* numParameters */
+    sizeof(SCX_UnixProcess_AggregateProcesses), /* size */
+    MI_BOOLEAN, /* returnType */
+    MI_T("SCX_UnixProcess"), /* origin */
+    MI_T("SCX_UnixProcess"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)SCX_UnixProcess_Invoke_AggregateProcesses, /* method */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): token */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_token_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00746E05, /* code */
+    MI_T("token"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, token), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): NextToken */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_NextToken_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006E6E09, /* code */
+    MI_T("NextToken"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, NextToken), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): FullResync */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_FullResync_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0066630A, /* code */
+    MI_T("FullResync"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, FullResync), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): Changes */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_Changes_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00637307, /* code */
+    MI_T("Changes"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT16A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, Changes), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): PIDs */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_PIDs_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x00707304, /* code */
+    MI_T("PIDs"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, PIDs), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): StartTimes */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_StartTimes_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0073730A, /* code */
+    MI_T("StartTimes"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, StartTimes), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): Names */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_Names_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006E7305, /* code */
+    MI_T("Names"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, Names), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): ExecutionStates */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_ExecutionStates_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x0065730F, /* code */
+    MI_T("ExecutionStates"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT16A, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, ExecutionStates), /* offset */
+};
+
+/* parameter SCX_UnixProcess.EnumerateChanges(): MIReturn */
+static MI_CONST MI_ParameterDecl SCX_UnixProcess_EnumerateChanges_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_BOOLEAN, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(SCX_UnixProcess_EnumerateChanges, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST SCX_UnixProcess_EnumerateChanges_params[] =
+{
+    &SCX_UnixProcess_EnumerateChanges_MIReturn_param,
+    &SCX_UnixProcess_EnumerateChanges_token_param,
+    &SCX_UnixProcess_EnumerateChanges_NextToken_param,
+    &SCX_UnixProcess_EnumerateChanges_FullResync_param,
+    &SCX_UnixProcess_EnumerateChanges_Changes_param,
+    &SCX_UnixProcess_EnumerateChanges_PIDs_param,
+    &SCX_UnixProcess_EnumerateChanges_StartTimes_param,
+    &SCX_UnixProcess_EnumerateChanges_Names_param,
+    &SCX_UnixProcess_EnumerateChanges_ExecutionStates_param,
+};
+
+/* method SCX_UnixProcess.EnumerateChanges() */
+MI_CONST MI_MethodDecl SCX_UnixProcess_EnumerateChanges_rtti =
+{
+    MI_FLAG_METHOD|MI_FLAG_STATIC, /* flags */
+    0x00657310, /* code */
+    MI_T("EnumerateChanges"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    SCX_UnixProcess_EnumerateChanges_params, /* parameters */
+    MI_COUNT(SCX_UnixProcess_EnumerateChanges_params), /* numParameters */
+    sizeof(SCX_UnixProcess_EnumerateChanges), /* size */
+    MI_BOOLEAN, /* returnType */
+    MI_T("SCX_UnixProcess"), /* origin */
+    MI_T("SCX_UnixProcess"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)SCX_UnixProcess_Invoke_EnumerateChanges, /* method */
+};
+
 static MI_MethodDecl MI_CONST* MI_CONST SCX_UnixProcess_meths[] =
 {
     &SCX_UnixProcess_RequestStateChange_rtti,
     &SCX_UnixProcess_TopResourceConsumers_rtti,
+    &SCX_UnixProcess_TopResourceConsumerValues_rtti,
+    &SCX_UnixProcess_AggregateProcesses_rtti,
+    &SCX_UnixProcess_EnumerateChanges_rtti,
 };
 
 static MI_CONST MI_ProviderFT SCX_UnixProcess_funcs =
@@ -18386,6 +19839,7 @@ static MI_ClassDecl MI_CONST* MI_CONST classes[] =
     &CIM_EthernetPortStatistics_rtti,
     &CIM_FileSystem_rtti,
     &CIM_IPProtocolEndpoint_rtti,
+    &CIM_Indication_rtti,
     &CIM_Job_rtti,
     &CIM_LANEndpoint_rtti,
     &CIM_LogicalDevice_rtti,
@@ -18413,11 +19867,13 @@ static MI_ClassDecl MI_CONST* MI_CONST classes[] =
     &SCX_IPProtocolEndpoint_rtti,
     &SCX_LANEndpoint_rtti,
     &SCX_LogFile_rtti,
+    &SCX_LogFileMatchIndication_rtti,
     &SCX_MemoryStatisticalInformation_rtti,
     &SCX_OperatingSystem_rtti,
     &SCX_ProcessorStatisticalInformation_rtti,
     &SCX_RTProcessorStatisticalInformation_rtti,
     &SCX_StatisticalInformation_rtti,
+    &SCX_StatisticalThresholdIndication_rtti,
     &SCX_UnixProcess_rtti,
     &SCX_UnixProcessStatisticalInformation_rtti,
 };
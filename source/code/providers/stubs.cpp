@@ -18,10 +18,12 @@
 #include "SCX_LANEndpoint_Class_Provider.h"
 #include "SCX_IPProtocolEndpoint_Class_Provider.h"
 #include "SCX_LogFile_Class_Provider.h"
+#include "SCX_LogFileMatchIndication_Class_Provider.h"
 #include "SCX_MemoryStatisticalInformation_Class_Provider.h"
 #include "SCX_OperatingSystem_Class_Provider.h"
 #include "SCX_ProcessorStatisticalInformation_Class_Provider.h"
 #include "SCX_RTProcessorStatisticalInformation_Class_Provider.h"
+#include "SCX_StatisticalThresholdIndication_Class_Provider.h"
 #include "SCX_UnixProcess_Class_Provider.h"
 #include "SCX_UnixProcessStatisticalInformation_Class_Provider.h"
 
@@ -1523,6 +1525,106 @@ MI_EXTERN_C void MI_CALL SCX_LogFile_Invoke_ResetStateFile(
     cxxSelf->Invoke_ResetStateFile(cxxContext, nameSpace, instance, param);
 }
 
+MI_EXTERN_C void MI_CALL SCX_LogFile_Invoke_GetMatchedRowsBatch(
+    SCX_LogFile_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_LogFile* instanceName,
+    const SCX_LogFile_GetMatchedRowsBatch* in)
+{
+    SCX_LogFile_Class_Provider* cxxSelf =((SCX_LogFile_Class_Provider*)self);
+    SCX_LogFile_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    SCX_LogFile_GetMatchedRowsBatch_Class param(in, false);
+
+    cxxSelf->Invoke_GetMatchedRowsBatch(cxxContext, nameSpace, instance, param);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Load(
+    SCX_LogFileMatchIndication_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    SCX_LogFileMatchIndication_Class_Provider* prov = new SCX_LogFileMatchIndication_Class_Provider((Module*)selfModule);
+
+    prov->Load(ctx);
+    if (MI_RESULT_OK != r)
+    {
+        delete prov;
+        MI_Context_PostResult(context, r);
+        return;
+    }
+    *self = (SCX_LogFileMatchIndication_Self*)prov;
+    MI_Context_PostResult(context, MI_RESULT_OK);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Unload(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    SCX_LogFileMatchIndication_Class_Provider* prov = (SCX_LogFileMatchIndication_Class_Provider*)self;
+
+    prov->Unload(ctx);
+    delete ((SCX_LogFileMatchIndication_Class_Provider*)self);
+    MI_Context_PostResult(context, r);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_EnableIndications(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className)
+{
+    SCX_LogFileMatchIndication_Class_Provider* cxxSelf =((SCX_LogFileMatchIndication_Class_Provider*)self);
+
+    cxxSelf->EnableIndications(indicationsContext, nameSpace, className);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_DisableIndications(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className)
+{
+    SCX_LogFileMatchIndication_Class_Provider* cxxSelf =((SCX_LogFileMatchIndication_Class_Provider*)self);
+
+    cxxSelf->DisableIndications(indicationsContext, nameSpace, className);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Subscribe(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Filter* filter,
+    const MI_Char* bookmark,
+    MI_Uint64  subscriptionID,
+    void** subscriptionSelf)
+{
+    SCX_LogFileMatchIndication_Class_Provider* cxxSelf =((SCX_LogFileMatchIndication_Class_Provider*)self);
+
+    cxxSelf->Subscribe(context, nameSpace, filter, bookmark, subscriptionID, subscriptionSelf);
+}
+
+MI_EXTERN_C void MI_CALL SCX_LogFileMatchIndication_Unsubscribe(
+    SCX_LogFileMatchIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    MI_Uint64  subscriptionID,
+    void* subscriptionSelf)
+{
+    SCX_LogFileMatchIndication_Class_Provider* cxxSelf =((SCX_LogFileMatchIndication_Class_Provider*)self);
+
+    cxxSelf->Unsubscribe(context, nameSpace, subscriptionID, subscriptionSelf);
+}
+
 MI_EXTERN_C void MI_CALL SCX_MemoryStatisticalInformation_Load(
     SCX_MemoryStatisticalInformation_Self** self,
     MI_Module_Self* selfModule,
@@ -1863,6 +1965,23 @@ MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_ExecuteScript(
     cxxSelf->Invoke_ExecuteScript(cxxContext, nameSpace, instance, param);
 }
 
+MI_EXTERN_C void MI_CALL SCX_OperatingSystem_Invoke_GetSystemSnapshot(
+    SCX_OperatingSystem_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_OperatingSystem* instanceName,
+    const SCX_OperatingSystem_GetSystemSnapshot* in)
+{
+    SCX_OperatingSystem_Class_Provider* cxxSelf =((SCX_OperatingSystem_Class_Provider*)self);
+    SCX_OperatingSystem_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    SCX_OperatingSystem_GetSystemSnapshot_Class param(in, false);
+
+    cxxSelf->Invoke_GetSystemSnapshot(cxxContext, nameSpace, instance, param);
+}
+
 MI_EXTERN_C void MI_CALL SCX_ProcessorStatisticalInformation_Load(
     SCX_ProcessorStatisticalInformation_Self** self,
     MI_Module_Self* selfModule,
@@ -2101,6 +2220,89 @@ MI_EXTERN_C void MI_CALL SCX_RTProcessorStatisticalInformation_DeleteInstance(
     cxxSelf->DeleteInstance(cxxContext, nameSpace, cxxInstanceName);
 }
 
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Load(
+    SCX_StatisticalThresholdIndication_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    SCX_StatisticalThresholdIndication_Class_Provider* prov = new SCX_StatisticalThresholdIndication_Class_Provider((Module*)selfModule);
+
+    prov->Load(ctx);
+    if (MI_RESULT_OK != r)
+    {
+        delete prov;
+        MI_Context_PostResult(context, r);
+        return;
+    }
+    *self = (SCX_StatisticalThresholdIndication_Self*)prov;
+    MI_Context_PostResult(context, MI_RESULT_OK);
+}
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Unload(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    SCX_StatisticalThresholdIndication_Class_Provider* prov = (SCX_StatisticalThresholdIndication_Class_Provider*)self;
+
+    prov->Unload(ctx);
+    delete ((SCX_StatisticalThresholdIndication_Class_Provider*)self);
+    MI_Context_PostResult(context, r);
+}
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_EnableIndications(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className)
+{
+    SCX_StatisticalThresholdIndication_Class_Provider* cxxSelf =((SCX_StatisticalThresholdIndication_Class_Provider*)self);
+
+    cxxSelf->EnableIndications(indicationsContext, nameSpace, className);
+}
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_DisableIndications(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* indicationsContext,
+    const MI_Char* nameSpace,
+    const MI_Char* className)
+{
+    SCX_StatisticalThresholdIndication_Class_Provider* cxxSelf =((SCX_StatisticalThresholdIndication_Class_Provider*)self);
+
+    cxxSelf->DisableIndications(indicationsContext, nameSpace, className);
+}
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Subscribe(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Filter* filter,
+    const MI_Char* bookmark,
+    MI_Uint64  subscriptionID,
+    void** subscriptionSelf)
+{
+    SCX_StatisticalThresholdIndication_Class_Provider* cxxSelf =((SCX_StatisticalThresholdIndication_Class_Provider*)self);
+
+    cxxSelf->Subscribe(context, nameSpace, filter, bookmark, subscriptionID, subscriptionSelf);
+}
+
+MI_EXTERN_C void MI_CALL SCX_StatisticalThresholdIndication_Unsubscribe(
+    SCX_StatisticalThresholdIndication_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    MI_Uint64  subscriptionID,
+    void* subscriptionSelf)
+{
+    SCX_StatisticalThresholdIndication_Class_Provider* cxxSelf =((SCX_StatisticalThresholdIndication_Class_Provider*)self);
+
+    cxxSelf->Unsubscribe(context, nameSpace, subscriptionID, subscriptionSelf);
+}
+
 MI_EXTERN_C void MI_CALL SCX_UnixProcess_Load(
     SCX_UnixProcess_Self** self,
     MI_Module_Self* selfModule,
@@ -2254,6 +2456,57 @@ MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_TopResourceConsumers(
     cxxSelf->Invoke_TopResourceConsumers(cxxContext, nameSpace, instance, param);
 }
 
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_TopResourceConsumerValues(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_TopResourceConsumerValues* in)
+{
+    SCX_UnixProcess_Class_Provider* cxxSelf =((SCX_UnixProcess_Class_Provider*)self);
+    SCX_UnixProcess_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    SCX_UnixProcess_TopResourceConsumerValues_Class param(in, false);
+
+    cxxSelf->Invoke_TopResourceConsumerValues(cxxContext, nameSpace, instance, param);
+}
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_AggregateProcesses(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_AggregateProcesses* in)
+{
+    SCX_UnixProcess_Class_Provider* cxxSelf =((SCX_UnixProcess_Class_Provider*)self);
+    SCX_UnixProcess_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    SCX_UnixProcess_AggregateProcesses_Class param(in, false);
+
+    cxxSelf->Invoke_AggregateProcesses(cxxContext, nameSpace, instance, param);
+}
+
+MI_EXTERN_C void MI_CALL SCX_UnixProcess_Invoke_EnumerateChanges(
+    SCX_UnixProcess_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const SCX_UnixProcess* instanceName,
+    const SCX_UnixProcess_EnumerateChanges* in)
+{
+    SCX_UnixProcess_Class_Provider* cxxSelf =((SCX_UnixProcess_Class_Provider*)self);
+    SCX_UnixProcess_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    SCX_UnixProcess_EnumerateChanges_Class param(in, false);
+
+    cxxSelf->Invoke_EnumerateChanges(cxxContext, nameSpace, instance, param);
+}
+
 MI_EXTERN_C void MI_CALL SCX_UnixProcessStatisticalInformation_Load(
     SCX_UnixProcessStatisticalInformation_Self** self,
     MI_Module_Self* selfModule,
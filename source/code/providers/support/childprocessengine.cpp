@@ -0,0 +1,1090 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        childprocessengine.cpp
+
+    \brief       Runs RunAs child processes from a single event loop
+
+    \date        2026-10-19 16:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+
+#include "childprocessengine.h"
+#include "sysutils.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <iterator>
+#include <map>
+#include <istream>
+#include <ostream>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(linux)
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Milliseconds between checks for exited children
+    const int cExitPollInterval = 100;
+
+    //! Milliseconds between checks for a child that closed its pipes, but hasn't exited yet
+    const int cExitingPollInterval = 10;
+
+    //! Bytes read from a pipe at a time
+    const size_t cReadSize = 64*1024;
+
+    //! Steps of starting a child that can fail; the child reports the step and errno
+    enum StartStep
+    {
+        eStartCGroup,
+        eStartRLimit,
+        eStartNice,
+        eStartIOPriority,
+        eStartChroot,
+        eStartChdir,
+        eStartExec
+    };
+
+    //! Names of the failed calls, by StartStep
+    const wchar_t* const cStartStepNames[] =
+    {
+        L"cgroup.procs", L"setrlimit", L"nice", L"ioprio_set", L"chroot", L"chdir", L"execvp"
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Signals the process group of a child (or the child, if it has no group
+       of its own).
+
+       \param[in]   pid      Child (and process group) id
+       \param[in]   signal   Signal to send
+    */
+    void SignalGroup(pid_t pid, int signal)
+    {
+        if (kill(-pid, signal) < 0)
+        {
+            kill(pid, signal);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reaps a child if it has exited, collecting its resource usage where
+       the platform supports it.
+
+       \param[in]   pid      Child
+       \param[out]  status   Receives the wait status
+       \param[out]  usage    Receives the resource usage
+       \returns     As waitpid() with WNOHANG
+    */
+    pid_t WaitChild(pid_t pid, int& status, SCXCore::ChildResourceUsage& usage)
+    {
+#if defined(linux) || defined(macos)
+        struct rusage rusage;
+        pid_t result = wait4(pid, &status, WNOHANG, &rusage);
+        if (result == pid)
+        {
+            usage.known = true;
+            usage.userMilliseconds = static_cast<scxulong>(rusage.ru_utime.tv_sec) * 1000 + rusage.ru_utime.tv_usec / 1000;
+            usage.systemMilliseconds = static_cast<scxulong>(rusage.ru_stime.tv_sec) * 1000 + rusage.ru_stime.tv_usec / 1000;
+#if defined(macos)
+            // Bytes on Mac OS, kilobytes elsewhere
+            usage.maxResidentKB = static_cast<scxulong>(rusage.ru_maxrss) / 1024;
+#else
+            usage.maxResidentKB = static_cast<scxulong>(rusage.ru_maxrss);
+#endif
+            usage.blockReads = static_cast<scxulong>(rusage.ru_inblock);
+            usage.blockWrites = static_cast<scxulong>(rusage.ru_oublock);
+        }
+        return result;
+#else
+        (void) usage;
+        return waitpid(pid, &status, WNOHANG);
+#endif
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds a resource limit to set in a child.
+
+       \param[in,out]  rlimits    Limits to set
+       \param[in]      resource   Resource (RLIMIT_*)
+       \param[in]      value      Limit (0 for none)
+    */
+    void AddRLimit(std::vector<std::pair<int, rlim_t> >& rlimits, int resource, scxulong value)
+    {
+        if (0 != value)
+        {
+            rlimits.push_back(std::make_pair(resource, static_cast<rlim_t>(value)));
+        }
+    }
+
+    //! Thread parameter for the event loop
+    class ChildProcessEngineParam : public SCXThreadParam
+    {
+    public:
+        ChildProcessEngineParam(SCXCore::ChildProcessEngine* engine) : m_engine(engine) { }
+
+        SCXCore::ChildProcessEngine* m_engine;
+    };
+}
+
+namespace SCXCore
+{
+    ChildProcessEngine g_ChildProcessEngine;
+
+    struct ChildExecution;
+
+    //! Identifies one pipe of an execution in the poller
+    struct ChildFd
+    {
+        ChildExecution* execution;
+        int* fd;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       One running child.  Owned by the caller of Run(), used by the event loop
+       until done is set.
+    */
+    struct ChildExecution
+    {
+        ChildExecution(std::ostream& out, std::ostream& err, scxulong deadlineTime)
+            : pid(0), reaped(false), statusKnown(false), status(0),
+              inFd(-1), outFd(-1), errFd(-1), inputOffset(0),
+              output(out), error(err), deadline(deadlineTime), exitedAt(0), termSentAt(0),
+              killSent(false), timedOut(false), done(false)
+        {
+            inTag.execution = this;
+            inTag.fd = &inFd;
+            outTag.execution = this;
+            outTag.fd = &outFd;
+            errTag.execution = this;
+            errTag.fd = &errFd;
+        }
+
+        pid_t pid;              //!< Child (and its process group)
+        bool reaped;            //!< Child has exited
+        bool statusKnown;       //!< status is valid
+        int status;             //!< Wait status of the child
+        int inFd;               //!< Pipe to the child's stdin (-1 when closed)
+        int outFd;              //!< Pipe from the child's stdout (-1 when closed)
+        int errFd;              //!< Pipe from the child's stderr (-1 when closed)
+        std::string input;      //!< Data for stdin
+        size_t inputOffset;     //!< Bytes of input written
+        std::ostream& output;   //!< Receives stdout
+        std::ostream& error;    //!< Receives stderr
+        SCXCore::ChildResourceUsage usage;  //!< Resources used by the child
+        scxulong deadline;      //!< When the child is timed out (0 for never)
+        scxulong exitedAt;      //!< When the child was reaped
+        scxulong termSentAt;    //!< When the process group was sent SIGTERM
+        bool killSent;          //!< The process group was sent SIGKILL
+        bool timedOut;          //!< Deadline passed before the child exited
+        bool done;              //!< Event loop is done with the execution
+        ChildFd inTag;
+        ChildFd outTag;
+        ChildFd errTag;
+
+    private:
+        ChildExecution(const ChildExecution&);
+        ChildExecution& operator=(const ChildExecution&);
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Waits for pipes to become ready: epoll on Linux, poll elsewhere.
+    */
+    class ChildEventPoller
+    {
+    public:
+        ChildEventPoller()
+        {
+#if defined(linux)
+            m_epollFd = epoll_create(16);
+            if (m_epollFd < 0)
+            {
+                throw SCXErrnoException(L"epoll_create", errno, SCXSRCLOCATION);
+            }
+            SetCloseOnExec(m_epollFd);
+#endif
+        }
+
+        ~ChildEventPoller()
+        {
+#if defined(linux)
+            close(m_epollFd);
+#endif
+        }
+
+        void Add(int fd, bool writable, void* tag)
+        {
+#if defined(linux)
+            struct epoll_event event;
+            event.events = writable ? EPOLLOUT : EPOLLIN;
+            event.data.ptr = tag;
+            if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+            {
+                throw SCXErrnoException(L"epoll_ctl", errno, SCXSRCLOCATION);
+            }
+#else
+            m_fds[fd] = std::make_pair(static_cast<short>(writable ? POLLOUT : POLLIN), tag);
+#endif
+        }
+
+        void Remove(int fd)
+        {
+#if defined(linux)
+            struct epoll_event event;
+            epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, &event);
+#else
+            m_fds.erase(fd);
+#endif
+        }
+
+        void Wait(int timeoutMilliseconds, std::vector<void*>& ready)
+        {
+            ready.clear();
+#if defined(linux)
+            struct epoll_event events[64];
+            int count = epoll_wait(m_epollFd, events, sizeof(events) / sizeof(events[0]), timeoutMilliseconds);
+            for (int i = 0; i < count; i++)
+            {
+                ready.push_back(events[i].data.ptr);
+            }
+#else
+            std::vector<struct pollfd> fds;
+            std::vector<void*> tags;
+            for (std::map<int, std::pair<short, void*> >::const_iterator it = m_fds.begin(); it != m_fds.end(); ++it)
+            {
+                struct pollfd pfd;
+                pfd.fd = it->first;
+                pfd.events = it->second.first;
+                pfd.revents = 0;
+                fds.push_back(pfd);
+                tags.push_back(it->second.second);
+            }
+            int count = poll(&fds[0], fds.size(), timeoutMilliseconds);
+            for (size_t i = 0; count > 0 && i < fds.size(); i++)
+            {
+                if (0 != fds[i].revents)
+                {
+                    ready.push_back(tags[i]);
+                }
+            }
+#endif
+        }
+
+    private:
+#if defined(linux)
+        int m_epollFd;                                      //!< epoll instance
+#else
+        std::map<int, std::pair<short, void*> > m_fds;      //!< Events and tag by descriptor
+#endif
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Formats the usage as returned by the RunAs provider.
+
+       \returns     Usage as "name=value;" pairs (empty if not known)
+    */
+    std::wstring ChildResourceUsage::Format() const
+    {
+        if (!known)
+        {
+            return L"";
+        }
+
+        return L"UserCPUMilliseconds=" + StrFrom(userMilliseconds) +
+            L";SystemCPUMilliseconds=" + StrFrom(systemMilliseconds) +
+            L";MaxResidentKB=" + StrFrom(maxResidentKB) +
+            L";BlockReads=" + StrFrom(blockReads) +
+            L";BlockWrites=" + StrFrom(blockWrites) + L";";
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+    */
+    ChildProcessEngine::ChildProcessEngine()
+        : m_running(0),
+          m_loopRunning(false),
+          m_stop(false)
+    {
+        if (OpenWakePipe(m_wakeFds))
+        {
+            SetNonBlocking(m_wakeFds[0]);
+            SetNonBlocking(m_wakeFds[1]);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    ChildProcessEngine::~ChildProcessEngine()
+    {
+        Shutdown();
+        ClosePipe(m_wakeFds);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Runs a command and waits for it to complete.
+
+       The command line is split into arguments the way a shell would (quotes
+       and backslashes), but is not otherwise interpreted.  When the timeout
+       passes, the child's process group is sent SIGTERM and then SIGKILL,
+       and the call returns once the child exited (or, if it can't be
+       signalled, after the grace periods).
+
+       \param[in]   command               Command line
+       \param[in]   input                 Data for stdin
+       \param[out]  output                Receives stdout
+       \param[out]  error                 Receives stderr
+       \param[in]   timeoutMilliseconds   Time allowed (0 for no limit)
+       \param[in]   cwd                   Working directory (empty for the current one)
+       \param[in]   chroot                Directory to chroot to (empty for none)
+       \param[in]   limits                Resource limits for the child
+       \param[out]  usage                 If not NULL, receives the resources used by the child
+       \returns     Exit status of the command (128 + signal if killed by a signal)
+       \throws      SCXInvalidArgumentException   If the command is empty
+       \throws      SCXErrnoException             If the command can't be started
+       \throws      SCXInternalErrorException     If the timeout passed
+    */
+    int ChildProcessEngine::Run(const std::wstring& command, std::istream& input, std::ostream& output,
+                                std::ostream& error, unsigned int timeoutMilliseconds, const SCXFilePath& cwd,
+                                const SCXFilePath& chroot, const RunAsResourceLimits& limits, ChildResourceUsage* usage)
+    {
+        scxulong deadline = (0 == timeoutMilliseconds) ? 0 : GetMonotonicMilliseconds() + timeoutMilliseconds;
+        ChildExecution execution(output, error, deadline);
+        Start(execution, command, input, cwd, chroot, limits);
+
+        {
+            SCXConditionHandle h(m_cond);
+            m_pending.push_back(&execution);
+            m_running++;
+            if (m_loopRunning)
+            {
+                Wake();
+            }
+            else
+            {
+                try
+                {
+                    if (NULL != m_thread)
+                    {
+                        // Previous loop thread is exiting (or has exited)
+                        m_thread->Wait();
+                    }
+                    m_stop = false;
+                    m_thread = new SCXThread(LoopBody, new ChildProcessEngineParam(this));
+                    m_loopRunning = true;
+                }
+                catch (...)
+                {
+                    m_pending.remove(&execution);
+                    m_running--;
+                    SignalGroup(execution.pid, SIGKILL);
+                    waitpid(execution.pid, NULL, 0);
+                    close(execution.outFd);
+                    close(execution.errFd);
+                    if (execution.inFd >= 0)
+                    {
+                        close(execution.inFd);
+                    }
+                    throw;
+                }
+            }
+
+            while (!execution.done)
+            {
+                h.Wait();
+            }
+        }
+
+        if (NULL != usage)
+        {
+            *usage = execution.usage;
+        }
+
+        if (execution.timedOut)
+        {
+            throw SCXInternalErrorException(L"Timeout of " + StrFrom(timeoutMilliseconds / 1000)
+                                            + L" seconds expired running: " + command, SCXSRCLOCATION);
+        }
+        if (execution.statusKnown && WIFEXITED(execution.status))
+        {
+            return WEXITSTATUS(execution.status);
+        }
+        if (execution.statusKnown && WIFSIGNALED(execution.status))
+        {
+            return 128 + WTERMSIG(execution.status);
+        }
+        return -1;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the event loop thread (after running children complete).
+    */
+    void ChildProcessEngine::Shutdown()
+    {
+        SCXHandle<SCXThread> thread;
+        {
+            SCXConditionHandle h(m_cond);
+            m_stop = true;
+            Wake();
+            thread = m_thread;
+        }
+
+        if (NULL != thread)
+        {
+            thread->Wait();
+        }
+
+        SCXConditionHandle h(m_cond);
+        if (!m_loopRunning)
+        {
+            m_thread = NULL;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of children not yet completed.
+
+       \returns     Number of running children
+    */
+    size_t ChildProcessEngine::GetRunningCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_running;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Splits a command line into arguments.
+
+       Arguments are separated by blanks.  Single quotes keep everything up to
+       the next single quote, double quotes keep everything up to the next
+       double quote (where backslash escapes ", \, $ and `), and elsewhere a
+       backslash keeps the following character.
+
+       \param[in]   command   Command line
+       \returns     Arguments (UTF-8)
+    */
+    std::vector<std::string> ChildProcessEngine::SplitCommand(const std::wstring& command)
+    {
+        // Quotes, blanks and backslash are single bytes in UTF-8
+        std::string line = StrToUTF8(command);
+        std::vector<std::string> args;
+        std::string current;
+        bool inArgument = false;
+        char quote = 0;
+
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            char c = line[i];
+            if ('\'' == quote)
+            {
+                if ('\'' == c)
+                {
+                    quote = 0;
+                }
+                else
+                {
+                    current += c;
+                }
+            }
+            else if ('"' == quote)
+            {
+                if ('"' == c)
+                {
+                    quote = 0;
+                }
+                else if ('\\' == c && i + 1 < line.size() && std::string("\"\\$`").find(line[i + 1]) != std::string::npos)
+                {
+                    current += line[++i];
+                }
+                else
+                {
+                    current += c;
+                }
+            }
+            else if ('\'' == c || '"' == c)
+            {
+                quote = c;
+                inArgument = true;
+            }
+            else if ('\\' == c && i + 1 < line.size())
+            {
+                current += line[++i];
+                inArgument = true;
+            }
+            else if (' ' == c || '\t' == c || '\n' == c)
+            {
+                if (inArgument)
+                {
+                    args.push_back(current);
+                    current.clear();
+                    inArgument = false;
+                }
+            }
+            else
+            {
+                current += c;
+                inArgument = true;
+            }
+        }
+
+        if (inArgument)
+        {
+            args.push_back(current);
+        }
+        return args;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Event loop thread body.
+
+       \param[in]   param   ChildProcessEngineParam
+    */
+    void ChildProcessEngine::LoopBody(SCXThreadParamHandle& param)
+    {
+        ChildProcessEngineParam* p = static_cast<ChildProcessEngineParam*>(param.GetData());
+        p->m_engine->Loop();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Event loop: moves data to and from the pipes of all children, reaps
+       them, and enforces their deadlines.
+    */
+    void ChildProcessEngine::Loop()
+    {
+        // Writing to a child that closed stdin returns EPIPE instead of signalling the process
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+        ChildEventPoller poller;
+        poller.Add(m_wakeFds[0], false, m_wakeFds);
+
+        std::list<ChildExecution*> active;
+        std::vector<void*> ready;
+        std::vector<char> buffer(cReadSize);
+        scxulong idleSince = GetMonotonicMilliseconds();
+        scxulong wakeAt = 0;
+
+        for (;;)
+        {
+            {
+                SCXConditionHandle h(m_cond);
+                while (!m_pending.empty())
+                {
+                    ChildExecution* execution = m_pending.front();
+                    m_pending.pop_front();
+                    Register(poller, *execution);
+                    active.push_back(execution);
+                }
+
+                if (active.empty() && (m_stop || GetMonotonicMilliseconds() - idleSince >= cIdleExit))
+                {
+                    m_loopRunning = false;
+                    break;
+                }
+            }
+
+            scxulong now = GetMonotonicMilliseconds();
+            int timeout = cExitPollInterval;
+            if (active.empty())
+            {
+                timeout = (now - idleSince >= cIdleExit) ? 0 : static_cast<int>(cIdleExit - (now - idleSince));
+            }
+            else if (0 != wakeAt)
+            {
+                timeout = (wakeAt <= now) ? 0 : static_cast<int>(std::min<scxulong>(wakeAt - now, timeout));
+            }
+
+            poller.Wait(timeout, ready);
+            for (std::vector<void*>::const_iterator it = ready.begin(); it != ready.end(); ++it)
+            {
+                if (m_wakeFds == *it)
+                {
+                    while (read(m_wakeFds[0], &buffer[0], buffer.size()) > 0)
+                    {
+                    }
+                }
+                else
+                {
+                    HandleEvent(poller, *it, buffer);
+                }
+            }
+
+            now = GetMonotonicMilliseconds();
+            wakeAt = 0;
+            std::vector<ChildExecution*> completed;
+            std::list<ChildExecution*>::iterator it = active.begin();
+            while (it != active.end())
+            {
+                ChildExecution* execution = *it;
+                if (Check(poller, *execution, now))
+                {
+                    if (!execution->reaped)
+                    {
+                        m_orphans.push_back(execution->pid);
+                    }
+                    completed.push_back(execution);
+                    it = active.erase(it);
+                    continue;
+                }
+
+                scxulong next = 0;
+                if (execution->reaped)
+                {
+                    next = execution->exitedAt + cDrainGrace;
+                }
+                else if (execution->outFd < 0 && execution->errFd < 0)
+                {
+                    next = now + cExitingPollInterval;
+                }
+                else if (0 != execution->termSentAt)
+                {
+                    next = execution->termSentAt + (execution->killSent ? 2 : 1) * cKillGrace;
+                }
+                else if (0 != execution->deadline)
+                {
+                    next = execution->deadline;
+                }
+                if (0 != next && (0 == wakeAt || next < wakeAt))
+                {
+                    wakeAt = next;
+                }
+                ++it;
+            }
+
+            std::vector<pid_t>::iterator orphan = m_orphans.begin();
+            while (orphan != m_orphans.end())
+            {
+                pid_t result = waitpid(*orphan, NULL, WNOHANG);
+                orphan = (0 == result) ? orphan + 1 : m_orphans.erase(orphan);
+            }
+
+            if (!completed.empty())
+            {
+                SCXConditionHandle h(m_cond);
+                for (std::vector<ChildExecution*>::const_iterator c = completed.begin(); c != completed.end(); ++c)
+                {
+                    (*c)->done = true;
+                    m_running--;
+                }
+                h.Broadcast();
+            }
+            if (active.empty() && !completed.empty())
+            {
+                idleSince = now;
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts a child in its own process group, with pipes for stdin, stdout
+       and stderr.  Runs in the caller's thread.
+
+       \param[in,out]  execution   Receives the child and its pipes
+       \param[in]      command     Command line
+       \param[in]      input       Data for stdin
+       \param[in]      cwd         Working directory (empty for the current one)
+       \param[in]      chroot      Directory to chroot to (empty for none)
+       \param[in]      limits      Resource limits for the child
+    */
+    void ChildProcessEngine::Start(ChildExecution& execution, const std::wstring& command, std::istream& input,
+                                   const SCXFilePath& cwd, const SCXFilePath& chroot,
+                                   const RunAsResourceLimits& limits)
+    {
+        std::vector<std::string> args = SplitCommand(command);
+        if (args.empty())
+        {
+            throw SCXInvalidArgumentException(L"command", L"Empty command", SCXSRCLOCATION);
+        }
+        execution.input.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+        // Everything the child needs is prepared before fork, so it only makes async-signal-safe calls
+        std::vector<char*> argv;
+        for (std::vector<std::string>::iterator it = args.begin(); it != args.end(); ++it)
+        {
+            argv.push_back(&(*it)[0]);
+        }
+        argv.push_back(NULL);
+        std::string cwdPath = StrToUTF8(cwd.Get());
+        std::string chrootPath = StrToUTF8(chroot.Get());
+        std::string cgroupProcs;
+        if (!limits.cgroup.empty())
+        {
+            SCXFilePath procs;
+            procs.SetDirectory(limits.cgroup);
+            procs.SetFilename(L"cgroup.procs");
+            cgroupProcs = StrToUTF8(procs.Get());
+        }
+        std::vector<std::pair<int, rlim_t> > rlimits;
+        AddRLimit(rlimits, RLIMIT_CPU, limits.cpuSeconds);
+        AddRLimit(rlimits, RLIMIT_AS, limits.memoryMB * 1024 * 1024);
+        AddRLimit(rlimits, RLIMIT_FSIZE, limits.fileSizeMB * 1024 * 1024);
+#if defined(RLIMIT_NPROC)
+        AddRLimit(rlimits, RLIMIT_NPROC, limits.processes);
+#endif
+        AddRLimit(rlimits, RLIMIT_NOFILE, limits.openFiles);
+        long maxFd = sysconf(_SC_OPEN_MAX);
+        if (maxFd < 0)
+        {
+            maxFd = 1024;
+        }
+
+        int inPipe[2] = { -1, -1 };
+        int outPipe[2] = { -1, -1 };
+        int errPipe[2] = { -1, -1 };
+        int statusPipe[2] = { -1, -1 };
+        if (pipe(inPipe) < 0 || pipe(outPipe) < 0 || pipe(errPipe) < 0 || pipe(statusPipe) < 0)
+        {
+            int err = errno;
+            ClosePipe(inPipe);
+            ClosePipe(outPipe);
+            ClosePipe(errPipe);
+            ClosePipe(statusPipe);
+            throw SCXErrnoException(L"pipe", err, SCXSRCLOCATION);
+        }
+        SetCloseOnExec(inPipe[1]);
+        SetCloseOnExec(outPipe[0]);
+        SetCloseOnExec(errPipe[0]);
+        SetCloseOnExec(statusPipe[1]);
+
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            int err = errno;
+            ClosePipe(inPipe);
+            ClosePipe(outPipe);
+            ClosePipe(errPipe);
+            ClosePipe(statusPipe);
+            throw SCXErrnoException(L"fork", err, SCXSRCLOCATION);
+        }
+
+        if (0 == pid)
+        {
+            setpgid(0, 0);
+            dup2(inPipe[0], 0);
+            dup2(outPipe[1], 1);
+            dup2(errPipe[1], 2);
+            for (int fd = 3; fd < maxFd; fd++)
+            {
+                if (fd != statusPipe[1])
+                {
+                    close(fd);
+                }
+            }
+
+            // The cgroup is joined first, as its path is outside of the chroot
+            int failure[2] = { eStartCGroup, 0 };
+            if (!cgroupProcs.empty())
+            {
+                int fd = open(cgroupProcs.c_str(), O_WRONLY);
+                if (fd < 0 || write(fd, "0", 1) != 1)
+                {
+                    failure[1] = errno;
+                }
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+            }
+
+            // A limit can't be raised above the hard limit the agent runs with
+            for (size_t i = 0; 0 == failure[1] && i < rlimits.size(); i++)
+            {
+                failure[0] = eStartRLimit;
+                struct rlimit limit;
+                if (0 == getrlimit(rlimits[i].first, &limit) &&
+                    RLIM_INFINITY != limit.rlim_max && limit.rlim_max < rlimits[i].second)
+                {
+                    rlimits[i].second = limit.rlim_max;
+                }
+                limit.rlim_cur = limit.rlim_max = rlimits[i].second;
+                if (0 != setrlimit(rlimits[i].first, &limit))
+                {
+                    failure[1] = errno;
+                }
+            }
+
+            if (0 == failure[1] && 0 != limits.nice)
+            {
+                failure[0] = eStartNice;
+                errno = 0;
+                if (-1 == nice(limits.nice) && 0 != errno)
+                {
+                    failure[1] = errno;
+                }
+            }
+
+#if defined(linux) && defined(SYS_ioprio_set)
+            if (0 == failure[1] && 0 != limits.ioClass)
+            {
+                // IOPRIO_WHO_PROCESS, IOPRIO_PRIO_VALUE(class, level)
+                failure[0] = eStartIOPriority;
+                if (syscall(SYS_ioprio_set, 1, 0, (limits.ioClass << 13) | limits.ioPriority) < 0)
+                {
+                    failure[1] = errno;
+                }
+            }
+#endif
+
+            if (0 == failure[1] && !chrootPath.empty())
+            {
+                failure[0] = eStartChroot;
+                if (0 != ::chroot(chrootPath.c_str()))
+                {
+                    failure[1] = errno;
+                }
+            }
+
+            if (0 == failure[1] && !cwdPath.empty())
+            {
+                failure[0] = eStartChdir;
+                if (0 != chdir(cwdPath.c_str()))
+                {
+                    failure[1] = errno;
+                }
+            }
+
+            if (0 == failure[1])
+            {
+                failure[0] = eStartExec;
+                execvp(argv[0], &argv[0]);
+                failure[1] = errno;
+            }
+
+            // Tell the parent why the command didn't start
+            ssize_t ignored = write(statusPipe[1], failure, sizeof(failure));
+            (void) ignored;
+            _exit(127);
+        }
+
+        // Also set in the parent, so the group exists before anyone signals it
+        setpgid(pid, pid);
+        close(inPipe[0]);
+        close(outPipe[1]);
+        close(errPipe[1]);
+        close(statusPipe[1]);
+
+        // The status pipe is closed by exec, or carries the failed step and its errno
+        int failure[2] = { eStartExec, 0 };
+        ssize_t count;
+        do
+        {
+            count = read(statusPipe[0], failure, sizeof(failure));
+        } while (count < 0 && EINTR == errno);
+        close(statusPipe[0]);
+
+        if (static_cast<ssize_t>(sizeof(failure)) == count)
+        {
+            waitpid(pid, NULL, 0);
+            close(inPipe[1]);
+            close(outPipe[0]);
+            close(errPipe[0]);
+            throw SCXErrnoException(cStartStepNames[failure[0]], failure[1], SCXSRCLOCATION);
+        }
+
+        execution.pid = pid;
+        execution.outFd = outPipe[0];
+        execution.errFd = errPipe[0];
+        SetNonBlocking(execution.outFd);
+        SetNonBlocking(execution.errFd);
+        if (execution.input.empty())
+        {
+            close(inPipe[1]);
+        }
+        else
+        {
+            execution.inFd = inPipe[1];
+            SetNonBlocking(execution.inFd);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds the open pipes of an execution to the poller.
+
+       \param[in]   poller      Poller
+       \param[in]   execution   New execution
+    */
+    void ChildProcessEngine::Register(ChildEventPoller& poller, ChildExecution& execution)
+    {
+        if (execution.inFd >= 0)
+        {
+            poller.Add(execution.inFd, true, &execution.inTag);
+        }
+        poller.Add(execution.outFd, false, &execution.outTag);
+        poller.Add(execution.errFd, false, &execution.errTag);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Moves data for a ready pipe.
+
+       \param[in]   poller   Poller
+       \param[in]   tag      ChildFd of the pipe
+       \param[in]   buffer   Buffer for reading
+    */
+    void ChildProcessEngine::HandleEvent(ChildEventPoller& poller, void* tag, std::vector<char>& buffer)
+    {
+        ChildFd* childFd = static_cast<ChildFd*>(tag);
+        ChildExecution& execution = *childFd->execution;
+        int& fd = *childFd->fd;
+        if (fd < 0)
+        {
+            return;
+        }
+
+        if (&fd == &execution.inFd)
+        {
+            ssize_t count = write(fd, execution.input.data() + execution.inputOffset,
+                                  execution.input.size() - execution.inputOffset);
+            if (count > 0)
+            {
+                execution.inputOffset += static_cast<size_t>(count);
+            }
+            if (execution.inputOffset == execution.input.size()
+                || (count < 0 && EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno))
+            {
+                CloseFd(poller, fd);
+            }
+            return;
+        }
+
+        ssize_t count = read(fd, &buffer[0], buffer.size());
+        if (count > 0)
+        {
+            std::ostream& stream = (&fd == &execution.outFd) ? execution.output : execution.error;
+            stream.write(&buffer[0], count);
+        }
+        else if (0 == count || (EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno))
+        {
+            CloseFd(poller, fd);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reaps an execution's child and enforces its deadline.
+
+       \param[in]   poller      Poller
+       \param[in]   execution   Execution
+       \param[in]   now         Current time
+       \returns     true if the execution is complete (all pipes are closed then)
+    */
+    bool ChildProcessEngine::Check(ChildEventPoller& poller, ChildExecution& execution, scxulong now)
+    {
+        if (!execution.reaped)
+        {
+            int status = 0;
+            pid_t result = WaitChild(execution.pid, status, execution.usage);
+            if (result == execution.pid)
+            {
+                execution.reaped = true;
+                execution.statusKnown = true;
+                execution.status = status;
+                execution.exitedAt = now;
+            }
+            else if (result < 0 && ECHILD == errno)
+            {
+                // Reaped elsewhere; the exit status is lost
+                execution.reaped = true;
+                execution.exitedAt = now;
+            }
+        }
+
+        bool complete = false;
+        if (execution.reaped)
+        {
+            // Background grandchildren may keep the pipes open; they get a short
+            // grace period to finish writing and are then left on their own.
+            complete = (execution.outFd < 0 && execution.errFd < 0) || now - execution.exitedAt >= cDrainGrace;
+        }
+        else if (0 != execution.deadline && now >= execution.deadline)
+        {
+            execution.timedOut = true;
+            if (0 == execution.termSentAt)
+            {
+                SignalGroup(execution.pid, SIGTERM);
+                execution.termSentAt = now;
+            }
+            else if (!execution.killSent && now - execution.termSentAt >= cKillGrace)
+            {
+                SignalGroup(execution.pid, SIGKILL);
+                execution.killSent = true;
+            }
+            else if (execution.killSent && now - execution.termSentAt >= 2 * cKillGrace)
+            {
+                // Can't be signalled (e.g. elevated); stop waiting for it
+                complete = true;
+            }
+        }
+
+        if (complete)
+        {
+            CloseFd(poller, execution.inFd);
+            CloseFd(poller, execution.outFd);
+            CloseFd(poller, execution.errFd);
+        }
+        return complete;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes a pipe from the poller and closes it.
+
+       \param[in]      poller   Poller
+       \param[in,out]  fd       Pipe; set to -1
+    */
+    void ChildProcessEngine::CloseFd(ChildEventPoller& poller, int& fd)
+    {
+        if (fd >= 0)
+        {
+            poller.Remove(fd);
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Wakes the event loop.  Called with the lock held.
+    */
+    void ChildProcessEngine::Wake()
+    {
+        WriteWakePipe(m_wakeFds);
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,126 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        childprocessengine.h
+
+    \brief       Runs RunAs child processes from a single event loop
+
+    Every child runs in its own process group.  One thread multiplexes the
+    pipes of all running children (epoll on Linux, poll elsewhere), and
+    signals the whole process group when a child's deadline passes, so
+    grandchildren that keep the pipes open can't hold a caller beyond its
+    timeout.  Children can be started with resource limits, and their
+    resource usage is collected when they are reaped.
+
+    \date        2026-10-19 16:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef CHILDPROCESSENGINE_H
+#define CHILDPROCESSENGINE_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/scxfilepath.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxthread.h>
+
+#include "scxrunasconfigurator.h"
+
+#include <iosfwd>
+#include <list>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+namespace SCXCore
+{
+    struct ChildExecution;
+    class ChildEventPoller;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Resources used by a child (including the descendants it waited for).
+    */
+    struct ChildResourceUsage
+    {
+        ChildResourceUsage() :
+            known(false), userMilliseconds(0), systemMilliseconds(0), maxResidentKB(0),
+            blockReads(0), blockWrites(0)
+        { }
+
+        std::wstring Format() const;
+
+        bool known;                     //!< Usage was collected (false on platforms without wait4)
+        scxulong userMilliseconds;      //!< CPU time in user mode
+        scxulong systemMilliseconds;    //!< CPU time in kernel mode
+        scxulong maxResidentKB;         //!< Largest resident set size
+        scxulong blockReads;            //!< Block input operations
+        scxulong blockWrites;           //!< Block output operations
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Runs child processes, with all their I/O and deadlines handled by one
+       thread.  The thread is started when needed, and exits when no child
+       has run for a while.
+    */
+    class ChildProcessEngine
+    {
+    public:
+        //! Milliseconds between SIGTERM and SIGKILL to a timed out process group
+        static const unsigned int cKillGrace = 1000;
+
+        //! Milliseconds the pipes are drained after the child exited (for grandchildren holding them)
+        static const unsigned int cDrainGrace = 500;
+
+        //! Milliseconds without children before the event loop thread exits
+        static const unsigned int cIdleExit = 30000;
+
+        ChildProcessEngine();
+        virtual ~ChildProcessEngine();
+
+        int Run(const std::wstring& command, std::istream& input, std::ostream& output, std::ostream& error,
+                unsigned int timeoutMilliseconds, const SCXCoreLib::SCXFilePath& cwd,
+                const SCXCoreLib::SCXFilePath& chroot,
+                const RunAsResourceLimits& limits = RunAsResourceLimits(), ChildResourceUsage* usage = NULL);
+        void Shutdown();
+
+        size_t GetRunningCount();
+
+        static std::vector<std::string> SplitCommand(const std::wstring& command);
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ChildProcessEngine";
+        }
+
+    private:
+        static void LoopBody(SCXCoreLib::SCXThreadParamHandle& param);
+        void Loop();
+        void Start(ChildExecution& execution, const std::wstring& command, std::istream& input,
+                   const SCXCoreLib::SCXFilePath& cwd, const SCXCoreLib::SCXFilePath& chroot,
+                   const RunAsResourceLimits& limits);
+        void Register(ChildEventPoller& poller, ChildExecution& execution);
+        void HandleEvent(ChildEventPoller& poller, void* tag, std::vector<char>& buffer);
+        bool Check(ChildEventPoller& poller, ChildExecution& execution, scxulong now);
+        void CloseFd(ChildEventPoller& poller, int& fd);
+        void Wake();
+
+        SCXCoreLib::SCXCondition m_cond;                        //!< Protects the members below, signalled on completion
+        std::list<ChildExecution*> m_pending;                   //!< Started, not yet taken by the event loop
+        size_t m_running;                                       //!< Executions not yet completed
+        bool m_loopRunning;                                     //!< Event loop thread is running
+        bool m_stop;                                            //!< Event loop should exit once idle
+        int m_wakeFds[2];                                       //!< Pipe waking the event loop
+        std::vector<pid_t> m_orphans;                           //!< Children given up on, not yet reaped (event loop only)
+        SCXCoreLib::SCXHandle<SCXCoreLib::SCXThread> m_thread;  //!< Event loop thread
+    };
+
+    extern ChildProcessEngine g_ChildProcessEngine;
+}
+
+#endif /* CHILDPROCESSENGINE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
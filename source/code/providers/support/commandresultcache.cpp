@@ -0,0 +1,266 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        commandresultcache.cpp
+
+    \brief       Result cache for read-only ExecuteCommand calls
+
+    \date        2026-10-19 15:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/stringaid.h>
+
+#include "commandresultcache.h"
+#include "providermetrics.h"
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    SCXCore::ProviderCounter& Hits()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"CommandResultCache::Hits");
+        return s_counter;
+    }
+
+    SCXCore::ProviderCounter& Misses()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"CommandResultCache::Misses");
+        return s_counter;
+    }
+
+    SCXCore::ProviderCounter& Shared()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"CommandResultCache::Shared");
+        return s_counter;
+    }
+}
+
+namespace SCXCore
+{
+    CommandResultCache g_CommandResultCache;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   maxEntries   Maximum number of completed results kept
+    */
+    CommandResultCache::CommandResultCache(size_t maxEntries)
+        : m_maxEntries(maxEntries)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the result of a command, running it only if needed.
+
+       A completed result no older than maxAge is returned as is.  If the same
+       command is already running, the call waits for it and returns its
+       result (the timeout is part of the key, so the wait is bounded by the
+       caller's own timeout).  Otherwise the executor runs the command and the result is
+       stored.  If the executor throws, nothing is stored and the exception is
+       passed on (calls waiting for it then run the command themselves).
+
+       \param[in]   key        Cache key (see MakeKey())
+       \param[in]   maxAge     Maximum age of a returned result, in seconds
+                               (limited to cMaxCommandResultAge)
+       \param[in]   executor   Runs the command
+       \param[out]  result     The result
+       \returns     true if the result was shared, false if the executor ran
+    */
+    bool CommandResultCache::Execute(const std::wstring& key, unsigned int maxAge, CommandResultExecutor& executor,
+                                     CommandResult& result)
+    {
+        SCXConditionHandle h(m_cond);
+
+        bool waited = false;
+        for (;;)
+        {
+            Prune(GetTime());
+
+            std::map<std::wstring, Entry>::iterator it = m_entries.find(key);
+            if (it == m_entries.end())
+            {
+                break;
+            }
+
+            if (it->second.running)
+            {
+                if (!waited)
+                {
+                    Shared().Increment();
+                    waited = true;
+                }
+                h.Wait();
+                continue;
+            }
+
+            if (waited || IsFresh(it->second, GetTime(), maxAge))
+            {
+                if (!waited)
+                {
+                    Hits().Increment();
+                }
+                result = it->second.result;
+                return true;
+            }
+
+            m_entries.erase(it);
+            break;
+        }
+
+        Misses().Increment();
+        m_entries[key].running = true;
+        h.Unlock();
+
+        CommandResult executed;
+        try
+        {
+            executor.Execute(executed);
+        }
+        catch (...)
+        {
+            h.Lock();
+            m_entries.erase(key);
+            h.Broadcast();
+            throw;
+        }
+
+        h.Lock();
+        Entry& entry = m_entries[key];
+        entry.running = false;
+        entry.completed = GetTime();
+        entry.result = executed;
+        Prune(entry.completed);
+        h.Broadcast();
+
+        result = executed;
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes all completed results.
+    */
+    void CommandResultCache::Clear()
+    {
+        SCXConditionHandle h(m_cond);
+
+        std::map<std::wstring, Entry>::iterator it = m_entries.begin();
+        while (it != m_entries.end())
+        {
+            std::map<std::wstring, Entry>::iterator current = it++;
+            if (!current->second.running)
+            {
+                m_entries.erase(current);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of entries (completed or running).
+
+       \returns     Number of entries
+    */
+    size_t CommandResultCache::GetEntryCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_entries.size();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Builds the cache key of a command.
+
+       \param[in]   command         Command line
+       \param[in]   elevationType   Elevation type
+       \param[in]   cwd             Working directory the command runs in
+       \param[in]   chroot          Directory the command is chrooted to
+       \param[in]   timeout         Seconds the command may run (0 for no limit)
+       \returns     Key for Execute()
+
+       Calls only share an execution that runs with their own timeout, so
+       waiting for it never takes longer than running the command would.
+    */
+    std::wstring CommandResultCache::MakeKey(const std::wstring& command, const std::wstring& elevationType,
+                                             const std::wstring& cwd, const std::wstring& chroot,
+                                             unsigned int timeout)
+    {
+        // Separated by a character that can't appear in any of the parts
+        std::wstring key(StrFrom(timeout));
+        key.append(1, L'\0').append(elevationType);
+        key.append(1, L'\0').append(cwd);
+        key.append(1, L'\0').append(chroot);
+        key.append(1, L'\0').append(command);
+        return key;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Tells if a completed result may be returned.
+
+       \param[in]   entry    Completed entry
+       \param[in]   now      Current time
+       \param[in]   maxAge   Maximum age the caller accepts
+       \returns     true if the result is recent enough
+    */
+    bool CommandResultCache::IsFresh(const Entry& entry, time_t now, unsigned int maxAge) const
+    {
+        if (maxAge > cMaxCommandResultAge)
+        {
+            maxAge = cMaxCommandResultAge;
+        }
+
+        // Wall clock may have been stepped backwards since the result was stored
+        return now >= entry.completed && now - entry.completed <= static_cast<time_t>(maxAge);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes expired results, and the oldest results beyond the entry limit.
+       Must be called with the lock held.
+
+       \param[in]   now   Current time
+    */
+    void CommandResultCache::Prune(time_t now)
+    {
+        size_t completed = 0;
+        std::map<std::wstring, Entry>::iterator it = m_entries.begin();
+        while (it != m_entries.end())
+        {
+            std::map<std::wstring, Entry>::iterator current = it++;
+            if (current->second.running)
+            {
+                continue;
+            }
+            if (!IsFresh(current->second, now, cMaxCommandResultAge))
+            {
+                m_entries.erase(current);
+                continue;
+            }
+            completed++;
+        }
+
+        while (completed > m_maxEntries)
+        {
+            std::map<std::wstring, Entry>::iterator oldest = m_entries.end();
+            for (it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if (!it->second.running && (oldest == m_entries.end() || it->second.completed < oldest->second.completed))
+                {
+                    oldest = it;
+                }
+            }
+            m_entries.erase(oldest);
+            completed--;
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,122 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        commandresultcache.h
+
+    \brief       Result cache for read-only ExecuteCommand calls
+
+    Management packs run the same read-only commands (df, rpm -q, ...) from
+    several rules within seconds of each other.  Callers that mark a command
+    as cacheable (by giving a maximum result age) share recent results, and
+    identical calls made while the command runs wait for it instead of
+    starting another process.
+
+    \date        2026-10-19 15:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef COMMANDRESULTCACHE_H
+#define COMMANDRESULTCACHE_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+
+#include "childprocessengine.h"
+
+#include <map>
+#include <string>
+#include <time.h>
+
+namespace SCXCore
+{
+    //! Default maximum number of cached results
+    const size_t cDefaultCommandResultCacheEntries = 128;
+
+    //! Results are never kept (or returned) longer than this, in seconds
+    const unsigned int cMaxCommandResultAge = 3600;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Result of one command execution.
+    */
+    struct CommandResult
+    {
+        CommandResult() : succeeded(false), returncode(-1) { }
+
+        bool succeeded;             //!< Return value of the execution
+        int returncode;             //!< Exit code of the command
+        std::wstring out;           //!< stdout (already limited)
+        std::wstring err;           //!< stderr (already limited)
+        ChildResourceUsage usage;   //!< Resources used by the run that produced the result
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Runs the command when the cache has no usable result.
+    */
+    class CommandResultExecutor
+    {
+    public:
+        virtual ~CommandResultExecutor() { }
+        virtual void Execute(CommandResult& result) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Cache of command results, keyed by everything that affects the result.
+
+       Hits, misses and calls that shared a running execution are published
+       through the provider metrics as CommandResultCache::Hits,
+       CommandResultCache::Misses and CommandResultCache::Shared.
+    */
+    class CommandResultCache
+    {
+    public:
+        CommandResultCache(size_t maxEntries = cDefaultCommandResultCacheEntries);
+        virtual ~CommandResultCache() { };
+
+        bool Execute(const std::wstring& key, unsigned int maxAge, CommandResultExecutor& executor,
+                     CommandResult& result);
+        void Clear();
+
+        size_t GetEntryCount();
+
+        static std::wstring MakeKey(const std::wstring& command, const std::wstring& elevationType,
+                                    const std::wstring& cwd, const std::wstring& chroot,
+                                    unsigned int timeout);
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"CommandResultCache";
+        }
+
+    protected:
+        //! Current time; virtual so tests can control it
+        virtual time_t GetTime() const { return time(NULL); }
+
+    private:
+        //! One cached result (or running execution)
+        struct Entry
+        {
+            Entry() : running(false), completed(0) { }
+
+            bool running;               //!< true while the command executes
+            time_t completed;           //!< When the result was produced
+            CommandResult result;       //!< The result (if not running)
+        };
+
+        bool IsFresh(const Entry& entry, time_t now, unsigned int maxAge) const;
+        void Prune(time_t now);
+
+        SCXCoreLib::SCXCondition m_cond;            //!< Protects the entries, signalled when an execution completes
+        size_t m_maxEntries;                        //!< Maximum number of completed results kept
+        std::map<std::wstring, Entry> m_entries;    //!< Entries by key
+    };
+
+    extern CommandResultCache g_CommandResultCache;
+}
+
+#endif /* COMMANDRESULTCACHE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,121 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        cpuprovider.cpp
+
+    \brief       CPU provider implementation
+
+    \date        2026-10-19 12:10:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxthread.h>
+#include <scxcorelib/scxthreadlock.h>
+
+#include "startuplog.h"
+#include "cpuprovider.h"
+#include "sysutils.h"
+
+#include <time.h>
+
+using namespace SCXSystemLib;
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    void CPUProvider::Load()
+    {
+        if ( 1 == ++ms_loadCount )
+        {
+            m_log = SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.cpuprovider");
+            LogStartup();
+            SCX_LOGTRACE(m_log, L"CPUProvider::Load()");
+
+            m_cpusEnum = new CPUEnumeration();
+            m_cpusEnum->Init();
+            m_demand.Start(GetSamplingIdleSecs(), time(NULL));
+        }
+    }
+
+    void CPUProvider::Unload()
+    {
+        SCX_LOGTRACE(m_log, L"CPUProvider::Unload()");
+        if (0 == --ms_loadCount)
+        {
+            m_demand.Stop();
+            if (m_cpusEnum != NULL)
+            {
+                m_cpusEnum->CleanUp();
+                m_cpusEnum = NULL;
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the CPU enumeration for a query, creating it again if it was
+       released while idle.  This never waits: until the warm-up is over
+       (see IsWarmingUp()), the percentages come from a single sample.
+
+       \param[in]   className   Class queried
+       \returns     CPU enumeration
+    */
+    SCXHandle<CPUEnumeration> CPUProvider::GetEnumCPUs(const std::wstring& className)
+    {
+        scxulong nowMs = GetMonotonicMilliseconds();
+        if (m_demand.Query(className, time(NULL)))
+        {
+            // Percentages are computed between samples; the second one follows once it is due
+            m_cpusEnum = new CPUEnumeration();
+            m_cpusEnum->Init();
+            m_cpusEnum->SampleData();
+            m_demand.StartWarmUp(nowMs);
+        }
+        else if (m_demand.WarmUpDue(nowMs))
+        {
+            m_cpusEnum->SampleData();
+        }
+        return m_cpusEnum;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Records a query, and if it resumes sampling, waits for the second
+       sample to be due, so that GetEnumCPUs() takes it.  Called without the
+       lock, before a query that may wait.
+
+       \param[in]   className   Class queried
+    */
+    void CPUProvider::WarmUp(const std::wstring& className)
+    {
+        scxulong waitMs;
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+            GetEnumCPUs(className);
+            waitMs = m_demand.GetWarmUpWaitMs(GetMonotonicMilliseconds());
+        }
+        if (waitMs > 0)
+        {
+            SCXThread::Sleep(waitMs);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Releases the CPU enumeration, which stops its sampling thread.
+    */
+    void CPUProvider::SuspendSampling()
+    {
+        if (m_cpusEnum != NULL)
+        {
+            m_cpusEnum->CleanUp();
+            m_cpusEnum = NULL;
+        }
+    }
+
+    SCXCore::CPUProvider g_CPUProvider;
+    int SCXCore::CPUProvider::ms_loadCount = 0;
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
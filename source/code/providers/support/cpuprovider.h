@@ -0,0 +1,66 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        cpuprovider.h
+
+    \brief       CPU provider
+
+    \date        2026-10-19 12:10:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef CPUPROVIDER_H
+#define CPUPROVIDER_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxlog.h>
+#include <scxsystemlib/cpuenumeration.h>
+
+#include "samplingdemand.h"
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Holds the CPU enumeration shared by SCX_ProcessorStatisticalInformation
+       and the system snapshot.  Protected by "SCXCore::CPUProvider::Lock".
+
+       The enumeration is released while it isn't queried (see SamplingDemand).
+       All methods but WarmUp() must be called with the lock held.
+    */
+    class CPUProvider : public SuspendableSampler
+    {
+    public:
+        CPUProvider() : m_demand(L"CPUProvider", L"SCXCore::CPUProvider::Lock", this) { };
+        virtual ~CPUProvider() { };
+        void Load();
+        void Unload();
+
+        SCXCoreLib::SCXHandle<SCXSystemLib::CPUEnumeration> GetEnumCPUs(const std::wstring& className);
+        void WarmUp(const std::wstring& className);
+        bool IsWarmingUp() const { return m_demand.IsWarmingUp(); }
+        virtual void SuspendSampling();
+
+        SCXCoreLib::SCXLogHandle& GetLogHandle() { return m_log; }
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"CPUProvider";
+        }
+
+    private:
+        //! PAL implementation retrieving CPU information for local host
+        SCXCoreLib::SCXHandle<SCXSystemLib::CPUEnumeration> m_cpusEnum;
+        SCXCoreLib::SCXLogHandle m_log;
+        //! Queries of the enumeration, to release it while idle
+        SamplingDemand m_demand;
+        static int ms_loadCount;
+    };
+
+    extern SCXCore::CPUProvider g_CPUProvider;
+}
+
+#endif /* CPUPROVIDER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
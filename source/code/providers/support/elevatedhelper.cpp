@@ -0,0 +1,618 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        elevatedhelper.cpp
+
+    \brief       Long-lived elevated helper for sudo elevated RunAs commands
+
+    \date        2026-10-19 15:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+#include <scxsystemlib/scxsysteminfo.h>
+
+#include "childprocessengine.h"
+#include "elevatedhelper.h"
+#include "outputcapture.h"
+#include "sysutils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Response status: the command ran (returncode and output are valid)
+    const scxlong cStatusCompleted = 0;
+
+    //! Response status: the command couldn't be run (error text is valid)
+    const scxlong cStatusFailed = 1;
+
+#if defined(MSG_NOSIGNAL)
+    const int cSendFlags = MSG_NOSIGNAL;
+#else
+    const int cSendFlags = 0;
+#endif
+}
+
+namespace SCXCore
+{
+    ElevatedHelper g_ElevatedHelper;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sends a field.
+
+       \param[in]   data   Field data
+       \throws      SCXErrnoException   If the socket fails
+    */
+    void ElevatedHelperChannel::Write(const std::string& data)
+    {
+        if (data.size() > cMaxFieldSize)
+        {
+            throw SCXInternalErrorException(L"Field too large for elevated helper: " + StrFrom(data.size()), SCXSRCLOCATION);
+        }
+
+        unsigned char header[4];
+        size_t size = data.size();
+        for (int i = 3; i >= 0; i--)
+        {
+            header[i] = static_cast<unsigned char>(size & 0xFF);
+            size >>= 8;
+        }
+        Send(reinterpret_cast<const char*>(header), sizeof(header));
+        Send(data.data(), data.size());
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sends a number.
+
+       \param[in]   value   Number
+       \throws      SCXErrnoException   If the socket fails
+    */
+    void ElevatedHelperChannel::Write(scxlong value)
+    {
+        std::string data(8, '\0');
+        scxulong bits = static_cast<scxulong>(value);
+        for (int i = 7; i >= 0; i--)
+        {
+            data[i] = static_cast<char>(bits & 0xFF);
+            bits >>= 8;
+        }
+        Write(data);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives a field.
+
+       \param[out]  data   Field data
+       \returns     false if the other end closed the socket before the field
+       \throws      SCXErrnoException           If the socket fails
+       \throws      SCXInternalErrorException   If the field is malformed or cut short
+    */
+    bool ElevatedHelperChannel::Read(std::string& data)
+    {
+        unsigned char header[4];
+        if (!Receive(reinterpret_cast<char*>(header), sizeof(header), true))
+        {
+            return false;
+        }
+
+        size_t size = 0;
+        for (size_t i = 0; i < sizeof(header); i++)
+        {
+            size = (size << 8) | header[i];
+        }
+        if (size > cMaxFieldSize)
+        {
+            throw SCXInternalErrorException(L"Field too large from elevated helper: " + StrFrom(size), SCXSRCLOCATION);
+        }
+
+        data.resize(size);
+        if (size > 0)
+        {
+            Receive(&data[0], size, false);
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives a number.
+
+       \param[out]  value   Number
+       \returns     false if the other end closed the socket before the field
+       \throws      SCXErrnoException           If the socket fails
+       \throws      SCXInternalErrorException   If the field is malformed or cut short
+    */
+    bool ElevatedHelperChannel::Read(scxlong& value)
+    {
+        std::string data;
+        if (!Read(data))
+        {
+            return false;
+        }
+        if (data.size() != 8)
+        {
+            throw SCXInternalErrorException(L"Malformed number from elevated helper", SCXSRCLOCATION);
+        }
+
+        scxulong bits = 0;
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            bits = (bits << 8) | static_cast<unsigned char>(data[i]);
+        }
+        value = static_cast<scxlong>(bits);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Waits for data (or end of file) on the socket.
+
+       \param[in]   milliseconds   Maximum time to wait
+       \returns     true if a Read() won't block
+    */
+    bool ElevatedHelperChannel::WaitReadable(int milliseconds)
+    {
+        struct pollfd pfd;
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        int result;
+        do
+        {
+            result = poll(&pfd, 1, milliseconds);
+        } while (result < 0 && EINTR == errno);
+
+        return result > 0;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sends all of a buffer.
+
+       \param[in]   data   Data
+       \param[in]   size   Number of bytes
+       \throws      SCXErrnoException   If the socket fails
+    */
+    void ElevatedHelperChannel::Send(const char* data, size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t sent = send(m_fd, data, size, cSendFlags);
+            if (sent < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                throw SCXErrnoException(L"send", errno, SCXSRCLOCATION);
+            }
+            data += sent;
+            size -= static_cast<size_t>(sent);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives an exact number of bytes.
+
+       \param[out]  data         Buffer
+       \param[in]   size         Number of bytes
+       \param[in]   eofAllowed   true if end of file before the first byte is not an error
+       \returns     false on an allowed end of file
+       \throws      SCXErrnoException           If the socket fails
+       \throws      SCXInternalErrorException   On end of file within the data
+    */
+    bool ElevatedHelperChannel::Receive(char* data, size_t size, bool eofAllowed)
+    {
+        size_t received = 0;
+        while (received < size)
+        {
+            ssize_t result = recv(m_fd, data + received, size - received, 0);
+            if (result < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                throw SCXErrnoException(L"recv", errno, SCXSRCLOCATION);
+            }
+            if (0 == result)
+            {
+                if (eofAllowed && 0 == received)
+                {
+                    return false;
+                }
+                throw SCXInternalErrorException(L"Elevated helper connection closed unexpectedly", SCXSRCLOCATION);
+            }
+            received += static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Helper side: runs commands received on a socket until it is closed.
+
+       Each request is a command line, the data to write to its stdin, a
+       timeout in seconds and the number of bytes of stdout and stderr to
+       return.  Each response is a status, the
+       return code, the stdout data and total size, the stderr data and total
+       size, an error text, and the resource usage of the command (known flag,
+       user and system CPU milliseconds, max resident KB, block reads and
+       block writes).
+
+       \param[in]   fd       Socket to the agent
+       \param[in]   cwd      Working directory for commands
+       \param[in]   chroot   Directory commands are chrooted to (empty for none)
+       \param[in]   limits   Resource limits for commands
+       \returns     Exit status for the helper program
+    */
+    int RunElevatedHelper(int fd, const SCXFilePath& cwd, const SCXFilePath& chroot, const RunAsResourceLimits& limits)
+    {
+        ElevatedHelperChannel channel(fd);
+
+        try
+        {
+            channel.Write(std::string(cElevatedHelperHello));
+
+            for (;;)
+            {
+                std::string command;
+                std::string input;
+                scxlong timeout = 0;
+                scxlong limit = 0;
+                if (!channel.Read(command))
+                {
+                    // Agent closed the connection
+                    return 0;
+                }
+                if (!channel.Read(input) || !channel.Read(timeout) || !channel.Read(limit) || timeout < 0 || limit < 0)
+                {
+                    return 1;
+                }
+
+                std::istringstream processInput(input);
+                OutputCaptureBuffer processOutputBuffer(static_cast<size_t>(limit));
+                OutputCaptureBuffer processErrorBuffer(static_cast<size_t>(limit));
+                std::ostream processOutput(&processOutputBuffer);
+                std::ostream processError(&processErrorBuffer);
+
+                scxlong status = cStatusCompleted;
+                scxlong returncode = -1;
+                std::string errorText;
+                ChildResourceUsage usage;
+                try
+                {
+                    returncode = g_ChildProcessEngine.Run(StrFromUTF8(command), processInput, processOutput, processError,
+                                                 static_cast<unsigned>(timeout) * 1000, cwd, chroot, limits, &usage);
+                }
+                catch (SCXException& e)
+                {
+                    status = cStatusFailed;
+                    errorText = StrToUTF8(e.What());
+                }
+
+                channel.Write(status);
+                channel.Write(returncode);
+                channel.Write(processOutputBuffer.GetData());
+                channel.Write(static_cast<scxlong>(processOutputBuffer.GetTotalBytes()));
+                channel.Write(processErrorBuffer.GetData());
+                channel.Write(static_cast<scxlong>(processErrorBuffer.GetTotalBytes()));
+                channel.Write(errorText);
+                channel.Write(static_cast<scxlong>(usage.known ? 1 : 0));
+                channel.Write(static_cast<scxlong>(usage.userMilliseconds));
+                channel.Write(static_cast<scxlong>(usage.systemMilliseconds));
+                channel.Write(static_cast<scxlong>(usage.maxResidentKB));
+                channel.Write(static_cast<scxlong>(usage.blockReads));
+                channel.Write(static_cast<scxlong>(usage.blockWrites));
+            }
+        }
+        catch (SCXException&)
+        {
+            // Connection to the agent is broken
+            return 1;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+    */
+    ElevatedHelper::ElevatedHelper()
+        : m_lock(ThreadLockHandleGet()),
+          m_fd(-1),
+          m_pid(0),
+          m_busy(false),
+          m_stopPending(false),
+          m_lastFailedStart(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Runs a command through the elevated helper.
+
+       \param[in]   command         Command line (run without elevation by the helper)
+       \param[in]   input           Data written to the stdin of the command
+       \param[in]   timeout         Accepted number of seconds to wait (0 for no limit)
+       \param[in]   limit           Maximum number of bytes of stdout and of stderr to return
+       \param[out]  processOutput   Receives stdout
+       \param[out]  processError    Receives stderr
+       \param[out]  returncode      Return code from command
+       \param[out]  usage           If not NULL, receives the resources used by the command
+       \returns     false if the helper is not available (or not needed), and the command was not run
+       \throws      SCXInternalErrorException   If the helper couldn't run the command
+       \throws      SCXException                If the helper failed while the command ran
+    */
+    bool ElevatedHelper::Execute(const std::wstring& command, const std::string& input, unsigned timeout, size_t limit,
+                                 OutputCaptureBuffer& processOutput, OutputCaptureBuffer& processError, int& returncode,
+                                 ChildResourceUsage* usage)
+    {
+        // Already elevated; sudo isn't used either
+        if (IsElevated())
+        {
+            return false;
+        }
+
+        int fd;
+        {
+            SCXThreadLock lock(m_lock);
+            Reap();
+            if (m_busy || (m_fd < 0 && !Start()))
+            {
+                return false;
+            }
+            m_busy = true;
+            fd = m_fd;
+        }
+
+        ElevatedHelperChannel channel(fd);
+        bool sent = false;
+        scxlong status, code, outTotal, errTotal;
+        scxlong usageFields[6];
+        std::string out, err, errorText;
+        try
+        {
+            channel.Write(StrToUTF8(command));
+            channel.Write(input);
+            channel.Write(static_cast<scxlong>(timeout));
+            channel.Write(static_cast<scxlong>(limit));
+            sent = true;
+
+            if (!channel.Read(status) || !channel.Read(code)
+                || !channel.Read(out) || !channel.Read(outTotal)
+                || !channel.Read(err) || !channel.Read(errTotal)
+                || !channel.Read(errorText)
+                || !channel.Read(usageFields[0]) || !channel.Read(usageFields[1])
+                || !channel.Read(usageFields[2]) || !channel.Read(usageFields[3])
+                || !channel.Read(usageFields[4]) || !channel.Read(usageFields[5]))
+            {
+                throw SCXInternalErrorException(L"Elevated helper exited while running: " + command, SCXSRCLOCATION);
+            }
+        }
+        catch (SCXException&)
+        {
+            // The connection is broken; a new helper is started for the next command
+            SCXThreadLock lock(m_lock);
+            m_busy = false;
+            Close();
+            if (!sent)
+            {
+                // The helper never got the whole request, so the command didn't run
+                return false;
+            }
+            throw;
+        }
+
+        {
+            SCXThreadLock lock(m_lock);
+            m_busy = false;
+            if (m_stopPending)
+            {
+                Close();
+            }
+        }
+
+        if (NULL != usage)
+        {
+            usage->known = (0 != usageFields[0]);
+            usage->userMilliseconds = static_cast<scxulong>(usageFields[1]);
+            usage->systemMilliseconds = static_cast<scxulong>(usageFields[2]);
+            usage->maxResidentKB = static_cast<scxulong>(usageFields[3]);
+            usage->blockReads = static_cast<scxulong>(usageFields[4]);
+            usage->blockWrites = static_cast<scxulong>(usageFields[5]);
+        }
+
+        if (cStatusCompleted != status)
+        {
+            throw SCXInternalErrorException(StrFromUTF8(errorText), SCXSRCLOCATION);
+        }
+
+        processOutput.sputn(out.data(), static_cast<std::streamsize>(out.size()));
+        processOutput.AddDiscardedBytes(static_cast<scxulong>(outTotal) - out.size());
+        processError.sputn(err.data(), static_cast<std::streamsize>(err.size()));
+        processError.AddDiscardedBytes(static_cast<scxulong>(errTotal) - err.size());
+        returncode = static_cast<int>(code);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the helper (once the running command, if any, completes).
+    */
+    void ElevatedHelper::Stop()
+    {
+        SCXThreadLock lock(m_lock);
+        if (m_busy)
+        {
+            m_stopPending = true;
+            return;
+        }
+        Close();
+        m_lastFailedStart = 0;
+        Reap();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether the agent already runs as root.
+    */
+    bool ElevatedHelper::IsElevated() const
+    {
+        return 0 == geteuid();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the helper through sudo, with a socket as its stdin and stdout.
+
+       \param[out]  fd    Agent end of the socket
+       \param[out]  pid   Process started
+       \returns     false if the helper couldn't be started
+    */
+    bool ElevatedHelper::StartHelper(int& fd, pid_t& pid)
+    {
+        // Elevated the same way as other commands, so the existing sudoers rules apply
+        SCXSystemLib::SystemInfo si;
+        std::string elevated = StrToUTF8(si.GetElevatedCommand(cElevatedHelperPath));
+
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+        {
+            return false;
+        }
+        SetCloseOnExec(sv[0]);
+
+        pid = fork();
+        if (pid < 0)
+        {
+            close(sv[0]);
+            close(sv[1]);
+            return false;
+        }
+
+        if (0 == pid)
+        {
+            // Only async-signal-safe calls until exec
+            dup2(sv[1], 0);
+            dup2(sv[1], 1);
+            if (sv[1] > 1)
+            {
+                close(sv[1]);
+            }
+            execl("/bin/sh", "sh", "-c", elevated.c_str(), static_cast<char*>(NULL));
+            _exit(127);
+        }
+
+        close(sv[1]);
+        fd = sv[0];
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the helper and waits for it to identify itself.  Must be called
+       with the lock held.
+
+       \returns     true if the helper is running
+    */
+    bool ElevatedHelper::Start()
+    {
+        time_t now = time(NULL);
+        if (0 != m_lastFailedStart && now >= m_lastFailedStart && now - m_lastFailedStart < cRetryInterval)
+        {
+            return false;
+        }
+
+        int fd = -1;
+        pid_t pid = 0;
+        if (!StartHelper(fd, pid))
+        {
+            m_lastFailedStart = now;
+            return false;
+        }
+        m_fd = fd;
+        m_pid = pid;
+
+        try
+        {
+            // sudo refusing to run the helper (or asking for a password) shows up as a timeout
+            ElevatedHelperChannel channel(m_fd);
+            std::string hello;
+            if (channel.WaitReadable(cStartupTimeout) && channel.Read(hello) && hello == cElevatedHelperHello)
+            {
+                m_lastFailedStart = 0;
+                return true;
+            }
+        }
+        catch (SCXException&)
+        {
+        }
+
+        Close();
+        m_lastFailedStart = now;
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Closes the connection to the helper (which then exits).  Must be called
+       with the lock held.
+    */
+    void ElevatedHelper::Close()
+    {
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+        if (m_pid > 0)
+        {
+            m_exited.push_back(m_pid);
+            m_pid = 0;
+        }
+        m_stopPending = false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reaps closed helpers that have exited.  Must be called with the lock held.
+    */
+    void ElevatedHelper::Reap()
+    {
+        std::vector<pid_t>::iterator it = m_exited.begin();
+        while (it != m_exited.end())
+        {
+            int status;
+            pid_t result = waitpid(*it, &status, WNOHANG);
+            if (0 == result)
+            {
+                ++it;
+            }
+            else
+            {
+                it = m_exited.erase(it);
+            }
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,131 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        elevatedhelper.h
+
+    \brief       Long-lived elevated helper for sudo elevated RunAs commands
+
+    Starting every elevated command through sudo costs a sudo startup (PAM,
+    sudoers parsing, logging) per command.  When enabled in scxrunas.conf
+    (ElevatedHelper=true), the agent starts scxelevatedhelper through sudo
+    once, and passes elevated commands to it over a private socket pair.
+    The helper runs them with the working directory and chroot path from its
+    own (root owned) copy of the configuration.
+
+    \date        2026-10-19 15:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef ELEVATEDHELPER_H
+#define ELEVATEDHELPER_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxfilepath.h>
+#include <scxcorelib/scxthreadlock.h>
+
+#include "scxrunasconfigurator.h"
+
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+namespace SCXCore
+{
+    class OutputCaptureBuffer;
+    struct ChildResourceUsage;
+
+    //! Installed location of the helper program
+    const wchar_t* const cElevatedHelperPath = L"/opt/microsoft/scx/bin/scxelevatedhelper";
+
+    //! First field sent by the helper, identifying the protocol version
+    const char* const cElevatedHelperHello = "SCXELEVATEDHELPER3";
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Length prefixed fields over a socket.
+
+       Each field is a 4 byte (big endian) length followed by the data.
+       Numbers are sent as 8 byte (big endian) fields.
+    */
+    class ElevatedHelperChannel
+    {
+    public:
+        //! Largest field accepted
+        static const size_t cMaxFieldSize = 16*1024*1024;
+
+        ElevatedHelperChannel(int fd) : m_fd(fd) { }
+
+        void Write(const std::string& data);
+        void Write(scxlong value);
+
+        bool Read(std::string& data);
+        bool Read(scxlong& value);
+
+        bool WaitReadable(int milliseconds);
+
+    private:
+        void Send(const char* data, size_t size);
+        bool Receive(char* data, size_t size, bool eofAllowed);
+
+        int m_fd;       //!< Socket (not owned)
+    };
+
+    int RunElevatedHelper(int fd, const SCXCoreLib::SCXFilePath& cwd, const SCXCoreLib::SCXFilePath& chroot,
+                          const RunAsResourceLimits& limits = RunAsResourceLimits());
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Agent side of the elevated helper.
+
+       One command runs at a time; Execute() returns false when the helper is
+       busy or can't be started, and the caller then runs the command through
+       sudo as usual.  It also returns false when the agent already runs as
+       root (then sudo isn't used either).
+    */
+    class ElevatedHelper
+    {
+    public:
+        //! Seconds before starting a helper is retried after a failed start
+        static const time_t cRetryInterval = 300;
+
+        //! Milliseconds to wait for a starting helper to identify itself
+        static const int cStartupTimeout = 10000;
+
+        ElevatedHelper();
+        virtual ~ElevatedHelper() { };
+
+        bool Execute(const std::wstring& command, const std::string& input, unsigned timeout, size_t limit,
+                     OutputCaptureBuffer& processOutput, OutputCaptureBuffer& processError, int& returncode,
+                     ChildResourceUsage* usage = NULL);
+        void Stop();
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ElevatedHelper";
+        }
+
+    protected:
+        virtual bool IsElevated() const;
+        virtual bool StartHelper(int& fd, pid_t& pid);
+
+    private:
+        bool Start();
+        void Close();
+        void Reap();
+
+        SCXCoreLib::SCXThreadLockHandle m_lock;     //!< Protects the members below
+        int m_fd;                                   //!< Socket to the helper, -1 if not running
+        pid_t m_pid;                                //!< Process started for the helper (0 if none)
+        std::vector<pid_t> m_exited;                //!< Closed helpers not yet reaped
+        bool m_busy;                                //!< A command is running
+        bool m_stopPending;                         //!< Stop() was called while a command was running
+        time_t m_lastFailedStart;                   //!< When starting the helper last failed
+    };
+
+    extern ElevatedHelper g_ElevatedHelper;
+}
+
+#endif /* ELEVATEDHELPER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
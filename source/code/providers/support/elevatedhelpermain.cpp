@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+
+*/
+/**
+    \file      elevatedhelpermain.cpp
+
+    \brief     Main routine for the scxelevatedhelper program.
+
+    The agent starts this program through sudo, with a socket as stdin and
+    stdout, and passes it the commands to run elevated (see elevatedhelper.h).
+
+    \date      2026-10-19 15:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+
+#include "elevatedhelper.h"
+#include "scxrunasconfigurator.h"
+
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+using namespace SCXCore;
+using namespace SCXCoreLib;
+using namespace std;
+
+/*----------------------------------------------------------------------------*/
+/**
+   scxelevatedhelper (main) function.
+
+   \param argc size of \a argv[]
+   \param argv array of string pointers from the command line.
+   \returns 0 when the agent closed the connection, otherwise, 1 on error.
+*/
+
+int main(int argc, char * const argv[])
+{
+    if (1 != argc || isatty(0))
+    {
+        cerr << argv[0] << ": For internal use by the agent only" << endl;
+        return 1;
+    }
+
+    // Move the socket off stdin/stdout, so commands can't read or write it
+    int fd = dup(0);
+    int devnull = open("/dev/null", O_RDWR);
+    if (fd < 0 || devnull < 0 || dup2(devnull, 0) < 0 || dup2(devnull, 1) < 0)
+    {
+        return 1;
+    }
+    if (devnull > 2)
+    {
+        close(devnull);
+    }
+    fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC);
+
+    // Working directory, chroot path and resource limits come from our (root
+    // owned) copy of the configuration, not from the agent
+    RunAsConfigurator configurator;
+    try
+    {
+        configurator.Parse();
+    }
+    catch (SCXException& e)
+    {
+        wcerr << argv[0] << L": " << e.What() << endl;
+        return 1;
+    }
+
+    return RunElevatedHelper(fd, configurator.GetCWD(), configurator.GetChRootPath(),
+                             configurator.GetResourceLimits());
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,176 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        indicationsubscriptions.cpp
+
+    \brief       Subscriptions of the indication providers
+
+    \date        2026-10-21 10:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxtime.h>
+#include <scxcorelib/stringaid.h>
+
+#include "indicationsubscriptions.h"
+#include "scxcimutils.h"
+
+#include <strings.h>
+
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   className   Indication class, for logs and the name of the lock
+    */
+    IndicationSubscriptions::IndicationSubscriptions(const std::wstring& className)
+        : m_className(className),
+          m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.indications")),
+          m_lock(ThreadLockHandleGet(L"SCXCore::" + className + L"::Subscriptions")),
+          m_sequenceNumber(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the source of the events, on EnableIndications.  The
+       indications context stays open until DisableIndications.
+
+       \param[in]   source   Source of the events
+       \returns     true if started
+    */
+    bool IndicationSubscriptions::Enable(IndicationSource& source)
+    {
+        if (!source.Start())
+        {
+            SCX_LOGWARNING(m_log, m_className + L"_Class_Provider::EnableIndications unable to start the source of the indications");
+            return false;
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the source of the events, on DisableIndications.
+
+       \param[in]   source   Source of the events
+    */
+    void IndicationSubscriptions::Disable(IndicationSource& source)
+    {
+        source.Stop();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets the query of the filter of a subscription, which must be WQL.
+
+       \param[in]   filter       Filter passed to Subscribe
+       \param[out]  expression   Query
+       \returns     MI_RESULT_OK, or the result to post if there is no WQL query
+    */
+    MI_Result IndicationSubscriptions::GetFilterExpression(const MI_Filter* filter, std::wstring& expression)
+    {
+        const MI_Char* language = NULL;
+        const MI_Char* query = NULL;
+        if (NULL == filter || MI_RESULT_OK != MI_Filter_GetExpression(filter, &language, &query)
+            || NULL == language || NULL == query)
+        {
+            SCX_LOGWARNING(m_log, m_className + L"_Class_Provider::Subscribe requires a filter");
+            return MI_RESULT_INVALID_QUERY;
+        }
+        if (0 != strcasecmp(language, "WQL"))
+        {
+            SCX_LOGWARNING(m_log, m_className + L"_Class_Provider::Subscribe unsupported query language: "
+                           + StrFromUTF8(language));
+            return MI_RESULT_QUERY_LANGUAGE_NOT_SUPPORTED;
+        }
+
+        expression = StrFromUTF8(query);
+        return MI_RESULT_OK;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds the context of a subscription.  Add it before subscribing to
+       the source, so no event of the subscription is missed.
+
+       \param[in]   subscriptionID   Subscription
+       \param[in]   context          Subscription context, open until Unsubscribe
+    */
+    void IndicationSubscriptions::Add(scxulong subscriptionID, MI_Context* context)
+    {
+        SCXThreadLock lock(m_lock);
+        m_contexts[subscriptionID] = context;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Drops the context of a subscription the source refused, without
+       posting on it (the caller posts the error).
+
+       \param[in]   subscriptionID   Subscription
+    */
+    void IndicationSubscriptions::Remove(scxulong subscriptionID)
+    {
+        SCXThreadLock lock(m_lock);
+        m_contexts.erase(subscriptionID);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Ends a subscription: unsubscribes from the source, and closes the
+       subscription context.
+
+       \param[in]   source           Source of the events
+       \param[in]   subscriptionID   Subscription
+    */
+    void IndicationSubscriptions::Unsubscribe(IndicationSource& source, scxulong subscriptionID)
+    {
+        source.Unsubscribe(subscriptionID);
+
+        SCXThreadLock lock(m_lock);
+        std::map<scxulong, MI_Context*>::iterator it = m_contexts.find(subscriptionID);
+        if (m_contexts.end() != it)
+        {
+            MI_Context_PostResult(it->second, MI_RESULT_OK);
+            m_contexts.erase(it);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Posts an indication on the context of a subscription.  Events of a
+       subscription that was removed meanwhile are dropped.
+
+       \param[in]   subscriptionID   Subscription
+       \param[in]   builder          Sets the properties of the event, and posts the indication
+    */
+    void IndicationSubscriptions::Post(scxulong subscriptionID, IndicationBuilder& builder)
+    {
+        // Kept locked while posting, so Unsubscribe can't close the context meanwhile
+        SCXThreadLock lock(m_lock);
+        std::map<scxulong, MI_Context*>::iterator it = m_contexts.find(subscriptionID);
+        if (m_contexts.end() == it)
+        {
+            return;
+        }
+
+        SCXCalendarTime now(SCXCalendarTime::CurrentLocal());
+        MI_Datetime indicationTime;
+        CIMUtils::ConvertToCIMDatetime(indicationTime, now);
+
+        MI_Result r = builder.Post(it->second, indicationTime, static_cast<MI_Sint64>(++m_sequenceNumber));
+        if (MI_RESULT_OK != r)
+        {
+            SCX_LOGWARNING(m_log, StrAppend(m_className + L" unable to post indication, error = ", r));
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
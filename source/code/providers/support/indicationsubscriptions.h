@@ -0,0 +1,93 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        indicationsubscriptions.h
+
+    \brief       Subscriptions of the indication providers
+
+    The indication providers (SCX_LogFileMatchIndication and
+    SCX_StatisticalThresholdIndication) differ only in the source of their
+    events and in the properties of their indications.  The subscription
+    contexts, the sequence numbers, the WQL filter checks and the starting
+    and stopping of the source are kept here.
+
+    \date        2026-10-21 10:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef INDICATIONSUBSCRIPTIONS_H
+#define INDICATIONSUBSCRIPTIONS_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxthreadlock.h>
+
+#include <MI.h>
+
+#include <map>
+#include <string>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Source of the events of an indication class.  Started on
+       EnableIndications and stopped on DisableIndications; subscriptions
+       are kept while it is stopped.
+    */
+    class IndicationSource
+    {
+    public:
+        virtual ~IndicationSource() { }
+        virtual bool Start() = 0;
+        virtual void Stop() = 0;
+        virtual bool Unsubscribe(scxulong subscriptionID) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sets the properties of one event on an indication, and posts it.
+    */
+    class IndicationBuilder
+    {
+    public:
+        virtual ~IndicationBuilder() { }
+        virtual MI_Result Post(MI_Context* context, const MI_Datetime& indicationTime, MI_Sint64 sequenceNumber) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Subscription contexts of an indication class, by subscription ID.  A
+       subscription context stays open, with the indications of the
+       subscription posted on it, until Unsubscribe.
+    */
+    class IndicationSubscriptions
+    {
+    public:
+        IndicationSubscriptions(const std::wstring& className);
+
+        bool Enable(IndicationSource& source);
+        void Disable(IndicationSource& source);
+
+        MI_Result GetFilterExpression(const MI_Filter* filter, std::wstring& expression);
+        void Add(scxulong subscriptionID, MI_Context* context);
+        void Remove(scxulong subscriptionID);
+        void Unsubscribe(IndicationSource& source, scxulong subscriptionID);
+
+        void Post(scxulong subscriptionID, IndicationBuilder& builder);
+
+        SCXCoreLib::SCXLogHandle& GetLogHandle() { return m_log; }
+
+    private:
+        std::wstring m_className;                       //!< Indication class
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        SCXCoreLib::SCXThreadLockHandle m_lock;         //!< Protects the members below
+        std::map<scxulong, MI_Context*> m_contexts;     //!< Subscription contexts, by subscription ID
+        scxulong m_sequenceNumber;                      //!< Sequence number of the last indication
+    };
+}
+
+#endif /* INDICATIONSUBSCRIPTIONS_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -24,6 +24,7 @@
 
 #include "logfileprovider.h"
 #include "logfileutils.h"
+#include "providerconfig.h"
 #include "startuplog.h"
 
 using namespace SCXCoreLib;
@@ -39,13 +40,15 @@ namespace SCXCore {
        Default constructor
     */
     LogFileProvider::LogFileProvider() :
-        m_pLogFileReader(NULL)
+        m_pLogFileReader(NULL),
+        m_scanTimeBudget(cDefaultLogScanTimeBudgetMs)
     {
         // Assuming we have one global object - initialized at load time
     }
 
     LogFileProvider::LogFileProvider(SCXCoreLib::SCXHandle<LogFileReader> pLogFileReader)
-        : m_pLogFileReader(pLogFileReader)
+        : m_pLogFileReader(pLogFileReader),
+          m_scanTimeBudget(cDefaultLogScanTimeBudgetMs)
     {
         // Assuming we have one global object - initialized at load time
     }
@@ -74,6 +77,10 @@ namespace SCXCore {
             {
                 m_pLogFileReader = new LogFileReader();
             }
+
+            m_scanTimeBudget = GetConfigUInt(L"LogFileProvider_ScanTimeBudgetMs", cDefaultLogScanTimeBudgetMs);
+
+            SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider parameters: Scan Time Budget (ms) = ", m_scanTimeBudget));
         }
     }
 
@@ -112,6 +119,7 @@ namespace SCXCore {
         \param[in]     regexps           List of regular expressions to look for
         \param[in]     performElevation  Perform elevation when running the command
         \param[out]    matchedLines      Resulting matched lines, if any, from log file
+        \param[in]     scanTimeBudget    Time allowed for the read, in milliseconds (0 means no limit)
 
         \returns       Boolean flag to indicate if partial matches were returned
     */
@@ -120,7 +128,8 @@ namespace SCXCore {
         const std::wstring& qid,
         const std::vector<SCXRegexWithIndex>& regexps,
         bool fPerformElevation,
-        std::vector<std::wstring>& matchedLines)
+        std::vector<std::wstring>& matchedLines,
+        unsigned int scanTimeBudget)
     {
         SCX_LOGTRACE(m_log, L"SCXLogFileProvider InvokeLogFileReader");
 
@@ -133,7 +142,6 @@ namespace SCXCore {
 
         std::stringstream processInput;
         std::stringstream processOutput;
-        std::stringstream processError;
 
         SCX_LOGTRACE(m_log, L"SCXLogFileProvider InvokeLogFileReader - Marshaling");
 
@@ -143,6 +151,100 @@ namespace SCXCore {
         send.Write(regexps);
         send.Flush();
 
+        if ( ! RunLogFileReader(L"-p", scanTimeBudget, fPerformElevation, processInput, processOutput) )
+        {
+            // Log file didn't exist - scxlogfilereader logged message about it
+            // Nothing to unmarshal at this point ...
+            return false;
+        }
+
+        // Unmarshall matchedLines and partialRead flag
+        //
+        // Note that we can't marshal/unmarshal a bool, so we treat as int
+
+        int wasPartialRead;
+
+        SCX_LOGTRACE(m_log, L"SCXLogFileProvider InvokeLogFileReader - UnMarshaling");
+
+        UnMarshal receive(processOutput);
+        receive.Read(wasPartialRead);
+        receive.Read(matchedLines);
+
+        SCX_LOGTRACE(m_log, StrAppend(L"SCXLogFileProvider InvokeLogFileReader - Returning: ", (0 != wasPartialRead)));
+
+        return (0 != wasPartialRead);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Invoke the logfileread CLI (command line) program, with elevation if needed,
+        to read a log file for several QIDs at once.
+
+        \param[in]     filename          Filename to scan for matches
+        \param[in,out] queries           QIDs and regular expressions; gets the matched lines
+        \param[in]     performElevation  Perform elevation when running the command
+        \param[in]     scanTimeBudget    Time allowed for the read, in milliseconds (0 means no limit)
+
+        \returns       false if the log file doesn't exist
+    */
+    bool LogFileProvider::InvokeLogFileReader(
+        const std::wstring& filename,
+        std::vector<LogFileQuery>& queries,
+        bool fPerformElevation,
+        unsigned int scanTimeBudget)
+    {
+        SCX_LOGTRACE(m_log, StrAppend(L"SCXLogFileProvider InvokeLogFileReader - Queries: ", queries.size()));
+
+        std::stringstream processInput;
+        std::stringstream processOutput;
+
+        Marshal send(processInput);
+        send.Write(filename);
+        send.Write(static_cast<int>(queries.size()));
+        for (size_t i = 0; i < queries.size(); i++)
+        {
+            send.Write(queries[i].qid);
+            send.Write(queries[i].regexps);
+        }
+        send.Flush();
+
+        if ( ! RunLogFileReader(L"-b", scanTimeBudget, fPerformElevation, processInput, processOutput) )
+        {
+            return false;
+        }
+
+        // Note that we can't marshal/unmarshal a bool, so we treat as int
+        UnMarshal receive(processOutput);
+        for (size_t i = 0; i < queries.size(); i++)
+        {
+            int wasPartialRead;
+            receive.Read(wasPartialRead);
+            receive.Read(queries[i].matchedLines);
+            queries[i].partialRead = (0 != wasPartialRead);
+        }
+
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Run the logfilereader CLI (command line) program, with elevation if needed
+
+        \param[in]     option            Command line option selecting the operation
+        \param[in]     scanTimeBudget    Time allowed for the read, in milliseconds (0 means no limit)
+        \param[in]     performElevation  Perform elevation when running the command
+        \param[in]     processInput      Marshaled input for the program
+        \param[out]    processOutput     Marshaled output of the program
+
+        \returns       false if the log file doesn't exist (nothing to unmarshal)
+    */
+    bool LogFileProvider::RunLogFileReader(
+        const std::wstring& option,
+        unsigned int scanTimeBudget,
+        bool fPerformElevation,
+        std::stringstream& processInput,
+        std::stringstream& processOutput)
+    {
         // Test to see if we're running under testrunner.  This makes it easy
         // to know where to launch our test program, allowing unit tests to
         // test all the way through to the CLI.
@@ -151,13 +253,19 @@ namespace SCXCore {
         char *testrunFlag = getenv("SCX_TESTRUN_ACTIVE");
         if (NULL != testrunFlag)
         {
-            programName = L"testfiles/scxlogfilereader-test -t -p";
+            programName = L"testfiles/scxlogfilereader-test -t ";
         }
         else
         {
-            programName = L"/opt/microsoft/scx/bin/scxlogfilereader -p";
+            programName = L"/opt/microsoft/scx/bin/scxlogfilereader ";
         }
 
+        if (0 != scanTimeBudget)
+        {
+            programName = StrAppend(programName + L"-d ", scanTimeBudget) + L" ";
+        }
+        programName += option;
+
         // Elevate the command if that's called for
         SCXSystemLib::SystemInfo si;
 
@@ -169,9 +277,11 @@ namespace SCXCore {
         // Call the log file reader (CLI) program
 
         SCX_LOGTRACE(m_log,
-                     StrAppend(L"SCXLogFileProvider InvokeLogFileReader - Running ",
+                     StrAppend(L"SCXLogFileProvider RunLogFileReader - Running ",
                                programName));
 
+        std::stringstream processError;
+
         try
         {
             int returnCode = SCXProcess::Run(
@@ -179,7 +289,7 @@ namespace SCXCore {
                 processInput, processOutput, processError);
 
             SCX_LOGTRACE(m_log,
-                         StrAppend(L"SCXLogFileProvider InvokeLogFileReader - Result ", returnCode));
+                         StrAppend(L"SCXLogFileProvider RunLogFileReader - Result ", returnCode));
 
             switch (returnCode)
             {
@@ -202,25 +312,11 @@ namespace SCXCore {
         }
         catch (SCXCoreLib::SCXException& e)
         {
-            SCX_LOGWARNING(m_log, StrAppend(L"LogFileProvider InvokeLogFileReader - Exception: ", e.What()));
+            SCX_LOGWARNING(m_log, StrAppend(L"LogFileProvider RunLogFileReader - Exception: ", e.What()));
             throw;
         }
 
-        // Unmarshall matchedLines and partialRead flag
-        //
-        // Note that we can't marshal/unmarshal a bool, so we treat as int
-
-        int wasPartialRead;
-
-        SCX_LOGTRACE(m_log, L"SCXLogFileProvider InvokeLogFileReader - UnMarshaling");
-
-        UnMarshal receive(processOutput);
-        receive.Read(wasPartialRead);
-        receive.Read(matchedLines);
-
-        SCX_LOGTRACE(m_log, StrAppend(L"SCXLogFileProvider InvokeLogFileReader - Returning: ", (0 != wasPartialRead)));
-
-        return (0 != wasPartialRead);
+        return true;
     }
 
     /*----------------------------------------------------------------------------*/
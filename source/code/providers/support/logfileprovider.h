@@ -16,8 +16,13 @@
 
 #include "logfileutils.h"
 
+#include <sstream>
+
 namespace SCXCore
 {
+    //! Default time allowed for reading a log file in one call, in milliseconds
+    const unsigned int cDefaultLogScanTimeBudgetMs = 20000;
+
     /*----------------------------------------------------------------------------*/
     /**
        LogFile provider
@@ -34,12 +39,19 @@ namespace SCXCore
         void Unload();
 
         SCXCoreLib::SCXLogHandle& GetLogHandle();
+        unsigned int GetScanTimeBudget() const { return m_scanTimeBudget; }
 
         bool InvokeLogFileReader(const std::wstring& filename,
                                  const std::wstring& qid,
                                  const std::vector<SCXCoreLib::SCXRegexWithIndex>& regexps,
                                  bool fPerformElevation,
-                                 std::vector<std::wstring>& matchedLines);
+                                 std::vector<std::wstring>& matchedLines,
+                                 unsigned int scanTimeBudget);
+
+        bool InvokeLogFileReader(const std::wstring& filename,
+                                 std::vector<LogFileQuery>& queries,
+                                 bool fPerformElevation,
+                                 unsigned int scanTimeBudget);
 
         int InvokeResetStateFile(const std::wstring& filename,
                                  const std::wstring& qid,
@@ -47,8 +59,15 @@ namespace SCXCore
                                  bool fPerformElevation);
 
     private:
+        bool RunLogFileReader(const std::wstring& option,
+                              unsigned int scanTimeBudget,
+                              bool fPerformElevation,
+                              std::stringstream& processInput,
+                              std::stringstream& processOutput);
+
         SCXCoreLib::SCXHandle<LogFileReader> m_pLogFileReader;
         SCXCoreLib::SCXLogHandle m_log;
+        unsigned int m_scanTimeBudget;      //!< Time allowed for reading a log file, in milliseconds (0 means no limit)
         static int ms_loadCount;
     };
 
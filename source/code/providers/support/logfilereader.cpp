@@ -51,6 +51,8 @@ static void show_version();
 static void PerformMarshalTest();
 static int ReadLogFile_Interactive();
 static int ReadLogFile_Provider();
+static int ReadLogFiles_Provider();
+static SCXHandle<LogFileReader> CreateLogFileReader();
 static int ResetLogFileState();
 static int ResetAllLogFileStates(bool fResetOnRead);
 static void ReadLogFile_TestSetup();
@@ -61,6 +63,7 @@ wstring s_basePath;
 
 const int EXIT_LOGIC_ERROR = 64; /* Random exit code that is not ENOENT */
 static bool s_fTestMode = false;
+static unsigned int s_scanTimeBudget = 0;
 
 // For the getopt() function:
 extern char *optarg;
@@ -106,6 +109,7 @@ int main(int argc, char * const argv[])
         Reset_All_Files,
         Read_Log_File_Interactive,
         Read_Log_File,
+        Read_Log_File_Batch,
         Show_Version
     } operation = UNSET;
 
@@ -116,10 +120,30 @@ int main(int argc, char * const argv[])
     // ourselves via the opterr variable.
 
     opterr = 0;                 // Disable printing errors for bad options
-    while ((c = getopt(argc, argv, "hi?g:mprtv")) != -1) {
+    while ((c = getopt(argc, argv, "bd:hi?g:mprtv")) != -1) {
         const char * parameter = NULL;
 
         switch(c) {
+            case 'b':                   /* Provider entry (read log file for several QIDs) */
+                if (UNSET != operation)
+                {
+                    cerr << argv[0] << ": Parsing error - operation already specified (" << operation << ")" << endl;
+                    usage(argv[0], true, EXIT_LOGIC_ERROR);
+                }
+                operation = Read_Log_File_Batch;
+                break;
+            case 'd':                   /* Time allowed for a read, in milliseconds */
+                parameter = optarg;
+                try
+                {
+                    s_scanTimeBudget = StrToUInt(StrFromUTF8(parameter));
+                }
+                catch (SCXException& e)
+                {
+                    cerr << argv[0] << ": Parsing error - Invalid argument for -d (" << parameter << ")" << endl;
+                    usage(argv[0], true, EXIT_LOGIC_ERROR);
+                }
+                break;
             case 'h':                   /* Show extended help information */
                 usage(argv[0], false, 0);
                 /*NOTREACHED*/
@@ -237,6 +261,10 @@ int main(int argc, char * const argv[])
             exitStatus = ReadLogFile_Provider();
             break;
 
+        case Read_Log_File_Batch:
+            exitStatus = ReadLogFiles_Provider();
+            break;
+
         case Show_Version:
             show_version();
             break;
@@ -272,6 +300,8 @@ static void usage(char const * const name, bool fBrief, int exitValue)
         wcout << L"Usage: " << name << endl
               << endl
               << L"Options:" << endl
+              << L"  -b:\tProvider interface for several QIDs (for internal use only)" << endl
+              << L"  -d:\tTime allowed for a read, in milliseconds (with -b or -p)" << endl
               << L"  -h:\tDisplay detailed help information" << endl
               << L"  -g:\tReset all log file states (for internal use only)" << endl
               << L"     \t(Requires parameter for ResetOnRead: 1/true/0/false)" << endl
@@ -452,6 +482,26 @@ int ReadLogFile_Interactive()
     return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+   Create a log file reader for the provider interface, set up for the
+   command line options.
+
+   \return Log file reader
+*/
+SCXHandle<LogFileReader> CreateLogFileReader()
+{
+    SCXHandle<LogFileReader> logFileReader(new LogFileReader());
+    if (s_fTestMode)
+    {
+        ReadLogFile_TestSetup();
+        logFileReader->SetPersistMedia(s_pmedia);
+    }
+    logFileReader->SetScanTimeBudget(s_scanTimeBudget);
+
+    return logFileReader;
+}
+
 /*----------------------------------------------------------------------------*/
 /**
    Implementation for provider interface to read log files.
@@ -474,12 +524,7 @@ int ReadLogFile_Interactive()
 */
 int ReadLogFile_Provider()
 {
-    SCXHandle<LogFileReader> logFileReader(new LogFileReader());
-    if (s_fTestMode)
-    {
-        ReadLogFile_TestSetup();
-        logFileReader->SetPersistMedia(s_pmedia);
-    }
+    SCXHandle<LogFileReader> logFileReader = CreateLogFileReader();
 
     SCXLogHandle logH = SCXLogHandleFactory::GetLogHandle(L"scx.logfilereader.ReadLogFile");
 
@@ -525,6 +570,82 @@ int ReadLogFile_Provider()
     return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+   Implementation for provider interface to read a log file for several QIDs.
+
+   QIDs that continue from the same position share a single read of the file.
+
+   Parameters come in from STDIN (marshalled by the log file provider), and the
+   results are returned (via STDOUT, marshalled).
+
+   Input parameters are (as required by LogFileReader::ReadLogFile):
+     filename:       Filename to be read
+     count:          Number of QIDs
+   Followed by, for each QID:
+     qid:            ID (from property)
+     regexps:        Regular expressions to search for
+
+   Output parameters are, for each QID:
+     wasPartialRead: This is incomplete (more data exists to return)
+     matchedLines:   Resulting lines that match the regular expressions
+
+   \return Resulting status (exit status for scxlogfilereader executable)
+*/
+int ReadLogFiles_Provider()
+{
+    SCXHandle<LogFileReader> logFileReader = CreateLogFileReader();
+
+    SCXLogHandle logH = SCXLogHandleFactory::GetLogHandle(L"scx.logfilereader.ReadLogFile");
+
+    // Unmarshal the parameters from the caller (passed via standard input)
+
+    wstring filename;
+    int count;
+
+    UnMarshal receive(cin);
+    receive.Read(filename);
+    receive.Read(count);
+
+    vector<LogFileQuery> queries(count > 0 ? count : 0);
+    for (size_t i = 0; i < queries.size(); i++)
+    {
+        receive.Read(queries[i].qid);
+        receive.Read(queries[i].regexps);
+    }
+
+    try
+    {
+        logFileReader->ReadLogFile(filename, queries);
+
+        // Marshal the results
+
+        Marshal send(cout);
+        for (size_t i = 0; i < queries.size(); i++)
+        {
+            int wasPartialRead = queries[i].partialRead;
+            send.Write(wasPartialRead);
+            send.Write(queries[i].matchedLines);
+        }
+        send.Flush();
+    }
+    catch (SCXFilePathNotFoundException& e)
+    {
+        SCX_LOGWARNING(logH, StrAppend(L"scxlogfilereader - File not found: ", filename).append(L", exception: ").append(e.What()));
+
+        // Return a special exit code so we know that the log file wasn't found
+        return ENOENT;
+    }
+    catch (SCXException &e)
+    {
+        SCX_LOGWARNING(logH, StrAppend(L"scxlogfilereader - Unexpected exception: ", e.What()));
+
+        return EINTR;
+    }
+
+    return 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /**
    Implementation for provider interface to reset the state of a log file.
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <iostream>
 #include <locale>
+#include <wctype.h>
 
 #include <scxcorelib/scxexception.h>
 #include <scxcorelib/scxdirectoryinfo.h>
@@ -29,6 +30,7 @@
 #include <scxcorelib/scxfile.h>
 
 #include "logfileutils.h"
+#include "sysutils.h"
 
 using namespace SCXCoreLib;
 using namespace std;
@@ -38,7 +40,37 @@ namespace SCXCore {
     const std::wstring LogFileReader::s_pattern = L"SELECT * FROM SCX_LogFileRecord WHERE FileName=%PATH";
     const std::wstring LogFileReader::s_patternParameter = L"PATH";
     const unsigned int cMaxMatchedRows = 500;   //!< max number of matched log rows return limit, 1000 rows from scx log file does not work, 750 does
-    const size_t cMaxTotalBytes = 60 * 1024;    //!< max number of bytes to return in a single instance
+    const size_t cMaxTotalBytes = 60 * 1024;    //!< max number of bytes to return in a single instance (all QIDs of a call together)
+    const unsigned int cDeadlineCheckRows = 64; //!< number of rows read between checks of the scan deadline
+
+    /**
+        Progress of one query within a read shared by several QIDs.
+    */
+    struct SharedReadQuery
+    {
+        size_t query;                       //!< Index into the queries
+        std::vector<std::wstring> literals; //!< Literals required by each regular expression
+        bool active;                        //!< Still reading (limits not reached)
+        std::streamoff stop;                //!< Position to continue from next time
+    };
+
+    /**
+        Rows returned by one read of a log file, for all of its QIDs together:
+        they are all returned in a single instance, so they share its limits.
+    */
+    struct MatchedTotals
+    {
+        unsigned int matchedRows;           //!< Rows matched so far
+        size_t totalBytes;                  //!< Bytes returned so far
+
+        MatchedTotals() : matchedRows(0), totalBytes(0) { }
+
+        //! Returns true if no more rows fit in the instance
+        bool IsFull() const
+        {
+            return (matchedRows >= cMaxMatchedRows || totalBytes >= cMaxTotalBytes);
+        }
+    };
 
     /*----------------------------------------------------------------------------*/
     /* LogFileReader::LogFilePositionRecord                                     */
@@ -63,7 +95,8 @@ namespace SCXCore {
           m_ResetOnRead(false),
           m_Pos(0),
           m_StIno(0),
-          m_StSize(0)
+          m_StSize(0),
+          m_Fingerprint(L"")
     {
         SCXUser user;
         m_IdString = L"LogFileProvider_" + user.GetName() + logfile.Get() + qid;
@@ -159,6 +192,26 @@ namespace SCXCore {
         m_StSize = st_size;
     }
 
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the fingerprint of the bytes before the current position.
+        \returns Fingerprint (empty if unknown).
+    */
+    const std::wstring& LogFileReader::LogFilePositionRecord::GetFingerprint() const
+    {
+        return m_Fingerprint;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Set the fingerprint of the bytes before the current position.
+        \param[in] fingerprint Fingerprint (empty if unknown).
+    */
+    void LogFileReader::LogFilePositionRecord::SetFingerprint(const std::wstring& fingerprint)
+    {
+        m_Fingerprint = fingerprint;
+    }
+
     /*----------------------------------------------------------------------------*/
     /**
         Persist data
@@ -169,7 +222,7 @@ namespace SCXCore {
         {
             m_StSize = static_cast<scxulong>(m_Pos);
         }
-        SCXHandle<SCXPersistDataWriter> pwriter = m_PersistMedia->CreateWriter(m_IdString, 1);
+        SCXHandle<SCXPersistDataWriter> pwriter = m_PersistMedia->CreateWriter(m_IdString, 2);
         pwriter->WriteValue(L"Filename", SCXCoreLib::StrFrom(m_LogFile.Get()));
         pwriter->WriteValue(L"QID", SCXCoreLib::StrFrom(m_Qid));
         pwriter->WriteValue(L"Reset", SCXCoreLib::StrFrom(m_ResetOnRead));
@@ -178,6 +231,7 @@ namespace SCXCore {
         pwriter->WriteValue(L"StIno", SCXCoreLib::StrFrom(m_StIno));
         pwriter->WriteValue(L"StSize", SCXCoreLib::StrFrom(m_StSize));
         pwriter->WriteEndGroup();
+        pwriter->WriteValue(L"Fingerprint", m_Fingerprint);
         pwriter->DoneWriting();
     }
 
@@ -192,13 +246,14 @@ namespace SCXCore {
         {
             SCXHandle<SCXPersistDataReader> preader = m_PersistMedia->CreateReader(m_IdString);
             int version = preader->GetVersion();
-            if (0 != version && 1 != version)
+            if (0 != version && 1 != version && 2 != version)
             {
                 // Wrong version. Just ignore. It will be re-persisted later.
                 return false;
             }
 
             // Version 0 does not include Filename, QID, or Reset; Version 1 does
+            // Version 2 adds Fingerprint
             // By being version-aware, we always recover properly
 
             if (version >= 1)
@@ -214,6 +269,12 @@ namespace SCXCore {
             m_StIno = SCXCoreLib::StrToULong(preader->ConsumeValue(L"StIno"));
             m_StSize = SCXCoreLib::StrToULong(preader->ConsumeValue(L"StSize"));
             preader->ConsumeEndGroup();
+
+            m_Fingerprint = L"";
+            if (version >= 2)
+            {
+                m_Fingerprint = preader->ConsumeValue(L"Fingerprint");
+            }
             return true;
         }
         catch (SCXNotSupportedException&)
@@ -271,7 +332,13 @@ namespace SCXCore {
         SCXCoreLib::SCXHandle<SCXCoreLib::SCXPersistMedia> persistMedia /* =  SCXCoreLib::GetPersistMedia()*/)
         : m_Record(0),
           m_Stream(0),
-          m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider.logfilestreampositioner"))
+          m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider.logfilestreampositioner")),
+          m_Wrapped(false),
+          m_PrevStIno(0),
+          m_PrevStSize(0),
+          m_PrevPos(0),
+          m_PredecessorChecked(false),
+          m_Predecessor(0)
     {
         m_Record = new LogFilePositionRecord(logfile, qid, persistMedia);
         m_Stream = SCXFile::OpenWFstream(logfile, std::ios_base::in);
@@ -325,8 +392,14 @@ namespace SCXCore {
             else
             {
                 // File has wrapped so we find new last position.
+                // Lines not read before it wrapped may still be in its rotated predecessor.
                 SCX_LOGTRACE(m_log, L"LogFileProvider OpenLogFile " + m_Record->GetLogFile().Get() + L" - File has wrapped");
                 SCXFile::SeekG(*m_Stream, 0);
+                m_Wrapped = true;
+                m_PrevStIno = m_Record->GetStatStIno();
+                m_PrevStSize = m_Record->GetStatStSize();
+                m_PrevPos = m_Record->GetPos();
+                m_PrevFingerprint = m_Record->GetFingerprint();
                 SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider OpenStream save last pos = ", pos));
             }
         }
@@ -352,7 +425,17 @@ namespace SCXCore {
     */
     void LogFileReader::LogFileStreamPositioner::PersistState()
     {
-        std::streamoff pos = m_Stream->tellg();
+        PersistState(m_Stream->tellg());
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Save the state of a logfile, with a position read through another stream.
+
+        \param[in] pos Position to continue reading from next time.
+    */
+    void LogFileReader::LogFileStreamPositioner::PersistState(std::streamoff pos)
+    {
         SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider PersistState() - pos = ", pos));
 
         // Never persist -1, happens on some platforms (AIX) when reading past end of file.  It can
@@ -368,6 +451,46 @@ namespace SCXCore {
         {
             m_Record->SetPos(pos);
         }
+        m_Record->SetFingerprint(RotatedLogFile::ReadFingerprint(m_Record->GetLogFile(), m_Record->GetPos()));
+        m_Record->Persist();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Return the rotated predecessor of a wrapped log file, opened at the
+        position reached before the file wrapped.
+
+        \returns       Handle to the predecessor (NULL if the file didn't wrap, or
+                       no predecessor with unread lines was found).
+    */
+    SCXHandle<RotatedLogFile> LogFileReader::LogFileStreamPositioner::GetPredecessor()
+    {
+        if (m_Wrapped && !m_PredecessorChecked)
+        {
+            m_PredecessorChecked = true;
+            m_Predecessor = RotatedLogFile::FindPredecessor(m_Record->GetLogFile(), m_PrevStIno, m_PrevPos, m_PrevFingerprint);
+            if (NULL != m_Predecessor)
+            {
+                SCX_LOGTRACE(m_log, L"LogFileProvider OpenLogFile " + m_Record->GetLogFile().Get()
+                             + L" - Continuing in rotated file " + m_Predecessor->GetPath().Get());
+            }
+        }
+        return m_Predecessor;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Save the state of a logfile while its rotated predecessor hasn't been read
+        to the end, so the next read continues in the predecessor.
+    */
+    void LogFileReader::LogFileStreamPositioner::PersistPredecessorState()
+    {
+        SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider PersistPredecessorState() - pos = ", m_Predecessor->GetPos()));
+
+        m_Record->SetPos(m_Predecessor->GetPos());
+        m_Record->SetStatStIno(m_PrevStIno);
+        m_Record->SetStatStSize(m_PrevStSize);
+        m_Record->SetFingerprint(m_Predecessor->GetFingerprint());
         m_Record->Persist();
     }
 
@@ -427,7 +550,8 @@ namespace SCXCore {
         Creates a new LogFileReader class
     */
     LogFileReader::LogFileReader()
-        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider"))
+        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider")),
+          m_scanTimeBudget(0)
     {
         m_persistMedia = GetPersistMedia();
         m_cqlPatterns.RegisterPattern(s_patternID, s_pattern);
@@ -529,70 +653,506 @@ namespace SCXCore {
         m_persistMedia = persistMedia; 
     }
 
+    /*----------------------------------------------------------------------------*/
+    /**
+        Set the time a single read of a log file may take.
+
+        When the time is up, the read stops, the position reached is persisted
+        and a partial read is reported, so the next read continues from there.
+
+        \param[in] milliseconds Time allowed for one read (0 means no limit).
+    */
+    void LogFileReader::SetScanTimeBudget(unsigned int milliseconds)
+    {
+        m_scanTimeBudget = milliseconds;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Find the end of a bracket expression in an extended regular expression
+
+        \param[in]     regex     Regular expression
+        \param[in]     start     Position of the opening '['
+
+        \returns       Position after the closing ']', or npos if there is none
+    */
+    static size_t SkipBracketExpression(const std::wstring& regex, size_t start)
+    {
+        size_t i = start + 1;
+        if (i < regex.size() && L'^' == regex[i])
+        {
+            i++;
+        }
+        if (i < regex.size() && L']' == regex[i])
+        {
+            // A leading ']' is part of the list
+            i++;
+        }
+        while (i < regex.size())
+        {
+            if (L'[' == regex[i] && i + 1 < regex.size()
+                && (L':' == regex[i + 1] || L'.' == regex[i + 1] || L'=' == regex[i + 1]))
+            {
+                // Character class, collating symbol or equivalence class, like [:alpha:]
+                wchar_t terminator[] = { regex[i + 1], L']', L'\0' };
+                size_t end = regex.find(terminator, i + 2);
+                if (std::wstring::npos == end)
+                {
+                    return std::wstring::npos;
+                }
+                i = end + 2;
+                continue;
+            }
+            if (L']' == regex[i])
+            {
+                return i + 1;
+            }
+            i++;
+        }
+        return std::wstring::npos;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Find the end of a parenthesized group in an extended regular expression
+
+        \param[in]     regex     Regular expression
+        \param[in]     start     Position of the opening '('
+
+        \returns       Position after the closing ')', or npos if there is none
+    */
+    static size_t SkipGroup(const std::wstring& regex, size_t start)
+    {
+        size_t depth = 0;
+        size_t i = start;
+        while (i < regex.size())
+        {
+            switch (regex[i])
+            {
+            case L'\\':
+                i += 2;
+                continue;
+            case L'[':
+                i = SkipBracketExpression(regex, i);
+                if (std::wstring::npos == i)
+                {
+                    return i;
+                }
+                continue;
+            case L'(':
+                depth++;
+                break;
+            case L')':
+                if (0 == --depth)
+                {
+                    return i + 1;
+                }
+                break;
+            }
+            i++;
+        }
+        return std::wstring::npos;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the longest literal string that every match of a regular expression contains
+
+        The expression is taken as a case sensitive POSIX extended regular
+        expression (as compiled by SCXRegex).  Anything that isn't understood
+        results in no literal, so a line without the literal can never match.
+
+        \param[in]     regex     Regular expression
+
+        \returns       Required literal, or an empty string if there is none
+    */
+    std::wstring LogFileReader::GetRequiredLiteral(const std::wstring& regex)
+    {
+        std::wstring best;
+        std::wstring run;
+        size_t i = 0;
+
+        while (i < regex.size())
+        {
+            wchar_t c = regex[i];
+            bool literal = false;
+            size_t next = i + 1;
+
+            switch (c)
+            {
+            case L'|':
+                // Alternatives have no single required literal
+                return L"";
+            case L'\\':
+                if (i + 1 >= regex.size())
+                {
+                    return L"";
+                }
+                // Escaped letters and digits may be operators (like \w or \<)
+                literal = !iswalnum(regex[i + 1]);
+                c = regex[i + 1];
+                next = i + 2;
+                break;
+            case L'[':
+                next = SkipBracketExpression(regex, i);
+                break;
+            case L'(':
+                next = SkipGroup(regex, i);
+                break;
+            case L'.':
+            case L'^':
+            case L'$':
+                break;
+            case L')':
+            case L'*':
+            case L'+':
+            case L'?':
+            case L'{':
+                return L"";
+            default:
+                literal = true;
+                break;
+            }
+            if (std::wstring::npos == next)
+            {
+                return L"";
+            }
+
+            // A quantifier may make the atom optional, or repeat it
+            bool optional = false;
+            bool repeated = false;
+            if (next < regex.size())
+            {
+                switch (regex[next])
+                {
+                case L'*':
+                case L'?':
+                    optional = true;
+                    next++;
+                    break;
+                case L'+':
+                    repeated = true;
+                    next++;
+                    break;
+                case L'{':
+                {
+                    size_t end = regex.find(L'}', next);
+                    size_t digits = next + 1;
+                    while (digits < regex.size() && iswdigit(regex[digits]))
+                    {
+                        digits++;
+                    }
+                    if (std::wstring::npos == end || digits == next + 1)
+                    {
+                        return L"";
+                    }
+                    optional = (0 == StrToUInt(regex.substr(next + 1, digits - next - 1)));
+                    repeated = true;
+                    next = end + 1;
+                    break;
+                }
+                }
+                if (next < regex.size() && (optional || repeated)
+                    && (L'*' == regex[next] || L'+' == regex[next] || L'?' == regex[next] || L'{' == regex[next]))
+                {
+                    return L"";
+                }
+            }
+
+            if (literal && !optional)
+            {
+                run += c;
+            }
+            if (!literal || optional || repeated)
+            {
+                if (run.size() > best.size())
+                {
+                    best = run;
+                }
+                run.clear();
+            }
+            i = next;
+        }
+
+        return (run.size() > best.size()) ? run : best;
+    }
+
     bool LogFileReader::ReadLogFile(
         const std::wstring& filename,
         const std::wstring& qid,
         const std::vector<SCXRegexWithIndex>& regexps,
         std::vector<std::wstring>& matchedLines)
     {
-        LogFileStreamPositioner positioner(filename, qid, m_persistMedia);
-        SCXHandle<std::wfstream> logfile = positioner.GetStream();
+        std::vector<LogFileQuery> queries(1);
+        queries[0].qid = qid;
+        queries[0].regexps = regexps;
 
-        bool partialRead = false;
+        ReadLogFile(filename, queries);
+
+        matchedLines.insert(matchedLines.end(), queries[0].matchedLines.begin(), queries[0].matchedLines.end());
+        return queries[0].partialRead;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Read a log file for several QIDs at once.
+
+        Each QID keeps its own position and regular expressions.  The rows
+        matched for all of them are returned together, so the limits on rows and
+        bytes apply to all QIDs together: once they are reached, every QID
+        stops at the line reached (or where it started, if it wasn't read yet),
+        is flagged as partially read, and continues from there on the next
+        call.  QIDs that continue from the same position share a single read of the file:
+        every line is read once and matched against the regular expressions of
+        all of them.  Since QIDs that read to the end of the file end up at the
+        same position, QIDs monitoring the same file share reads from the second
+        call on.
+
+        If a scan time budget is set, reading stops when it is used up, and each
+        QID still reading continues from the position reached on the next call.
+
+        If the file was rotated since a QID last read it, the lines that QID
+        didn't read yet are read from the rotated (possibly compressed)
+        predecessor first.
+
+        \param[in]     filename Log file to read.
+        \param[in,out] queries  QIDs and regular expressions; gets the results.
+        \throws SCXFilePathNotFoundException if log file does not exist.
+    */
+    void LogFileReader::ReadLogFile(
+        const std::wstring& filename,
+        std::vector<LogFileQuery>& queries)
+    {
+        std::vector<SCXHandle<LogFileStreamPositioner> > positioners;
+        std::vector<std::streamoff> starts;
+        positioners.reserve(queries.size());
+        starts.reserve(queries.size());
+        for (size_t i=0; i<queries.size(); i++)
+        {
+            positioners.push_back(SCXHandle<LogFileStreamPositioner>(
+                new LogFileStreamPositioner(filename, queries[i].qid, m_persistMedia)));
+            starts.push_back(positioners[i]->GetStream()->tellg());
+            queries[i].matchedLines.clear();
+            queries[i].partialRead = false;
+        }
 
-        unsigned int rows = 0;
-        unsigned int matched_rows = 0;
-        size_t total_bytes = 0;
+        std::vector<std::streamoff> stops(queries.size(), -1);
+        std::vector<bool> inPredecessor(queries.size(), false);
+        std::vector<bool> done(queries.size(), false);
+        MatchedTotals totals;
+        scxulong deadline = (0 != m_scanTimeBudget) ? GetMonotonicMilliseconds() + m_scanTimeBudget : 0;
 
-        // Read rows from log file
-        while ((matched_rows < cMaxMatchedRows && total_bytes < cMaxTotalBytes)
-               && SCXStream::IsGood(*logfile))
+        for (size_t i=0; i<queries.size(); i++)
         {
-            wstring line;
-            SCXStream::NLF nlf;
+            if (done[i])
+            {
+                continue;
+            }
+
+            // No more rows fit; the QIDs not read yet continue from where they are next time
+            if (totals.IsFull())
+            {
+                inPredecessor[i] = (NULL != positioners[i]->GetPredecessor());
+                stops[i] = starts[i];
+                queries[i].partialRead = true;
+                done[i] = true;
+                continue;
+            }
+
+            // Group with all remaining queries starting at the same position (unless that's unknown);
+            // a query that first has to finish the rotated predecessor of the file is read on its own
+            SCXHandle<RotatedLogFile> predecessor = positioners[i]->GetPredecessor();
+            std::vector<SharedReadQuery> readers;
+            for (size_t k=i; k<queries.size(); k++)
+            {
+                if (done[k] || (k != i && (NULL != predecessor || starts[i] < 0 || starts[k] != starts[i]
+                                           || NULL != positioners[k]->GetPredecessor())))
+                {
+                    continue;
+                }
+
+                SharedReadQuery reader;
+                reader.query = k;
+                reader.active = true;
+                reader.stop = -1;
+                for (size_t j=0; j<queries[k].regexps.size(); j++)
+                {
+                    reader.literals.push_back(GetRequiredLiteral(queries[k].regexps[j].regex->Get()));
+                    SCX_LOGHYSTERICAL(m_log, StrAppend(StrAppend(StrAppend(L"LogFileProvider ReadLogFile - regexp: ", queries[k].regexps[j].index),
+                                                                 L" required literal: "), reader.literals[j]));
+                }
+                readers.push_back(reader);
+                done[k] = true;
+            }
 
-            rows++;
+            SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"LogFileProvider ReadLogFile - QID: ", queries[i].qid),
+                                          StrAppend(L" shares read with QIDs: ", readers.size() - 1)));
 
-            SCX_LOGHYSTERICAL(m_log, StrAppend(L"LogFileProvider DoInvokeMethod - Reading row: ", rows));
+            unsigned int rows = 0;
+            bool timedOut = false;
 
-            SCXStream::ReadLine(*logfile, line, nlf);
+            // Lines written before the file was rotated come first
+            if (NULL != predecessor)
+            {
+                SharedReadQuery& reader = readers[0];
+                while (reader.active && predecessor->IsGood())
+                {
+                    if (0 != deadline && rows > 0 && 0 == rows % cDeadlineCheckRows && GetMonotonicMilliseconds() >= deadline)
+                    {
+                        SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider ReadLogFile - Scan time budget used up in rotated file after rows: ", rows));
+                        timedOut = true;
+                        break;
+                    }
+
+                    wstring line;
+                    if (!predecessor->ReadLine(line))
+                    {
+                        break;
+                    }
+                    rows++;
+
+                    if (MatchLine(line, rows, queries[i], reader, totals))
+                    {
+                        reader.active = false;
+                    }
+                }
+
+                if (!reader.active || timedOut)
+                {
+                    // Continue in the predecessor next time
+                    inPredecessor[i] = true;
+                    queries[i].partialRead = true;
+                    continue;
+                }
+            }
+
+            SCXHandle<std::wfstream> logfile = positioners[i]->GetStream();
+            size_t activeReaders = readers.size();
+
+            // Read rows from log file
+            while (activeReaders > 0 && SCXStream::IsGood(*logfile))
+            {
+                wstring line;
+                SCXStream::NLF nlf;
+
+                // Stop if out of time (after reading some rows, so every scan makes
+                // progress); the QIDs still reading continue from here next time
+                if (0 != deadline && rows > 0 && 0 == rows % cDeadlineCheckRows && GetMonotonicMilliseconds() >= deadline)
+                {
+                    SCX_LOGTRACE(m_log, StrAppend(L"LogFileProvider ReadLogFile - Scan time budget used up after rows: ", rows));
+                    timedOut = true;
+                    break;
+                }
+
+                rows++;
+
+                SCX_LOGHYSTERICAL(m_log, StrAppend(L"LogFileProvider DoInvokeMethod - Reading row: ", rows));
+
+                SCXStream::ReadLine(*logfile, line, nlf);
+
+                // Every query gets the line, even if the limits are reached on the way
+                bool full = false;
+                for (size_t r=0; r<readers.size(); r++)
+                {
+                    SharedReadQuery& reader = readers[r];
+                    if (reader.active && MatchLine(line, rows, queries[reader.query], reader, totals))
+                    {
+                        full = true;
+                    }
+                }
+
+                if (full)
+                {
+//TODO: logging policy not set so by default may write into stdout and therefore interfere with the normal operation.
+//                  SCX_LOGINFO(m_log, StrAppend(L"LogFileProvider DoInvokeMethod - Breaking after matching max number of rows : ", cMaxMatchedRows));
 
-            // Check line against regular expressions and add to result if any matches
-            std::wstring res(L"");
-            int matches = 0;
+                    // Not all rows were read; the queries continue from here next time
+                    bool partialRead = SCXStream::IsGood(*logfile);
+                    std::streamoff stop = logfile->tellg();
+                    for (size_t r=0; r<readers.size(); r++)
+                    {
+                        if (readers[r].active)
+                        {
+                            readers[r].active = false;
+                            readers[r].stop = stop;
+                            queries[readers[r].query].partialRead = partialRead;
+                        }
+                    }
+                    activeReaders = 0;
+                }
+            }
 
-            for (size_t j=0; j<regexps.size(); j++)
+            std::streamoff end = logfile->tellg();
+            for (size_t r=0; r<readers.size(); r++)
             {
-                if (regexps[j].regex->IsMatch(line))
+                stops[readers[r].query] = readers[r].active ? end : readers[r].stop;
+                if (readers[r].active && timedOut)
                 {
-                    SCX_LOGHYSTERICAL(m_log, StrAppend(StrAppend(StrAppend(L"LogFileProvider DoInvokeMethod - row: ", rows), 
-                                                                 L" Matched regexp: "), regexps[j].index));
-                    matches++;
-                    res = StrAppend(StrAppend(res, res.length()>0?L" ":L""), regexps[j].index);
+                    queries[readers[r].query].partialRead = true;
                 }
             }
+        }
 
-            if (matches > 0)
+        for (size_t i=0; i<queries.size(); i++)
+        {
+            if (inPredecessor[i])
             {
-                wstring retEntry = StrAppend(StrAppend(res, L";"), line);
-                matchedLines.push_back(retEntry);
-                matched_rows++;
-                total_bytes += retEntry.size();
+                positioners[i]->PersistPredecessorState();
+            }
+            else
+            {
+                positioners[i]->PersistState(stops[i]);
             }
         }
+    }
 
-        // Check if we read all rows, if not add special row to beginning of result
-        if ((matched_rows >= cMaxMatchedRows || total_bytes >= cMaxTotalBytes)
-            && SCXStream::IsGood(*logfile))
+    /*----------------------------------------------------------------------------*/
+    /**
+        Match a line against the regular expressions of a query, and add it to
+        the results of the query if any matches.
+
+        \param[in]     line   Line read.
+        \param[in]     row    Number of the row (for logging).
+        \param[in,out] query  Query; gets the line if it matches.
+        \param[in]     reader Progress of the query.
+        \param[in,out] totals Rows returned for all queries; counts the line if it matches.
+        \returns true if the limits of the rows returned are reached.
+    */
+    bool LogFileReader::MatchLine(
+        const std::wstring& line,
+        unsigned int row,
+        LogFileQuery& query,
+        const SharedReadQuery& reader,
+        MatchedTotals& totals)
+    {
+        std::wstring res(L"");
+        int matches = 0;
+
+        for (size_t j=0; j<query.regexps.size(); j++)
         {
-//TODO: logging policy not set so by default may write into stdout and therefore interfere with the normal operation.
-//          SCX_LOGINFO(m_log, StrAppend(L"LogFileProvider DoInvokeMethod - Breaking after matching max number of rows : ", cMaxMatchedRows));
+            // Lines without the literal a regular expression requires can't match it
+            if (!reader.literals[j].empty() && std::wstring::npos == line.find(reader.literals[j]))
+            {
+                continue;
+            }
+            if (query.regexps[j].regex->IsMatch(line))
+            {
+                SCX_LOGHYSTERICAL(m_log, StrAppend(StrAppend(StrAppend(L"LogFileProvider DoInvokeMethod - row: ", row), 
+                                                             L" Matched regexp: "), query.regexps[j].index));
+                matches++;
+                res = StrAppend(StrAppend(res, res.length()>0?L" ":L""), query.regexps[j].index);
+            }
+        }
 
-            partialRead = true;
+        if (matches > 0)
+        {
+            wstring retEntry = StrAppend(StrAppend(res, L";"), line);
+            query.matchedLines.push_back(retEntry);
+            totals.matchedRows++;
+            totals.totalBytes += retEntry.size();
         }
 
-        positioner.PersistState();
-        return partialRead;
+        return totals.IsFull();
     }
 
     int LogFileReader::ResetLogFileState(
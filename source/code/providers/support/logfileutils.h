@@ -24,8 +24,27 @@
 #include <scxcorelib/scxpatternfinder.h>
 #include <scxcorelib/scxregex.h>
 
+#include "rotatedlogfile.h"
+
 namespace SCXCore
 {
+    struct SharedReadQuery;
+    struct MatchedTotals;
+
+    /**
+       One query of a log file: a QID with its regular expressions, and the
+       result of reading the file for it.
+    */
+    struct LogFileQuery
+    {
+        LogFileQuery() : partialRead(false) {}
+
+        std::wstring qid;                                       //!< Query ID
+        std::vector<SCXCoreLib::SCXRegexWithIndex> regexps;     //!< Regular expressions to match
+        std::vector<std::wstring> matchedLines;                 //!< Resulting matched lines
+        bool partialRead;                                       //!< More matching lines are available
+    };
+
     class LogFileReader
     {
     public:             /* Public only for test purposes ... */
@@ -48,6 +67,8 @@ namespace SCXCore
             void SetStatStIno(scxulong st_ino);
             scxulong GetStatStSize() const;
             void SetStatStSize(scxulong st_size);
+            const std::wstring& GetFingerprint() const;
+            void SetFingerprint(const std::wstring& fingerprint);
 
             void Persist();
             bool Recover();
@@ -63,6 +84,7 @@ namespace SCXCore
             std::streamoff m_Pos;   //!< file end pos
             scxulong m_StIno;       //!< st_ino field of a stat struct.
             scxulong m_StSize;      //!< st_size field of a stat struct.
+            std::wstring m_Fingerprint; //!< Fingerprint of the bytes before m_Pos (to recognize the file once rotated)
         };
 
         /**
@@ -78,12 +100,23 @@ namespace SCXCore
             SCXCoreLib::SCXHandle<std::wfstream> GetStream();
             void SetResetOnRead(bool fSet) { m_Record->SetResetOnRead(fSet); }
             void PersistState();
+            void PersistState(std::streamoff pos);
+            SCXCoreLib::SCXHandle<RotatedLogFile> GetPredecessor();
+            void PersistPredecessorState();
 
         private:
             SCXCoreLib::SCXHandle<LogFilePositionRecord> m_Record; //!< Handle to record with persistable data.
             SCXCoreLib::SCXHandle<std::wfstream> m_Stream; //!< Handle to currently open stream.
             SCXCoreLib::SCXLogHandle m_log; //!< Handle to log framework.
 
+            bool m_Wrapped;                 //!< File was rotated since last read
+            scxulong m_PrevStIno;           //!< st_ino of the file when last read
+            scxulong m_PrevStSize;          //!< st_size of the file when last read
+            std::streamoff m_PrevPos;       //!< Position reached when last read
+            std::wstring m_PrevFingerprint; //!< Fingerprint of the bytes before m_PrevPos
+            bool m_PredecessorChecked;      //!< Rotated predecessor was looked for
+            SCXCoreLib::SCXHandle<RotatedLogFile> m_Predecessor; //!< Rotated predecessor with unread lines (if any)
+
             bool IsFileNew() const;
             void UpdateStatData();
         };
@@ -98,6 +131,10 @@ namespace SCXCore
             const std::vector<SCXCoreLib::SCXRegexWithIndex>& regexps,
             std::vector<std::wstring>& matchedLines);
 
+        void ReadLogFile(
+            const std::wstring& filename,
+            std::vector<LogFileQuery>& queries);
+
         int ResetLogFileState(
             const std::wstring& filename,
             const std::wstring& qid,
@@ -105,6 +142,12 @@ namespace SCXCore
 
         int ResetAllLogFileStates(const std::wstring& path, bool resetOnRead);
 
+        // Public solely for unit tests ...
+        static std::wstring GetRequiredLiteral(const std::wstring& regex);
+
+        void SetScanTimeBudget(unsigned int milliseconds);
+        unsigned int GetScanTimeBudget() const { return m_scanTimeBudget; }
+
         // Public solely for unit tests ...
         void SetPersistMedia(SCXCoreLib::SCXHandle<SCXCoreLib::SCXPersistMedia> persistMedia);
 
@@ -122,6 +165,8 @@ namespace SCXCore
         };
 
     private:
+        bool MatchLine(const std::wstring& line, unsigned int row, LogFileQuery& query, const SharedReadQuery& reader,
+                       MatchedTotals& totals);
         std::wstring GetFileName(const std::wstring& query);
         SCXLogFile* GetLogFile(const std::wstring& filename);
         bool CheckFileWrap(const struct stat64& oldstatinfo, const struct stat64& newstatinfo);
@@ -130,6 +175,7 @@ namespace SCXCore
 
         SCXCoreLib::SCXLogHandle m_log; //!< Handle to log framework.
         SCXCoreLib::SCXHandle<SCXCoreLib::SCXPersistMedia> m_persistMedia; //!< Persist media to use
+        unsigned int m_scanTimeBudget;      //!< Time allowed for one read, in milliseconds (0 means no limit)
         SCXCoreLib::SCXPatternFinder m_cqlPatterns; //!< Supported cql patterns finder.
         static const SCXCoreLib::SCXPatternFinder::SCXPatternCookie s_patternID; //!< Supported pattern identifier.
         static const std::wstring s_pattern; //!< The actual pattern supported
@@ -0,0 +1,643 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        logfilewatcher.cpp
+
+    \brief       Tails log files and reports rows matching subscribed regular expressions
+
+    \date        2026-10-19 22:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+
+#include "logfilewatcher.h"
+#include "sysutils.h"
+#include "wqlfilter.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(linux)
+#include <sys/inotify.h>
+#endif
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Thread parameter for the watching thread
+    class LogFileWatcherParam : public SCXThreadParam
+    {
+    public:
+        LogFileWatcherParam(SCXCore::LogFileWatcher* watcher) : m_watcher(watcher) { }
+
+        SCXCore::LogFileWatcher* m_watcher;
+    };
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Parses the WQL filter of a subscription.  The supported form is
+
+         SELECT * FROM <class> WHERE FileName = '<file>'
+             AND (Regexp = '<regexp>' OR Regexp = '<regexp>' ...)
+
+       in any order of the two conditions, with the parentheses optional
+       around a single regular expression.
+
+       \param[in]   query      Filter query
+       \param[out]  filename   File to watch
+       \param[out]  regexps    Regular expressions rows are matched against
+       \throws      SCXNotSupportedException if the query is not of that form
+    */
+    void LogFileWatcher::ParseFilter(const std::wstring& query,
+                                     std::wstring& filename,
+                                     std::vector<std::wstring>& regexps)
+    {
+        WqlFilterTokenizer tokens(query);
+        std::wstring token;
+
+        filename.clear();
+        regexps.clear();
+
+        tokens.Expect(L"SELECT");
+        tokens.Expect(L"*");
+        tokens.Expect(L"FROM");
+        if (WqlFilterTokenizer::eWord != tokens.Next(token))
+        {
+            throw SCXNotSupportedException(L"LogFileWatcher filter expected a class: " + query, SCXSRCLOCATION);
+        }
+        tokens.Expect(L"WHERE");
+
+        bool haveFileName = false;
+        WqlFilterTokenizer::TokenType type;
+        do
+        {
+            type = tokens.Next(token);
+            if (WqlFilterTokenizer::eWord == type && L"FILENAME" == token && !haveFileName)
+            {
+                tokens.Expect(L"=");
+                filename = tokens.ExpectString();
+                haveFileName = true;
+            }
+            else if (WqlFilterTokenizer::eWord == type && L"REGEXP" == token && regexps.empty())
+            {
+                tokens.Expect(L"=");
+                regexps.push_back(tokens.ExpectString());
+            }
+            else if (WqlFilterTokenizer::eSymbol == type && L"(" == token && regexps.empty())
+            {
+                do
+                {
+                    tokens.Expect(L"REGEXP");
+                    tokens.Expect(L"=");
+                    regexps.push_back(tokens.ExpectString());
+                    type = tokens.Next(token);
+                } while (WqlFilterTokenizer::eWord == type && L"OR" == token);
+
+                if (WqlFilterTokenizer::eSymbol != type || L")" != token)
+                {
+                    throw SCXNotSupportedException(L"LogFileWatcher filter expected OR or ): " + query, SCXSRCLOCATION);
+                }
+            }
+            else
+            {
+                throw SCXNotSupportedException(L"LogFileWatcher filter not supported: " + query, SCXSRCLOCATION);
+            }
+
+            type = tokens.Next(token);
+        } while (WqlFilterTokenizer::eWord == type && L"AND" == token);
+
+        if (WqlFilterTokenizer::eEnd != type || !haveFileName || regexps.empty())
+        {
+            throw SCXNotSupportedException(L"LogFileWatcher filter must select a FileName and Regexp: " + query, SCXSRCLOCATION);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   sink   Receives the matches
+    */
+    LogFileWatcher::LogFileWatcher(LogFileMatchSink* sink)
+        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider.logfilewatcher")),
+          m_sink(sink),
+          m_inotify(-1),
+          m_running(false)
+    {
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    LogFileWatcher::~LogFileWatcher()
+    {
+        Stop();
+
+        SCXConditionHandle h(m_cond);
+        for (std::map<std::wstring, WatchedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+        {
+            CloseFile(it->second);
+        }
+        m_files.clear();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the watching thread.
+
+       \returns     true if the thread is running
+    */
+    bool LogFileWatcher::Start()
+    {
+        SCXConditionHandle h(m_cond);
+        if (m_running)
+        {
+            return true;
+        }
+        if (NULL != m_thread)
+        {
+            // The thread failed earlier and has exited
+            h.Unlock();
+            Stop();
+            h.Lock();
+        }
+
+        if (!OpenWakePipe(m_wakeFds))
+        {
+            SCX_LOGWARNING(m_log, StrAppend(L"Unable to create pipe for log file watching thread, errno = ", errno));
+            return false;
+        }
+
+#if defined(linux)
+        m_inotify = inotify_init();
+        if (m_inotify < 0)
+        {
+            SCX_LOGINFO(m_log, StrAppend(L"inotify not available, log files are checked at intervals; errno = ", errno));
+        }
+        else
+        {
+            SetCloseOnExec(m_inotify);
+            SetNonBlocking(m_inotify);
+        }
+#endif
+        for (std::map<std::wstring, WatchedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+        {
+            AddWatches(it->second);
+        }
+
+        m_running = true;
+        try
+        {
+            m_thread = new SCXThread(WatchBody, new LogFileWatcherParam(this));
+        }
+        catch (SCXException& e)
+        {
+            SCX_LOGWARNING(m_log, L"Unable to start log file watching thread: " + e.What());
+            m_running = false;
+            CloseFd(m_inotify);
+            ClosePipe(m_wakeFds);
+            return false;
+        }
+
+        SCX_LOGTRACE(m_log, L"Watching log files");
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the watching thread.  Subscriptions are kept.
+    */
+    void LogFileWatcher::Stop()
+    {
+        SCXHandle<SCXThread> thread;
+        {
+            SCXConditionHandle h(m_cond);
+            thread = m_thread;
+            WriteWakePipe(m_wakeFds);
+        }
+
+        if (NULL != thread)
+        {
+            thread->Wait();
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_thread = NULL;
+        m_running = false;
+        // Closing the inotify instance removes all its watches
+        CloseFd(m_inotify);
+        for (std::map<std::wstring, WatchedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+        {
+            it->second.watch = -1;
+        }
+        ClosePipe(m_wakeFds);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether the watching thread is running.
+    */
+    bool LogFileWatcher::IsRunning()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_running;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds a subscription to the rows written to a file from now on that
+       match any of a set of regular expressions.  A file that doesn't exist
+       yet is followed from its start once it is created.
+
+       \param[in]   subscriptionID   Subscription, passed to the sink with its matches
+       \param[in]   filename         File to follow
+       \param[in]   regexps          Regular expressions
+       \throws      SCXInvalidRegexException if a regular expression is invalid
+    */
+    void LogFileWatcher::Subscribe(scxulong subscriptionID,
+                                   const std::wstring& filename,
+                                   const std::vector<std::wstring>& regexps)
+    {
+        Subscription subscription;
+        subscription.id = subscriptionID;
+        for (size_t i = 0; i < regexps.size(); i++)
+        {
+            subscription.expressions.push_back(regexps[i]);
+            subscription.regexps.push_back(new SCXRegex(regexps[i]));
+        }
+
+        SCXConditionHandle h(m_cond);
+        std::map<std::wstring, WatchedFile>::iterator it = m_files.find(filename);
+        if (m_files.end() == it)
+        {
+            it = m_files.insert(std::make_pair(filename, WatchedFile())).first;
+            it->second.name = filename;
+            OpenFile(it->second, true);
+            AddWatches(it->second);
+        }
+        it->second.subscriptions.push_back(subscription);
+
+        SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"LogFileWatcher Subscribe - ID: ", subscriptionID), L" file: " + filename));
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes a subscription.  Once this returns, the sink gets no more matches
+       for it.
+
+       \param[in]   subscriptionID   Subscription
+       \returns     true if the subscription was found
+    */
+    bool LogFileWatcher::Unsubscribe(scxulong subscriptionID)
+    {
+        SCXConditionHandle h(m_cond);
+        for (std::map<std::wstring, WatchedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+        {
+            std::vector<Subscription>& subscriptions = it->second.subscriptions;
+            for (size_t i = 0; i < subscriptions.size(); i++)
+            {
+                if (subscriptions[i].id == subscriptionID)
+                {
+                    SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"LogFileWatcher Unsubscribe - ID: ", subscriptionID), L" file: " + it->first));
+
+                    subscriptions.erase(subscriptions.begin() + i);
+                    if (subscriptions.empty())
+                    {
+                        CloseFile(it->second);
+                        m_files.erase(it);
+                    }
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of files followed.
+    */
+    size_t LogFileWatcher::GetFileCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_files.size();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads what was written to the followed files, and reports the rows that
+       match.  A file that was rotated is read to its end before continuing in
+       the new file; a file that was truncated is read from its start.
+
+       \returns     true if some file has more to read right away
+    */
+    bool LogFileWatcher::CheckFiles()
+    {
+        SCXConditionHandle h(m_cond);
+        bool more = false;
+
+        for (std::map<std::wstring, WatchedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+        {
+            WatchedFile& file = it->second;
+            if (file.fd < 0)
+            {
+                // Created since last checked: all of it is new
+                OpenFile(file, false);
+                if (file.fd < 0)
+                {
+                    continue;
+                }
+            }
+
+            if (ReadFile(file))
+            {
+                more = true;
+                continue;
+            }
+
+            struct stat st;
+            if (0 != stat(StrToUTF8(file.name).c_str(), &st))
+            {
+                // Moved away, and not created again yet
+                continue;
+            }
+            if (static_cast<scxulong>(st.st_ino) != file.ino)
+            {
+                SCX_LOGTRACE(m_log, L"LogFileWatcher CheckFiles - rotated: " + file.name);
+                if (!file.partial.empty())
+                {
+                    MatchRow(file, file.partialPos, file.partial);
+                    file.partial.clear();
+                }
+                CloseFile(file);
+                OpenFile(file, false);
+                more = ReadFile(file) || more;
+            }
+            else if (static_cast<scxulong>(st.st_size) < file.pos)
+            {
+                SCX_LOGTRACE(m_log, L"LogFileWatcher CheckFiles - truncated: " + file.name);
+                file.pos = 0;
+                file.partial.clear();
+                more = ReadFile(file) || more;
+            }
+        }
+
+        return more;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Watching thread body.
+
+       \param[in]   param   LogFileWatcherParam
+    */
+    void LogFileWatcher::WatchBody(SCXThreadParamHandle& param)
+    {
+        LogFileWatcherParam* p = static_cast<LogFileWatcherParam*>(param.GetData());
+        p->m_watcher->Watch();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Checks the files whenever woken by inotify, and at intervals, until
+       stopped.
+    */
+    void LogFileWatcher::Watch()
+    {
+        int wakeFd, inotifyFd;
+        {
+            SCXConditionHandle h(m_cond);
+            wakeFd = m_wakeFds[0];
+            inotifyFd = m_inotify;
+        }
+
+        bool more = false;
+        for (;;)
+        {
+            struct pollfd fds[2];
+            fds[0].fd = wakeFd;
+            fds[0].events = POLLIN;
+            fds[0].revents = 0;
+            fds[1].fd = inotifyFd;
+            fds[1].events = POLLIN;
+            fds[1].revents = 0;
+
+            if (poll(fds, inotifyFd >= 0 ? 2 : 1, more ? 0 : cCheckIntervalMs) < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                SCX_LOGERROR(m_log, StrAppend(L"Polling for log file changes failed, errno = ", errno));
+                break;
+            }
+            if (0 != fds[0].revents)
+            {
+                return;
+            }
+            if (0 != fds[1].revents)
+            {
+                // Which file changed doesn't matter, they are all checked
+                char events[4096];
+                while (read(inotifyFd, events, sizeof(events)) > 0)
+                {
+                }
+            }
+
+            more = CheckFiles();
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_running = false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Opens a followed file.
+
+       \param[in,out]  file    File; left closed if it doesn't exist
+       \param[in]      atEnd   Start reading at the end (true) or the start (false) of the file
+    */
+    void LogFileWatcher::OpenFile(WatchedFile& file, bool atEnd)
+    {
+        file.fd = open(StrToUTF8(file.name).c_str(), O_RDONLY);
+        if (file.fd < 0)
+        {
+            return;
+        }
+        SetCloseOnExec(file.fd);
+
+        struct stat st;
+        if (0 != fstat(file.fd, &st))
+        {
+            CloseFd(file.fd);
+            return;
+        }
+
+        file.ino = static_cast<scxulong>(st.st_ino);
+        file.pos = atEnd ? static_cast<scxulong>(st.st_size) : 0;
+        file.partial.clear();
+        AddWatches(file);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Closes a followed file.
+
+       \param[in,out]  file    File
+    */
+    void LogFileWatcher::CloseFile(WatchedFile& file)
+    {
+#if defined(linux)
+        if (file.watch >= 0 && m_inotify >= 0)
+        {
+            inotify_rm_watch(m_inotify, file.watch);
+        }
+#endif
+        file.watch = -1;
+        CloseFd(file.fd);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Asks inotify to wake the watching thread when a file is written to,
+       moved or deleted, or created again in its directory.
+
+       \param[in,out]  file    File
+    */
+    void LogFileWatcher::AddWatches(WatchedFile& file)
+    {
+#if defined(linux)
+        if (m_inotify < 0)
+        {
+            return;
+        }
+
+        std::string path = StrToUTF8(file.name);
+        std::string::size_type slash = path.rfind('/');
+        std::string directory = (std::string::npos == slash) ? "." : (0 == slash ? "/" : path.substr(0, slash));
+        inotify_add_watch(m_inotify, directory.c_str(), IN_CREATE | IN_MOVED_TO);
+
+        if (file.fd >= 0 && file.watch < 0)
+        {
+            file.watch = inotify_add_watch(m_inotify, path.c_str(), IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+        }
+#else
+        (void) file;
+#endif
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads what was written to a file since it was last read, and reports
+       the complete rows that match.
+
+       \param[in,out]  file    File
+       \returns        true if there is more to read than was read this time
+    */
+    bool LogFileWatcher::ReadFile(WatchedFile& file)
+    {
+        std::vector<char> buffer(64 * 1024);
+        size_t total = 0;
+
+        while (total < cMaxReadBytes)
+        {
+            ssize_t count = pread(file.fd, &buffer[0], buffer.size(), static_cast<off_t>(file.pos));
+            if (count < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                SCX_LOGWARNING(m_log, StrAppend(L"LogFileWatcher unable to read " + file.name + L", errno = ", errno));
+                return false;
+            }
+            if (0 == count)
+            {
+                return false;
+            }
+
+            const char* data = &buffer[0];
+            size_t size = static_cast<size_t>(count);
+            size_t start = 0;
+            while (start < size)
+            {
+                if (file.partial.empty())
+                {
+                    file.partialPos = file.pos + start;
+                }
+
+                const char* newline = static_cast<const char*>(memchr(data + start, '\n', size - start));
+                size_t length = (NULL != newline) ? static_cast<size_t>(newline - (data + start)) : size - start;
+                file.partial.append(data + start, length);
+                start += length;
+
+                if (NULL != newline || file.partial.size() >= cMaxRowBytes)
+                {
+                    MatchRow(file, file.partialPos, file.partial);
+                    file.partial.clear();
+                }
+                if (NULL != newline)
+                {
+                    start++;
+                }
+            }
+
+            file.pos += size;
+            total += size;
+        }
+
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reports a row to the subscriptions whose regular expressions it matches.
+
+       \param[in]      file       File of the row
+       \param[in]      position   Position of the row in the file
+       \param[in,out]  bytes      The row (without newline; a carriage return is removed)
+    */
+    void LogFileWatcher::MatchRow(const WatchedFile& file, scxulong position, std::string& bytes)
+    {
+        if (!bytes.empty() && '\r' == bytes[bytes.size() - 1])
+        {
+            bytes.erase(bytes.size() - 1);
+        }
+        std::wstring row = StrFromMultibyte(bytes);
+
+        for (size_t i = 0; i < file.subscriptions.size(); i++)
+        {
+            const Subscription& subscription = file.subscriptions[i];
+            for (size_t j = 0; j < subscription.regexps.size(); j++)
+            {
+                if (subscription.regexps[j]->IsMatch(row))
+                {
+                    LogFileMatch match;
+                    match.filename = file.name;
+                    match.position = position;
+                    match.regexp = subscription.expressions[j];
+                    match.row = row;
+                    m_sink->PostMatch(subscription.id, match);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,146 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        logfilewatcher.h
+
+    \brief       Tails log files and reports rows matching subscribed regular expressions
+
+    Subscribers of SCX_LogFileMatchIndication register a log file with a set
+    of regular expressions.  A thread follows the end of each subscribed file
+    and hands every new row that matches to a sink, as it is written.  On
+    Linux, inotify wakes the thread when a file is written to or rotated;
+    files are also checked at a fixed interval, which is all there is on
+    other platforms.
+
+    \date        2026-10-19 22:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef LOGFILEWATCHER_H
+#define LOGFILEWATCHER_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxregex.h>
+#include <scxcorelib/scxthread.h>
+
+#include "indicationsubscriptions.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SCXCore
+{
+    /**
+       A row of a log file that matched a regular expression of a subscription.
+    */
+    struct LogFileMatch
+    {
+        std::wstring filename;      //!< Log file
+        scxulong position;          //!< Position of the row in the file
+        std::wstring regexp;        //!< Regular expression the row matched
+        std::wstring row;           //!< The row
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives the matches of a LogFileWatcher.  Called on the watching
+       thread with the watcher locked, so it must not call back into the
+       watcher.
+    */
+    class LogFileMatchSink
+    {
+    public:
+        virtual ~LogFileMatchSink() { }
+        virtual void PostMatch(scxulong subscriptionID, const LogFileMatch& match) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Follows subscribed log files, and reports new rows that match.
+    */
+    class LogFileWatcher : public IndicationSource
+    {
+    public:
+        //! Interval between checks of the files when nothing wakes the thread, in milliseconds
+        static const int cCheckIntervalMs = 1000;
+        //! Bytes read from one file per check; the rest is read right after the other files were checked
+        static const size_t cMaxReadBytes = 1024 * 1024;
+        //! Longest row; a longer row is reported in pieces
+        static const size_t cMaxRowBytes = 64 * 1024;
+
+        static void ParseFilter(const std::wstring& query,
+                                std::wstring& filename,
+                                std::vector<std::wstring>& regexps);
+
+        LogFileWatcher(LogFileMatchSink* sink);
+        virtual ~LogFileWatcher();
+
+        virtual bool Start();
+        virtual void Stop();
+        bool IsRunning();
+
+        void Subscribe(scxulong subscriptionID,
+                       const std::wstring& filename,
+                       const std::vector<std::wstring>& regexps);
+        virtual bool Unsubscribe(scxulong subscriptionID);
+        size_t GetFileCount();
+
+        // Public solely for unit tests (done by the watching thread otherwise) ...
+        bool CheckFiles();
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"LogFileWatcher";
+        }
+
+    private:
+        //! Subscription to the matching rows of a file
+        struct Subscription
+        {
+            scxulong id;                                            //!< Subscription ID
+            std::vector<std::wstring> expressions;                  //!< Regular expressions
+            std::vector<SCXCoreLib::SCXHandle<SCXCoreLib::SCXRegex> > regexps; //!< Compiled expressions
+        };
+
+        //! A followed file
+        struct WatchedFile
+        {
+            WatchedFile() : fd(-1), ino(0), pos(0), partialPos(0), watch(-1) {}
+
+            std::wstring name;         //!< Path of the file
+            int fd;                     //!< Open file (-1 while the file doesn't exist)
+            scxulong ino;               //!< Inode of the open file
+            scxulong pos;               //!< Position of the next byte to read
+            std::string partial;        //!< Start of a row not yet terminated
+            scxulong partialPos;        //!< Position of the partial row
+            int watch;                  //!< inotify watch of the file (-1 if none)
+            std::vector<Subscription> subscriptions; //!< Subscriptions to the file
+        };
+
+        static void WatchBody(SCXCoreLib::SCXThreadParamHandle& param);
+        void Watch();
+        void OpenFile(WatchedFile& file, bool atEnd);
+        void CloseFile(WatchedFile& file);
+        void AddWatches(WatchedFile& file);
+        bool ReadFile(WatchedFile& file);
+        void MatchRow(const WatchedFile& file, scxulong position, std::string& bytes);
+
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        SCXCoreLib::SCXCondition m_cond;                //!< Protects the members below
+        SCXCoreLib::SCXHandle<SCXCoreLib::SCXThread> m_thread; //!< Watching thread
+        LogFileMatchSink* m_sink;       //!< Receives the matches
+        std::map<std::wstring, WatchedFile> m_files; //!< Followed files, by name
+        int m_inotify;                  //!< inotify instance (-1 if none)
+        int m_wakeFds[2];               //!< Pipe used to stop the watching thread
+        bool m_running;                 //!< The watching thread is running
+    };
+}
+
+#endif /* LOGFILEWATCHER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -11,6 +11,8 @@
 */
 /*----------------------------------------------------------------------------*/
 
+#include <scxcorelib/stringaid.h>
+#include "providerconfig.h"
 #include "startuplog.h"
 #include "memoryprovider.h"
 
@@ -27,8 +29,32 @@ namespace SCXCore
             LogStartup();
             SCX_LOGTRACE(m_log, L"MemoryProvider::Load()");
 
+            // See if we have a config file for overriding the refresh interval
+            m_refreshSecs = static_cast<time_t>(GetConfigUInt(L"MemoryProvider_RefreshSecs", cDefaultMemoryRefreshSecs));
+
+            SCX_LOGTRACE(m_log, StrAppend(L"MemoryProvider parameters: Refresh Seconds = ", m_refreshSecs));
+
             m_memEnum = new MemoryEnumeration();
             m_memEnum->Init();
+            m_lastUpdate = 0;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Refreshes the memory enumeration unless the current sample is recent.
+
+       \param[in]   force   Refresh even if the current sample is recent
+    */
+    void MemoryProvider::UpdateMemoryEnumeration(bool force)
+    {
+        time_t now = time(NULL);
+
+        // Also refresh if the clock has been set back
+        if (force || 0 == m_lastUpdate || now < m_lastUpdate || now - m_lastUpdate >= m_refreshSecs)
+        {
+            m_memEnum->Update();
+            m_lastUpdate = now;
         }
     }
 
@@ -40,7 +66,7 @@ namespace SCXCore
             if (m_memEnum != NULL)
             {
                 m_memEnum->CleanUp();
-                m_memEnum == NULL;
+                m_memEnum = NULL;
             }
         }
     }
@@ -18,19 +18,41 @@
 #include <scxcorelib/scxlog.h>
 #include <scxsystemlib/memoryenumeration.h>
 
+#include <time.h>
+
 using namespace SCXCoreLib;
 using namespace SCXSystemLib;
 
 namespace SCXCore
 {
+    //! Default for how long a memory sample is reused (seconds)
+    const time_t cDefaultMemoryRefreshSecs = 5;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Memory provider
+
+       Both SCX_OperatingSystem and SCX_MemoryStatisticalInformation report
+       memory values, so they share this one memory enumeration.  A sample is
+       reused for up to "MemoryProvider_RefreshSecs" seconds (configuration
+       file setting), so both classes report the same values when polled back
+       to back.
+
+       All methods must be called with SCXCore::MemoryProvider::Lock held.
+    */
     class MemoryProvider
     {
     public:
-        MemoryProvider() { };
+        MemoryProvider() : m_refreshSecs(cDefaultMemoryRefreshSecs), m_lastUpdate(0) { };
         virtual ~MemoryProvider() { };
         void Load();
         void Unload();
 
+        void UpdateMemoryEnumeration(bool force = false);
+
+        //! Sets how long a memory sample is reused (seconds), until the next Load()
+        void SetRefreshSecs(time_t refreshSecs) { m_refreshSecs = refreshSecs; }
+
         SCXCoreLib::SCXHandle<SCXSystemLib::MemoryEnumeration> GetMemoryEnumeration() const
         {
             return m_memEnum;
@@ -45,6 +67,8 @@ namespace SCXCore
         
     private:
         SCXCoreLib::SCXHandle<SCXSystemLib::MemoryEnumeration> m_memEnum;
+        time_t m_refreshSecs;   //!< Maximum age of a memory sample
+        time_t m_lastUpdate;    //!< Time of the last sample (0 if none)
         SCXCoreLib::SCXLogHandle m_log;
         static int ms_loadCount;
     };
@@ -10,9 +10,11 @@
 */
 /*----------------------------------------------------------------------------*/
 
+#include <scxcorelib/scxthreadlock.h>
 #include <scxsystemlib/osenumeration.h>
 #include "startuplog.h"
 #include "osprovider.h"
+#include "memoryprovider.h"
 
 using namespace SCXSystemLib;
 using namespace SCXCoreLib;
@@ -29,7 +31,6 @@ namespace SCXCore
     */
     OSProvider::OSProvider() :
         m_osEnum(NULL),
-        m_memEnum(NULL),
         m_OSTypeInfo(NULL)
     {
     }
@@ -56,10 +57,12 @@ namespace SCXCore
             m_osEnum = new OSEnumeration();
             m_osEnum->Init();
 
-            // We need the memory provider for some stuff as well
-            SCXASSERT( NULL == m_memEnum );
-            m_memEnum = new MemoryEnumeration();
-            m_memEnum->Init();
+            // We need the memory provider for some stuff as well (the
+            // enumeration is shared with SCX_MemoryStatisticalInformation)
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+                g_MemoryProvider.Load();
+            }
 
             // And OS type information
             SCXASSERT( NULL == m_OSTypeInfo );
@@ -80,10 +83,9 @@ namespace SCXCore
                 m_osEnum = NULL;
             }
 
-            if (m_memEnum != NULL)
             {
-                m_memEnum->CleanUp();
-                m_memEnum = NULL;
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+                g_MemoryProvider.Unload();
             }
 
             m_OSTypeInfo = NULL;
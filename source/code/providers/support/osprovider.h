@@ -32,7 +32,6 @@ namespace SCXCore
         void Unload();
 
         SCXHandle<OSEnumeration> GetOS_Enumerator() { return m_osEnum; }
-        SCXHandle<MemoryEnumeration> GetMemory_Enumerator() { return m_memEnum; }
         SCXHandle<SCXOSTypeInfo> GetOSTypeInfo() { return m_OSTypeInfo; }
         SCXLogHandle& GetLogHandle() { return m_log; }
         virtual const std::wstring DumpString() const { return L"OSProvider"; }
@@ -41,9 +40,6 @@ namespace SCXCore
         //! PAL implementation representing os information for local host
         SCXCoreLib::SCXHandle<OSEnumeration> m_osEnum;
 
-        //! PAL implementation representing memory information for local host
-        SCXCoreLib::SCXHandle<MemoryEnumeration> m_memEnum;
-
         //! PAL for providing static OS information
         SCXCoreLib::SCXHandle<SCXOSTypeInfo> m_OSTypeInfo;
 
@@ -0,0 +1,142 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        outputcapture.cpp
+
+    \brief       Bounded capture of child process output for the RunAs provider
+
+    \date        2026-10-19 14:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/stringaid.h>
+
+#include "outputcapture.h"
+
+#include <algorithm>
+
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   limit   Maximum number of bytes to store
+    */
+    OutputCaptureBuffer::OutputCaptureBuffer(size_t limit)
+        : m_limit(limit),
+          m_totalBytes(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Converts the start of the captured output to a wide string.
+
+       If the output is cut short (by maxBytes or by the capture limit), a
+       multibyte character split at the end is dropped rather than converted.
+
+       \param[in]   maxBytes   Maximum number of bytes to convert
+       \returns     Converted output
+    */
+    std::wstring OutputCaptureBuffer::GetText(size_t maxBytes) const
+    {
+        if (maxBytes >= m_totalBytes)
+        {
+            return StrFromMultibyte(m_data);
+        }
+
+        size_t length = GetUTF8Boundary(m_data, std::min(maxBytes, m_data.size()));
+        return StrFromMultibyte(m_data.substr(0, length));
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Finds where to cut UTF-8 data so no character is split.
+
+       \param[in]   data     UTF-8 data
+       \param[in]   length   Desired length (at most data.size())
+       \returns     Largest length not above the desired one that ends on a
+                    character boundary (invalid sequences are left alone)
+    */
+    size_t OutputCaptureBuffer::GetUTF8Boundary(const std::string& data, size_t length)
+    {
+        // Find the lead byte of the last character (at most 4 bytes long)
+        size_t lead = length;
+        while (lead > 0 && length - lead < 4)
+        {
+            lead--;
+            unsigned char c = static_cast<unsigned char>(data[lead]);
+            if ((c & 0xC0) != 0x80)
+            {
+                size_t sequence = 1;
+                if ((c & 0xE0) == 0xC0)
+                {
+                    sequence = 2;
+                }
+                else if ((c & 0xF0) == 0xE0)
+                {
+                    sequence = 3;
+                }
+                else if ((c & 0xF8) == 0xF0)
+                {
+                    sequence = 4;
+                }
+                return (lead + sequence > length) ? lead : length;
+            }
+        }
+        return length;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stores one character, if below the limit.
+
+       \param[in]   c   Character written
+       \returns     c (never fails)
+    */
+    OutputCaptureBuffer::int_type OutputCaptureBuffer::overflow(int_type c)
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            return traits_type::not_eof(c);
+        }
+
+        m_totalBytes++;
+        if (m_data.size() < m_limit)
+        {
+            m_data.push_back(traits_type::to_char_type(c));
+        }
+        return c;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stores a block of characters, up to the limit.
+
+       \param[in]   s   Characters written
+       \param[in]   n   Number of characters
+       \returns     n (the rest is counted and discarded)
+    */
+    std::streamsize OutputCaptureBuffer::xsputn(const char* s, std::streamsize n)
+    {
+        if (n <= 0)
+        {
+            return 0;
+        }
+
+        m_totalBytes += static_cast<scxulong>(n);
+        if (m_data.size() < m_limit)
+        {
+            size_t room = m_limit - m_data.size();
+            m_data.append(s, std::min(room, static_cast<size_t>(n)));
+        }
+        return n;
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,60 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        outputcapture.h
+
+    \brief       Bounded capture of child process output for the RunAs provider
+
+    \date        2026-10-19 14:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef OUTPUTCAPTURE_H
+#define OUTPUTCAPTURE_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <streambuf>
+#include <string>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stream buffer that keeps at most a fixed number of bytes.
+
+       Everything written to the buffer is accepted (so the process pipe keeps
+       being drained), but only the first bytes up to the limit are stored.
+       The total number of bytes written is counted, so callers can tell how
+       much output was thrown away.
+    */
+    class OutputCaptureBuffer : public std::streambuf
+    {
+    public:
+        OutputCaptureBuffer(size_t limit);
+
+        const std::string& GetData() const { return m_data; }
+        scxulong GetTotalBytes() const { return m_totalBytes; }
+        bool IsTruncated() const { return m_totalBytes > m_data.size(); }
+
+        std::wstring GetText(size_t maxBytes) const;
+
+        void AddDiscardedBytes(scxulong count) { m_totalBytes += count; }
+
+        static size_t GetUTF8Boundary(const std::string& data, size_t length);
+
+    protected:
+        virtual int_type overflow(int_type c);
+        virtual std::streamsize xsputn(const char* s, std::streamsize n);
+
+    private:
+        size_t m_limit;             //!< Maximum number of bytes stored
+        std::string m_data;         //!< Stored bytes
+        scxulong m_totalBytes;      //!< Number of bytes written, including those discarded
+    };
+}
+
+#endif /* OUTPUTCAPTURE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,226 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        processchangetracker.cpp
+
+    \brief       Change tokens for delta enumeration of processes
+
+    \date        2026-10-19 23:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "processchangetracker.h"
+
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    /**
+       Tells whether a process has the same name and execution state in two lists.
+    */
+    bool SameValues(const SCXCore::ProcessRecord& a, const SCXCore::ProcessRecord& b)
+    {
+        return a.name == b.name && a.executionState == b.executionState;
+    }
+
+    /**
+       Returns a number no other tracker of this process was given, so a
+       tracker created in the same second as an earlier one (like after the
+       provider is unloaded and loaded again) doesn't take its tokens.
+    */
+    scxulong NextTrackerNumber()
+    {
+        static scxulong s_trackers = 0;
+
+        SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::ProcessChangeTracker::Lock"));
+        return ++s_trackers;
+    }
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+    */
+    ProcessChangeTracker::ProcessChangeTracker()
+        : m_instance(StrAppend(StrAppend(StrAppend(StrAppend(StrFrom(static_cast<scxulong>(time(NULL))), L"-"), getpid()), L"-"),
+                               NextTrackerNumber())),
+          m_nextGeneration(1)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Compares the current processes with those a token was issued for.
+
+       \param[in]   processes   Current processes
+       \param[in]   token       Token of an earlier call (empty for the first call)
+       \param[in]   now         Current time
+       \param[out]  changes     Processes that started, exited or changed since the token
+                                (every current process, as added, on a full resync)
+       \param[out]  nextToken   Token for the next call
+       \returns     true if the token couldn't be used, so this is a full resync
+    */
+    bool ProcessChangeTracker::GetChanges(const std::vector<ProcessRecord>& processes, const std::wstring& token, time_t now,
+                                          std::vector<ProcessChange>& changes, std::wstring& nextToken)
+    {
+        Prune(now);
+
+        ProcessList current;
+        for (std::vector<ProcessRecord>::const_iterator it = processes.begin(); it != processes.end(); ++it)
+        {
+            current[Identity(it->pid, it->startTime)] = *it;
+        }
+
+        changes.clear();
+        std::map<scxulong, Generation>::iterator base = m_generations.end();
+        scxulong generation;
+        if (ParseToken(token, generation))
+        {
+            base = m_generations.find(generation);
+        }
+
+        bool fullResync = (m_generations.end() == base);
+        if (fullResync)
+        {
+            for (ProcessList::const_iterator it = current.begin(); it != current.end(); ++it)
+            {
+                changes.push_back(ProcessChange(ProcessChange::eAdded, it->second));
+            }
+        }
+        else
+        {
+            // Both lists are ordered by identity, so walk them side by side
+            const ProcessList& previous = base->second.processes;
+            ProcessList::const_iterator p = previous.begin();
+            ProcessList::const_iterator c = current.begin();
+            while (p != previous.end() || c != current.end())
+            {
+                if (c == current.end() || (p != previous.end() && p->first < c->first))
+                {
+                    changes.push_back(ProcessChange(ProcessChange::eRemoved, p->second));
+                    ++p;
+                }
+                else if (p == previous.end() || c->first < p->first)
+                {
+                    changes.push_back(ProcessChange(ProcessChange::eAdded, c->second));
+                    ++c;
+                }
+                else
+                {
+                    if (!SameValues(p->second, c->second))
+                    {
+                        changes.push_back(ProcessChange(ProcessChange::eChanged, c->second));
+                    }
+                    ++p;
+                    ++c;
+                }
+            }
+        }
+
+        // Issue the newest token again if nothing changed since it, so idle pollers don't use up the kept lists
+        if (!m_generations.empty())
+        {
+            std::map<scxulong, Generation>::iterator newest = m_generations.end();
+            --newest;
+
+            bool same = (newest->second.processes.size() == current.size());
+            for (ProcessList::const_iterator n = newest->second.processes.begin(), c = current.begin();
+                 same && n != newest->second.processes.end(); ++n, ++c)
+            {
+                same = (n->first == c->first && SameValues(n->second, c->second));
+            }
+            if (same)
+            {
+                newest->second.issued = now;
+                nextToken = MakeToken(newest->first);
+                return fullResync;
+            }
+        }
+
+        generation = m_nextGeneration++;
+        Generation& issued = m_generations[generation];
+        issued.issued = now;
+        issued.processes.swap(current);
+        while (m_generations.size() > cMaxTokens)
+        {
+            m_generations.erase(m_generations.begin());
+        }
+
+        nextToken = MakeToken(generation);
+        return fullResync;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the process list number out of a token of this tracker.
+
+       \param[in]   token        Token
+       \param[out]  generation   Number of the process list
+       \returns     false if the token is empty, malformed, or from another tracker
+    */
+    bool ProcessChangeTracker::ParseToken(const std::wstring& token, scxulong& generation) const
+    {
+        std::wstring prefix = m_instance + L".";
+        if (token.size() <= prefix.size() || 0 != token.compare(0, prefix.size(), prefix)
+            || std::wstring::npos != token.find_first_not_of(L"0123456789", prefix.size()))
+        {
+            return false;
+        }
+
+        try
+        {
+            generation = StrToULong(token.substr(prefix.size()));
+        }
+        catch (SCXException& e)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Makes the token of a process list.
+
+       \param[in]   generation   Number of the process list
+       \returns     Token
+    */
+    std::wstring ProcessChangeTracker::MakeToken(scxulong generation) const
+    {
+        return StrAppend(m_instance + L".", generation);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Forgets the process lists no token was issued for in cMaxTokenAgeSecs seconds.
+
+       \param[in]   now   Current time
+    */
+    void ProcessChangeTracker::Prune(time_t now)
+    {
+        std::map<scxulong, Generation>::iterator it = m_generations.begin();
+        while (it != m_generations.end())
+        {
+            if (now >= it->second.issued && now - it->second.issued > cMaxTokenAgeSecs)
+            {
+                m_generations.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,124 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        processchangetracker.h
+
+    \brief       Change tokens for delta enumeration of processes
+
+    Each call returns an opaque token naming the process list it saw.  Given
+    that token, the next call only returns the processes that started,
+    exited or changed since.  Processes are identified by (PID, start time),
+    so a reused PID is reported as an exit and a start.
+
+    \date        2026-10-19 23:30:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef PROCESSCHANGETRACKER_H
+#define PROCESSCHANGETRACKER_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <time.h>
+
+namespace SCXCore
+{
+    /**
+       Values of a process compared between process lists.
+    */
+    struct ProcessRecord
+    {
+        ProcessRecord() : pid(0), executionState(0) {}
+
+        scxulong pid;                   //!< Process ID
+        std::wstring startTime;         //!< Start time (with the PID, identifies the process)
+        std::string name;               //!< Process name
+        unsigned short executionState;  //!< Execution state (as in SCX_UnixProcess)
+    };
+
+    /**
+       A process that started, exited or changed.
+    */
+    struct ProcessChange
+    {
+        //! Kind of change (values of the Changes parameter of SCX_UnixProcess.EnumerateChanges)
+        enum Type
+        {
+            eAdded = 0,     //!< Started since the token (or any process, on a full resync)
+            eRemoved = 1,   //!< Exited since the token; the values are those it had then
+            eChanged = 2    //!< Name or execution state changed since the token
+        };
+
+        ProcessChange() : type(eAdded) {}
+        ProcessChange(Type t, const ProcessRecord& p) : type(t), process(p) {}
+
+        Type type;                      //!< Kind of change
+        ProcessRecord process;          //!< Values of the process
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Keeps the process lists of the most recent tokens, and compares the
+       current list with them.
+
+       At most cMaxTokens lists are kept, and for at most cMaxTokenAgeSecs
+       seconds.  A token that is empty, malformed, forgotten, too old, or
+       issued before the tracker was constructed (like by an earlier agent)
+       gets a full resync: every current process, reported as added.
+
+       Not thread safe; ProcessProvider calls it with its lock held.
+    */
+    class ProcessChangeTracker
+    {
+    public:
+        //! Most process lists kept
+        static const size_t cMaxTokens = 16;
+        //! Seconds a process list is kept after it was last issued
+        static const time_t cMaxTokenAgeSecs = 10 * 60;
+
+        ProcessChangeTracker();
+        virtual ~ProcessChangeTracker() { }
+
+        bool GetChanges(const std::vector<ProcessRecord>& processes, const std::wstring& token, time_t now,
+                        std::vector<ProcessChange>& changes, std::wstring& nextToken);
+
+        size_t GetTokenCount() const { return m_generations.size(); }
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ProcessChangeTracker";
+        }
+
+    private:
+        //! Identity of a process: (PID, start time)
+        typedef std::pair<scxulong, std::wstring> Identity;
+        //! Process list, by identity
+        typedef std::map<Identity, ProcessRecord> ProcessList;
+
+        //! A process list a token was issued for
+        struct Generation
+        {
+            Generation() : issued(0) {}
+
+            time_t issued;              //!< Last time a token was issued for the list
+            ProcessList processes;      //!< Processes
+        };
+
+        bool ParseToken(const std::wstring& token, scxulong& generation) const;
+        std::wstring MakeToken(scxulong generation) const;
+        void Prune(time_t now);
+
+        std::wstring m_instance;                        //!< Distinguishes the tokens of this tracker
+        scxulong m_nextGeneration;                      //!< Number of the next process list
+        std::map<scxulong, Generation> m_generations;   //!< Kept process lists, by number
+    };
+}
+
+#endif /* PROCESSCHANGETRACKER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,448 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        processeventtracker.cpp
+
+    \brief       Tracks process creation and exit from kernel events
+
+    \date        2026-10-19 18:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+
+#include "processeventtracker.h"
+#include "sysutils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(linux)
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/connector.h>
+#include <linux/cn_proc.h>
+#endif
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Thread parameter for the listening thread
+    class ProcessEventTrackerParam : public SCXThreadParam
+    {
+    public:
+        ProcessEventTrackerParam(SCXCore::ProcessEventTracker* tracker) : m_tracker(tracker) { }
+
+        SCXCore::ProcessEventTracker* m_tracker;
+    };
+
+#if defined(linux)
+    /*----------------------------------------------------------------------------*/
+    /**
+       Asks the kernel to start or stop sending process events to a socket.
+
+       \param[in]   fd       Process connector socket
+       \param[in]   listen   Start (true) or stop (false) sending events
+       \returns     true if the request was sent
+    */
+    bool SendMulticastOp(int fd, bool listen)
+    {
+        union
+        {
+            struct nlmsghdr hdr;
+            char buffer[NLMSG_SPACE(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op))];
+        } request;
+        memset(&request, 0, sizeof(request));
+
+        request.hdr.nlmsg_len = NLMSG_LENGTH(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op));
+        request.hdr.nlmsg_type = NLMSG_DONE;
+
+        struct cn_msg* msg = static_cast<struct cn_msg*>(NLMSG_DATA(&request.hdr));
+        msg->id.idx = CN_IDX_PROC;
+        msg->id.val = CN_VAL_PROC;
+        msg->len = sizeof(enum proc_cn_mcast_op);
+
+        enum proc_cn_mcast_op op = listen ? PROC_CN_MCAST_LISTEN : PROC_CN_MCAST_IGNORE;
+        memcpy(msg->data, &op, sizeof(op));
+
+        return send(fd, &request, request.hdr.nlmsg_len, 0) == static_cast<ssize_t>(request.hdr.nlmsg_len);
+    }
+
+    // Event types of struct proc_event (part of the kernel ABI).  The enum is
+    // nested in the struct in older headers, so it can't be named portably.
+    const unsigned int cProcEventFork = 0x00000001;
+    const unsigned int cProcEventExec = 0x00000002;
+    const unsigned int cProcEventExit = 0x80000000;
+#endif
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+    */
+    ProcessEventTracker::ProcessEventTracker()
+        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.process_provider.eventtracker")),
+          m_socket(-1),
+          m_running(false),
+          m_overrun(false),
+          m_eventCount(0)
+    {
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    ProcessEventTracker::~ProcessEventTracker()
+    {
+        Stop();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts listening for process events.
+
+       \returns     true if events are being received; false if the platform
+                    or privileges don't allow it
+    */
+    bool ProcessEventTracker::Start()
+    {
+        SCXConditionHandle h(m_cond);
+        if (m_running)
+        {
+            return true;
+        }
+        if (NULL != m_thread)
+        {
+            // Listening failed earlier; the thread has exited
+            h.Unlock();
+            Stop();
+            h.Lock();
+        }
+
+#if defined(linux)
+        m_socket = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_CONNECTOR);
+        if (m_socket < 0)
+        {
+            SCX_LOGINFO(m_log, StrAppend(L"Process connector not available, errno = ", errno));
+            return false;
+        }
+        SetCloseOnExec(m_socket);
+
+        struct sockaddr_nl address;
+        memset(&address, 0, sizeof(address));
+        address.nl_family = AF_NETLINK;
+        address.nl_groups = CN_IDX_PROC;
+        address.nl_pid = 0;             // Assigned by the kernel
+
+        if (bind(m_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0
+            || !SendMulticastOp(m_socket, true))
+        {
+            // Typically EPERM: binding to the connector group requires CAP_NET_ADMIN
+            SCX_LOGINFO(m_log, StrAppend(L"Unable to listen on the process connector, errno = ", errno));
+            CloseFd(m_socket);
+            return false;
+        }
+
+        if (!OpenWakePipe(m_wakeFds))
+        {
+            SCX_LOGWARNING(m_log, StrAppend(L"Unable to create pipe for process event thread, errno = ", errno));
+            CloseFd(m_socket);
+            return false;
+        }
+
+        m_running = true;
+        m_overrun = false;
+        m_changed.clear();
+        try
+        {
+            m_thread = new SCXThread(ListenBody, new ProcessEventTrackerParam(this));
+        }
+        catch (SCXException& e)
+        {
+            SCX_LOGWARNING(m_log, L"Unable to start process event thread: " + e.What());
+            m_running = false;
+            SendMulticastOp(m_socket, false);
+            CloseFd(m_socket);
+            ClosePipe(m_wakeFds);
+            return false;
+        }
+
+        SCX_LOGTRACE(m_log, L"Listening for process events");
+        return true;
+#else
+        SCX_LOGTRACE(m_log, L"Process events are not supported on this platform");
+        return false;
+#endif
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops listening for process events.
+    */
+    void ProcessEventTracker::Stop()
+    {
+        SCXHandle<SCXThread> thread;
+        {
+            SCXConditionHandle h(m_cond);
+            thread = m_thread;
+            WriteWakePipe(m_wakeFds);
+        }
+
+        if (NULL != thread)
+        {
+            thread->Wait();
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_thread = NULL;
+        m_running = false;
+#if defined(linux)
+        if (m_socket >= 0)
+        {
+            SendMulticastOp(m_socket, false);
+        }
+#endif
+        CloseFd(m_socket);
+        ClosePipe(m_wakeFds);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether process events are being received.
+    */
+    bool ProcessEventTracker::IsRunning()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_running;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether processes may have changed since the last call.
+
+       Processes are reported as changed whenever events aren't being received,
+       or some were lost.
+
+       \param[out]  changedCount   Number of processes known to have changed
+       \returns     true if processes may have changed
+    */
+    bool ProcessEventTracker::TakeChanges(size_t& changedCount)
+    {
+        SCXConditionHandle h(m_cond);
+        bool changed = !m_running || m_overrun || !m_changed.empty();
+
+        changedCount = m_changed.size();
+        m_changed.clear();
+        m_overrun = false;
+        return changed;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of process events received.
+    */
+    scxulong ProcessEventTracker::GetEventCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_eventCount;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Records that a process started, exec'd or exited.
+
+       \param[in]   pid   Process ID
+    */
+    void ProcessEventTracker::NoteEvent(pid_t pid)
+    {
+        SCXConditionHandle h(m_cond);
+        m_eventCount++;
+        if (m_changed.size() < cMaxChangedPids)
+        {
+            m_changed.insert(pid);
+        }
+        else
+        {
+            m_overrun = true;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Records that events were lost.
+    */
+    void ProcessEventTracker::NoteOverrun()
+    {
+        SCXConditionHandle h(m_cond);
+        m_overrun = true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Listening thread body.
+
+       \param[in]   param   ProcessEventTrackerParam
+    */
+    void ProcessEventTracker::ListenBody(SCXThreadParamHandle& param)
+    {
+        ProcessEventTrackerParam* p = static_cast<ProcessEventTrackerParam*>(param.GetData());
+        p->m_tracker->Listen();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives events until stopped, or the socket fails.
+    */
+    void ProcessEventTracker::Listen()
+    {
+        int socketFd, wakeFd;
+        {
+            SCXConditionHandle h(m_cond);
+            socketFd = m_socket;
+            wakeFd = m_wakeFds[0];
+        }
+
+        for (;;)
+        {
+            struct pollfd fds[2];
+            fds[0].fd = socketFd;
+            fds[0].events = POLLIN;
+            fds[0].revents = 0;
+            fds[1].fd = wakeFd;
+            fds[1].events = POLLIN;
+            fds[1].revents = 0;
+
+            if (poll(fds, 2, -1) < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                SCX_LOGERROR(m_log, StrAppend(L"Polling process connector failed, errno = ", errno));
+                break;
+            }
+            if (0 != fds[1].revents)
+            {
+                return;
+            }
+            if (0 != fds[0].revents)
+            {
+                ReceiveEvents();
+                if (!IsRunning())
+                {
+                    return;
+                }
+            }
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_running = false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads all queued events from the socket.
+    */
+    void ProcessEventTracker::ReceiveEvents()
+    {
+#if defined(linux)
+        union
+        {
+            struct nlmsghdr hdr;
+            char buffer[8192];
+        } message;
+
+        for (;;)
+        {
+            struct sockaddr_nl sender;
+            socklen_t senderLength = sizeof(sender);
+            ssize_t length = recvfrom(m_socket, &message, sizeof(message), MSG_DONTWAIT,
+                                      reinterpret_cast<struct sockaddr*>(&sender), &senderLength);
+            if (length < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                if (EAGAIN == errno || EWOULDBLOCK == errno)
+                {
+                    return;
+                }
+                if (ENOBUFS == errno)
+                {
+                    // The kernel dropped events; the next walk has to be a full one
+                    SCX_LOGTRACE(m_log, L"Process events were lost");
+                    NoteOverrun();
+                    continue;
+                }
+
+                SCX_LOGERROR(m_log, StrAppend(L"Receiving process events failed, errno = ", errno));
+                SCXConditionHandle h(m_cond);
+                m_running = false;
+                return;
+            }
+            if (0 != sender.nl_pid)
+            {
+                // Only the kernel sends process events
+                continue;
+            }
+
+            size_t remaining = static_cast<size_t>(length);
+            for (struct nlmsghdr* hdr = &message.hdr; NLMSG_OK(hdr, remaining); hdr = NLMSG_NEXT(hdr, remaining))
+            {
+                if (NLMSG_NOOP == hdr->nlmsg_type)
+                {
+                    continue;
+                }
+                if (NLMSG_ERROR == hdr->nlmsg_type || NLMSG_OVERRUN == hdr->nlmsg_type)
+                {
+                    NoteOverrun();
+                    continue;
+                }
+
+                const struct cn_msg* msg = static_cast<const struct cn_msg*>(NLMSG_DATA(hdr));
+                if (CN_IDX_PROC != msg->id.idx || CN_VAL_PROC != msg->id.val)
+                {
+                    continue;
+                }
+
+                // Thread events are ignored; only processes are enumerated
+                const struct proc_event* event = reinterpret_cast<const struct proc_event*>(msg->data);
+                switch (static_cast<unsigned int>(event->what))
+                {
+                case cProcEventFork:
+                    if (event->event_data.fork.child_pid == event->event_data.fork.child_tgid)
+                    {
+                        NoteEvent(event->event_data.fork.child_tgid);
+                    }
+                    break;
+                case cProcEventExec:
+                    NoteEvent(event->event_data.exec.process_tgid);
+                    break;
+                case cProcEventExit:
+                    if (event->event_data.exit.process_pid == event->event_data.exit.process_tgid)
+                    {
+                        NoteEvent(event->event_data.exit.process_tgid);
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+#endif
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
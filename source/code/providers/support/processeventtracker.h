@@ -0,0 +1,81 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        processeventtracker.h
+
+    \brief       Tracks process creation and exit from kernel events
+
+    On Linux, the kernel reports fork, exec, name changes and exits of all
+    processes on the netlink process connector.  A thread listening there
+    lets the process provider tell whether the process table can have changed
+    since it was last walked.  Listening requires CAP_NET_ADMIN; where it
+    isn't possible, processes are always reported as changed.
+
+    \date        2026-10-19 18:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef PROCESSEVENTTRACKER_H
+#define PROCESSEVENTTRACKER_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxthread.h>
+
+#include <set>
+#include <sys/types.h>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Listens for process events, and collects the processes that changed.
+    */
+    class ProcessEventTracker
+    {
+    public:
+        //! Changed processes remembered by PID; beyond this only the fact that something changed is kept
+        static const size_t cMaxChangedPids = 4096;
+
+        ProcessEventTracker();
+        virtual ~ProcessEventTracker();
+
+        bool Start();
+        void Stop();
+        bool IsRunning();
+
+        bool TakeChanges(size_t& changedCount);
+        scxulong GetEventCount();
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ProcessEventTracker";
+        }
+
+    protected:
+        void NoteEvent(pid_t pid);
+        void NoteOverrun();
+
+    private:
+        static void ListenBody(SCXCoreLib::SCXThreadParamHandle& param);
+        void Listen();
+        void ReceiveEvents();
+
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        SCXCoreLib::SCXCondition m_cond;                //!< Protects the members below
+        SCXCoreLib::SCXHandle<SCXCoreLib::SCXThread> m_thread; //!< Listening thread
+        int m_socket;                   //!< Process connector socket (-1 if not listening)
+        int m_wakeFds[2];               //!< Pipe used to stop the listening thread
+        bool m_running;                 //!< Events are being received
+        bool m_overrun;                 //!< Events were lost, or too many PIDs changed to remember
+        scxulong m_eventCount;          //!< Events received since started
+        std::set<pid_t> m_changed;      //!< PIDs changed since the changes were last taken
+    };
+}
+
+#endif /* PROCESSEVENTTRACKER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
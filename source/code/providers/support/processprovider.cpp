@@ -11,14 +11,20 @@
 /*----------------------------------------------------------------------------*/
 
 #include "processprovider.h"
+#include "providerconfig.h"
+#include "sysutils.h"
 #include <scxsystemlib/processenumeration.h>
 #include <scxcorelib/scxlog.h>
 #include <scxcorelib/scxcmn.h>
 #include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthread.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/scxtime.h>
 #include <scxcorelib/stringaid.h>
 
 #include <sstream>
 #include <algorithm>
+#include <map>
 #include <vector>
 
 using namespace SCXSystemLib;
@@ -51,7 +57,7 @@ namespace SCXCore
 
         \returns       true if value in p1 is greater then in p2
     */
-    static bool CompareProcSort(ProcessInstanceSort p1, ProcessInstanceSort p2)
+    static bool CompareProcSort(const ProcessInstanceSort& p1, const ProcessInstanceSort& p2)
     {
         return p1.value > p2.value;
     }
@@ -69,6 +75,26 @@ namespace SCXCore
             SCXASSERT( NULL == m_processes );
             m_processes = new ProcessEnumeration();
             m_processes->Init();
+
+            // Process event tracking is opt-in, configured in the config file
+            bool trackEvents = GetConfigBool(L"ProcessProvider_TrackEvents", false);
+            m_consistencySecs = static_cast<time_t>(GetConfigUInt(L"ProcessProvider_ConsistencySecs", cDefaultProcessConsistencySecs));
+
+            SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"ProcessProvider parameters: Track Events = ", trackEvents ? L"true" : L"false"),
+                                          StrAppend(L", Consistency Seconds = ", m_consistencySecs)));
+
+            m_changes = new ProcessChangeTracker();
+            m_lastFullUpdate = 0;
+            m_demand.Start(GetSamplingIdleSecs(), time(NULL));
+            if (trackEvents)
+            {
+                m_tracker = new ProcessEventTracker();
+                if (!m_tracker->Start())
+                {
+                    SCX_LOGINFO(m_log, L"Process events not available; processes are walked on every request");
+                    m_tracker = NULL;
+                }
+            }
         }
     }
 
@@ -79,6 +105,13 @@ namespace SCXCore
         SCXASSERT( ms_loadCount >= 1 );
         if ( 0 == --ms_loadCount )
         {
+            m_demand.Stop();
+            if (m_tracker != NULL)
+            {
+                m_tracker->Stop();
+                m_tracker = NULL;
+            }
+            m_changes = NULL;
             if (m_processes != NULL)
             {
                 m_processes->CleanUp();
@@ -87,111 +120,506 @@ namespace SCXCore
         }
     }
 
+    /*----------------------------------------------------------------------------*/
+    /**
+        Returns the process enumeration for a query, creating it again if it
+        was released while idle.
+
+        \param[in]     className     Class queried
+
+        \returns       Process enumeration
+    */
+    SCXHandle<ProcessEnumeration> ProcessProvider::GetProcessEnumerator(const std::wstring &className)
+    {
+        Queried(className);
+        return m_processes;
+    }
 
     /*----------------------------------------------------------------------------*/
     /**
-        Get the value for the spcified resource from a specified instance
+        Records a query, and creates the process enumeration again if it was
+        released while idle.  This never waits: until the warm-up is over,
+        the rates come from a single sample.
 
-        \param[in]     resource      Name of resource to get
-        \param[in]     processinst   Instance to get resource from
+        \param[in]     className     Class queried
+    */
+    void ProcessProvider::Queried(const std::wstring &className)
+    {
+        scxulong nowMs = GetMonotonicMilliseconds();
+        if (m_demand.Query(className, time(NULL)))
+        {
+            // Rates are computed between samples; the second one follows once it is due
+            m_processes = new ProcessEnumeration();
+            m_processes->Init();
+            m_processes->SampleData();
+            m_demand.StartWarmUp(nowMs);
+            m_lastFullUpdate = 0;
+        }
+        else if (m_demand.WarmUpDue(nowMs))
+        {
+            m_processes->SampleData();
+            m_lastFullUpdate = 0;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Records a query, and if it resumes sampling, waits for the second
+        sample to be due, so that the query itself takes it.  Called without
+        SCXCore::ProcessProvider::Lock, before a query that may wait.
+
+        \param[in]     className     Class queried
+    */
+    void ProcessProvider::WarmUp(const std::wstring &className)
+    {
+        scxulong waitMs;
+        {
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+            Queried(className);
+            waitMs = m_demand.GetWarmUpWaitMs(GetMonotonicMilliseconds());
+        }
+        if (waitMs > 0)
+        {
+            SCXThread::Sleep(waitMs);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Releases the process enumeration, which stops its sampling thread.
+    */
+    void ProcessProvider::SuspendSampling()
+    {
+        if (m_processes != NULL)
+        {
+            m_processes->CleanUp();
+            m_processes = NULL;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Decides whether the process enumeration has to be walked again.
+
+        Without process events, it always has to be.  With them, it only has
+        to be after processes started, exec'd or exited, and at least every
+        m_consistencySecs seconds to pick up anything the events don't cover.
+
+        The events only tell about processes coming and going, and the
+        enumeration reads the values of each process while walking, so a
+        request that reads values (memory, CPU times, rates) always walks.
 
-        \returns       Value for specifed resource
+        \param[in]     identityOnly  The request only needs which processes
+                                     exist and what they are
+        \returns      true if the enumeration should be updated
+    */
+    bool ProcessProvider::NeedsUpdate(bool identityOnly)
+    {
+        if (NULL == m_tracker)
+        {
+            return true;
+        }
+
+        // Take the changes before walking, so changes made during the walk are seen next time
+        size_t changedCount = 0;
+        bool changed = m_tracker->TakeChanges(changedCount);
+
+        time_t now = time(NULL);
+        if (!identityOnly || changed || 0 == m_lastFullUpdate || now < m_lastFullUpdate || now - m_lastFullUpdate >= m_consistencySecs)
+        {
+            SCX_LOGHYSTERICAL(m_log, StrAppend(L"ProcessProvider updating processes, changed: ", changedCount));
+            m_lastFullUpdate = now;
+            return true;
+        }
+
+        SCX_LOGHYSTERICAL(m_log, L"ProcessProvider processes unchanged since the last update");
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Updates the process enumeration, unless the request only needs the
+        identity of processes and they are known not to have changed.
 
-        \throws        SCXInternalErrorException    If given resource not handled
+        Callers hold the ProcessProvider lock.
+
+        \param[in]     identityOnly  The request only needs which processes
+                                     exist and what they are
     */
-    scxulong ProcessProvider::GetResource(const std::wstring &resource, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst)
+    void ProcessProvider::UpdateProcesses(bool identityOnly)
     {
+        if (NeedsUpdate(identityOnly))
+        {
+            m_processes->Update();
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the resource type for a resource name
+
+        \param[in]     resource      Name of resource (case insensitive)
 
-        scxulong res = 0;
-        bool gotResource = false;
+        \returns       Resource type
 
+        \throws        UnknownResourceException    If given resource not handled
+    */
+    ProcessProvider::Resource ProcessProvider::GetResourceType(const std::wstring &resource)
+    {
         if (StrCompare(resource, L"CPUTime", true) == 0)
         {
-            unsigned int cputime;
-            gotResource = processinst->GetCPUTime(cputime);
-            res = static_cast<scxulong>(cputime);
+            return eCPUTime;
         }
         else if (StrCompare(resource, L"BlockReadsPerSecond", true) == 0)
         {
-            gotResource = processinst->GetBlockReadsPerSecond(res);
+            return eBlockReadsPerSecond;
         }
         else if (StrCompare(resource, L"BlockWritesPerSecond", true) == 0)
         {
-            gotResource = processinst->GetBlockWritesPerSecond(res);
+            return eBlockWritesPerSecond;
         }
         else if (StrCompare(resource, L"BlockTransfersPerSecond", true) == 0)
         {
-            gotResource = processinst->GetBlockTransfersPerSecond(res);
+            return eBlockTransfersPerSecond;
         }
         else if (StrCompare(resource, L"PercentUserTime", true) == 0)
         {
-            gotResource = processinst->GetPercentUserTime(res);
+            return ePercentUserTime;
         }
         else if (StrCompare(resource, L"PercentPrivilegedTime", true) == 0)
         {
-            gotResource = processinst->GetPercentPrivilegedTime(res);
+            return ePercentPrivilegedTime;
         }
         else if (StrCompare(resource, L"UsedMemory", true) == 0)
         {
-            gotResource = processinst->GetUsedMemory(res);
+            return eUsedMemory;
         }
         else if (StrCompare(resource, L"PercentUsedMemory", true) == 0)
         {
-            gotResource = processinst->GetPercentUsedMemory(res);
+            return ePercentUsedMemory;
         }
         else if (StrCompare(resource, L"PagesReadPerSec", true) == 0)
         {
-            gotResource = processinst->GetPagesReadPerSec(res);
-        }
-        else
-        {
-            throw UnknownResourceException(resource, SCXSRCLOCATION);
+            return ePagesReadPerSec;
         }
 
-        if ( ! gotResource)
+        throw UnknownResourceException(resource, SCXSRCLOCATION);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the value for the spcified resource from a specified instance
+
+        \param[in]     resource      Resource to get
+        \param[in]     processinst   Instance to get resource from
+        \param[out]    value         Value for specifed resource
+
+        \returns       true if the value was available
+    */
+    bool ProcessProvider::GetResource(Resource resource, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst,
+                                      scxulong &value)
+    {
+        switch (resource)
         {
-            throw SCXInternalErrorException(StrAppend(L"GetResource: Failed to get resouce: ", resource), SCXSRCLOCATION);
+            case eCPUTime:
+            {
+                unsigned int cputime;
+                bool gotResource = processinst->GetCPUTime(cputime);
+                value = static_cast<scxulong>(cputime);
+                return gotResource;
+            }
+            case eBlockReadsPerSecond:
+                return processinst->GetBlockReadsPerSecond(value);
+            case eBlockWritesPerSecond:
+                return processinst->GetBlockWritesPerSecond(value);
+            case eBlockTransfersPerSecond:
+                return processinst->GetBlockTransfersPerSecond(value);
+            case ePercentUserTime:
+                return processinst->GetPercentUserTime(value);
+            case ePercentPrivilegedTime:
+                return processinst->GetPercentPrivilegedTime(value);
+            case eUsedMemory:
+                return processinst->GetUsedMemory(value);
+            case ePercentUsedMemory:
+                return processinst->GetPercentUsedMemory(value);
+            case ePagesReadPerSec:
+                return processinst->GetPagesReadPerSec(value);
         }
 
-        return res;
+        return false;
     }
 
-    void ProcessProvider::GetTopResourceConsumers(const std::wstring &resource, unsigned int count, std::wstring &result)
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the processes consuming the most of a resource
+
+        Only the top <count> entries are ordered, so this is linear in the
+        number of processes for small counts.
+
+        \param[in]     resource      Name of resource to rank processes by
+        \param[in]     count         Maximum number of processes to return
+        \param[in]     threshold     Only return processes with at least this value
+        \param[out]    result        Processes, largest value first
+
+        \throws        UnknownResourceException     If given resource not handled
+        \throws        SCXInternalErrorException    If a resource value is not available
+    */
+    void ProcessProvider::GetTopResourceConsumers(const std::wstring &resource, unsigned int count, scxulong threshold,
+                                                  std::vector<ResourceConsumer> &result)
     {
         SCX_LOGTRACE(m_log, L"SCXProcessProvider GetTopResourceConsumers");
 
-        std::wstringstream ss;
+        Resource resourceType = GetResourceType(resource);
         std::vector<ProcessInstanceSort> procsort;
 
+        Queried(L"SCX_UnixProcess");
+
         SCXCoreLib::SCXThreadLock lock(m_processes->GetLockHandle());
 
-        m_processes->UpdateNoLock(lock);
+        if (NeedsUpdate(false))
+        {
+            m_processes->UpdateNoLock(lock);
+        }
 
         // Build separate vector for sorting
+        procsort.reserve(m_processes->Size());
         for(size_t i=0; i<m_processes->Size(); i++)
         {
             ProcessInstanceSort p;
 
             p.procinst = m_processes->GetInstance(i);
-            p.value = GetResource(resource, p.procinst);
-            procsort.push_back(p);
+            if ( ! GetResource(resourceType, p.procinst, p.value))
+            {
+                throw SCXInternalErrorException(StrAppend(L"GetResource: Failed to get resouce: ", resource), SCXSRCLOCATION);
+            }
+            if (p.value >= threshold)
+            {
+                procsort.push_back(p);
+            }
         }
 
-        std::sort(procsort.begin(), procsort.end(), CompareProcSort);
+        size_t top = std::min(static_cast<size_t>(count), procsort.size());
+        std::partial_sort(procsort.begin(), procsort.begin() + top, procsort.end(), CompareProcSort);
+
+        result.clear();
+        result.resize(top);
+        for(size_t i=0; i<top; i++)
+        {
+            ResourceConsumer& consumer = result[i];
+
+            consumer.hasPID = procsort[i].procinst->GetPID(consumer.pid);
+            consumer.hasName = procsort[i].procinst->GetName(consumer.name);
+            consumer.value = procsort[i].value;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the grouping type for a grouping name
+
+        \param[in]     groupBy       Name of the grouping (case insensitive)
+
+        \returns       Grouping type
+
+        \throws        SCXInvalidArgumentException    If given grouping not handled
+    */
+    ProcessProvider::Grouping ProcessProvider::GetGroupingType(const std::wstring &groupBy)
+    {
+        if (StrCompare(groupBy, L"Name", true) == 0)
+        {
+            return eGroupByName;
+        }
+        else if (StrCompare(groupBy, L"RealUserID", true) == 0)
+        {
+            return eGroupByRealUserID;
+        }
+        else if (StrCompare(groupBy, L"ProcessGroupID", true) == 0)
+        {
+            return eGroupByProcessGroupID;
+        }
+
+        throw SCXInvalidArgumentException(L"groupBy", L"Unknown grouping: " + groupBy, SCXSRCLOCATION);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the key of the group a process belongs to
+
+        \param[in]     grouping      Grouping
+        \param[in]     processinst   Instance to get the key from
+
+        \returns       Name, real user ID or process group ID ("<unknown>" if not available)
+    */
+    std::string ProcessProvider::GetGroupKey(Grouping grouping, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst)
+    {
+        std::string key;
+        scxulong id;
+
+        switch (grouping)
+        {
+            case eGroupByName:
+                if (processinst->GetName(key))
+                {
+                    return key;
+                }
+                break;
+            case eGroupByRealUserID:
+                if (processinst->GetRealUserID(id))
+                {
+                    return StrToUTF8(StrFrom(id));
+                }
+                break;
+            case eGroupByProcessGroupID:
+                if (processinst->GetProcessGroupID(id))
+                {
+                    return StrToUTF8(StrFrom(id));
+                }
+                break;
+        }
+
+        return "<unknown>";
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Group the processes by name, real user ID or process group ID
+
+        Counts the processes of each group and sums their busy time, used
+        memory and block I/O rates, in a single walk of the processes.
+        Values a process doesn't have are left out of the sums.
+
+        \param[in]     groupBy       "Name", "RealUserID" or "ProcessGroupID" (case insensitive)
+        \param[out]    result        Groups, ordered by key
+
+        \throws        SCXInvalidArgumentException    If given grouping not handled
+    */
+    void ProcessProvider::AggregateProcesses(const std::wstring &groupBy, std::vector<ProcessGroup> &result)
+    {
+        SCX_LOGTRACE(m_log, L"SCXProcessProvider AggregateProcesses");
+
+        Grouping grouping = GetGroupingType(groupBy);
+        std::map<std::string, ProcessGroup> groups;
+
+        Queried(L"SCX_UnixProcess");
+
+        SCXCoreLib::SCXThreadLock lock(m_processes->GetLockHandle());
+
+        if (NeedsUpdate(false))
+        {
+            m_processes->UpdateNoLock(lock);
+        }
+
+        for(size_t i=0; i<m_processes->Size(); i++)
+        {
+            SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> procinst = m_processes->GetInstance(i);
+            ProcessGroup& group = groups[GetGroupKey(grouping, procinst)];
+            scxulong value;
+
+            group.count++;
+            if (procinst->GetPercentUserTime(value))
+            {
+                group.percentBusyTime += value;
+            }
+            if (procinst->GetPercentPrivilegedTime(value))
+            {
+                group.percentBusyTime += value;
+            }
+            if (procinst->GetUsedMemory(value))
+            {
+                group.usedMemory += value;
+            }
+            if (procinst->GetBlockReadsPerSecond(value))
+            {
+                group.blockReadsPerSecond += value;
+            }
+            if (procinst->GetBlockWritesPerSecond(value))
+            {
+                group.blockWritesPerSecond += value;
+            }
+        }
+
+        result.clear();
+        result.reserve(groups.size());
+        for (std::map<std::string, ProcessGroup>::iterator it = groups.begin(); it != groups.end(); ++it)
+        {
+            result.push_back(it->second);
+            result.back().key = it->first;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Get the processes that started, exited or changed since a change token
+
+        \param[in]     token         Token returned by an earlier call (empty for the first call)
+        \param[out]    changes       Processes that started, exited or changed since the token
+                                     (every process, as started, on a full resync)
+        \param[out]    nextToken     Token to pass to the next call
+
+        \returns       true if the token couldn't be used, so this is a full resync
+    */
+    bool ProcessProvider::GetProcessChanges(const std::wstring &token, std::vector<ProcessChange> &changes, std::wstring &nextToken)
+    {
+        SCX_LOGTRACE(m_log, L"SCXProcessProvider GetProcessChanges");
+
+        std::vector<ProcessRecord> processes;
+        Queried(L"SCX_UnixProcess");
+
+        {
+            SCXCoreLib::SCXThreadLock lock(m_processes->GetLockHandle());
+
+            if (NeedsUpdate(true))
+            {
+                m_processes->UpdateNoLock(lock);
+            }
+
+            processes.reserve(m_processes->Size());
+            for(size_t i=0; i<m_processes->Size(); i++)
+            {
+                SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> procinst = m_processes->GetInstance(i);
+                ProcessRecord record;
+                SCXCoreLib::SCXCalendarTime startTime;
+
+                if ( ! procinst->GetPID(record.pid))
+                {
+                    continue;
+                }
+                if (procinst->GetCreationDate(startTime))
+                {
+                    record.startTime = startTime.ToExtendedISO8601();
+                }
+                procinst->GetName(record.name);
+                procinst->GetExecutionState(record.executionState);
+                processes.push_back(record);
+            }
+        }
+
+        bool fullResync = m_changes->GetChanges(processes, token, time(NULL), changes, nextToken);
+        if (fullResync && !token.empty())
+        {
+            SCX_LOGTRACE(m_log, L"SCXProcessProvider GetProcessChanges: change token not known, full resync");
+        }
+        return fullResync;
+    }
+
+    void ProcessProvider::GetTopResourceConsumers(const std::wstring &resource, unsigned int count, std::wstring &result)
+    {
+        std::wstringstream ss;
+        std::vector<ResourceConsumer> consumers;
+
+        GetTopResourceConsumers(resource, count, 0, consumers);
 
         ss << std::endl << L"PID   Name                 " << resource << std::endl;
         ss << L"-------------------------------------------------------------" << std::endl;
 
-        for(size_t i=0; i<procsort.size() && i<count; i++)
+        for(size_t i=0; i<consumers.size(); i++)
         {
-            const ProcessInstanceSort* processinst = &procsort[i];
-
-            scxulong pid;
+            const ResourceConsumer& consumer = consumers[i];
 
             ss.width(5);
-            if (processinst->procinst->GetPID(pid))
+            if (consumer.hasPID)
             {
-                ss << pid;
+                ss << consumer.pid;
             }
             else
             {
@@ -199,12 +627,11 @@ namespace SCXCore
             }
             ss << L" ";
 
-            std::string name;
             ss.setf(std::ios_base::left);
             ss.width(20);
-            if (processinst->procinst->GetName(name))
+            if (consumer.hasName)
             {
-                ss << StrFromMultibyte(name);
+                ss << StrFromMultibyte(consumer.name);
             }
             else
             {
@@ -214,7 +641,7 @@ namespace SCXCore
             ss << L" ";
 
             ss.width(10);
-            ss << processinst->value;
+            ss << consumer.value;
 
             ss << std::endl;
         }
@@ -16,13 +16,45 @@
 #include <scxcorelib/scxlog.h>
 #include <scxsystemlib/processenumeration.h>
 #include "startuplog.h"
+#include "processchangetracker.h"
+#include "processeventtracker.h"
+#include "samplingdemand.h"
+
+#include <string>
+#include <vector>
+#include <time.h>
 
 using namespace SCXCoreLib;
 using namespace SCXSystemLib;
 
 namespace SCXCore
 {
-    class ProcessProvider
+    //! Default maximum seconds between full process walks when tracking process events
+    const time_t cDefaultProcessConsistencySecs = 30;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Process provider
+
+       Processes are walked again on every request, unless
+       "ProcessProvider_TrackEvents" is true (configuration file setting) and
+       kernel process events can be received.  Then requests for the identity
+       of processes (SCX_UnixProcess instances and EnumerateChanges) only walk
+       them after a process started, exec'd or exited, or when the last walk
+       is "ProcessProvider_ConsistencySecs" seconds old.
+
+       The walk is also what reads the values of each process, so requests
+       for values (SCX_UnixProcessStatisticalInformation, TopResourceConsumers
+       and AggregateProcesses) always walk.  The other values of SCX_UnixProcess
+       instances, like memory use and state, may be up to
+       "ProcessProvider_ConsistencySecs" seconds stale.
+
+       The process enumeration is released while it isn't queried (see
+       SamplingDemand).
+
+       All methods but WarmUp() must be called with SCXCore::ProcessProvider::Lock held.
+    */
+    class ProcessProvider : public SuspendableSampler
     {
     public:
         /*----------------------------------------------------------------------------*/
@@ -56,24 +88,101 @@ namespace SCXCore
             std::wstring   m_resource;
         };
 
-        ProcessProvider() : m_processes(NULL) { }
+        /*----------------------------------------------------------------------------*/
+        /**
+            One entry of a TopResourceConsumers result.
+        */
+        struct ResourceConsumer
+        {
+            ResourceConsumer() : pid(0), hasPID(false), hasName(false), value(0) { }
+
+            scxulong pid;           //!< Process ID (valid if hasPID)
+            bool hasPID;            //!< Was the process ID available?
+            std::string name;       //!< Process name (valid if hasName)
+            bool hasName;           //!< Was the process name available?
+            scxulong value;         //!< Value of the requested resource
+        };
+
+        /*----------------------------------------------------------------------------*/
+        /**
+            One group of an AggregateProcesses result.
+        */
+        struct ProcessGroup
+        {
+            ProcessGroup() : count(0), percentBusyTime(0), usedMemory(0),
+                             blockReadsPerSecond(0), blockWritesPerSecond(0) { }
+
+            std::string key;                //!< Name, real user ID or process group ID shared by the group
+            scxulong count;                 //!< Number of processes in the group
+            scxulong percentBusyTime;       //!< Sum of the percent user + privileged time
+            scxulong usedMemory;            //!< Sum of the used memory, in kilobytes
+            scxulong blockReadsPerSecond;   //!< Sum of the block reads per second
+            scxulong blockWritesPerSecond;  //!< Sum of the block writes per second
+        };
+
+        ProcessProvider() : m_processes(NULL), m_consistencySecs(cDefaultProcessConsistencySecs), m_lastFullUpdate(0),
+                            m_demand(L"ProcessProvider", L"SCXCore::ProcessProvider::Lock", this) { }
         virtual ~ProcessProvider() { };
         
         void Load();
         void Unload();
-        SCXHandle<SCXSystemLib::ProcessEnumeration> GetProcessEnumerator() { return m_processes; }
+        SCXHandle<SCXSystemLib::ProcessEnumeration> GetProcessEnumerator(const std::wstring &className);
+        void WarmUp(const std::wstring &className);
         SCXLogHandle& GetLogHandle(){ return m_log; }
+        void UpdateProcesses(bool identityOnly);
 
         void GetTopResourceConsumers(const std::wstring &resource, unsigned int count, std::wstring &result);
+        void GetTopResourceConsumers(const std::wstring &resource, unsigned int count, scxulong threshold,
+                                     std::vector<ResourceConsumer> &result);
+        void AggregateProcesses(const std::wstring &groupBy, std::vector<ProcessGroup> &result);
+        bool GetProcessChanges(const std::wstring &token, std::vector<ProcessChange> &changes, std::wstring &nextToken);
+        virtual void SuspendSampling();
 
     private:
         //! PAL implementation retrieving processes information for local host
         SCXCoreLib::SCXHandle<SCXSystemLib::ProcessEnumeration> m_processes;
 
+        //! Process events, when tracked (only walk processes again after they changed)
+        SCXCoreLib::SCXHandle<ProcessEventTracker> m_tracker;
+        time_t m_consistencySecs;       //!< Maximum seconds between full walks while tracking
+        time_t m_lastFullUpdate;        //!< Time of the last full walk (0 if none)
+        //! Process lists of the change tokens issued by GetProcessChanges
+        SCXCoreLib::SCXHandle<ProcessChangeTracker> m_changes;
+        //! Queries of the process enumeration, to release it while idle
+        SamplingDemand m_demand;
+
         static int ms_loadCount;
         SCXCoreLib::SCXLogHandle m_log; //!< Handle to log file.
 
-        scxulong GetResource(const std::wstring &resource, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst);
+        //! Resources that processes can be ranked by
+        enum Resource
+        {
+            eCPUTime,
+            eBlockReadsPerSecond,
+            eBlockWritesPerSecond,
+            eBlockTransfersPerSecond,
+            ePercentUserTime,
+            ePercentPrivilegedTime,
+            eUsedMemory,
+            ePercentUsedMemory,
+            ePagesReadPerSec
+        };
+
+        //! Process properties that processes can be grouped by
+        enum Grouping
+        {
+            eGroupByName,
+            eGroupByRealUserID,
+            eGroupByProcessGroupID
+        };
+
+        bool NeedsUpdate(bool identityOnly);
+        void Queried(const std::wstring &className);
+
+        Resource GetResourceType(const std::wstring &resource);
+        bool GetResource(Resource resource, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst, scxulong &value);
+        Grouping GetGroupingType(const std::wstring &groupBy);
+        std::string GetGroupKey(Grouping grouping, SCXCoreLib::SCXHandle<SCXSystemLib::ProcessInstance> processinst);
     };
 
     extern ProcessProvider g_ProcessProvider;
@@ -0,0 +1,96 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        providerconfig.cpp
+
+    \brief       Reading of provider settings from the configuration file
+
+    \date        2026-10-21 10:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxconfigfile.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+
+#include "providerconfig.h"
+#include "startuplog.h"
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Looks up a setting in the configuration file.
+
+       \param[in]   name    Name of the setting (like "MemoryProvider_RefreshSecs")
+       \param[out]  value   Value of the setting, if set
+       \returns     true if the file exists and has the setting
+    */
+    bool GetConfigValue(const std::wstring& name, std::wstring& value)
+    {
+        SCXConfigFile conf(SCXCore::SCXConfFile);
+        try {
+            conf.LoadConfig();
+        }
+        catch (SCXFilePathNotFoundException &e)
+        {
+            return false;
+        }
+
+        return conf.GetValue(name, value);
+    }
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns an unsigned setting from the configuration file.
+
+       \param[in]   name           Name of the setting
+       \param[in]   defaultValue   Returned if the setting is missing or malformed
+       \returns     Value of the setting
+    */
+    scxulong GetConfigUInt(const std::wstring& name, scxulong defaultValue)
+    {
+        std::wstring value;
+        if (GetConfigValue(name, value))
+        {
+            try {
+                return StrToULong(value);
+            }
+            catch (SCXNotSupportedException &e)
+            {
+                // Malformed setting; keep the default
+            }
+        }
+
+        return defaultValue;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns a boolean setting ("true" or "false", in any case) from the
+       configuration file.
+
+       \param[in]   name           Name of the setting
+       \param[in]   defaultValue   Returned if the setting is missing
+       \returns     Value of the setting
+    */
+    bool GetConfigBool(const std::wstring& name, bool defaultValue)
+    {
+        std::wstring value;
+        if (GetConfigValue(name, value))
+        {
+            return 0 == StrCompare(StrTrim(value), L"true", true);
+        }
+
+        return defaultValue;
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
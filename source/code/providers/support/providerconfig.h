@@ -0,0 +1,28 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        providerconfig.h
+
+    \brief       Reading of provider settings from the configuration file
+
+    \date        2026-10-21 10:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef PROVIDERCONFIG_H
+#define PROVIDERCONFIG_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <string>
+
+namespace SCXCore
+{
+    scxulong GetConfigUInt(const std::wstring& name, scxulong defaultValue);
+    bool GetConfigBool(const std::wstring& name, bool defaultValue);
+}
+
+#endif /* PROVIDERCONFIG_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
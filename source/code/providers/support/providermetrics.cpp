@@ -0,0 +1,315 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        providermetrics.cpp
+
+    \brief       Always-on latency and throughput counters for provider operations
+
+    \date        2026-10-19 10:05:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "providermetrics.h"
+#include "sysutils.h"
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Upper bounds (exclusive, in microseconds) of all but the last latency bucket
+    const scxulong cLatencyBucketBounds[] = {
+        1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000 };
+
+    //! Display names of the latency buckets
+    const wchar_t* const cLatencyBucketNames[] = {
+        L"<1ms", L"<5ms", L"<10ms", L"<50ms", L"<100ms", L"<500ms", L"<1s", L"<5s", L">=5s" };
+
+    //! Name of lock protecting the registry (and the counters where atomics are unavailable)
+    const wchar_t* const cMetricsLockName = L"SCXCore::ProviderMetrics::Lock";
+
+#if defined(__GNUC__)
+    inline void AtomicAdd(volatile scxulong& counter, scxulong value)
+    {
+        __sync_fetch_and_add(&counter, value);
+    }
+
+    inline void AtomicMax(volatile scxulong& counter, scxulong value)
+    {
+        scxulong current = counter;
+        while (value > current)
+        {
+            scxulong previous = __sync_val_compare_and_swap(&counter, current, value);
+            if (previous == current)
+            {
+                break;
+            }
+            current = previous;
+        }
+    }
+#endif
+}
+
+namespace SCXCore
+{
+    ProviderMetrics g_ProviderMetrics;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Default constructor
+    */
+    ProviderOperationStatistics::ProviderOperationStatistics()
+        : m_calls(0),
+          m_failures(0),
+          m_instances(0),
+          m_totalMicroseconds(0),
+          m_maxMicroseconds(0)
+    {
+        for (size_t i = 0; i < cLatencyBuckets; i++)
+        {
+            m_latencyBuckets[i] = 0;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Records a completed call of the operation.
+
+       \param[in]   elapsedMicroseconds   Latency of the call
+       \param[in]   instances             Number of instances posted by the call
+       \param[in]   failed                true if the call terminated with an exception
+    */
+    void ProviderOperationStatistics::Record(scxulong elapsedMicroseconds, scxulong instances, bool failed)
+    {
+        size_t bucket = GetLatencyBucketIndex(elapsedMicroseconds);
+
+#if defined(__GNUC__)
+        AtomicAdd(m_calls, 1);
+        if (failed)
+        {
+            AtomicAdd(m_failures, 1);
+        }
+        AtomicAdd(m_instances, instances);
+        AtomicAdd(m_totalMicroseconds, elapsedMicroseconds);
+        AtomicMax(m_maxMicroseconds, elapsedMicroseconds);
+        AtomicAdd(m_latencyBuckets[bucket], 1);
+#else
+        SCXThreadLock lock(ThreadLockHandleGet(cMetricsLockName));
+
+        m_calls++;
+        if (failed)
+        {
+            m_failures++;
+        }
+        m_instances += instances;
+        m_totalMicroseconds += elapsedMicroseconds;
+        if (elapsedMicroseconds > m_maxMicroseconds)
+        {
+            m_maxMicroseconds = elapsedMicroseconds;
+        }
+        m_latencyBuckets[bucket]++;
+#endif
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the histogram bucket a latency falls into.
+
+       \param[in]   elapsedMicroseconds   Latency of a call
+       \returns     Bucket index in the range [0, cLatencyBuckets)
+    */
+    size_t ProviderOperationStatistics::GetLatencyBucketIndex(scxulong elapsedMicroseconds)
+    {
+        size_t bucket = 0;
+        while (bucket < cLatencyBuckets - 1 && elapsedMicroseconds >= cLatencyBucketBounds[bucket])
+        {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the display name of a histogram bucket (e.g. "<10ms").
+
+       \param[in]   bucket   Bucket index
+       \returns     Bucket name, or empty string if index is out of range
+    */
+    std::wstring ProviderOperationStatistics::GetLatencyBucketName(size_t bucket)
+    {
+        if (bucket >= cLatencyBuckets)
+        {
+            return L"";
+        }
+        return cLatencyBucketNames[bucket];
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds to the counter.
+
+       \param[in]   value   Amount to add
+    */
+    void ProviderCounter::Increment(scxulong value)
+    {
+#if defined(__GNUC__)
+        AtomicAdd(m_value, value);
+#else
+        SCXThreadLock lock(ThreadLockHandleGet(cMetricsLockName));
+        m_value += value;
+#endif
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Default constructor
+    */
+    ProviderMetrics::ProviderMetrics()
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    ProviderMetrics::~ProviderMetrics()
+    {
+        for (std::map<std::wstring, ProviderOperationStatistics*>::iterator it = m_statistics.begin();
+             it != m_statistics.end(); ++it)
+        {
+            delete it->second;
+        }
+        for (std::map<std::wstring, ProviderCounter*>::iterator it = m_counters.begin();
+             it != m_counters.end(); ++it)
+        {
+            delete it->second;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the counters for an operation, creating them on first use.
+
+       The returned reference stays valid for the life of the registry, so
+       callers may cache it (SCX_PEX_BEGIN_TIMED does so in a function static).
+
+       \param[in]   operation   Operation name ("<provider class>::<operation>")
+       \returns     Counters for the operation
+    */
+    ProviderOperationStatistics& ProviderMetrics::GetStatistics(const std::wstring& operation)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cMetricsLockName));
+
+        std::map<std::wstring, ProviderOperationStatistics*>::iterator it = m_statistics.find(operation);
+        if (it == m_statistics.end())
+        {
+            it = m_statistics.insert(std::make_pair(operation, new ProviderOperationStatistics())).first;
+        }
+        return *it->second;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns an event counter, creating it on first use.
+
+       As with GetStatistics(), the returned reference stays valid for the
+       life of the registry.
+
+       \param[in]   name   Counter name ("<component>::<event>")
+       \returns     The counter
+    */
+    ProviderCounter& ProviderMetrics::GetCounter(const std::wstring& name)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cMetricsLockName));
+
+        std::map<std::wstring, ProviderCounter*>::iterator it = m_counters.find(name);
+        if (it == m_counters.end())
+        {
+            it = m_counters.insert(std::make_pair(name, new ProviderCounter())).first;
+        }
+        return *it->second;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Formats the counters of all operations called so far, one string per
+       operation, in the form:
+
+         <operation>;Calls=n;Failures=n;Instances=n;TotalMicroseconds=n;MaxMicroseconds=n;Histogram=<1ms:n,<5ms:n,...
+
+       followed by one string per event counter:
+
+         <counter>;Count=n
+
+       \param[out]  metrics   Formatted counters, each kind sorted by name
+    */
+    void ProviderMetrics::GetMetrics(std::vector<std::wstring>& metrics)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cMetricsLockName));
+
+        metrics.clear();
+        for (std::map<std::wstring, ProviderOperationStatistics*>::const_iterator it = m_statistics.begin();
+             it != m_statistics.end(); ++it)
+        {
+            const ProviderOperationStatistics& stats = *it->second;
+
+            std::wstring line(it->first);
+            line.append(L";Calls=").append(StrFrom(stats.GetCalls()));
+            line.append(L";Failures=").append(StrFrom(stats.GetFailures()));
+            line.append(L";Instances=").append(StrFrom(stats.GetInstances()));
+            line.append(L";TotalMicroseconds=").append(StrFrom(stats.GetTotalMicroseconds()));
+            line.append(L";MaxMicroseconds=").append(StrFrom(stats.GetMaxMicroseconds()));
+            line.append(L";Histogram=");
+            for (size_t i = 0; i < ProviderOperationStatistics::cLatencyBuckets; i++)
+            {
+                if (i > 0)
+                {
+                    line.append(L",");
+                }
+                line.append(ProviderOperationStatistics::GetLatencyBucketName(i));
+                line.append(L":").append(StrFrom(stats.GetLatencyBucket(i)));
+            }
+
+            metrics.push_back(line);
+        }
+
+        for (std::map<std::wstring, ProviderCounter*>::const_iterator it = m_counters.begin();
+             it != m_counters.end(); ++it)
+        {
+            metrics.push_back(std::wstring(it->first).append(L";Count=").append(StrFrom(it->second->Get())));
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor; starts timing the operation.
+
+       \param[in]   statistics   Counters to record the operation in
+    */
+    ProviderOperationTimer::ProviderOperationTimer(ProviderOperationStatistics& statistics)
+        : m_statistics(statistics),
+          m_startMicroseconds(GetMonotonicMicroseconds()),
+          m_instances(0),
+          m_failed(false)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor; records the operation.
+    */
+    ProviderOperationTimer::~ProviderOperationTimer()
+    {
+        scxulong now = GetMonotonicMicroseconds();
+
+        // The time of day (used without a monotonic clock) may have been stepped backwards during the call
+        scxulong elapsed = (now > m_startMicroseconds) ? now - m_startMicroseconds : 0;
+        m_statistics.Record(elapsed, m_instances, m_failed);
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
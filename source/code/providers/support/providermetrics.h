@@ -0,0 +1,137 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        providermetrics.h
+
+    \brief       Always-on latency and throughput counters for provider operations
+
+    Each provider operation (EnumerateInstances, GetInstance, Invoke_*) that
+    is wrapped with SCX_PEX_BEGIN_TIMED / SCX_PEX_END_TIMED records its call
+    count, latency histogram, number of instances posted and number of
+    exceptions.  The counters are published through the SCX_Agent class.
+
+    \date        2026-10-19 10:05:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef PROVIDERMETRICS_H
+#define PROVIDERMETRICS_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Counters for a single provider operation.
+
+       Counters are only ever incremented (never reset), and are updated with
+       atomic operations (where the compiler provides them) so that recording
+       a call takes no lock.
+    */
+    class ProviderOperationStatistics
+    {
+    public:
+        //! Number of latency histogram buckets
+        static const size_t cLatencyBuckets = 9;
+
+        ProviderOperationStatistics();
+
+        void Record(scxulong elapsedMicroseconds, scxulong instances, bool failed);
+
+        scxulong GetCalls() const { return m_calls; }
+        scxulong GetFailures() const { return m_failures; }
+        scxulong GetInstances() const { return m_instances; }
+        scxulong GetTotalMicroseconds() const { return m_totalMicroseconds; }
+        scxulong GetMaxMicroseconds() const { return m_maxMicroseconds; }
+        scxulong GetLatencyBucket(size_t bucket) const { return m_latencyBuckets[bucket]; }
+
+        static size_t GetLatencyBucketIndex(scxulong elapsedMicroseconds);
+        static std::wstring GetLatencyBucketName(size_t bucket);
+
+    private:
+        volatile scxulong m_calls;              //!< Number of completed calls
+        volatile scxulong m_failures;           //!< Number of calls that threw an exception
+        volatile scxulong m_instances;          //!< Number of instances posted
+        volatile scxulong m_totalMicroseconds;  //!< Sum of call latencies
+        volatile scxulong m_maxMicroseconds;    //!< Slowest call seen
+        volatile scxulong m_latencyBuckets[cLatencyBuckets]; //!< Latency histogram
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       A single event counter (cache hits, evictions and so on) that is
+       published along with the operation counters.
+    */
+    class ProviderCounter
+    {
+    public:
+        ProviderCounter() : m_value(0) { }
+
+        void Increment(scxulong value = 1);
+        scxulong Get() const { return m_value; }
+
+    private:
+        volatile scxulong m_value;  //!< Current count
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Registry of operation counters, keyed by "<provider class>::<operation>",
+       and of event counters, keyed by "<component>::<event>".
+    */
+    class ProviderMetrics
+    {
+    public:
+        ProviderMetrics();
+        ~ProviderMetrics();
+
+        ProviderOperationStatistics& GetStatistics(const std::wstring& operation);
+        ProviderCounter& GetCounter(const std::wstring& name);
+        void GetMetrics(std::vector<std::wstring>& metrics);
+
+    private:
+        //! Not implemented (registry is a singleton)
+        ProviderMetrics(const ProviderMetrics&);
+        ProviderMetrics& operator=(const ProviderMetrics&);
+
+        std::map<std::wstring, ProviderOperationStatistics*> m_statistics;
+        std::map<std::wstring, ProviderCounter*> m_counters;
+    };
+
+    extern ProviderMetrics g_ProviderMetrics;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Measures a single provider operation from construction to destruction
+       and records the result in the operation's statistics.
+    */
+    class ProviderOperationTimer
+    {
+    public:
+        explicit ProviderOperationTimer(ProviderOperationStatistics& statistics);
+        ~ProviderOperationTimer();
+
+        void AddInstances(size_t count) { m_instances += count; }
+        void SetFailed() { m_failed = true; }
+
+    private:
+        //! Not implemented
+        ProviderOperationTimer(const ProviderOperationTimer&);
+        ProviderOperationTimer& operator=(const ProviderOperationTimer&);
+
+        ProviderOperationStatistics& m_statistics;
+        scxulong m_startMicroseconds;
+        scxulong m_instances;
+        bool m_failed;
+    };
+}
+
+#endif /* PROVIDERMETRICS_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
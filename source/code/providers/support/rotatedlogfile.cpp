@@ -0,0 +1,492 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        rotatedlogfile.cpp
+
+    \brief       Reads the unread end of a rotated (possibly compressed) log file
+
+    \date        2026-10-19 21:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/stringaid.h>
+
+#include "rotatedlogfile.h"
+#include "sysutils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Read buffer size (the most memory a rotated file is read with, apart from a line)
+    const size_t cReadBufferSize = 64 * 1024;
+
+    //! Rotated files that can be the predecessor of a log file, newest first
+    const struct
+    {
+        const char* suffix;
+        SCXCore::RotatedLogFile::Compression compression;
+    } cPredecessors[] =
+    {
+        { ".1",    SCXCore::RotatedLogFile::eUncompressed },
+        { ".1.gz", SCXCore::RotatedLogFile::eGzip },
+        { ".1.xz", SCXCore::RotatedLogFile::eXz }
+    };
+
+    //! Directories searched for the decompressors (never PATH, which comes from the caller's environment)
+    const char* const cDecompressorDirs[] = { "/bin", "/usr/bin" };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Finds a decompressor in the trusted directories.
+
+       \param[in]   program   Name of the decompressor
+       \param[out]  path      Absolute path of the decompressor
+       \returns     true if found
+    */
+    bool FindDecompressor(const char* program, std::string& path)
+    {
+        for (size_t i = 0; i < sizeof(cDecompressorDirs) / sizeof(cDecompressorDirs[0]); i++)
+        {
+            path = std::string(cDecompressorDirs[i]) + "/" + program;
+            if (0 == access(path.c_str(), X_OK))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Finds the rotated predecessor of a log file that was read up to a position.
+
+       An uncompressed predecessor is recognized by the inode the log file had
+       (rotation by renaming) or by the fingerprint (rotation by copying); a
+       compressed one by the fingerprint only.
+
+       \param[in]   logfile       Log file that was rotated
+       \param[in]   stIno         Inode of the log file when last read
+       \param[in]   pos           Position reached in the log file
+       \param[in]   fingerprint   Fingerprint of the bytes before pos (may be empty)
+       \returns     Predecessor, opened at pos (NULL if none was found)
+    */
+    SCXHandle<RotatedLogFile> RotatedLogFile::FindPredecessor(
+        const SCXFilePath& logfile,
+        scxulong stIno,
+        std::streamoff pos,
+        const std::wstring& fingerprint)
+    {
+        std::string base = StrToUTF8(logfile.Get());
+
+        for (size_t i = 0; i < sizeof(cPredecessors) / sizeof(cPredecessors[0]); i++)
+        {
+            std::string path = base + cPredecessors[i].suffix;
+            struct stat st;
+            if (0 != stat(path.c_str(), &st))
+            {
+                continue;
+            }
+
+            bool sameInode = (eUncompressed == cPredecessors[i].compression && static_cast<scxulong>(st.st_ino) == stIno);
+            if (!sameInode && fingerprint.empty())
+            {
+                continue;
+            }
+
+            SCXHandle<RotatedLogFile> file(new RotatedLogFile(StrFromUTF8(path), cPredecessors[i].compression));
+            if (file->Open(pos, sameInode ? L"" : fingerprint))
+            {
+                return file;
+            }
+        }
+
+        return SCXHandle<RotatedLogFile>(0);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Computes the fingerprint of the bytes before a position.
+
+       \param[in]   bytes   Bytes before the position (at most cFingerprintBytes)
+       \returns     Fingerprint (64-bit FNV-1a hash, in hex)
+    */
+    std::wstring RotatedLogFile::ComputeFingerprint(const std::string& bytes)
+    {
+        scxulong hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < bytes.size(); i++)
+        {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= 1099511628211ULL;
+        }
+
+        std::wostringstream ss;
+        ss << std::hex << std::setfill(L'0') << std::setw(16) << hash;
+        return ss.str();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the fingerprint of the bytes before a position of an uncompressed file.
+
+       \param[in]   file   File to read
+       \param[in]   pos    Position
+       \returns     Fingerprint (empty if the bytes couldn't be read)
+    */
+    std::wstring RotatedLogFile::ReadFingerprint(const SCXFilePath& file, std::streamoff pos)
+    {
+        if (pos < 0)
+        {
+            return L"";
+        }
+
+        int fd = open(StrToUTF8(file.Get()).c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return L"";
+        }
+
+        size_t count = (pos < static_cast<std::streamoff>(cFingerprintBytes)) ? static_cast<size_t>(pos) : cFingerprintBytes;
+        std::string bytes(count, '\0');
+        ssize_t got = (0 == count) ? 0 : pread(fd, &bytes[0], count, static_cast<off_t>(pos - count));
+        close(fd);
+
+        if (got != static_cast<ssize_t>(count))
+        {
+            return L"";
+        }
+        return ComputeFingerprint(bytes);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   path          Rotated log file
+       \param[in]   compression   Compression of the file
+    */
+    RotatedLogFile::RotatedLogFile(const SCXFilePath& path, Compression compression)
+        : m_path(path),
+          m_compression(compression),
+          m_fd(-1),
+          m_pid(0),
+          m_buffer(cReadBufferSize),
+          m_begin(0),
+          m_end(0),
+          m_eof(false),
+          m_pos(0),
+          m_bytesRead(0),
+          m_startMs(0),
+          m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.logfileprovider.rotatedlogfile"))
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    RotatedLogFile::~RotatedLogFile()
+    {
+        Close();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Opens the file and skips to a position.
+
+       \param[in]   pos           Position to read from
+       \param[in]   fingerprint   Fingerprint the bytes before pos must have (empty to not check)
+       \returns     false if the file couldn't be read up to pos, or the fingerprint differs
+    */
+    bool RotatedLogFile::Open(std::streamoff pos, const std::wstring& fingerprint)
+    {
+        if (pos < 0 || !Start())
+        {
+            return false;
+        }
+
+        // An uncompressed file can seek to just before the bytes of the fingerprint
+        std::streamoff skip = pos;
+        if (eUncompressed == m_compression)
+        {
+            std::streamoff back = (pos < static_cast<std::streamoff>(cFingerprintBytes)) ? pos : static_cast<std::streamoff>(cFingerprintBytes);
+            if (lseek(m_fd, static_cast<off_t>(pos - back), SEEK_SET) < 0)
+            {
+                Close();
+                return false;
+            }
+            m_pos = pos - back;
+            skip = back;
+        }
+
+        if (!Skip(skip) || (!fingerprint.empty() && GetFingerprint() != fingerprint))
+        {
+            SCX_LOGTRACE(m_log, StrAppend(L"RotatedLogFile - Not the predecessor: ", m_path.Get()));
+            Close();
+            return false;
+        }
+
+        SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"RotatedLogFile - Reading ", m_path.Get()), StrAppend(L" from ", pos)));
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Tells whether there is more to read.
+
+       \returns     true unless the end of the file was reached
+    */
+    bool RotatedLogFile::IsGood()
+    {
+        return m_begin < m_end || Fill();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads a line (without its line ending).
+
+       \param[out]  line   Line read
+       \returns     false at the end of the file
+    */
+    bool RotatedLogFile::ReadLine(std::wstring& line)
+    {
+        std::string bytes;
+        bool found = false;
+
+        while (!found && (m_begin < m_end || Fill()))
+        {
+            const char* start = &m_buffer[m_begin];
+            size_t available = m_end - m_begin;
+            const char* newline = static_cast<const char*>(memchr(start, '\n', available));
+            size_t count = (NULL != newline) ? static_cast<size_t>(newline - start) + 1 : available;
+
+            bytes.append(start, count);
+            Consumed(start, count);
+            m_begin += count;
+            found = (NULL != newline);
+        }
+
+        if (bytes.empty())
+        {
+            return false;
+        }
+
+        if (found)
+        {
+            bytes.erase(bytes.size() - 1);
+        }
+        if (!bytes.empty() && '\r' == bytes[bytes.size() - 1])
+        {
+            bytes.erase(bytes.size() - 1);
+        }
+        line = StrFromMultibyte(bytes);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the fingerprint of the bytes before the current position.
+
+       \returns     Fingerprint
+    */
+    std::wstring RotatedLogFile::GetFingerprint() const
+    {
+        size_t count = (m_tail.size() < cFingerprintBytes) ? m_tail.size() : cFingerprintBytes;
+        return ComputeFingerprint(m_tail.substr(m_tail.size() - count));
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Opens the file, or starts the decompressor with a pipe from it.
+
+       \returns     true if started
+    */
+    bool RotatedLogFile::Start()
+    {
+        std::string path = StrToUTF8(m_path.Get());
+        m_startMs = GetMonotonicMilliseconds();
+
+        if (eUncompressed == m_compression)
+        {
+            m_fd = open(path.c_str(), O_RDONLY);
+            if (m_fd >= 0)
+            {
+                SetCloseOnExec(m_fd);
+            }
+            return m_fd >= 0;
+        }
+
+        const char* program = (eGzip == m_compression) ? "gzip" : "xz";
+        std::string programPath;
+        if (!FindDecompressor(program, programPath))
+        {
+            SCX_LOGWARNING(m_log, L"RotatedLogFile - Decompressor not found in /bin or /usr/bin: " + StrFromUTF8(program));
+            return false;
+        }
+
+        int fds[2];
+        if (pipe(fds) < 0)
+        {
+            return false;
+        }
+        SetCloseOnExec(fds[0]);
+
+        m_pid = fork();
+        if (m_pid < 0)
+        {
+            m_pid = 0;
+            close(fds[0]);
+            close(fds[1]);
+            return false;
+        }
+
+        if (0 == m_pid)
+        {
+            // Only async-signal-safe calls until exec
+            int null = open("/dev/null", O_RDWR);
+            dup2(null, 0);
+            dup2(fds[1], 1);
+            dup2(null, 2);
+            char* const argv[] = { const_cast<char*>(program), const_cast<char*>("-dc"), const_cast<char*>(path.c_str()), NULL };
+            execv(programPath.c_str(), argv);
+            _exit(127);
+        }
+
+        close(fds[1]);
+        m_fd = fds[0];
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads more data into the (consumed) buffer.
+
+       \returns     false at the end of the file (or on a read error)
+    */
+    bool RotatedLogFile::Fill()
+    {
+        m_begin = m_end = 0;
+        if (m_eof || m_fd < 0)
+        {
+            return false;
+        }
+
+        ssize_t count;
+        do
+        {
+            count = read(m_fd, &m_buffer[0], m_buffer.size());
+        }
+        while (count < 0 && EINTR == errno);
+
+        if (count <= 0)
+        {
+            m_eof = true;
+            return false;
+        }
+
+        m_end = static_cast<size_t>(count);
+        m_bytesRead += static_cast<scxulong>(count);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Skips bytes.
+
+       \param[in]   count   Number of bytes to skip
+       \returns     false if the file ended first
+    */
+    bool RotatedLogFile::Skip(std::streamoff count)
+    {
+        while (count > 0)
+        {
+            if (m_begin == m_end && !Fill())
+            {
+                return false;
+            }
+
+            size_t available = m_end - m_begin;
+            size_t skipped = (static_cast<std::streamoff>(available) < count) ? available : static_cast<size_t>(count);
+            Consumed(&m_buffer[m_begin], skipped);
+            m_begin += skipped;
+            count -= static_cast<std::streamoff>(skipped);
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Accounts for consumed bytes: advances the position and keeps the last
+       bytes for the fingerprint.
+
+       \param[in]   data   Bytes consumed
+       \param[in]   size   Number of bytes consumed
+    */
+    void RotatedLogFile::Consumed(const char* data, size_t size)
+    {
+        m_pos += static_cast<std::streamoff>(size);
+
+        if (size >= cFingerprintBytes)
+        {
+            m_tail.assign(data + size - cFingerprintBytes, cFingerprintBytes);
+            return;
+        }
+
+        m_tail.append(data, size);
+        if (m_tail.size() > 2 * cFingerprintBytes)
+        {
+            m_tail.erase(0, m_tail.size() - cFingerprintBytes);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Closes the file, stopping the decompressor if it's still running.
+    */
+    void RotatedLogFile::Close()
+    {
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+
+        if (0 != m_pid)
+        {
+            if (!m_eof)
+            {
+                kill(m_pid, SIGTERM);
+            }
+            while (waitpid(m_pid, NULL, 0) < 0 && EINTR == errno)
+            {
+            }
+            m_pid = 0;
+
+            scxulong elapsed = GetMonotonicMilliseconds() - m_startMs;
+            scxulong rate = (0 == elapsed) ? m_bytesRead / 1024 * 1000 : m_bytesRead * 1000 / 1024 / elapsed;
+            SCX_LOGTRACE(m_log, StrAppend(StrAppend(StrAppend(L"RotatedLogFile - Decompressed ", m_path.Get()),
+                                                    StrAppend(StrAppend(L": ", m_bytesRead), StrAppend(L" bytes in ", elapsed))),
+                                          StrAppend(StrAppend(L" ms (", rate), L" KiB/s)")));
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,108 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        rotatedlogfile.h
+
+    \brief       Reads the unread end of a rotated (possibly compressed) log file
+
+    When a log file is rotated, the lines written to it after it was last read
+    now live in its predecessor (like messages.1, or messages.1.gz when
+    logrotate compresses it).  The predecessor is read from the position that
+    was reached in the live file before reading the new live file.
+
+    Compressed predecessors are decompressed by gzip or xz (from /bin or
+    /usr/bin, never from PATH) through a pipe, a buffer at a time.  Since the inode of a compressed file says nothing about
+    the file it was made from, the predecessor is recognized by a fingerprint
+    of the bytes just before the position reached.
+
+    \date        2026-10-19 21:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef ROTATEDLOGFILE_H
+#define ROTATEDLOGFILE_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxfilepath.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxlog.h>
+
+#include <sys/types.h>
+
+#include <ios>
+#include <string>
+#include <vector>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads lines from a rotated log file, from a position reached earlier in
+       the live file.
+    */
+    class RotatedLogFile
+    {
+    public:
+        //! Compression of a rotated log file
+        enum Compression
+        {
+            eUncompressed,
+            eGzip,
+            eXz
+        };
+
+        //! Number of bytes before a position that its fingerprint covers
+        static const size_t cFingerprintBytes = 256;
+
+        static SCXCoreLib::SCXHandle<RotatedLogFile> FindPredecessor(
+            const SCXCoreLib::SCXFilePath& logfile,
+            scxulong stIno,
+            std::streamoff pos,
+            const std::wstring& fingerprint);
+        static std::wstring ComputeFingerprint(const std::string& bytes);
+        static std::wstring ReadFingerprint(const SCXCoreLib::SCXFilePath& file, std::streamoff pos);
+
+        RotatedLogFile(const SCXCoreLib::SCXFilePath& path, Compression compression);
+        virtual ~RotatedLogFile();
+
+        bool Open(std::streamoff pos, const std::wstring& fingerprint);
+        bool IsGood();
+        bool ReadLine(std::wstring& line);
+
+        std::streamoff GetPos() const { return m_pos; }
+        std::wstring GetFingerprint() const;
+        const SCXCoreLib::SCXFilePath& GetPath() const { return m_path; }
+        Compression GetCompression() const { return m_compression; }
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"RotatedLogFile: " + m_path.Get();
+        }
+
+    private:
+        bool Start();
+        bool Fill();
+        bool Skip(std::streamoff count);
+        void Consumed(const char* data, size_t size);
+        void Close();
+
+        SCXCoreLib::SCXFilePath m_path;     //!< Rotated log file
+        Compression m_compression;          //!< Compression of the file
+        int m_fd;                           //!< File, or pipe from the decompressor
+        pid_t m_pid;                        //!< Decompressor (0 if none)
+        std::vector<char> m_buffer;         //!< Read buffer
+        size_t m_begin;                     //!< Start of unconsumed data in m_buffer
+        size_t m_end;                       //!< End of data in m_buffer
+        bool m_eof;                         //!< End of file reached
+        std::streamoff m_pos;               //!< Position of the next unconsumed byte
+        std::string m_tail;                 //!< Last bytes consumed (for the fingerprint)
+        scxulong m_bytesRead;               //!< Bytes read (decompressed) since opened
+        scxulong m_startMs;                 //!< Time opened, in milliseconds
+        SCXCoreLib::SCXLogHandle m_log;     //!< Handle to log framework
+    };
+}
+
+#endif /* ROTATEDLOGFILE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -15,17 +15,61 @@
 #include <scxcorelib/scxdirectoryinfo.h>
 #include <scxcorelib/logsuppressor.h>
 #include <scxsystemlib/scxsysteminfo.h>
+#include <scxcorelib/stringaid.h>
 #include "startuplog.h"
 #include "scxrunasconfigurator.h"
 #include "runasprovider.h"
+#include "outputcapture.h"
+#include "scriptcache.h"
+#include "commandresultcache.h"
+#include "elevatedhelper.h"
+#include "childprocessengine.h"
+
+#include <algorithm>
+#include <vector>
 
 const std::wstring s_defaultTmpDir = L"/etc/opt/microsoft/scx/conf/tmpdir/";
 
+//! Maximum stdout + stderr returned, to stay below OMI's 64k limit per instance
+const size_t s_maxOutputSize = 60*1024;
+
+//! Largest script passed to the interpreter on stdin (some shells read a pipe a byte at a time)
+const size_t s_maxInMemoryScriptSize = 64*1024;
+
+//! Interpreters that read their script from stdin with -s (the script is run by /bin/sh if there is no #! line)
+const wchar_t* const s_inMemoryInterpreters[] = { L"sh", L"bash", L"dash", L"ksh", L"ksh93", L"zsh", L"ash" };
+
 using namespace SCXSystemLib;
 using namespace SCXCoreLib;
 
 namespace SCXCore
 {
+    /*----------------------------------------------------------------------------*/
+    /**
+        Runs a command for the command result cache
+    */
+    class RunAsCommandExecutor : public CommandResultExecutor
+    {
+    public:
+        RunAsCommandExecutor(RunAsProvider& provider, const std::wstring &command, unsigned timeout,
+                             const std::wstring &elevationtype)
+            : m_provider(provider), m_command(command), m_timeout(timeout), m_elevationtype(elevationtype)
+        {
+        }
+
+        virtual void Execute(CommandResult& result)
+        {
+            result.succeeded = m_provider.RunCommand(m_command, result.out, result.err, result.returncode,
+                                                     m_timeout, m_elevationtype, result.usage);
+        }
+
+    private:
+        RunAsProvider& m_provider;
+        const std::wstring& m_command;
+        unsigned m_timeout;
+        const std::wstring& m_elevationtype;
+    };
+
     void RunAsProvider::Load()
     {
         SCXASSERT( ms_loadCount >= 0 );
@@ -56,6 +100,10 @@ namespace SCXCore
         if (0 == --ms_loadCount)
         {
             m_Configurator = NULL;
+            g_ScriptCache.Clear();
+            g_CommandResultCache.Clear();
+            g_ElevatedHelper.Stop();
+            g_ChildProcessEngine.Shutdown();
         }
     }
 
@@ -69,11 +117,15 @@ namespace SCXCore
         \param[out]    returncode       Return code from command
         \param[in]     timeout          Accepted number of seconds to wait
         \param[in]     elevationtype    Elevation type 
+        \param[in]     maxResultAge     If nonzero, the command is read-only and the result of an
+                                        identical call at most this many seconds old may be returned
+        \param[out]    usage            If not NULL, receives the resources used by the command
         \returns       true if command succeeded, else false
         \throws SCXAccessViolationException If execution is prohibited by configuration
     */
     bool RunAsProvider::ExecuteCommand(const std::wstring &command, std::wstring &resultOut, std::wstring &resultErr,
-                                       int& returncode, unsigned timeout, const std::wstring &elevationtype)
+                                       int& returncode, unsigned timeout, const std::wstring &elevationtype,
+                                       unsigned maxResultAge, ChildResourceUsage* usage)
     {
         SCX_LOGTRACE(m_log, L"RunAsProvider ExecuteCommand");
 
@@ -86,9 +138,60 @@ namespace SCXCore
             }
         }
 
+        if ( 0 == maxResultAge )
+        {
+            ChildResourceUsage childUsage;
+            bool succeeded = RunCommand(command, resultOut, resultErr, returncode, timeout, elevationtype, childUsage);
+            if ( NULL != usage )
+            {
+                *usage = childUsage;
+            }
+            return succeeded;
+        }
+
+        // Everything that can change the output of the command is part of the key
+        std::wstring key = CommandResultCache::MakeKey(command, elevationtype, m_Configurator->GetCWD().Get(),
+                                                       m_Configurator->GetChRootPath().Get(), timeout);
+        RunAsCommandExecutor executor(*this, command, timeout, elevationtype);
+        CommandResult result;
+        if ( g_CommandResultCache.Execute(key, maxResultAge, executor, result) )
+        {
+            SCX_LOGHYSTERICAL(m_log, L"\"" + command + L"\" result shared from an identical call");
+        }
+
+        resultOut = result.out;
+        resultErr = result.err;
+        returncode = result.returncode;
+        if ( NULL != usage )
+        {
+            *usage = result.usage;
+        }
+        return result.succeeded;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Execute a command, without checking the configuration or using the result cache
+
+        \param[in]     command          Command to execute
+        \param[out]    resultOut        Result string from stdout
+        \param[out]    resultErr        Result string from stderr
+        \param[out]    returncode       Return code from command
+        \param[in]     timeout          Accepted number of seconds to wait
+        \param[in]     elevationtype    Elevation type 
+        \param[out]    usage            Receives the resources used by the command
+        \returns       true if command succeeded, else false
+    */
+    bool RunAsProvider::RunCommand(const std::wstring &command, std::wstring &resultOut, std::wstring &resultErr,
+                                   int& returncode, unsigned timeout, const std::wstring &elevationtype,
+                                   ChildResourceUsage& usage)
+    {
+        // Output beyond what can be returned is drained from the pipes, but not kept
         std::istringstream processInput;
-        std::ostringstream processOutput;
-        std::ostringstream processError;
+        OutputCaptureBuffer processOutputBuffer(s_maxOutputSize);
+        OutputCaptureBuffer processErrorBuffer(s_maxOutputSize);
+        std::ostream processOutput(&processOutputBuffer);
+        std::ostream processError(&processErrorBuffer);
         
         // Construct the command by considering the elevation type. It simply returns the command
         // when elevation type is not empty or the current user is already privilege.
@@ -97,24 +200,26 @@ namespace SCXCore
 
         try
         {
-            returncode = SCXCoreLib::SCXProcess::Run(elecommand, processInput, processOutput, processError, timeout * 1000,
-                m_Configurator->GetCWD(), m_Configurator->GetChRootPath());
-            SCX_LOGHYSTERICAL(m_log, L"\"" + elecommand + L"\" returned " + StrFrom(returncode));
-            resultOut = StrFromMultibyte(processOutput.str());
-            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
-            resultErr = StrFromMultibyte(processError.str());
-            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            if ( ! RunWithElevatedHelper(command, "", elevationtype, timeout, processOutputBuffer, processErrorBuffer, returncode, usage) )
+            {
+                returncode = g_ChildProcessEngine.Run(elecommand, processInput, processOutput, processError, timeout * 1000,
+                    m_Configurator->GetCWD(), m_Configurator->GetChRootPath(), m_Configurator->GetResourceLimits(), &usage);
+            }
+            SCX_LOGHYSTERICAL(m_log, L"\"" + elecommand + L"\" returned " + StrFrom(returncode) + L", used " + usage.Format());
 
             // Trim output if necessary
-            if ( OutputLimiter(resultOut, resultErr) )
+            bool truncated = OutputLimiter(processOutputBuffer, processErrorBuffer, resultOut, resultErr);
+            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
+            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            if ( truncated )
             {
-                SCX_LOGWARNING(m_log, StrAppend(L"ExecuteCommand: Exceeded maximum output size for provider (64k), output truncated. Monitoring will not be reliable! Command executed: ", command));
+                SCX_LOGWARNING(m_log, L"ExecuteCommand: Exceeded maximum output size for provider (64k), output truncated (" + StrFrom(processOutputBuffer.GetTotalBytes() + processErrorBuffer.GetTotalBytes()) + L" bytes produced). Monitoring will not be reliable! Command executed: " + command);
             }
         }
         catch (SCXCoreLib::SCXException& e)
         {
-            resultOut = StrFromMultibyte(processOutput.str());
-            resultErr = StrFromMultibyte(processError.str()) + e.What();
+            OutputLimiter(processOutputBuffer, processErrorBuffer, resultOut, resultErr);
+            resultErr += e.What();
             returncode = -1;
         }
 
@@ -131,11 +236,13 @@ namespace SCXCore
         \param[out]    returncode       Return code from command
         \param[in]     timeout          Accepted number of seconds to wait
         \param[in]     elevationtype    Elevation type
+        \param[out]    usage            If not NULL, receives the resources used by the command
         \returns       true if command succeeded, else false
         \throws SCXAccessViolationException If execution is prohibited by configuration
     */
     bool RunAsProvider::ExecuteShellCommand(const std::wstring &command, std::wstring &resultOut, std::wstring &resultErr,
-                                            int& returncode, unsigned timeout, const std::wstring &elevationtype)
+                                            int& returncode, unsigned timeout, const std::wstring &elevationtype,
+                                            ChildResourceUsage* usage)
     {
         SCX_LOGTRACE(m_log, L"RunAsProvider ExecuteShellCommand");
 
@@ -148,9 +255,13 @@ namespace SCXCore
             }
         }
 
+        // Output beyond what can be returned is drained from the pipes, but not kept
         std::istringstream processInput;
-        std::ostringstream processOutput;
-        std::ostringstream processError;
+        OutputCaptureBuffer processOutputBuffer(s_maxOutputSize);
+        OutputCaptureBuffer processErrorBuffer(s_maxOutputSize);
+        std::ostream processOutput(&processOutputBuffer);
+        std::ostream processError(&processErrorBuffer);
+        ChildResourceUsage childUsage;
        
         // Construct the shell command with the given command and elevation type.
         // Please be noted that the constructed shell command use the single quotes. Hence,
@@ -160,19 +271,24 @@ namespace SCXCore
 
         try
         {
-            returncode = SCXCoreLib::SCXProcess::Run(shellcommand, processInput, processOutput, processError,
-                timeout * 1000, m_Configurator->GetCWD(), m_Configurator->GetChRootPath());
+            // The helper runs the shell command that sudo would run
+            SCXSystemLib::SystemInfo si;
+            if ( ! RunWithElevatedHelper(si.GetShellCommand(command), "", elevationtype, timeout, processOutputBuffer, processErrorBuffer, returncode, childUsage) )
+            {
+                returncode = g_ChildProcessEngine.Run(shellcommand, processInput, processOutput, processError,
+                    timeout * 1000, m_Configurator->GetCWD(), m_Configurator->GetChRootPath(),
+                    m_Configurator->GetResourceLimits(), &childUsage);
+            }
 
-            SCX_LOGHYSTERICAL(m_log, L"\"" + shellcommand + L"\" returned " + StrFrom(returncode));
-            resultOut = StrFromMultibyte(processOutput.str());
-            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
-            resultErr = StrFromMultibyte(processError.str());
-            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            SCX_LOGHYSTERICAL(m_log, L"\"" + shellcommand + L"\" returned " + StrFrom(returncode) + L", used " + childUsage.Format());
 
             // Trim output if necessary
-            if ( OutputLimiter(resultOut, resultErr) )
+            bool truncated = OutputLimiter(processOutputBuffer, processErrorBuffer, resultOut, resultErr);
+            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
+            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            if ( truncated )
             {
-                SCX_LOGWARNING(m_log, StrAppend(L"ExecuteShellCommand: Exceeded maximum output size for provider (64k), output truncated. Monitoring will not be reliable! Command executed: ", command));
+                SCX_LOGWARNING(m_log, L"ExecuteShellCommand: Exceeded maximum output size for provider (64k), output truncated (" + StrFrom(processOutputBuffer.GetTotalBytes() + processErrorBuffer.GetTotalBytes()) + L" bytes produced). Monitoring will not be reliable! Command executed: " + command);
             }
         }
         catch (SCXCoreLib::SCXException& e)
@@ -182,6 +298,10 @@ namespace SCXCore
             returncode = -1;
         }
 
+        if ( NULL != usage )
+        {
+            *usage = childUsage;
+        }
         return (returncode == 0);
     }
 
@@ -196,12 +316,13 @@ namespace SCXCore
         \param[out]    returncode       Return code from command
         \param[in]     timeout          Accepted number of seconds to wait
         \param[in]     elevationtype    Elevation type
+        \param[out]    usage            If not NULL, receives the resources used by the script
 
         \returns       true if script succeeded, else false
         \throws SCXAccessViolationException If execution is prohibited by configuration    */
     bool RunAsProvider::ExecuteScript(const std::wstring &script, const std::wstring &arguments, std::wstring &resultOut,
                                       std::wstring &resultErr, int& returncode, unsigned timeout,
-                                      const std::wstring &elevationtype)
+                                      const std::wstring &elevationtype, ChildResourceUsage* usage)
     {
         SCX_LOGTRACE(m_log, L"SCXRunAsProvider ExecuteScript");
 
@@ -214,9 +335,13 @@ namespace SCXCore
             }
         }
 
+        // Output beyond what can be returned is drained from the pipes, but not kept
         std::istringstream processInput;
-        std::ostringstream processOutput;
-        std::ostringstream processError;
+        OutputCaptureBuffer processOutputBuffer(s_maxOutputSize);
+        OutputCaptureBuffer processErrorBuffer(s_maxOutputSize);
+        std::ostream processOutput(&processOutputBuffer);
+        std::ostream processError(&processErrorBuffer);
+        ChildResourceUsage childUsage;
 
         try
         {
@@ -226,31 +351,45 @@ namespace SCXCore
         		static SCXCoreLib::LogSuppressor suppressor(SCXCoreLib::eWarning, SCXCoreLib::eHysterical);
         		SCX_LOG(m_log, suppressor.GetSeverity(m_defaultTmpDir), L"Default tmp Directory does not exist. Falling back to /tmp");
         	}
-            SCXFilePath scriptfile = SCXFile::CreateTempFile(script, tmpDir);
-            SCXFileSystem::Attributes attribs = SCXFileSystem::GetAttributes(scriptfile);
-            attribs.insert(SCXFileSystem::eUserExecute);
-            SCXFile::SetAttributes(scriptfile, attribs);
+            // Shell scripts are passed to the interpreter on stdin, so nothing is
+            // written to disk, and the script doesn't show on the command line;
+            // anything else is run from a script file.  Script files are cached,
+            // unless we fell back to the shared /tmp.
+            std::wstring command;
+            std::string scriptInput;
+            SCXCoreLib::SCXHandle<ScriptCacheLease> scriptfile;
+            if ( ConstructInMemoryScriptCommand(script, arguments, command, scriptInput) )
+            {
+                processInput.str(scriptInput);
+            }
+            else
+            {
+                scriptfile = new ScriptCacheLease(g_ScriptCache, script, tmpDir, tmpDirExists);
 
-            std::wstring command(scriptfile.Get());
-            command.append(L" ").append(arguments);
+                command = scriptfile->GetPath().Get();
+                command.append(L" ").append(arguments);
+            }
 
-            // Construct the command with the given elevation type.
-            command = ConstructCommandWithElevation(command, elevationtype);
+            if ( ! RunWithElevatedHelper(command, scriptInput, elevationtype, timeout, processOutputBuffer, processErrorBuffer, returncode, childUsage) )
+            {
+                // Construct the command with the given elevation type.
+                command = ConstructCommandWithElevation(command, elevationtype);
 
-            returncode = SCXCoreLib::SCXProcess::Run(command, processInput, processOutput, processError, timeout * 1000,
-                m_Configurator->GetCWD(), m_Configurator->GetChRootPath());
-            SCXFile::Delete(scriptfile);
+                returncode = g_ChildProcessEngine.Run(command, processInput, processOutput, processError, timeout * 1000,
+                    m_Configurator->GetCWD(), m_Configurator->GetChRootPath(), m_Configurator->GetResourceLimits(),
+                    &childUsage);
+            }
+            scriptfile = NULL;
 
-            SCX_LOGHYSTERICAL(m_log, L"\"" + command + L"\" returned " + StrFrom(returncode));
-            resultOut = StrFromMultibyte(processOutput.str());
-            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
-            resultErr = StrFromMultibyte(processError.str());
-            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            SCX_LOGHYSTERICAL(m_log, L"\"" + command + L"\" returned " + StrFrom(returncode) + L", used " + childUsage.Format());
 
             // Trim output if necessary
-            if ( OutputLimiter(resultOut, resultErr) )
+            bool truncated = OutputLimiter(processOutputBuffer, processErrorBuffer, resultOut, resultErr);
+            SCX_LOGHYSTERICAL(m_log, L"stdout: " + resultOut);
+            SCX_LOGHYSTERICAL(m_log, L"stderr: " + resultErr);
+            if ( truncated )
             {
-                SCX_LOGWARNING(m_log, L"ExecuteScript: Exceeded maximum output size for provider (64k), output truncated. Monitoring will not be reliable! Script contents logged only with hysterical logging.");
+                SCX_LOGWARNING(m_log, L"ExecuteScript: Exceeded maximum output size for provider (64k), output truncated (" + StrFrom(processOutputBuffer.GetTotalBytes() + processErrorBuffer.GetTotalBytes()) + L" bytes produced). Monitoring will not be reliable! Script contents logged only with hysterical logging.");
             }
         }
         catch (SCXCoreLib::SCXException& e)
@@ -260,9 +399,114 @@ namespace SCXCore
             returncode = -1;
         }
 
+        if ( NULL != usage )
+        {
+            *usage = childUsage;
+        }
         return (returncode == 0);
     }
     
+    /*----------------------------------------------------------------------------*/
+    /**
+        Construct a command that runs a script without writing it to disk
+
+        The interpreter reads the script from stdin (-s), so only the
+        interpreter and the arguments are on the command line (and in what
+        sudo logs).  The script is wrapped in a group reading its own stdin
+        from /dev/null, so it is parsed completely before it runs, and sees an
+        empty stdin as it does when run from a file.
+
+        $0 is the interpreter rather than a script file, so scripts using it
+        are run from a file.
+
+        \param[in]     script      Script to execute
+        \param[in]     arguments   Command line arguments to script
+        \param[out]    command     Command to run
+        \param[out]    input       Data to write to the stdin of the command
+        \returns       false if the script must be run from a temp file
+    */
+    bool RunAsProvider::ConstructInMemoryScriptCommand(const std::wstring &script, const std::wstring &arguments,
+                                                       std::wstring &command, std::string &input)
+    {
+        if (script.size() > s_maxInMemoryScriptSize
+            || script.find(L"$0") != std::wstring::npos || script.find(L"${0") != std::wstring::npos)
+        {
+            return false;
+        }
+
+        // Find the interpreter (and at most one option) from the #! line
+        std::wstring interpreter(L"/bin/sh");
+        std::wstring option;
+        if (script.compare(0, 2, L"#!") == 0)
+        {
+            std::vector<std::wstring> tokens;
+            StrTokenize(script.substr(2, script.find(L'\n') - 2), tokens, L" \t");
+            if (tokens.size() < 1 || tokens.size() > 2
+                || (tokens.size() == 2 && tokens[1].compare(0, 1, L"-") != 0))
+            {
+                return false;
+            }
+            interpreter = tokens[0];
+            if (tokens.size() == 2)
+            {
+                option = tokens[1];
+            }
+        }
+
+        std::wstring name(SCXFilePath(interpreter).GetFilename());
+        const size_t count = sizeof(s_inMemoryInterpreters) / sizeof(s_inMemoryInterpreters[0]);
+        if (std::find(s_inMemoryInterpreters, s_inMemoryInterpreters + count, name) == s_inMemoryInterpreters + count)
+        {
+            return false;
+        }
+
+        command = interpreter;
+        if (!option.empty())
+        {
+            command.append(L" ").append(option);
+        }
+        command.append(L" -s -- ").append(arguments);
+
+        input = "{\n" + StrToUTF8(script) + "\n} < /dev/null\n";
+
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+        Run a sudo elevated command through the elevated helper, if configured
+
+        The helper runs the command line as given, which is the one the caller
+        would elevate through sudo: a shell command for ExecuteShellCommand,
+        and run directly otherwise.  Commands that the helper can't take (it
+        isn't enabled or needed, can't be started, or is busy with another
+        command) are left to the caller.
+
+        \param[in]     command          Command line to execute (not elevated)
+        \param[in]     input            Data to write to the stdin of the command
+        \param[in]     elevationtype    Elevation type
+        \param[in]     timeout          Accepted number of seconds to wait
+        \param[out]    processOutput    Receives stdout
+        \param[out]    processError     Receives stderr
+        \param[out]    returncode       Return code from command
+        \param[out]    usage            Receives the resources used by the command
+        \returns       true if the helper ran the command
+        \throws SCXException If the helper failed to run the command
+    */
+    bool RunAsProvider::RunWithElevatedHelper(const std::wstring &command, const std::string &input,
+                                              const std::wstring &elevationtype, unsigned timeout, OutputCaptureBuffer& processOutput,
+                                              OutputCaptureBuffer& processError, int& returncode,
+                                              ChildResourceUsage& usage)
+    {
+        if (elevationtype != L"sudo" || ! m_Configurator->GetElevatedHelper())
+        {
+            return false;
+        }
+
+        ElevatedHelper& helper = (NULL != m_ElevatedHelper) ? *m_ElevatedHelper : g_ElevatedHelper;
+        return helper.Execute(command, input, timeout, s_maxOutputSize, processOutput, processError, returncode, &usage);
+    }
+
     std::wstring RunAsProvider::ConstructCommandWithElevation(const std::wstring &command, 
                                                               const std::wstring &elevationtype)
     {
@@ -301,34 +545,43 @@ namespace SCXCore
 
     // Limit stdout/stderr length to avoid bumping up against OMI's 64k limit per instance
     // (Not a whole lot of sense in raising that, since WS-Man has a limit as well)
-    bool RunAsProvider::OutputLimiter(std::wstring& resultOut, std::wstring& resultErr)
+    //
+    // The limits are applied to the bytes the process produced, and only the bytes
+    // that are returned get converted.
+    bool RunAsProvider::OutputLimiter(const OutputCaptureBuffer& processOutput, const OutputCaptureBuffer& processError,
+                                      std::wstring& resultOut, std::wstring& resultErr)
     {
-        const size_t maxOutputSize = 60*1024;
+        scxulong outSize = processOutput.GetTotalBytes();
+        scxulong errSize = processError.GetTotalBytes();
 
         // Do we need to truncate the output?
-        if (resultOut.size() + resultErr.size() <= maxOutputSize)
+        if (outSize + errSize <= s_maxOutputSize)
         {
             // Nope, we're good
+            resultOut = processOutput.GetText(s_maxOutputSize);
+            resultErr = processError.GetText(s_maxOutputSize);
             return false;
         }
 
-        if ( resultErr.size() == 0 )
+        if ( errSize == 0 )
         {
             // Truncate stdout only
-            resultOut = resultOut.substr(0, maxOutputSize-1);
+            resultOut = processOutput.GetText(s_maxOutputSize-1);
+            resultErr = L"";
         }
-        else if ( resultOut.size() == 0 )
+        else if ( outSize == 0 )
         {
             // Truncate stderr only
-            resultErr = resultErr.substr(0, maxOutputSize-1);
+            resultOut = L"";
+            resultErr = processError.GetText(s_maxOutputSize-1);
         }
         else
         {
             // They are both non-zero in size. There are a number of ways to do
             // this, but PM said to keep it simple and do this ...
 
-            resultOut = resultOut.substr(0, maxOutputSize - 1 - 1024);
-            resultErr = resultErr.substr(0, 1024 - 1);
+            resultOut = processOutput.GetText(s_maxOutputSize - 1 - 1024);
+            resultErr = processError.GetText(1024 - 1);
         }
 
         return true;
@@ -20,6 +20,10 @@ using namespace SCXCoreLib;
 
 namespace SCXCore
 {
+    class OutputCaptureBuffer;
+    class ElevatedHelper;
+    struct ChildResourceUsage;
+
     //
     // RunAs Provider
     //
@@ -30,7 +34,7 @@ namespace SCXCore
     class RunAsProvider
     {
     public:
-        RunAsProvider() : m_Configurator(NULL) { }
+        RunAsProvider() : m_Configurator(NULL), m_ElevatedHelper(NULL) { }
         ~RunAsProvider() { };
 
         void Load();
@@ -38,15 +42,17 @@ namespace SCXCore
 
         bool ExecuteCommand(const std::wstring &command, std::wstring &resultOut,
                             std::wstring &resultErr, int& returncode, unsigned timeout = 0,
-                            const std::wstring &elevationtype = L"");
+                            const std::wstring &elevationtype = L"", unsigned maxResultAge = 0,
+                            ChildResourceUsage* usage = NULL);
 
         bool ExecuteShellCommand(const std::wstring &command, std::wstring &resultOut,
                                  std::wstring &resultErr, int& returncode, unsigned timeout = 0,
-                                 const std::wstring &elevationtype = L"");
+                                 const std::wstring &elevationtype = L"", ChildResourceUsage* usage = NULL);
 
         bool ExecuteScript(const std::wstring &script, const std::wstring &arguments,
                            std::wstring &resultOut, std::wstring &resultErr,
-                           int& returncode, unsigned timeout = 0, const std::wstring &elevationtype = L"");
+                           int& returncode, unsigned timeout = 0, const std::wstring &elevationtype = L"",
+                           ChildResourceUsage* usage = NULL);
         
         SCXLogHandle& GetLogHandle() { return m_log; }
         
@@ -60,15 +66,37 @@ namespace SCXCore
         	m_defaultTmpDir = tmpDir;
         }
 
+        //! Sets the elevated helper used (NULL for g_ElevatedHelper)
+        void SetElevatedHelper(ElevatedHelper* elevatedHelper)
+        {
+            m_ElevatedHelper = elevatedHelper;
+        }
+
     private:
+        friend class RunAsCommandExecutor;
+
         void ParseConfiguration() { m_Configurator->Parse(); }
 
+        bool RunCommand(const std::wstring &command, std::wstring &resultOut, std::wstring &resultErr,
+                        int& returncode, unsigned timeout, const std::wstring &elevationtype,
+                        ChildResourceUsage& usage);
+
+        bool RunWithElevatedHelper(const std::wstring &command, const std::string &input,
+                                   const std::wstring &elevationtype, unsigned timeout,
+                                   OutputCaptureBuffer& processOutput, OutputCaptureBuffer& processError,
+                                   int& returncode, ChildResourceUsage& usage);
+
         std::wstring ConstructCommandWithElevation(const std::wstring &command, const std::wstring &elevationtype);
         std::wstring ConstructShellCommandWithElevation(const std::wstring &command, const std::wstring &elevationtype);
-        bool OutputLimiter(std::wstring& resultOut, std::wstring& resultErr);
+        bool OutputLimiter(const OutputCaptureBuffer& processOutput, const OutputCaptureBuffer& processError,
+                           std::wstring& resultOut, std::wstring& resultErr);
+        bool ConstructInMemoryScriptCommand(const std::wstring &script, const std::wstring &arguments,
+                                            std::wstring &command, std::string &input);
 
         //! Configurator.
         SCXCoreLib::SCXHandle<RunAsConfigurator> m_Configurator;
+        //! Elevated helper (NULL for g_ElevatedHelper).
+        ElevatedHelper* m_ElevatedHelper;
 
         SCXCoreLib::SCXLogHandle m_log;
         std::wstring m_defaultTmpDir;
@@ -0,0 +1,441 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        samplerscheduler.cpp
+
+    \brief       Runs the periodic sampling of the providers from one thread
+
+    \date        2026-10-20 00:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/stringaid.h>
+
+#include "samplerscheduler.h"
+#include "sysutils.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Thread parameter for the scheduler thread
+    class SamplerSchedulerParam : public SCXThreadParam
+    {
+    public:
+        SamplerSchedulerParam(SCXCore::SamplerScheduler* scheduler) : m_scheduler(scheduler) { }
+
+        SCXCore::SamplerScheduler* m_scheduler;
+    };
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   tickMs   Length of a tick, in milliseconds
+    */
+    SamplerScheduler::SamplerScheduler(int tickMs)
+        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.samplerscheduler")),
+          m_tickMs(tickMs > 0 ? tickMs : cTickMs),
+          m_wheel(cWheelSlots),
+          m_current(0),
+          m_nextTaskID(1),
+          m_runningTaskID(0),
+          m_running(false),
+          m_stopping(false)
+    {
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    SamplerScheduler::~SamplerScheduler()
+    {
+        Stop();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the scheduler thread.  Starting a running scheduler does nothing.
+
+       \returns     true if the thread is running
+    */
+    bool SamplerScheduler::Start()
+    {
+        SCXConditionHandle h(m_cond);
+        if (m_running)
+        {
+            return true;
+        }
+        if (NULL != m_thread)
+        {
+            // The thread failed earlier and has exited
+            h.Unlock();
+            Stop();
+            h.Lock();
+        }
+
+        if (!OpenWakePipe(m_wakeFds))
+        {
+            SCX_LOGWARNING(m_log, StrAppend(L"Unable to create pipe for sampler scheduler thread, errno = ", errno));
+            return false;
+        }
+
+        m_running = true;
+        m_stopping = false;
+        try
+        {
+            m_thread = new SCXThread(SchedulerBody, new SamplerSchedulerParam(this));
+        }
+        catch (SCXException& e)
+        {
+            SCX_LOGWARNING(m_log, L"Unable to start sampler scheduler thread: " + e.What());
+            m_running = false;
+            ClosePipe(m_wakeFds);
+            return false;
+        }
+
+        SCX_LOGTRACE(m_log, StrAppend(L"Sampler scheduler ticking every ms: ", m_tickMs));
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the scheduler thread, after the task it is running (if any)
+       returns.  Tasks are kept, and run again once the scheduler is started.
+    */
+    void SamplerScheduler::Stop()
+    {
+        SCXHandle<SCXThread> thread;
+        {
+            SCXConditionHandle h(m_cond);
+            thread = m_thread;
+            m_stopping = true;
+            Wake();
+        }
+
+        if (NULL != thread)
+        {
+            thread->Wait();
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_thread = NULL;
+        m_running = false;
+        m_stopping = false;
+        ClosePipe(m_wakeFds);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether the scheduler thread is running.
+    */
+    bool SamplerScheduler::IsRunning()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_running;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds a periodic task.  It first runs one interval from now.
+
+       \param[in]   name            Name of the task, for logs and statistics
+       \param[in]   task            The task (owned by the caller; must stay valid until removed)
+       \param[in]   intervalTicks   Ticks between runs (at least 1)
+       \returns     ID of the task
+    */
+    scxulong SamplerScheduler::AddTask(const std::wstring& name, SamplerTask* task, unsigned int intervalTicks)
+    {
+        ProviderOperationStatistics& statistics = g_ProviderMetrics.GetStatistics(L"SamplerScheduler::" + name);
+
+        SCXConditionHandle h(m_cond);
+        scxulong taskID = m_nextTaskID++;
+        Task& added = m_tasks[taskID];
+        added.name = name;
+        added.task = task;
+        added.intervalTicks = std::max(intervalTicks, 1u);
+        added.statistics = &statistics;
+        Place(taskID, added);
+
+        SCX_LOGTRACE(m_log, StrAppend(StrAppend(L"SamplerScheduler AddTask - ID: ", taskID), L" " + name)
+                     + StrAppend(L", ticks: ", added.intervalTicks));
+
+        // The thread doesn't tick while there are no tasks
+        Wake();
+        return taskID;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes a task.  If the task is running, waits for it to return, so
+       the task may be destroyed once this returns.
+
+       Callers holding a lock the task takes must not wait; they pass false,
+       and keep the task valid (it may still be running once this returns).
+
+       \param[in]   taskID   ID of the task
+       \param[in]   wait     Wait for the task to return, if it is running
+       \returns     true if the task was found
+    */
+    bool SamplerScheduler::RemoveTask(scxulong taskID, bool wait)
+    {
+        SCXConditionHandle h(m_cond);
+        std::map<scxulong, Task>::iterator it = m_tasks.find(taskID);
+        if (m_tasks.end() == it)
+        {
+            return false;
+        }
+
+        SCX_LOGTRACE(m_log, StrAppend(L"SamplerScheduler RemoveTask - ID: ", taskID) + L" " + it->second.name);
+        Unplace(taskID, it->second);
+        m_tasks.erase(it);
+
+        while (wait && m_runningTaskID == taskID)
+        {
+            h.Wait();
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of tasks.
+    */
+    size_t SamplerScheduler::GetTaskCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_tasks.size();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Advances the wheel by one tick, and runs the tasks due on it.
+
+       \returns     Number of tasks run
+    */
+    size_t SamplerScheduler::Tick()
+    {
+        std::vector<scxulong> due;
+        {
+            SCXConditionHandle h(m_cond);
+            m_current = (m_current + 1) % cWheelSlots;
+
+            std::vector<scxulong> slot;
+            slot.swap(m_wheel[m_current]);
+            for (std::vector<scxulong>::const_iterator id = slot.begin(); id != slot.end(); ++id)
+            {
+                Task& task = m_tasks[*id];
+                if (task.rounds > 0)
+                {
+                    task.rounds--;
+                    m_wheel[m_current].push_back(*id);
+                    continue;
+                }
+
+                // Scheduled from the tick it was due on, so a slow run doesn't delay the next one
+                due.push_back(*id);
+                Place(*id, task);
+            }
+        }
+
+        size_t run = 0;
+        for (std::vector<scxulong>::const_iterator id = due.begin(); id != due.end(); ++id)
+        {
+            SamplerTask* task;
+            ProviderOperationStatistics* statistics;
+            std::wstring name;
+            {
+                SCXConditionHandle h(m_cond);
+                std::map<scxulong, Task>::const_iterator it = m_tasks.find(*id);
+                if (m_tasks.end() == it)
+                {
+                    // Removed by a task that ran before it
+                    continue;
+                }
+                task = it->second.task;
+                statistics = it->second.statistics;
+                name = it->second.name;
+                m_runningTaskID = *id;
+            }
+
+            {
+                ProviderOperationTimer timer(*statistics);
+                try
+                {
+                    task->RunSample();
+                }
+                catch (SCXException& e)
+                {
+                    timer.SetFailed();
+                    SCX_LOGWARNING(m_log, L"SamplerScheduler task " + name + L" failed: " + e.What() + L" - " + e.Where());
+                }
+                catch (std::exception& e)
+                {
+                    timer.SetFailed();
+                    SCX_LOGERROR(m_log, L"SamplerScheduler task " + name + L" failed: " + SCXCoreLib::DumpString(e));
+                }
+                catch (...)
+                {
+                    // Whatever a task throws, the thread keeps ticking for the other tasks
+                    timer.SetFailed();
+                    SCX_LOGERROR(m_log, L"SamplerScheduler task " + name + L" failed with an unknown exception");
+                }
+            }
+            run++;
+
+            SCXConditionHandle h(m_cond);
+            m_runningTaskID = 0;
+            h.Broadcast();
+        }
+
+        return run;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Puts a task in the slot of its next run.  Called with the scheduler locked.
+
+       \param[in]       taskID   ID of the task
+       \param[in,out]   task     The task
+    */
+    void SamplerScheduler::Place(scxulong taskID, Task& task)
+    {
+        task.slot = (m_current + task.intervalTicks) % cWheelSlots;
+        task.rounds = static_cast<unsigned int>((task.intervalTicks - 1) / cWheelSlots);
+        m_wheel[task.slot].push_back(taskID);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Takes a task out of its slot.  Called with the scheduler locked.
+
+       \param[in]   taskID   ID of the task
+       \param[in]   task     The task
+    */
+    void SamplerScheduler::Unplace(scxulong taskID, const Task& task)
+    {
+        std::vector<scxulong>& slot = m_wheel[task.slot];
+        std::vector<scxulong>::iterator it = std::find(slot.begin(), slot.end(), taskID);
+        if (slot.end() != it)
+        {
+            slot.erase(it);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Wakes the scheduler thread, to look at its tasks again.  Called with
+       the scheduler locked.
+    */
+    void SamplerScheduler::Wake()
+    {
+        WriteWakePipe(m_wakeFds);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Scheduler thread body.
+
+       \param[in]   param   SamplerSchedulerParam
+    */
+    void SamplerScheduler::SchedulerBody(SCXThreadParamHandle& param)
+    {
+        SamplerSchedulerParam* p = static_cast<SamplerSchedulerParam*>(param.GetData());
+        p->m_scheduler->Schedule();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Ticks while there are tasks, and sleeps while there are none, until stopped.
+    */
+    void SamplerScheduler::Schedule()
+    {
+        int wakeFd;
+        {
+            SCXConditionHandle h(m_cond);
+            wakeFd = m_wakeFds[0];
+        }
+
+        bool idle = true;
+        scxulong nextTick = 0;
+        for (;;)
+        {
+            int timeout = -1;
+            {
+                SCXConditionHandle h(m_cond);
+                if (m_stopping)
+                {
+                    break;
+                }
+                if (m_tasks.empty())
+                {
+                    idle = true;
+                }
+                else
+                {
+                    scxulong now = GetMonotonicMilliseconds();
+                    if (idle)
+                    {
+                        nextTick = now + m_tickMs;
+                        idle = false;
+                    }
+
+                    // At most a tick, in case the time of day clock was stepped backwards
+                    timeout = (nextTick > now) ? static_cast<int>(std::min(nextTick - now, static_cast<scxulong>(m_tickMs))) : 0;
+                }
+            }
+
+            struct pollfd fds[1];
+            fds[0].fd = wakeFd;
+            fds[0].events = POLLIN;
+            fds[0].revents = 0;
+
+            int count = poll(fds, 1, timeout);
+            if (count < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                SCX_LOGERROR(m_log, StrAppend(L"Waiting for the next sampler tick failed, errno = ", errno));
+                break;
+            }
+            if (count > 0)
+            {
+                char buffer[64];
+                ssize_t ignored = read(wakeFd, buffer, sizeof(buffer));
+                (void) ignored;
+                continue;
+            }
+
+            // A tick that is late (like after a slow task, or a suspended system) isn't caught up
+            scxulong now = GetMonotonicMilliseconds();
+            nextTick += m_tickMs;
+            if (nextTick <= now)
+            {
+                nextTick = now + m_tickMs;
+            }
+            Tick();
+        }
+
+        SCXConditionHandle h(m_cond);
+        m_running = false;
+    }
+
+    SamplerScheduler g_SamplerScheduler;
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,134 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        samplerscheduler.h
+
+    \brief       Runs the periodic sampling of the providers from one thread
+
+    Periodic tasks are kept on a timer wheel, which one thread advances a
+    tick at a time.  Tasks due on the same tick run in the same wakeup, one
+    after the other, and the thread doesn't wake at all while there are no
+    tasks.  The run times of each task are recorded in g_ProviderMetrics
+    (as "SamplerScheduler::<task name>"), so they are published by SCX_Agent.
+
+    Only the sampling done by the providers themselves runs here: the
+    threshold monitor and the idle checks of SamplingDemand.  The PAL
+    enumerations still sample in threads of their own, which can't be moved
+    without changing the PAL.  In particular, the provider of
+    SCX_RTProcessorStatisticalInformation still keeps a CPUEnumeration of
+    its own, next to the one CPUProvider shares, so CPU statistics are still
+    sampled by two threads.
+
+    \date        2026-10-20 00:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SAMPLERSCHEDULER_H
+#define SAMPLERSCHEDULER_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxthread.h>
+
+#include "providermetrics.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       A periodic task of a SamplerScheduler.  Called on the scheduler
+       thread, without the scheduler locked; it may add tasks, but must not
+       remove any, nor stop the scheduler.
+    */
+    class SamplerTask
+    {
+    public:
+        virtual ~SamplerTask() { }
+        virtual void RunSample() = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Timer wheel of periodic sampling tasks, advanced by one thread.
+
+       Ticks are timed with CLOCK_MONOTONIC, so setting the time of day
+       doesn't delay or hurry them.  On systems without a monotonic clock
+       the time of day is used instead; a tick then waits at most one tick
+       length after the clock is stepped backwards, and ticks missed when
+       it is stepped forwards are dropped, not caught up.
+    */
+    class SamplerScheduler
+    {
+    public:
+        //! Length of a tick, in milliseconds
+        static const int cTickMs = 1000;
+        //! Slots of the wheel; tasks with longer intervals wait for more than one turn
+        static const size_t cWheelSlots = 64;
+
+        explicit SamplerScheduler(int tickMs = cTickMs);
+        virtual ~SamplerScheduler();
+
+        bool Start();
+        void Stop();
+        bool IsRunning();
+
+        scxulong AddTask(const std::wstring& name, SamplerTask* task, unsigned int intervalTicks);
+        bool RemoveTask(scxulong taskID, bool wait = true);
+        size_t GetTaskCount();
+        int GetTickMs() const { return m_tickMs; }
+
+        // Public solely for unit tests (done by the scheduler thread otherwise) ...
+        size_t Tick();
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"SamplerScheduler";
+        }
+
+    private:
+        //! A scheduled task
+        struct Task
+        {
+            Task() : task(NULL), intervalTicks(1), slot(0), rounds(0), statistics(NULL) {}
+
+            std::wstring name;                          //!< Name, for logs and statistics
+            SamplerTask* task;                          //!< The task
+            unsigned int intervalTicks;                 //!< Ticks between runs
+            size_t slot;                                //!< Wheel slot of the next run
+            unsigned int rounds;                        //!< Turns of the wheel left before the next run
+            ProviderOperationStatistics* statistics;    //!< Run times
+        };
+
+        static void SchedulerBody(SCXCoreLib::SCXThreadParamHandle& param);
+        void Schedule();
+        void Place(scxulong taskID, Task& task);
+        void Unplace(scxulong taskID, const Task& task);
+        void Wake();
+
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        int m_tickMs;                                   //!< Length of a tick
+        SCXCoreLib::SCXCondition m_cond;                //!< Protects the members below
+        SCXCoreLib::SCXHandle<SCXCoreLib::SCXThread> m_thread; //!< Scheduler thread
+        std::map<scxulong, Task> m_tasks;               //!< Tasks, by ID
+        std::vector<std::vector<scxulong> > m_wheel;    //!< IDs of the tasks due in each slot
+        size_t m_current;                               //!< Slot of the last tick
+        scxulong m_nextTaskID;                          //!< ID of the next task added
+        scxulong m_runningTaskID;                       //!< Task being run (0 if none)
+        int m_wakeFds[2];                               //!< Pipe used to wake the scheduler thread
+        bool m_running;                                 //!< The scheduler thread is running
+        bool m_stopping;                                //!< The scheduler thread is asked to exit
+    };
+
+    extern SamplerScheduler g_SamplerScheduler;
+}
+
+#endif /* SAMPLERSCHEDULER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
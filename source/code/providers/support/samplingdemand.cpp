@@ -0,0 +1,243 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        samplingdemand.cpp
+
+    \brief       Suspends the sampling of providers nobody queries
+
+    \date        2026-10-20 01:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "providerconfig.h"
+#include "samplingdemand.h"
+
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the seconds without queries after which sampling is suspended.
+
+       The value is read once from the configuration file (setting
+       "SamplingDemand_IdleSecs") and defaults to cDefaultSamplingIdleSecs.
+
+       \returns     Idle seconds (0 if sampling is never suspended)
+    */
+    time_t GetSamplingIdleSecs()
+    {
+        static bool s_initialized = false;
+        static time_t s_idleSecs = cDefaultSamplingIdleSecs;
+
+        SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::SamplingDemand::Lock"));
+        if (s_initialized)
+        {
+            return s_idleSecs;
+        }
+        s_initialized = true;
+
+        s_idleSecs = static_cast<time_t>(GetConfigUInt(L"SamplingDemand_IdleSecs", cDefaultSamplingIdleSecs));
+
+        return s_idleSecs;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   name        Name of the sampling source, for logs and statistics
+       \param[in]   lockName    Lock held when calling this (the lock of the provider owning the source)
+       \param[in]   sampler     The sampling source
+       \param[in]   scheduler   Scheduler of the idle checks
+    */
+    SamplingDemand::SamplingDemand(const std::wstring& name, const std::wstring& lockName, SuspendableSampler* sampler,
+                                   SamplerScheduler& scheduler)
+        : m_name(name),
+          m_lockName(lockName),
+          m_sampler(sampler),
+          m_scheduler(scheduler),
+          m_idleSecs(0),
+          m_lastActivity(0),
+          m_suspended(false),
+          m_warmUpDueMs(0),
+          m_taskID(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts tracking the queries, with sampling running.  The source counts
+       as queried now, so it isn't suspended right away.
+
+       \param[in]   idleSecs   Seconds without queries before suspending sampling (0: never)
+       \param[in]   now        Current time
+    */
+    void SamplingDemand::Start(time_t idleSecs, time_t now)
+    {
+        m_log = SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.samplingdemand");
+        m_idleSecs = idleSecs;
+        m_lastActivity = now;
+        m_lastQueries.clear();
+        m_suspended = false;
+        m_warmUpDueMs = 0;
+
+        if (m_idleSecs > 0)
+        {
+            SCX_LOGTRACE(m_log, StrAppend(L"SamplingDemand " + m_name + L" suspends sampling after idle seconds: ", m_idleSecs));
+            if (0 == m_taskID)
+            {
+                m_taskID = m_scheduler.AddTask(L"SamplingDemand::" + m_name, this, cCheckIntervalTicks);
+            }
+            m_scheduler.Start();
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops the idle checks.  A check that is waiting for the lock does
+       nothing once it gets it.
+    */
+    void SamplingDemand::Stop()
+    {
+        if (0 != m_taskID)
+        {
+            // The check takes the lock held by the caller, so it can't be waited for
+            m_scheduler.RemoveTask(m_taskID, false);
+            m_taskID = 0;
+        }
+        m_suspended = false;
+        m_warmUpDueMs = 0;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Records a query of a class served by the source.
+
+       \param[in]   className   Class queried
+       \param[in]   now         Current time
+       \returns     true if sampling was suspended; the caller resumes it
+                    with one sample, and calls StartWarmUp()
+    */
+    bool SamplingDemand::Query(const std::wstring& className, time_t now)
+    {
+        m_lastQueries[className] = now;
+        m_lastActivity = now;
+        if (!m_suspended)
+        {
+            return false;
+        }
+
+        SCX_LOGINFO(m_log, L"Resuming sampling of " + m_name + L" for a query of " + className);
+        m_suspended = false;
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Suspends sampling if no class was queried for the idle seconds.
+
+       \param[in]   now   Current time
+       \returns     true if sampling was suspended by this call
+    */
+    bool SamplingDemand::CheckIdle(time_t now)
+    {
+        if (0 == m_idleSecs || m_suspended)
+        {
+            return false;
+        }
+        if (now < m_lastActivity)
+        {
+            // The clock was stepped backwards; start counting again
+            m_lastActivity = now;
+            return false;
+        }
+        if (now - m_lastActivity < m_idleSecs)
+        {
+            return false;
+        }
+
+        SCX_LOGINFO(m_log, StrAppend(L"Suspending sampling of " + m_name + L", not queried for seconds: ", now - m_lastActivity));
+        m_sampler->SuspendSampling();
+        m_suspended = true;
+        m_warmUpDueMs = 0;
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts the warm-up of resumed sampling: its second sample is due
+       cWarmUpMs after the first one.
+
+       \param[in]   nowMs   Current monotonic time, in milliseconds
+    */
+    void SamplingDemand::StartWarmUp(scxulong nowMs)
+    {
+        m_warmUpDueMs = nowMs + cWarmUpMs;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Checks whether the second sample of the warm-up is due, and ends the
+       warm-up if it is.
+
+       \param[in]   nowMs   Current monotonic time, in milliseconds
+       \returns     true if the caller has to take the second sample now
+    */
+    bool SamplingDemand::WarmUpDue(scxulong nowMs)
+    {
+        if (0 == m_warmUpDueMs || nowMs < m_warmUpDueMs)
+        {
+            return false;
+        }
+        m_warmUpDueMs = 0;
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns how long until the second sample of the warm-up is due.
+
+       \param[in]   nowMs   Current monotonic time, in milliseconds
+       \returns     Milliseconds to wait (0 if not warming up, or if it is due)
+    */
+    scxulong SamplingDemand::GetWarmUpWaitMs(scxulong nowMs) const
+    {
+        return (0 == m_warmUpDueMs || nowMs >= m_warmUpDueMs) ? 0 : m_warmUpDueMs - nowMs;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the time of the last query of a class.
+
+       \param[in]   className   Class
+       \returns     Time of the last query (0 if none since Start())
+    */
+    time_t SamplingDemand::GetLastQuery(const std::wstring& className) const
+    {
+        std::map<std::wstring, time_t>::const_iterator it = m_lastQueries.find(className);
+        return (m_lastQueries.end() == it) ? 0 : it->second;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Periodic idle check, run by the scheduler.
+    */
+    void SamplingDemand::RunSample()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(m_lockName));
+        if (0 == m_taskID)
+        {
+            // Stopped while waiting for the lock
+            return;
+        }
+        CheckIdle(time(NULL));
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
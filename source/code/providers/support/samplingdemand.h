@@ -0,0 +1,115 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        samplingdemand.h
+
+    \brief       Suspends the sampling of providers nobody queries
+
+    The PAL enumerations of some providers sample in a thread of their own
+    from the time the provider is loaded, and providers refuse to unload.
+    A SamplingDemand tracks when each class served by such an enumeration
+    was last queried, and has the enumeration released once none of them
+    was queried for "SamplingDemand_IdleSecs" seconds (configuration file setting;
+    0, the default, never suspends sampling).  The next query creates the
+    enumeration again with one sample, and the second sample, which rates
+    are computed from, is taken by the first query made cWarmUpMs later.
+    Nothing sleeps with a provider lock held: callers that can wait call
+    the WarmUp() method of the provider before taking its lock, and the
+    threshold monitor, which runs on the scheduler thread, skips the class
+    until the warm-up is over.
+
+    \date        2026-10-20 01:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SAMPLINGDEMAND_H
+#define SAMPLINGDEMAND_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxlog.h>
+
+#include "samplerscheduler.h"
+
+#include <map>
+#include <string>
+#include <time.h>
+
+namespace SCXCore
+{
+    //! Default seconds without queries before sampling is suspended (0: never)
+    const time_t cDefaultSamplingIdleSecs = 0;
+
+    time_t GetSamplingIdleSecs();
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sampling that a SamplingDemand suspends while it is idle.
+    */
+    class SuspendableSampler
+    {
+    public:
+        virtual ~SuspendableSampler() { }
+        //! Stops sampling.  Called with the lock of the SamplingDemand held.
+        virtual void SuspendSampling() = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Tracks the queries of the classes served by one sampling source, and
+       suspends its sampling while they are idle.
+
+       All methods but RunSample() must be called with the lock named in the
+       constructor (the lock of the provider owning the source) held;
+       RunSample() takes it.
+    */
+    class SamplingDemand : public SamplerTask
+    {
+    public:
+        //! Ticks between checks for idle sampling
+        static const unsigned int cCheckIntervalTicks = 60;
+        //! Milliseconds between the two samples taken after idling
+        static const int cWarmUpMs = 250;
+
+        SamplingDemand(const std::wstring& name, const std::wstring& lockName, SuspendableSampler* sampler,
+                       SamplerScheduler& scheduler = g_SamplerScheduler);
+
+        void Start(time_t idleSecs, time_t now);
+        void Stop();
+
+        bool Query(const std::wstring& className, time_t now);
+        bool CheckIdle(time_t now);
+        bool IsSuspended() const { return m_suspended; }
+        time_t GetIdleSecs() const { return m_idleSecs; }
+        time_t GetLastQuery(const std::wstring& className) const;
+
+        void StartWarmUp(scxulong nowMs);
+        bool WarmUpDue(scxulong nowMs);
+        bool IsWarmingUp() const { return 0 != m_warmUpDueMs; }
+        scxulong GetWarmUpWaitMs(scxulong nowMs) const;
+
+        virtual void RunSample();
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"SamplingDemand";
+        }
+
+    private:
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        std::wstring m_name;                            //!< Name of the sampling source
+        std::wstring m_lockName;                        //!< Lock protecting this (and the source)
+        SuspendableSampler* m_sampler;                  //!< The sampling source
+        SamplerScheduler& m_scheduler;                  //!< Scheduler of the idle checks
+        time_t m_idleSecs;                              //!< Seconds without queries before suspending (0: never)
+        time_t m_lastActivity;                          //!< Time of the last query, or of Start()
+        std::map<std::wstring, time_t> m_lastQueries;   //!< Time of the last query, by class
+        bool m_suspended;                               //!< Sampling is suspended
+        scxulong m_warmUpDueMs;                         //!< Monotonic time the warm-up sample is due (0 if none)
+        scxulong m_taskID;                              //!< Idle check task (0 if not started)
+    };
+}
+
+#endif /* SAMPLINGDEMAND_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
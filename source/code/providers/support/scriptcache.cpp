@@ -0,0 +1,495 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        scriptcache.cpp
+
+    \brief       Content-addressed cache of script files for ExecuteScript
+
+    \date        2026-10-19 13:20:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxdirectoryinfo.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxfile.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "providermetrics.h"
+#include "scriptcache.h"
+
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Name of lock protecting the cache
+    const wchar_t* const cScriptCacheLockName = L"SCXCore::ScriptCache::Lock";
+
+    SCXCore::ProviderCounter& Hits()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"ScriptCache::Hits");
+        return s_counter;
+    }
+
+    SCXCore::ProviderCounter& Misses()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"ScriptCache::Misses");
+        return s_counter;
+    }
+
+    SCXCore::ProviderCounter& Evictions()
+    {
+        static SCXCore::ProviderCounter& s_counter = SCXCore::g_ProviderMetrics.GetCounter(L"ScriptCache::Evictions");
+        return s_counter;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Writes a script to a new file that the owner may execute.
+
+       \param[in]   script      Script contents
+       \param[in]   directory   Directory to create the file in
+       \returns     Path of the new file
+    */
+    SCXFilePath WriteScriptFile(const std::wstring& script, const std::wstring& directory)
+    {
+        SCXFilePath path = SCXFile::CreateTempFile(script, directory);
+        SCXFileSystem::Attributes attribs = SCXFileSystem::GetAttributes(path);
+        attribs.insert(SCXFileSystem::eUserExecute);
+        SCXFile::SetAttributes(path, attribs);
+        return path;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Writes a script to a new cache file that only the owner may access.
+
+       \param[in]   script   Script contents
+       \param[in]   path     Path of the file
+       \throws      SCXErrnoException   If the file can't be written
+    */
+    void WriteCachedScriptFile(const std::wstring& script, const SCXFilePath& path)
+    {
+        std::string fileName = StrToMultibyte(path.Get());
+        int fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, S_IRWXU);
+        if (fd < 0 && EEXIST == errno)
+        {
+            // Left behind by an earlier entry whose file couldn't be deleted
+            unlink(fileName.c_str());
+            fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, S_IRWXU);
+        }
+        if (fd < 0)
+        {
+            throw SCXErrnoException(L"open", errno, SCXSRCLOCATION);
+        }
+
+        // The mode given to open() is subject to the umask
+        int err = (0 == fchmod(fd, S_IRWXU)) ? 0 : errno;
+
+        std::string contents = StrToUTF8(script);
+        size_t written = 0;
+        while (0 == err && written < contents.size())
+        {
+            ssize_t count = write(fd, contents.data() + written, contents.size() - written);
+            if (count < 0)
+            {
+                if (EINTR != errno)
+                {
+                    err = errno;
+                }
+                continue;
+            }
+            written += count;
+        }
+        if (0 != close(fd) && 0 == err)
+        {
+            err = errno;
+        }
+
+        if (0 != err)
+        {
+            unlink(fileName.c_str());
+            throw SCXErrnoException(L"write", err, SCXSRCLOCATION);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Checks that a cache file is still the one written by WriteCachedScriptFile():
+       a regular file (not a link) owned by the agent user with mode 0700, and
+       containing the script.
+
+       \param[in]   script   Script contents
+       \param[in]   path     Path of the file
+       \returns     true if the file may be executed
+    */
+    bool VerifyCachedScriptFile(const std::wstring& script, const SCXFilePath& path)
+    {
+        std::string fileName = StrToMultibyte(path.Get());
+        int fd = open(fileName.c_str(), O_RDONLY | O_NOFOLLOW);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        std::string contents = StrToUTF8(script);
+        struct stat st;
+        bool good = 0 == fstat(fd, &st)
+            && S_ISREG(st.st_mode)
+            && st.st_uid == geteuid()
+            && (st.st_mode & 07777) == S_IRWXU
+            && static_cast<size_t>(st.st_size) == contents.size();
+
+        char buffer[4096];
+        size_t offset = 0;
+        while (good)
+        {
+            ssize_t count = read(fd, buffer, sizeof(buffer));
+            if (count < 0)
+            {
+                good = (EINTR == errno);
+                continue;
+            }
+            if (0 == count)
+            {
+                good = (offset == contents.size());
+                break;
+            }
+            good = offset + count <= contents.size() && 0 == contents.compare(offset, count, buffer, count);
+            offset += count;
+        }
+
+        close(fd);
+        return good;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Deletes a script file, ignoring errors (the file is only wasted space).
+
+       \param[in]   path   File to delete
+    */
+    void DeleteScriptFile(const SCXFilePath& path)
+    {
+        try
+        {
+            SCXFile::Delete(path);
+        }
+        catch (SCXException& e)
+        {
+        }
+    }
+}
+
+namespace SCXCore
+{
+    ScriptCache g_ScriptCache;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   maxEntries   Maximum number of cached scripts
+       \param[in]   maxSize      Maximum total size (characters) of cached scripts
+    */
+    ScriptCache::ScriptCache(size_t maxEntries, size_t maxSize)
+        : m_maxEntries(maxEntries),
+          m_maxSize(maxSize),
+          m_size(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns a file containing the script, writing it if it is not cached.
+
+       Every successful Acquire() must be followed by a Release().
+
+       \param[in]   script      Script contents
+       \param[in]   directory   Private directory to keep the cache below
+       \returns     Path of the script file, or an empty path if the script
+                    can't be cached (the caller should use a temp file)
+    */
+    SCXFilePath ScriptCache::Acquire(const std::wstring& script, const std::wstring& directory)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cScriptCacheLockName));
+
+        if (!SetDirectory(directory))
+        {
+            Misses().Increment();
+            return SCXFilePath();
+        }
+
+        scxulong hash = Hash(script);
+        std::map<scxulong, Entry>::iterator it = m_entries.find(hash);
+        if (it != m_entries.end())
+        {
+            Entry& entry = it->second;
+            if (entry.script == script && VerifyCachedScriptFile(script, entry.path))
+            {
+                Hits().Increment();
+                entry.pins++;
+                m_lru.splice(m_lru.begin(), m_lru, entry.lru);
+                return entry.path;
+            }
+
+            // Hash collision, or the file was removed or changed behind our back
+            if (entry.pins > 0)
+            {
+                Misses().Increment();
+                return SCXFilePath();
+            }
+            Remove(it);
+        }
+
+        Misses().Increment();
+
+        std::wostringstream fileName;
+        fileName << std::hex << std::setw(16) << std::setfill(L'0') << hash;
+
+        Entry& entry = m_entries[hash];
+        try
+        {
+            entry.path.SetDirectory(m_directory);
+            entry.path.SetFilename(fileName.str());
+            WriteCachedScriptFile(script, entry.path);
+        }
+        catch (SCXException& e)
+        {
+            m_entries.erase(hash);
+            throw;
+        }
+        entry.script = script;
+        entry.pins = 1;
+        entry.lru = m_lru.insert(m_lru.begin(), hash);
+        m_size += script.size();
+
+        SCXFilePath path = entry.path;
+        Evict();
+        return path;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Releases a script acquired with Acquire().
+
+       \param[in]   script   Script contents
+    */
+    void ScriptCache::Release(const std::wstring& script)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cScriptCacheLockName));
+
+        std::map<scxulong, Entry>::iterator it = m_entries.find(Hash(script));
+        if (it != m_entries.end() && it->second.pins > 0 && it->second.script == script)
+        {
+            it->second.pins--;
+        }
+
+        // Entries that were in use may have kept the cache above its limits
+        Evict();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes all entries that are not in use.
+    */
+    void ScriptCache::Clear()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(cScriptCacheLockName));
+        ClearNoLock();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes all entries that are not in use.  Must be called with the cache
+       lock held.
+    */
+    void ScriptCache::ClearNoLock()
+    {
+        std::map<scxulong, Entry>::iterator it = m_entries.begin();
+        while (it != m_entries.end())
+        {
+            std::map<scxulong, Entry>::iterator current = it++;
+            if (0 == current->second.pins)
+            {
+                Remove(current);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Hashes a script (64-bit FNV-1a over the characters).
+
+       \param[in]   script   Script contents
+       \returns     Hash value
+    */
+    scxulong ScriptCache::Hash(const std::wstring& script)
+    {
+        scxulong hash = 14695981039346656037ULL;
+        for (std::wstring::const_iterator it = script.begin(); it != script.end(); ++it)
+        {
+            hash ^= static_cast<scxulong>(static_cast<unsigned int>(*it));
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Switches the cache to the "scriptcache-<uid>" directory below a directory,
+       creating it if needed.  Must be called with the cache lock held.
+
+       A directory that already exists is only used if it is a directory (not
+       a link) owned by the agent user with mode 0700, so nobody else can
+       place or change the files that are executed.
+
+       \param[in]   directory   Private directory to keep the cache below
+       \returns     false if the directory can't be trusted
+       \throws      SCXErrnoException   If the directory can't be created
+    */
+    bool ScriptCache::SetDirectory(const std::wstring& directory)
+    {
+        SCXFilePath path;
+        path.SetDirectory(directory);
+        path.AppendDirectory(StrAppend(L"scriptcache-", static_cast<unsigned int>(geteuid())));
+        std::wstring cacheDirectory = path.GetDirectory();
+
+        if (cacheDirectory == m_directory)
+        {
+            return true;
+        }
+
+        std::string directoryName = StrToMultibyte(cacheDirectory);
+        if (0 == mkdir(directoryName.c_str(), S_IRWXU))
+        {
+            // The mode given to mkdir() is subject to the umask
+            chmod(directoryName.c_str(), S_IRWXU);
+        }
+        else if (EEXIST != errno)
+        {
+            throw SCXErrnoException(L"mkdir", errno, SCXSRCLOCATION);
+        }
+
+        struct stat st;
+        if (0 != lstat(directoryName.c_str(), &st))
+        {
+            throw SCXErrnoException(L"lstat", errno, SCXSRCLOCATION);
+        }
+        if (!S_ISDIR(st.st_mode) || st.st_uid != geteuid() || (st.st_mode & 07777) != S_IRWXU)
+        {
+            return false;
+        }
+
+        // Files of the old directory that are in use stay until released
+        ClearNoLock();
+        m_directory = cacheDirectory;
+
+        // Remove anything left behind by an earlier run
+        std::vector<SCXFilePath> files = SCXDirectory::GetFiles(m_directory);
+        for (std::vector<SCXFilePath>::const_iterator it = files.begin(); it != files.end(); ++it)
+        {
+            DeleteScriptFile(*it);
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes least recently used entries that are not in use until the
+       cache is within its limits.  Must be called with the cache lock held.
+    */
+    void ScriptCache::Evict()
+    {
+        // Walk from the least recently used end; it is the entry after the candidate
+        std::list<scxulong>::iterator it = m_lru.end();
+        while ((m_entries.size() > m_maxEntries || m_size > m_maxSize) && it != m_lru.begin())
+        {
+            std::list<scxulong>::iterator candidate = it;
+            --candidate;
+
+            std::map<scxulong, Entry>::iterator entry = m_entries.find(*candidate);
+            if (entry->second.pins > 0)
+            {
+                it = candidate;
+                continue;
+            }
+
+            Remove(entry);
+            Evictions().Increment();
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes an entry and deletes its file.  Must be called with the cache
+       lock held.
+
+       \param[in]   it   Entry to remove
+    */
+    void ScriptCache::Remove(std::map<scxulong, Entry>::iterator it)
+    {
+        DeleteScriptFile(it->second.path);
+        m_size -= it->second.script.size();
+        m_lru.erase(it->second.lru);
+        m_entries.erase(it);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor; acquires the script file.
+
+       \param[in]   cache       Cache to acquire the script from
+       \param[in]   script      Script contents
+       \param[in]   directory   Directory for the cache (or temp file)
+       \param[in]   useCache    If false, always use a temp file (for directories
+                                that are not private to the agent)
+    */
+    ScriptCacheLease::ScriptCacheLease(ScriptCache& cache, const std::wstring& script, const std::wstring& directory,
+                                       bool useCache)
+        : m_cache(cache),
+          m_script(script),
+          m_cached(false)
+    {
+        if (useCache)
+        {
+            m_path = m_cache.Acquire(script, directory);
+            m_cached = !m_path.Get().empty();
+        }
+
+        if (!m_cached)
+        {
+            m_path = WriteScriptFile(script, directory);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor; releases the script file.
+    */
+    ScriptCacheLease::~ScriptCacheLease()
+    {
+        if (m_cached)
+        {
+            m_cache.Release(m_script);
+        }
+        else
+        {
+            DeleteScriptFile(m_path);
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,131 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        scriptcache.h
+
+    \brief       Content-addressed cache of script files for ExecuteScript
+
+    Monitoring rules send the same scripts to ExecuteScript on every
+    interval.  Scripts that must be run from a file are written once to a
+    cache directory (keyed by a hash of their contents) and reused until
+    evicted, instead of being created and deleted on every call.
+
+    \date        2026-10-19 13:20:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SCRIPTCACHE_H
+#define SCRIPTCACHE_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxfilepath.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+namespace SCXCore
+{
+    //! Default maximum number of cached scripts
+    const size_t cDefaultScriptCacheEntries = 64;
+
+    //! Default maximum total size (characters) of cached scripts
+    const size_t cDefaultScriptCacheSize = 1024*1024;
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Script file cache.
+
+       Entries are evicted least recently used first, when either the number
+       of entries or their total size exceeds the limits.  Entries in use
+       (between Acquire() and Release()) are never evicted.
+
+       Files are kept in "scriptcache-<uid>" below the directory passed to
+       Acquire(), and named by the hash of the script.  That directory is only
+       used if it is owned by the agent user with mode 0700; otherwise nothing
+       is cached.  Files left over from an earlier run are removed when the
+       directory is first used, and a cached file is only handed out again
+       once its owner, mode and contents are checked.
+
+       Hits, misses and evictions are published through the provider metrics
+       as ScriptCache::Hits, ScriptCache::Misses and ScriptCache::Evictions.
+    */
+    class ScriptCache
+    {
+    public:
+        ScriptCache(size_t maxEntries = cDefaultScriptCacheEntries, size_t maxSize = cDefaultScriptCacheSize);
+        virtual ~ScriptCache() { };
+
+        SCXCoreLib::SCXFilePath Acquire(const std::wstring& script, const std::wstring& directory);
+        void Release(const std::wstring& script);
+        void Clear();
+
+        size_t GetEntryCount() const { return m_entries.size(); }
+        size_t GetSize() const { return m_size; }
+
+        static scxulong Hash(const std::wstring& script);
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ScriptCache";
+        }
+
+    private:
+        //! One cached script
+        struct Entry
+        {
+            Entry() : pins(0) { }
+
+            std::wstring script;                //!< Script contents (hash collisions are compared in full)
+            SCXCoreLib::SCXFilePath path;       //!< Script file
+            unsigned int pins;                  //!< Number of executions using the file
+            std::list<scxulong>::iterator lru;  //!< Position in m_lru
+        };
+
+        bool SetDirectory(const std::wstring& directory);
+        void ClearNoLock();
+        void Evict();
+        void Remove(std::map<scxulong, Entry>::iterator it);
+
+        size_t m_maxEntries;                    //!< Maximum number of entries
+        size_t m_maxSize;                       //!< Maximum total size of scripts
+        size_t m_size;                          //!< Current total size of scripts
+        std::wstring m_directory;               //!< Cache directory
+        std::map<scxulong, Entry> m_entries;    //!< Entries by script hash
+        std::list<scxulong> m_lru;              //!< Hashes, most recently used first
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Holds a script file for the duration of one execution.
+
+       The file comes from the cache if possible, and is otherwise a temp file
+       that is deleted when the lease is destroyed.
+    */
+    class ScriptCacheLease
+    {
+    public:
+        ScriptCacheLease(ScriptCache& cache, const std::wstring& script, const std::wstring& directory,
+                         bool useCache = true);
+        ~ScriptCacheLease();
+
+        const SCXCoreLib::SCXFilePath& GetPath() const { return m_path; }
+
+    private:
+        //! Not implemented
+        ScriptCacheLease(const ScriptCacheLease&);
+        ScriptCacheLease& operator=(const ScriptCacheLease&);
+
+        ScriptCache& m_cache;
+        std::wstring m_script;
+        SCXCoreLib::SCXFilePath m_path;
+        bool m_cached;          //!< false if m_path is a temp file of our own
+    };
+
+    extern ScriptCache g_ScriptCache;
+}
+
+#endif /* SCRIPTCACHE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -20,6 +20,8 @@
 
 #include <MI.h>
 
+#include "providermetrics.h"
+
 namespace CIMUtils
 {
     bool ConvertToCIMDatetime( MI_Datetime& outDT, SCXCoreLib::SCXCalendarTime& inTime );
@@ -42,18 +44,39 @@ namespace CIMUtils
     try
 
 #define SCX_PEX_END(module, log) \
+    SCX_PEX_END_HANDLER(module, log, (void) 0)
+
+//
+// Timed variants for data operations (EnumerateInstances, GetInstance, Invoke_*).
+// These record the call in SCXCore::g_ProviderMetrics, keyed by the module name.
+// Instances posted may be counted with scxPexTimer.AddInstances(n).
+//
+
+#define SCX_PEX_BEGIN_TIMED(module) \
+    static SCXCore::ProviderOperationStatistics& scxPexStatistics = \
+        SCXCore::g_ProviderMetrics.GetStatistics(module); \
+    SCXCore::ProviderOperationTimer scxPexTimer(scxPexStatistics); \
+    try
+
+#define SCX_PEX_END_TIMED(module, log) \
+    SCX_PEX_END_HANDLER(module, log, scxPexTimer.SetFailed())
+
+#define SCX_PEX_END_HANDLER(module, log, onFailure) \
     catch (const SCXCoreLib::SCXException& e) \
     { \
+        onFailure; \
         SCX_LOGWARNING((log), std::wstring(module).append(L" - "). \
                        append(e.What()).append(L" - ").append(e.Where())); \
         context.Post(MI_RESULT_FAILED); \
     } \
     catch (std::exception &e) { \
+        onFailure; \
         SCX_LOGERROR((log), std::wstring(module).append(L" - ").append(SCXCoreLib::DumpString(e))); \
         context.Post(MI_RESULT_FAILED); \
     } \
     catch (...) \
     { \
+        onFailure; \
         SCX_LOGERROR((log), std::wstring(module).append(L" - Unknown exception")); \
         context.Post(MI_RESULT_FAILED); \
     }
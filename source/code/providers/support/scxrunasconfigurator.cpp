@@ -21,8 +21,116 @@
 
 using namespace SCXCoreLib;
 
+namespace
+{
+    //! Values of IOClass, by I/O scheduling class
+    const wchar_t* const s_IOClassBestEffort = L"best-effort";
+    const wchar_t* const s_IOClassIdle = L"idle";
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Parses a number from the configuration. Invalid values are logged and ignored.
+
+       \param[in]  parser  Parsed configuration.
+       \param[in]  key     Configuration key.
+       \param[out] value   Receives the value, if the key has a valid one.
+       \param[in]  log     Log handle.
+    */
+    void ParseNumber(const SCXCore::ConfigurationParser& parser, const std::wstring& key,
+                     scxulong& value, SCXLogHandle& log)
+    {
+        SCXCore::ConfigurationParser::const_iterator it = parser.find(key);
+        if (it == parser.end())
+        {
+            return;
+        }
+
+        try
+        {
+            value = StrToULong(it->second);
+        }
+        catch (SCXException& e)
+        {
+            SCX_LOGWARNING(log, StrAppend(L"Ignoring invalid value of " + key + L": ", e.What()));
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Parses a signed number within a range from the configuration. Invalid
+       values are logged and ignored.
+
+       \param[in]  parser  Parsed configuration.
+       \param[in]  key     Configuration key.
+       \param[in]  min     Smallest value accepted.
+       \param[in]  max     Largest value accepted.
+       \param[out] value   Receives the value, if the key has a valid one.
+       \param[in]  log     Log handle.
+    */
+    void ParseNumber(const SCXCore::ConfigurationParser& parser, const std::wstring& key,
+                     int min, int max, int& value, SCXLogHandle& log)
+    {
+        SCXCore::ConfigurationParser::const_iterator it = parser.find(key);
+        if (it == parser.end())
+        {
+            return;
+        }
+
+        try
+        {
+            scxlong number = StrToLong(it->second);
+            if (number < min || number > max)
+            {
+                SCX_LOGWARNING(log, L"Ignoring " + key + L" outside " + StrFrom(min) + L".." + StrFrom(max) + L": " + it->second);
+                return;
+            }
+            value = static_cast<int>(number);
+        }
+        catch (SCXException& e)
+        {
+            SCX_LOGWARNING(log, StrAppend(L"Ignoring invalid value of " + key + L": ", e.What()));
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds a number to the configuration to write, if it isn't zero.
+
+       \param[in]  writer  Configuration to write.
+       \param[in]  key     Configuration key.
+       \param[in]  value   Value.
+    */
+    template <typename T> void WriteNumber(SCXCore::ConfigurationWriter& writer, const std::wstring& key, T value)
+    {
+        if (0 != value)
+        {
+            writer.insert(std::pair<const std::wstring, std::wstring>(key, StrFrom(value)));
+        }
+    }
+}
+
 namespace SCXCore
 {
+    /*----------------------------------------------------------------------------*/
+    /**
+       Compares resource limits.
+
+       \param[in] other Limits to compare with.
+       \returns true if all limits are the same.
+    */
+    bool RunAsResourceLimits::operator==(const RunAsResourceLimits& other) const
+    {
+        return cpuSeconds == other.cpuSeconds &&
+            memoryMB == other.memoryMB &&
+            fileSizeMB == other.fileSizeMB &&
+            processes == other.processes &&
+            openFiles == other.openFiles &&
+            nice == other.nice &&
+            ioClass == other.ioClass &&
+            ioPriority == other.ioPriority &&
+            cgroup == other.cgroup;
+    }
+
     /*----------------------------------------------------------------------------*/
     /**
        Parses a stream of the form 
@@ -147,6 +255,8 @@ namespace SCXCore
     const SCXCoreLib::SCXFilePath RunAsConfigurator::s_ChRootPathDefault(L"");
     /** Default value for CWD. */
     const SCXCoreLib::SCXFilePath RunAsConfigurator::s_CWDDefault(L"/var/opt/microsoft/scx/tmp/");
+    /** Default value for elevated helper. */
+    const bool RunAsConfigurator::s_ElevatedHelperDefault(false);
 
     /*----------------------------------------------------------------------------*/
     /**
@@ -157,7 +267,8 @@ namespace SCXCore
         m_Writer(new ConfigurationFileWriter(L"/etc/opt/microsoft/scx/conf/scxrunas.conf")),
         m_AllowRoot(s_AllowRootDefault),
         m_ChRootPath(s_ChRootPathDefault),
-        m_CWD(s_CWDDefault)
+        m_CWD(s_CWDDefault),
+        m_ElevatedHelper(s_ElevatedHelperDefault)
     {
     }
 
@@ -171,7 +282,8 @@ namespace SCXCore
         m_Writer(writer),
         m_AllowRoot(s_AllowRootDefault),
         m_ChRootPath(s_ChRootPathDefault),
-        m_CWD(s_CWDDefault)
+        m_CWD(s_CWDDefault),
+        m_ElevatedHelper(s_ElevatedHelperDefault)
     {
     }
 
@@ -216,6 +328,17 @@ namespace SCXCore
             }
         }
 
+        ConfigurationParser::const_iterator elevatedHelper = m_Parser->find(L"ElevatedHelper");
+        if (elevatedHelper != m_Parser->end() && (
+                elevatedHelper->second == L"true" ||
+                elevatedHelper->second == L"yes" ||
+                elevatedHelper->second == L"1"))
+        {
+            m_ElevatedHelper = true;
+        }
+
+        ParseResourceLimits();
+
         return *this;
     }
 
@@ -254,6 +377,28 @@ namespace SCXCore
         {
             writer.insert(std::pair<const std::wstring, std::wstring>(L"CWD", m_CWD.Get()));
         }
+        if (m_ElevatedHelper != s_ElevatedHelperDefault)
+        {
+            writer.insert(std::pair<const std::wstring, std::wstring>(L"ElevatedHelper",
+                                                                      m_ElevatedHelper ? L"true" : L"false"));
+        }
+
+        WriteNumber(writer, L"MaxCPUSeconds", m_ResourceLimits.cpuSeconds);
+        WriteNumber(writer, L"MaxMemoryMB", m_ResourceLimits.memoryMB);
+        WriteNumber(writer, L"MaxFileSizeMB", m_ResourceLimits.fileSizeMB);
+        WriteNumber(writer, L"MaxProcesses", m_ResourceLimits.processes);
+        WriteNumber(writer, L"MaxOpenFiles", m_ResourceLimits.openFiles);
+        WriteNumber(writer, L"Nice", m_ResourceLimits.nice);
+        if (0 != m_ResourceLimits.ioClass)
+        {
+            writer.insert(std::pair<const std::wstring, std::wstring>(L"IOClass",
+                                                                      3 == m_ResourceLimits.ioClass ? s_IOClassIdle : s_IOClassBestEffort));
+        }
+        WriteNumber(writer, L"IOPriority", m_ResourceLimits.ioPriority);
+        if (!m_ResourceLimits.cgroup.empty())
+        {
+            writer.insert(std::pair<const std::wstring, std::wstring>(L"CGroup", m_ResourceLimits.cgroup));
+        }
 
         writer.Write();
     }
@@ -344,6 +489,96 @@ namespace SCXCore
         m_CWD = s_CWDDefault;
     }
 
+    /*----------------------------------------------------------------------------*/
+    /**
+       Return if configuration says that sudo elevated commands should be run
+       through the long-lived elevated helper.
+
+       \returns Value of ElevatedHelper.
+    */
+    bool RunAsConfigurator::GetElevatedHelper() const
+    {
+        return m_ElevatedHelper;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Set configuration if the elevated helper should be used.
+
+       \param[in] elevatedHelper Value of ElevatedHelper.
+    */
+    void RunAsConfigurator::SetElevatedHelper(bool elevatedHelper)
+    {
+        m_ElevatedHelper = elevatedHelper;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Get the resource limits for processes started by the RunAs provider.
+
+       \returns Values of MaxCPUSeconds, MaxMemoryMB, MaxFileSizeMB, MaxProcesses,
+                MaxOpenFiles, Nice, IOClass, IOPriority and CGroup.
+    */
+    const RunAsResourceLimits& RunAsConfigurator::GetResourceLimits() const
+    {
+        return m_ResourceLimits;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Set the resource limits for processes started by the RunAs provider.
+
+       \param[in] limits Resource limits.
+    */
+    void RunAsConfigurator::SetResourceLimits(const RunAsResourceLimits& limits)
+    {
+        m_ResourceLimits = limits;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Parse the resource limits. Invalid values are logged and ignored.
+
+       MaxMemoryMB and MaxFileSizeMB are in megabytes, Nice is added to the
+       niceness of the agent, IOClass is "idle" or "best-effort" (with
+       IOPriority 0-7) and CGroup is the directory of a cgroup v2 group.
+    */
+    void RunAsConfigurator::ParseResourceLimits()
+    {
+        SCXCoreLib::SCXLogHandle log = SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.runasprovider.configurator");
+
+        ParseNumber(*m_Parser, L"MaxCPUSeconds", m_ResourceLimits.cpuSeconds, log);
+        ParseNumber(*m_Parser, L"MaxMemoryMB", m_ResourceLimits.memoryMB, log);
+        ParseNumber(*m_Parser, L"MaxFileSizeMB", m_ResourceLimits.fileSizeMB, log);
+        ParseNumber(*m_Parser, L"MaxProcesses", m_ResourceLimits.processes, log);
+        ParseNumber(*m_Parser, L"MaxOpenFiles", m_ResourceLimits.openFiles, log);
+        ParseNumber(*m_Parser, L"Nice", -40, 40, m_ResourceLimits.nice, log);
+        ParseNumber(*m_Parser, L"IOPriority", 0, 7, m_ResourceLimits.ioPriority, log);
+
+        ConfigurationParser::const_iterator ioClass = m_Parser->find(L"IOClass");
+        if (ioClass != m_Parser->end())
+        {
+            if (ioClass->second == s_IOClassIdle)
+            {
+                m_ResourceLimits.ioClass = 3;
+            }
+            else if (ioClass->second == s_IOClassBestEffort)
+            {
+                m_ResourceLimits.ioClass = 2;
+            }
+            else
+            {
+                SCX_LOGWARNING(log, L"Ignoring invalid value of IOClass: " + ioClass->second);
+            }
+        }
+
+        ConfigurationParser::const_iterator cgroup = m_Parser->find(L"CGroup");
+        if (cgroup != m_Parser->end())
+        {
+            m_ResourceLimits.cgroup = ResolveEnvVars(cgroup->second);
+        }
+    }
+
     /*----------------------------------------------------------------------------*/
     /**
        Recursively translate all environment variables with their actual values.
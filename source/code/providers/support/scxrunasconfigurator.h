@@ -13,6 +13,7 @@
 #define SCXRUNASCONFIGURATOR_H
 
 #include <map>
+#include <scxcorelib/scxcmn.h>
 #include <scxcorelib/scxfilepath.h>
 #include <scxcorelib/scxhandle.h>
 #include <scxcorelib/scxexception.h>
@@ -103,6 +104,32 @@ namespace SCXCore
         SCXCoreLib::SCXFilePath m_file;
     };
 
+    /*----------------------------------------------------------------------------*/
+    /**
+       Resource limits for the processes started by the RunAs provider.
+       Zero (or empty) means not limited.
+    */
+    struct RunAsResourceLimits
+    {
+        RunAsResourceLimits() :
+            cpuSeconds(0), memoryMB(0), fileSizeMB(0), processes(0), openFiles(0),
+            nice(0), ioClass(0), ioPriority(0)
+        { }
+
+        bool operator==(const RunAsResourceLimits& other) const;
+        bool operator!=(const RunAsResourceLimits& other) const { return !(*this == other); }
+
+        scxulong cpuSeconds;        //!< CPU time (RLIMIT_CPU)
+        scxulong memoryMB;          //!< Address space in megabytes (RLIMIT_AS)
+        scxulong fileSizeMB;        //!< Size of files written in megabytes (RLIMIT_FSIZE)
+        scxulong processes;         //!< Processes of the user (RLIMIT_NPROC, where available)
+        scxulong openFiles;         //!< Open file descriptors (RLIMIT_NOFILE)
+        int nice;                   //!< Added to the niceness of the process
+        int ioClass;                //!< I/O scheduling class on Linux (2 best effort, 3 idle)
+        int ioPriority;             //!< Priority within the best effort class (0-7)
+        std::wstring cgroup;        //!< cgroup v2 directory the process is moved to
+    };
+
     /*----------------------------------------------------------------------------*/
     /**
        Class for parsing and writing configuration for the RunAs provider.
@@ -125,13 +152,19 @@ namespace SCXCore
         const SCXCoreLib::SCXFilePath& GetCWD() const;
         void SetCWD(const SCXCoreLib::SCXFilePath& path);
         void ResetCWD();
+        bool GetElevatedHelper() const;
+        void SetElevatedHelper(bool elevatedHelper);
+        const RunAsResourceLimits& GetResourceLimits() const;
+        void SetResourceLimits(const RunAsResourceLimits& limits);
 
     private:
         static const bool s_AllowRootDefault;
+        static const bool s_ElevatedHelperDefault;
         static const SCXCoreLib::SCXFilePath s_ChRootPathDefault;
         static const SCXCoreLib::SCXFilePath s_CWDDefault;
 
         const std::wstring ResolveEnvVars(const std::wstring& input) const;
+        void ParseResourceLimits();
 
         //! Handles the actual parsing.
         SCXCoreLib::SCXHandle<ConfigurationParser> m_Parser;    
@@ -143,6 +176,10 @@ namespace SCXCore
         SCXCoreLib::SCXFilePath m_ChRootPath;
         //! Value of CWD configuration.
         SCXCoreLib::SCXFilePath m_CWD;
+        //! Value of ElevatedHelper configuration.
+        bool m_ElevatedHelper;
+        //! Values of the resource limit configuration.
+        RunAsResourceLimits m_ResourceLimits;
     };
 
     /*----------------------------------------------------------------------------*/
@@ -0,0 +1,54 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        snapshotenumeration.cpp
+
+    \brief       Configuration support for batched snapshot enumerations
+
+    \date        2026-10-19 09:12:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxthreadlock.h>
+
+#include "providerconfig.h"
+#include "snapshotenumeration.h"
+
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of instances to build and post per batch.
+
+       The value is read once from the configuration file (setting
+       "SnapshotEnumeration_BatchSize") and defaults to cDefaultEnumerationBatchSize.
+
+       \returns     Batch size (always at least 1)
+    */
+    size_t GetEnumerationBatchSize()
+    {
+        static bool s_initialized = false;
+        static size_t s_batchSize = cDefaultEnumerationBatchSize;
+
+        SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::SnapshotEnumeration::Lock"));
+        if (s_initialized)
+        {
+            return s_batchSize;
+        }
+        s_initialized = true;
+
+        size_t batchSize = static_cast<size_t>(GetConfigUInt(L"SnapshotEnumeration_BatchSize", cDefaultEnumerationBatchSize));
+        if (batchSize > 0)
+        {
+            s_batchSize = batchSize;
+        }
+
+        return s_batchSize;
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
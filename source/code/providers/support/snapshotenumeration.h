@@ -0,0 +1,134 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        snapshotenumeration.h
+
+    \brief       Helper to post large enumerations outside of the provider lock
+
+    Providers with large instance counts copy the data they need out of the
+    PAL instances while holding the provider lock, release the lock, and then
+    build and post the CIM instances in bounded batches.  This keeps the time
+    the lock is held independent of how long OMI takes to serialize the
+    instances.
+
+    \date        2026-10-19 09:12:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SNAPSHOTENUMERATION_H
+#define SNAPSHOTENUMERATION_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace SCXCore
+{
+    //! Default number of instances built and posted per batch
+    const size_t cDefaultEnumerationBatchSize = 256;
+
+    size_t GetEnumerationBatchSize();
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       A value copied out of a PAL instance, along with whether the PAL
+       instance was able to supply it.
+
+       Typical use:  s.name.exists = palInstance->GetName(s.name.value);
+    */
+    template <class T>
+    struct SnapshotValue
+    {
+        SnapshotValue() : value(), exists(false) { }
+
+        T value;        //!< Value as returned from the PAL
+        bool exists;    //!< true if the PAL returned the value
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Collection of per-instance snapshots that are posted in bounded batches.
+
+       Snapshots are added while the provider lock is held.  Once the lock is
+       released, Post() builds at most GetBatchSize() CIM instances at a time,
+       posts them, and discards the snapshots that were posted.  Peak memory is
+       thus the (small) snapshots plus one batch of CIM instances.
+    */
+    template <class Snapshot>
+    class SnapshotEnumeration
+    {
+    public:
+        SnapshotEnumeration()
+            : m_batchSize(GetEnumerationBatchSize())
+        {
+        }
+
+        explicit SnapshotEnumeration(size_t batchSize)
+            : m_batchSize(batchSize > 0 ? batchSize : 1)
+        {
+        }
+
+        /**
+           Adds a new, default constructed, snapshot to the collection.
+
+           \returns     Reference to the snapshot to populate
+        */
+        Snapshot& Add()
+        {
+            m_snapshots.push_back(Snapshot());
+            return m_snapshots.back();
+        }
+
+        size_t Size() const { return m_snapshots.size(); }
+        size_t GetBatchSize() const { return m_batchSize; }
+
+        /**
+           Builds and posts all snapshots, one batch at a time.
+
+           \param[in]   context   Context to post instances to
+           \param[in]   builder   Functor called as builder(const Snapshot&, Instance&)
+           \returns     Number of instances posted
+
+           The caller must NOT hold the provider lock while calling this.
+        */
+        template <class Instance, class Context, class Builder>
+        size_t Post(Context& context, const Builder& builder)
+        {
+            size_t posted = 0;
+            std::vector<Instance> batch;
+
+            while (!m_snapshots.empty())
+            {
+                size_t count = std::min(m_batchSize, m_snapshots.size());
+
+                batch.clear();
+                batch.resize(count);
+                for (size_t i = 0; i < count; i++)
+                {
+                    builder(m_snapshots[i], batch[i]);
+                }
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    context.Post(batch[i]);
+                }
+
+                m_snapshots.erase(m_snapshots.begin(), m_snapshots.begin() + count);
+                posted += count;
+            }
+
+            return posted;
+        }
+
+    private:
+        size_t m_batchSize;                 //!< Maximum number of CIM instances alive at once
+        std::deque<Snapshot> m_snapshots;   //!< Snapshots not yet posted
+    };
+}
+
+#endif /* SNAPSHOTENUMERATION_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,165 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        systemsnapshot.cpp
+
+    \brief       Time-consistent snapshot of the system performance classes
+
+    \date        2026-10-19 12:10:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+
+#include "startuplog.h"
+#include "cpuprovider.h"
+#include "diskprovider.h"
+#include "filesystemprovider.h"
+#include "memoryprovider.h"
+#include "osprovider.h"
+#include "systemsnapshot.h"
+
+using namespace SCXSystemLib;
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Loads the providers whose enumerations make up the snapshot.
+    */
+    void SystemSnapshot::Load()
+    {
+        if ( 1 == ++ms_loadCount )
+        {
+            m_log = SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.systemsnapshot");
+            LogStartup();
+            SCX_LOGTRACE(m_log, L"SystemSnapshot::Load()");
+
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+                g_MemoryProvider.Load();
+            }
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+                g_CPUProvider.Load();
+            }
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+                g_DiskProvider.Load();
+                g_FileSystemProvider.Load();
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Unloads the providers loaded by Load().
+    */
+    void SystemSnapshot::Unload()
+    {
+        SCX_LOGTRACE(m_log, L"SystemSnapshot::Unload()");
+        if (0 == --ms_loadCount)
+        {
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+                g_FileSystemProvider.UnLoad();
+                g_DiskProvider.UnLoad();
+            }
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+                g_CPUProvider.Unload();
+            }
+            {
+                SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+                g_MemoryProvider.Unload();
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Refreshes all enumerations once and passes their instances to a sink.
+
+       The caller must hold none of the provider locks (and must have loaded
+       the OS provider).  The sink gets the operating system and memory
+       first, then each processor, disk drive and file system, each followed
+       by the total instance of its enumeration.
+
+       \param[in]   className   Class the snapshot is taken for (recorded as a
+                                query of the enumerations that track them)
+       \param[in]   sink        Receives the instances
+       \returns     Time (UTC) at which the enumerations were refreshed
+    */
+    SCXCalendarTime SystemSnapshot::Take(const std::wstring& className, SystemSnapshotSink& sink)
+    {
+        // Waits (without any lock) if CPU sampling resumes for this snapshot
+        g_CPUProvider.WarmUp(className);
+
+        SCXThreadLock osLock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
+        SCXThreadLock memLock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+        SCXThreadLock cpuLock(ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+        SCXThreadLock diskLock(ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+
+        SCXHandle<OSEnumeration> osEnum = g_OSProvider.GetOS_Enumerator();
+        SCXHandle<MemoryEnumeration> memEnum = g_MemoryProvider.GetMemoryEnumeration();
+        SCXHandle<CPUEnumeration> cpuEnum = g_CPUProvider.GetEnumCPUs(className);
+        SCXHandle<StatisticalPhysicalDiskEnumeration> physicalEnum = g_DiskProvider.getEnumstatisticalPhysicalDisks();
+        SCXHandle<StatisticalLogicalDiskEnumeration> logicalEnum = g_FileSystemProvider.getEnumstatisticalLogicalDisks();
+
+        // Refresh everything as close together as possible
+        SCXCalendarTime timestamp = SCXCalendarTime::CurrentUTC();
+        osEnum->Update();
+        g_MemoryProvider.UpdateMemoryEnumeration(true);
+        cpuEnum->Update(true);
+        physicalEnum->Update(true);
+        logicalEnum->Update(true);
+
+        sink.AddOperatingSystem(osEnum->GetTotalInstance(), memEnum->GetTotalInstance());
+        if (memEnum->GetTotalInstance() != NULL)
+        {
+            sink.AddMemory(memEnum->GetTotalInstance());
+        }
+
+        for (size_t i = 0; i < cpuEnum->Size(); i++)
+        {
+            sink.AddProcessor(cpuEnum->GetInstance(i));
+        }
+        if (cpuEnum->GetTotalInstance() != NULL)
+        {
+            sink.AddProcessor(cpuEnum->GetTotalInstance());
+        }
+
+        for (size_t i = 0; i < physicalEnum->Size(); i++)
+        {
+            sink.AddDiskDrive(physicalEnum->GetInstance(i));
+        }
+        if (physicalEnum->GetTotalInstance() != NULL)
+        {
+            sink.AddDiskDrive(physicalEnum->GetTotalInstance());
+        }
+
+        // Logical disks read their space usage on demand
+        for (size_t i = 0; i < logicalEnum->Size(); i++)
+        {
+            logicalEnum->GetInstance(i)->Update();
+            sink.AddFileSystem(logicalEnum->GetInstance(i));
+        }
+        if (logicalEnum->GetTotalInstance() != NULL)
+        {
+            logicalEnum->GetTotalInstance()->Update();
+            sink.AddFileSystem(logicalEnum->GetTotalInstance());
+        }
+
+        SCX_LOGTRACE(m_log, StrAppend(L"SystemSnapshot::Take() - processors: ", cpuEnum->Size()));
+        return timestamp;
+    }
+
+    SCXCore::SystemSnapshot g_SystemSnapshot;
+    int SCXCore::SystemSnapshot::ms_loadCount = 0;
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
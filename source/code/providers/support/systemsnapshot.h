@@ -0,0 +1,95 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        systemsnapshot.h
+
+    \brief       Time-consistent snapshot of the system performance classes
+
+    The management server polls SCX_OperatingSystem, SCX_MemoryStatisticalInformation,
+    SCX_ProcessorStatisticalInformation, SCX_FileSystemStatisticalInformation
+    and SCX_DiskDriveStatisticalInformation back to back.  A system snapshot
+    refreshes all of the underlying enumerations in one pass, with all of the
+    provider locks held, and hands their instances to a sink.
+
+    \date        2026-10-19 12:10:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SYSTEMSNAPSHOT_H
+#define SYSTEMSNAPSHOT_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxlog.h>
+#include <scxcorelib/scxtime.h>
+#include <scxsystemlib/cpuenumeration.h>
+#include <scxsystemlib/memoryenumeration.h>
+#include <scxsystemlib/osenumeration.h>
+#include <scxsystemlib/statisticallogicaldiskenumeration.h>
+#include <scxsystemlib/statisticalphysicaldiskenumeration.h>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives the instances of a system snapshot.
+
+       Take() calls the sink with all of the provider locks held, so the sink
+       must copy what it needs and must not call back into the providers.
+    */
+    class SystemSnapshotSink
+    {
+    public:
+        virtual ~SystemSnapshotSink() { };
+
+        virtual void AddOperatingSystem(SCXCoreLib::SCXHandle<SCXSystemLib::OSInstance> osinst,
+                                        SCXCoreLib::SCXHandle<SCXSystemLib::MemoryInstance> meminst) = 0;
+        virtual void AddMemory(SCXCoreLib::SCXHandle<SCXSystemLib::MemoryInstance> meminst) = 0;
+        virtual void AddProcessor(SCXCoreLib::SCXHandle<SCXSystemLib::CPUInstance> cpuinst) = 0;
+        virtual void AddDiskDrive(SCXCoreLib::SCXHandle<SCXSystemLib::StatisticalPhysicalDiskInstance> diskinst) = 0;
+        virtual void AddFileSystem(SCXCoreLib::SCXHandle<SCXSystemLib::StatisticalLogicalDiskInstance> diskinst) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Takes system snapshots.
+
+       The snapshot uses the enumerations of the OS, memory, CPU, disk and
+       file system providers.  Their locks are always taken in this order:
+
+         SCXCore::OSProvider::Lock
+         SCXCore::MemoryProvider::Lock
+         SCXCore::CPUProvider::Lock
+         SCXCore::DiskProvider::Lock
+
+       Providers only ever hold one of these locks, so this cannot deadlock.
+    */
+    class SystemSnapshot
+    {
+    public:
+        SystemSnapshot() { };
+        virtual ~SystemSnapshot() { };
+
+        void Load();
+        void Unload();
+
+        SCXCoreLib::SCXCalendarTime Take(const std::wstring& className, SystemSnapshotSink& sink);
+
+        SCXCoreLib::SCXLogHandle& GetLogHandle() { return m_log; }
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"SystemSnapshot";
+        }
+
+    private:
+        SCXCoreLib::SCXLogHandle m_log;
+        static int ms_loadCount;
+    };
+
+    extern SCXCore::SystemSnapshot g_SystemSnapshot;
+}
+
+#endif /* SYSTEMSNAPSHOT_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,150 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        sysutils.cpp
+
+    \brief       Clock and descriptor helpers shared by the provider support code
+
+    \date        2026-10-19 16:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+
+#include "sysutils.h"
+
+#include <fcntl.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns a microsecond clock that isn't affected by changes of the time
+       of day.  Where there is no monotonic clock, the time of day is returned.
+
+       \returns     Microseconds since an arbitrary point
+    */
+    scxulong GetMonotonicMicroseconds()
+    {
+#if defined(CLOCK_MONOTONIC)
+        struct timespec ts;
+        if (0 == clock_gettime(CLOCK_MONOTONIC, &ts))
+        {
+            return static_cast<scxulong>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+        }
+#endif
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        return static_cast<scxulong>(tv.tv_sec) * 1000000 + tv.tv_usec;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns GetMonotonicMicroseconds() in milliseconds.
+
+       \returns     Milliseconds since an arbitrary point
+    */
+    scxulong GetMonotonicMilliseconds()
+    {
+        return GetMonotonicMicroseconds() / 1000;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Closes a descriptor, if open, and marks it closed.
+
+       \param[in,out]  fd   Descriptor
+    */
+    void CloseFd(int& fd)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Sets close-on-exec on a descriptor, so the commands the agent runs
+       don't inherit it.  Safe to call between fork() and exec().
+
+       \param[in]   fd   Descriptor
+    */
+    void SetCloseOnExec(int fd)
+    {
+        int flags = fcntl(fd, F_GETFD);
+        if (flags >= 0)
+        {
+            fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Makes reads and writes of a descriptor non-blocking.
+
+       \param[in]   fd   Descriptor
+    */
+    void SetNonBlocking(int fd)
+    {
+        int flags = fcntl(fd, F_GETFL);
+        if (flags >= 0)
+        {
+            fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Opens a pipe used to wake a thread waiting in poll() on its read end.
+       Both ends are close-on-exec.
+
+       \param[out]  fds   Read and write end (both -1 on failure)
+       \returns     true if opened; errno is set on failure
+    */
+    bool OpenWakePipe(int fds[2])
+    {
+        if (pipe(fds) < 0)
+        {
+            fds[0] = fds[1] = -1;
+            return false;
+        }
+        SetCloseOnExec(fds[0]);
+        SetCloseOnExec(fds[1]);
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Wakes the thread waiting on a wake pipe, if the pipe is open.
+
+       \param[in]   fds   Read and write end
+    */
+    void WriteWakePipe(int fds[2])
+    {
+        if (fds[1] >= 0)
+        {
+            ssize_t ignored = write(fds[1], "", 1);
+            (void) ignored;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Closes both ends of a pipe, if open, and marks them closed.
+
+       \param[in,out]  fds   Read and write end
+    */
+    void ClosePipe(int fds[2])
+    {
+        CloseFd(fds[0]);
+        CloseFd(fds[1]);
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,34 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        sysutils.h
+
+    \brief       Clock and descriptor helpers shared by the provider support code
+
+    \date        2026-10-19 16:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef SYSUTILS_H
+#define SYSUTILS_H
+
+#include <scxcorelib/scxcmn.h>
+
+namespace SCXCore
+{
+    scxulong GetMonotonicMicroseconds();
+    scxulong GetMonotonicMilliseconds();
+
+    void CloseFd(int& fd);
+    void SetCloseOnExec(int fd);
+    void SetNonBlocking(int fd);
+
+    bool OpenWakePipe(int fds[2]);
+    void WriteWakePipe(int fds[2]);
+    void ClosePipe(int fds[2]);
+}
+
+#endif /* SYSUTILS_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,740 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        thresholdmonitor.cpp
+
+    \brief       Evaluates statistical thresholds for SCX_StatisticalThresholdIndication
+
+    \date        2026-10-19 23:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxmath.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+#include <scxsystemlib/processenumeration.h>
+
+#include "cpuprovider.h"
+#include "diskprovider.h"
+#include "filesystemprovider.h"
+#include "memoryprovider.h"
+#include "osprovider.h"
+#include "thresholdmonitor.h"
+#include "wqlfilter.h"
+
+#include <algorithm>
+
+using namespace SCXSystemLib;
+using namespace SCXCoreLib;
+
+namespace
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets a property of the operating system.
+
+       \param[in]   osinst     Operating system instance
+       \param[in]   meminst    Memory instance
+       \param[in]   property   Property name
+       \param[out]  value      Value of the property
+       \returns     true if the instance has the property
+    */
+    bool GetOperatingSystemValue(SCXHandle<OSInstance> osinst, SCXHandle<MemoryInstance> meminst,
+                                 const std::wstring& property, double& value)
+    {
+        scxulong data, data2;
+        unsigned int count;
+
+        if (L"NumberOfProcesses" == property && ProcessEnumeration::GetNumberOfProcesses(count))
+        {
+            value = count;
+            return true;
+        }
+        if (meminst != NULL)
+        {
+            if (L"TotalVisibleMemorySize" == property && meminst->GetTotalPhysicalMemory(data))
+            {
+                value = static_cast<double>(BytesToKiloBytes(data));
+                return true;
+            }
+            if (L"FreePhysicalMemory" == property && meminst->GetAvailableMemory(data))
+            {
+                value = static_cast<double>(BytesToKiloBytes(data));
+                return true;
+            }
+            if (L"FreeVirtualMemory" == property && meminst->GetAvailableMemory(data) && meminst->GetAvailableSwap(data2))
+            {
+                value = static_cast<double>(BytesToKiloBytes(data) + BytesToKiloBytes(data2));
+                return true;
+            }
+        }
+        if (L"SystemUpTime" == property && osinst != NULL && osinst->GetSystemUpTime(data))
+        {
+            value = static_cast<double>(data);
+            return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets a property of the memory statistics.
+
+       \param[in]   meminst    Memory instance
+       \param[in]   property   Property name
+       \param[out]  value      Value of the property
+       \returns     true if the instance has the property
+    */
+    bool GetMemoryValue(SCXHandle<MemoryInstance> meminst, const std::wstring& property, double& value)
+    {
+        scxulong data, data2;
+
+        if ((L"AvailableMemory" == property && meminst->GetAvailableMemory(data))
+            || (L"UsedMemory" == property && meminst->GetUsedMemory(data))
+            || (L"AvailableSwap" == property && meminst->GetAvailableSwap(data))
+            || (L"UsedSwap" == property && meminst->GetUsedSwap(data)))
+        {
+            value = static_cast<double>(BytesToMegaBytes(data));
+            return true;
+        }
+        if (L"PagesPerSec" == property && meminst->GetPageReads(data) && meminst->GetPageWrites(data2))
+        {
+            value = static_cast<double>(data + data2);
+            return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets a property of the statistics of a processor.
+
+       \param[in]   cpuinst    Processor instance
+       \param[in]   property   Property name
+       \param[out]  value      Value of the property
+       \returns     true if the instance has the property
+    */
+    bool GetProcessorValue(SCXHandle<CPUInstance> cpuinst, const std::wstring& property, double& value)
+    {
+        scxulong data;
+
+        if ((L"PercentProcessorTime" == property && cpuinst->GetProcessorTime(data))
+            || (L"PercentIdleTime" == property && cpuinst->GetIdleTime(data))
+            || (L"PercentUserTime" == property && cpuinst->GetUserTime(data))
+            || (L"PercentPrivilegedTime" == property && cpuinst->GetPrivilegedTime(data))
+            || (L"PercentIOWaitTime" == property && cpuinst->GetIowaitTime(data)))
+        {
+            value = static_cast<double>(data);
+            return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets a property of the statistics of a disk drive.
+
+       \param[in]   diskinst   Disk drive instance
+       \param[in]   property   Property name
+       \param[out]  value      Value of the property
+       \returns     true if the instance has the property
+    */
+    bool GetDiskDriveValue(SCXHandle<StatisticalPhysicalDiskInstance> diskinst, const std::wstring& property, double& value)
+    {
+        scxulong data, data2;
+
+        if ((L"PercentBusyTime" == property && diskinst->GetIOPercentageTotal(data))
+            || (L"TransfersPerSecond" == property && diskinst->GetTransfersPerSecond(data))
+            || (L"ReadsPerSecond" == property && diskinst->GetReadsPerSecond(data))
+            || (L"WritesPerSecond" == property && diskinst->GetWritesPerSecond(data)))
+        {
+            value = static_cast<double>(data);
+            return true;
+        }
+        if ((L"ReadBytesPerSecond" == property || L"WriteBytesPerSecond" == property)
+            && diskinst->GetBytesPerSecond(data, data2))
+        {
+            value = static_cast<double>(L"ReadBytesPerSecond" == property ? data : data2);
+            return true;
+        }
+        if ((L"AverageTransferTime" == property && diskinst->GetIOTimesTotal(value))
+            || (L"AverageDiskQueueLength" == property && diskinst->GetDiskQueueLength(value)))
+        {
+            return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Gets a property of the statistics of a file system.
+
+       \param[in]   diskinst   File system instance
+       \param[in]   property   Property name
+       \param[out]  value      Value of the property
+       \returns     true if the instance has the property
+    */
+    bool GetFileSystemValue(SCXHandle<StatisticalLogicalDiskInstance> diskinst, const std::wstring& property, double& value)
+    {
+        scxulong data, data2;
+
+        if ((L"PercentBusyTime" == property && diskinst->GetIOPercentageTotal(data))
+            || (L"TransfersPerSecond" == property && diskinst->GetTransfersPerSecond(data)))
+        {
+            value = static_cast<double>(data);
+            return true;
+        }
+        if ((L"UsedMegabytes" == property || L"FreeMegabytes" == property || L"PercentFreeSpace" == property)
+            && diskinst->GetDiskSize(data, data2))
+        {
+            if (L"UsedMegabytes" == property)
+            {
+                value = static_cast<double>(data);
+                return true;
+            }
+            if (L"FreeMegabytes" == property)
+            {
+                value = static_cast<double>(data2);
+                return true;
+            }
+            if (0 < data + data2)
+            {
+                value = static_cast<double>(GetPercentage(0, data2, 0, data + data2));
+                return true;
+            }
+        }
+        if (L"PercentFreeInodes" == property && diskinst->GetInodeUsage(data, data2) && 0 < data)
+        {
+            value = static_cast<double>(GetPercentage(0, data2, 0, data));
+            return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the value of the Name key of an instance.
+    */
+    std::wstring GetInstanceName(SCXHandle<CPUInstance> cpuinst)
+    {
+        return cpuinst->GetProcName();
+    }
+
+    std::wstring GetInstanceName(SCXHandle<StatisticalPhysicalDiskInstance> diskinst)
+    {
+        std::wstring name;
+        diskinst->GetDiskName(name);
+        return name;
+    }
+
+    std::wstring GetInstanceName(SCXHandle<StatisticalLogicalDiskInstance> diskinst)
+    {
+        std::wstring name;
+        diskinst->GetDiskName(name);
+        return name;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds the values of the properties of one instance, skipping the ones
+       it doesn't have.
+
+       \param[in]   name         Name of the instance
+       \param[in]   instance     Instance
+       \param[in]   getValue     Gets a property of the instance
+       \param[in]   properties   Properties wanted
+       \param[out]  values       Values added to
+    */
+    template <class Instance>
+    void AddValues(const std::wstring& name, SCXHandle<Instance> instance,
+                   bool (*getValue)(SCXHandle<Instance>, const std::wstring&, double&),
+                   const std::vector<std::wstring>& properties, std::vector<SCXCore::ThresholdValue>& values)
+    {
+        for (size_t i = 0; i < properties.size(); i++)
+        {
+            double value;
+            if (getValue(instance, properties[i], value))
+            {
+                values.push_back(SCXCore::ThresholdValue(name, properties[i], value));
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds the values of the properties of all instances of an enumeration,
+       the total instance last.
+
+       \param[in]   enumeration  Enumeration (already updated)
+       \param[in]   getValue     Gets a property of an instance
+       \param[in]   properties   Properties wanted
+       \param[out]  values       Values added to
+    */
+    template <class Enumeration, class Instance>
+    void AddEnumerationValues(SCXHandle<Enumeration> enumeration,
+                              bool (*getValue)(SCXHandle<Instance>, const std::wstring&, double&),
+                              const std::vector<std::wstring>& properties, std::vector<SCXCore::ThresholdValue>& values)
+    {
+        for (size_t i = 0; i < enumeration->Size(); i++)
+        {
+            SCXHandle<Instance> instance = enumeration->GetInstance(i);
+            AddValues(GetInstanceName(instance), instance, getValue, properties, values);
+        }
+        if (enumeration->GetTotalInstance() != NULL)
+        {
+            SCXHandle<Instance> instance = enumeration->GetTotalInstance();
+            AddValues(GetInstanceName(instance), instance, getValue, properties, values);
+        }
+    }
+}
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether a value crosses the threshold.
+
+       \param[in]   value   Sampled value
+    */
+    bool ThresholdCondition::IsMet(double value) const
+    {
+        switch (comparison)
+        {
+        case eGreater:
+            return value > threshold;
+        case eGreaterOrEqual:
+            return value >= threshold;
+        case eLess:
+            return value < threshold;
+        case eLessOrEqual:
+            return value <= threshold;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Parses the WQL filter of a subscription.  The supported form is
+
+         SELECT * FROM <class> WHERE SourceClass = '<class>'
+             AND PropertyName = '<property>' AND Value > <threshold>
+             [AND Name = '<name>'] [AND Samples = <count>]
+
+       with the conditions in any order, and Value compared with >, >=, <
+       or <=.  Without Name, every instance of the class is followed on its
+       own; without Samples, a single sample changes the state.
+
+       \param[in]   query       Filter query
+       \param[out]  condition   Threshold
+       \throws      SCXNotSupportedException if the query is not of that form
+    */
+    void ThresholdMonitor::ParseFilter(const std::wstring& query, ThresholdCondition& condition)
+    {
+        WqlFilterTokenizer tokens(query);
+        std::wstring token;
+
+        condition = ThresholdCondition();
+
+        tokens.Expect(L"SELECT");
+        tokens.Expect(L"*");
+        tokens.Expect(L"FROM");
+        if (WqlFilterTokenizer::eWord != tokens.Next(token))
+        {
+            throw SCXNotSupportedException(L"ThresholdMonitor filter expected a class: " + query, SCXSRCLOCATION);
+        }
+        tokens.Expect(L"WHERE");
+
+        bool haveName = false, haveValue = false, haveSamples = false;
+        WqlFilterTokenizer::TokenType type;
+        do
+        {
+            type = tokens.Next(token);
+            if (WqlFilterTokenizer::eWord == type && L"SOURCECLASS" == token && condition.sourceClass.empty())
+            {
+                tokens.Expect(L"=");
+                condition.sourceClass = tokens.ExpectString();
+            }
+            else if (WqlFilterTokenizer::eWord == type && L"PROPERTYNAME" == token && condition.property.empty())
+            {
+                tokens.Expect(L"=");
+                condition.property = tokens.ExpectString();
+            }
+            else if (WqlFilterTokenizer::eWord == type && L"NAME" == token && !haveName)
+            {
+                tokens.Expect(L"=");
+                condition.name = tokens.ExpectString();
+                haveName = true;
+            }
+            else if (WqlFilterTokenizer::eWord == type && L"VALUE" == token && !haveValue)
+            {
+                tokens.Next(token);
+                if (L">" == token)
+                {
+                    condition.comparison = ThresholdCondition::eGreater;
+                }
+                else if (L">=" == token)
+                {
+                    condition.comparison = ThresholdCondition::eGreaterOrEqual;
+                }
+                else if (L"<" == token)
+                {
+                    condition.comparison = ThresholdCondition::eLess;
+                }
+                else if (L"<=" == token)
+                {
+                    condition.comparison = ThresholdCondition::eLessOrEqual;
+                }
+                else
+                {
+                    throw SCXNotSupportedException(L"ThresholdMonitor filter expected >, >=, < or <= after Value: " + query, SCXSRCLOCATION);
+                }
+                condition.threshold = tokens.ExpectNumber();
+                haveValue = true;
+            }
+            else if (WqlFilterTokenizer::eWord == type && L"SAMPLES" == token && !haveSamples)
+            {
+                tokens.Expect(L"=");
+                double samples = tokens.ExpectNumber();
+                if (samples < 1 || samples > cMaxSamples || samples != static_cast<unsigned int>(samples))
+                {
+                    throw SCXNotSupportedException(StrAppend(L"ThresholdMonitor filter Samples must be a whole number from 1 to ", cMaxSamples)
+                                                   + L": " + query, SCXSRCLOCATION);
+                }
+                condition.samples = static_cast<unsigned int>(samples);
+                haveSamples = true;
+            }
+            else
+            {
+                throw SCXNotSupportedException(L"ThresholdMonitor filter not supported: " + query, SCXSRCLOCATION);
+            }
+
+            type = tokens.Next(token);
+        } while (WqlFilterTokenizer::eWord == type && L"AND" == token);
+
+        if (WqlFilterTokenizer::eEnd != type || condition.sourceClass.empty() || condition.property.empty() || !haveValue)
+        {
+            throw SCXNotSupportedException(L"ThresholdMonitor filter must select a SourceClass, PropertyName and Value: " + query, SCXSRCLOCATION);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Constructor
+
+       \param[in]   sink            Receives the state changes
+       \param[in]   scheduler       Runs the samples
+       \param[in]   intervalTicks   Interval between samples, in ticks of the scheduler
+    */
+    ThresholdMonitor::ThresholdMonitor(ThresholdSink* sink, SamplerScheduler& scheduler, unsigned int intervalTicks)
+        : m_log(SCXLogHandleFactory::GetLogHandle(L"scx.core.providers.thresholdmonitor")),
+          m_scheduler(scheduler),
+          m_intervalTicks(intervalTicks),
+          m_sink(sink),
+          m_taskID(0)
+    {
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Destructor
+    */
+    ThresholdMonitor::~ThresholdMonitor()
+    {
+        Stop();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Starts sampling, as a task of the sampler scheduler.
+
+       \returns     true if the scheduler is running
+    */
+    bool ThresholdMonitor::Start()
+    {
+        {
+            SCXConditionHandle h(m_cond);
+            if (0 == m_taskID)
+            {
+                m_taskID = m_scheduler.AddTask(L"ThresholdMonitor", this, m_intervalTicks);
+                SCX_LOGTRACE(m_log, StrAppend(L"Sampling thresholds every ms: ",
+                                              static_cast<scxulong>(m_intervalTicks) * m_scheduler.GetTickMs()));
+            }
+        }
+
+        if (!m_scheduler.Start())
+        {
+            SCX_LOGWARNING(m_log, L"Unable to start threshold sampling, sampler scheduler not running");
+            Stop();
+            return false;
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Stops sampling, after a sample being taken (if any) is evaluated.
+       Subscriptions, and their states, are kept.
+    */
+    void ThresholdMonitor::Stop()
+    {
+        scxulong taskID;
+        {
+            SCXConditionHandle h(m_cond);
+            taskID = m_taskID;
+            m_taskID = 0;
+        }
+
+        // Not locked: removing waits for a running sample, which locks the monitor
+        if (0 != taskID)
+        {
+            m_scheduler.RemoveTask(taskID);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns whether samples are being taken.
+    */
+    bool ThresholdMonitor::IsRunning()
+    {
+        {
+            SCXConditionHandle h(m_cond);
+            if (0 == m_taskID)
+            {
+                return false;
+            }
+        }
+        return m_scheduler.IsRunning();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Adds a subscription.  Every instance starts out below its threshold.
+
+       \param[in]   subscriptionID   Subscription, passed to the sink with its changes
+       \param[in]   condition        Threshold
+    */
+    void ThresholdMonitor::Subscribe(scxulong subscriptionID, const ThresholdCondition& condition)
+    {
+        Subscription subscription;
+        subscription.id = subscriptionID;
+        subscription.condition = condition;
+
+        SCXConditionHandle h(m_cond);
+        m_subscriptions.push_back(subscription);
+
+        SCX_LOGTRACE(m_log, StrAppend(L"ThresholdMonitor Subscribe - ID: ", subscriptionID)
+                     + L" " + condition.sourceClass + L"." + condition.property);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Removes a subscription.  Once this returns, the sink gets no more
+       changes for it.
+
+       \param[in]   subscriptionID   Subscription
+       \returns     true if the subscription was found
+    */
+    bool ThresholdMonitor::Unsubscribe(scxulong subscriptionID)
+    {
+        SCXConditionHandle h(m_cond);
+        for (std::vector<Subscription>::iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it)
+        {
+            if (it->id == subscriptionID)
+            {
+                SCX_LOGTRACE(m_log, StrAppend(L"ThresholdMonitor Unsubscribe - ID: ", subscriptionID));
+                m_subscriptions.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Returns the number of subscriptions.
+    */
+    size_t ThresholdMonitor::GetSubscriptionCount()
+    {
+        SCXConditionHandle h(m_cond);
+        return m_subscriptions.size();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Evaluates the thresholds on a class against one sample of it.  An
+       instance changes state once its value contradicts the state for as
+       many consecutive samples as the subscription requires; a sample that
+       agrees with the state starts the count over.  A sample without the
+       value (a property a platform doesn't have) does neither.
+
+       \param[in]   sourceClass   Class sampled
+       \param[in]   values        Values of the sample
+    */
+    void ThresholdMonitor::Evaluate(const std::wstring& sourceClass, const std::vector<ThresholdValue>& values)
+    {
+        SCXConditionHandle h(m_cond);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            const ThresholdValue& value = values[i];
+
+            for (std::vector<Subscription>::iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it)
+            {
+                const ThresholdCondition& condition = it->condition;
+                if (condition.sourceClass != sourceClass || condition.property != value.property
+                    || (!condition.name.empty() && condition.name != value.name))
+                {
+                    continue;
+                }
+
+                InstanceState& state = it->states[value.name];
+                if (condition.IsMet(value.value) == state.exceeded)
+                {
+                    state.count = 0;
+                    continue;
+                }
+                if (++state.count < condition.samples)
+                {
+                    continue;
+                }
+
+                state.exceeded = !state.exceeded;
+                state.count = 0;
+
+                ThresholdChange change;
+                change.sourceClass = sourceClass;
+                change.name = value.name;
+                change.property = condition.property;
+                change.threshold = condition.threshold;
+                change.value = value.value;
+                change.samples = condition.samples;
+                change.exceeded = state.exceeded;
+                m_sink->PostChange(it->id, change);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Refreshes the enumeration of a class, and reads properties of its
+       instances.  Classes other than the ones listed in the file doc have no
+       values, nor has SCX_ProcessorStatisticalInformation while its sampling
+       warms up after idling (see SamplingDemand).
+
+       \param[in]   sourceClass   Class to sample
+       \param[in]   properties    Properties to read
+       \param[out]  values        Values read
+    */
+    void ThresholdMonitor::TakeSample(const std::wstring& sourceClass,
+                                      const std::vector<std::wstring>& properties,
+                                      std::vector<ThresholdValue>& values)
+    {
+        values.clear();
+
+        if (L"SCX_OperatingSystem" == sourceClass)
+        {
+            // Same lock order as SystemSnapshot
+            SCXThreadLock osLock(ThreadLockHandleGet(L"SCXCore::OSProvider::Lock"));
+            SCXThreadLock memLock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+
+            SCXHandle<OSEnumeration> osEnum = g_OSProvider.GetOS_Enumerator();
+            osEnum->Update();
+            g_MemoryProvider.UpdateMemoryEnumeration();
+
+            SCXHandle<OSInstance> osinst = osEnum->GetTotalInstance();
+            SCXHandle<MemoryInstance> meminst = g_MemoryProvider.GetMemoryEnumeration()->GetTotalInstance();
+            std::wstring name = g_OSProvider.GetOSTypeInfo()->GetOSName(true);
+            for (size_t i = 0; i < properties.size(); i++)
+            {
+                double value;
+                if (GetOperatingSystemValue(osinst, meminst, properties[i], value))
+                {
+                    values.push_back(ThresholdValue(name, properties[i], value));
+                }
+            }
+        }
+        else if (L"SCX_MemoryStatisticalInformation" == sourceClass)
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+            g_MemoryProvider.UpdateMemoryEnumeration();
+
+            SCXHandle<MemoryInstance> meminst = g_MemoryProvider.GetMemoryEnumeration()->GetTotalInstance();
+            if (meminst != NULL)
+            {
+                AddValues(L"Memory", meminst, GetMemoryValue, properties, values);
+            }
+        }
+        else if (L"SCX_ProcessorStatisticalInformation" == sourceClass)
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::CPUProvider::Lock"));
+            SCXHandle<CPUEnumeration> cpuEnum = g_CPUProvider.GetEnumCPUs(L"SCX_StatisticalThresholdIndication");
+            if (g_CPUProvider.IsWarmingUp())
+            {
+                // Sampling just resumed, so the percentages would come from one sample
+                return;
+            }
+            cpuEnum->Update(true);
+            AddEnumerationValues(cpuEnum, GetProcessorValue, properties, values);
+        }
+        else if (L"SCX_DiskDriveStatisticalInformation" == sourceClass)
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+            SCXHandle<StatisticalPhysicalDiskEnumeration> diskEnum = g_DiskProvider.getEnumstatisticalPhysicalDisks();
+            diskEnum->Update(true);
+            AddEnumerationValues(diskEnum, GetDiskDriveValue, properties, values);
+        }
+        else if (L"SCX_FileSystemStatisticalInformation" == sourceClass)
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::DiskProvider::Lock"));
+            SCXHandle<StatisticalLogicalDiskEnumeration> diskEnum = g_FileSystemProvider.getEnumstatisticalLogicalDisks();
+            diskEnum->Update(true);
+
+            // Like the provider, refresh the space and inode counts of each file system
+            for (size_t i = 0; i < diskEnum->Size(); i++)
+            {
+                diskEnum->GetInstance(i)->Update();
+            }
+            if (diskEnum->GetTotalInstance() != NULL)
+            {
+                diskEnum->GetTotalInstance()->Update();
+            }
+            AddEnumerationValues(diskEnum, GetFileSystemValue, properties, values);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Samples the classes that have subscriptions, reading only the
+       subscribed properties, and evaluates the samples.  Runs on the sampler
+       scheduler thread.
+    */
+    void ThresholdMonitor::RunSample()
+    {
+        std::map<std::wstring, std::vector<std::wstring> > classes;
+        {
+            SCXConditionHandle h(m_cond);
+            for (std::vector<Subscription>::const_iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it)
+            {
+                std::vector<std::wstring>& properties = classes[it->condition.sourceClass];
+                if (properties.end() == std::find(properties.begin(), properties.end(), it->condition.property))
+                {
+                    properties.push_back(it->condition.property);
+                }
+            }
+        }
+
+        // Sampling takes the provider locks; it is done without the monitor locked
+        std::vector<ThresholdValue> values;
+        for (std::map<std::wstring, std::vector<std::wstring> >::const_iterator it = classes.begin(); it != classes.end(); ++it)
+        {
+            TakeSample(it->first, it->second, values);
+            Evaluate(it->first, values);
+        }
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,177 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        thresholdmonitor.h
+
+    \brief       Evaluates statistical thresholds for SCX_StatisticalThresholdIndication
+
+    Subscribers register a threshold on a numeric property of
+    SCX_OperatingSystem, SCX_MemoryStatisticalInformation,
+    SCX_ProcessorStatisticalInformation, SCX_DiskDriveStatisticalInformation
+    or SCX_FileSystemStatisticalInformation (for example PercentProcessorTime
+    of SCX_ProcessorStatisticalInformation), and the number of consecutive
+    samples it must be crossed for.  A task of the sampler scheduler reads the
+    values from the enumerations of the subscribed classes at a fixed
+    interval, and reports only when an instance enters or leaves the exceeded
+    state.
+
+    \date        2026-10-19 23:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef THRESHOLDMONITOR_H
+#define THRESHOLDMONITOR_H
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxcondition.h>
+#include <scxcorelib/scxlog.h>
+
+#include "indicationsubscriptions.h"
+#include "samplerscheduler.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SCXCore
+{
+    /**
+       Threshold of a subscription.
+    */
+    struct ThresholdCondition
+    {
+        //! Comparison of the sampled value with the threshold
+        enum Comparison
+        {
+            eGreater,
+            eGreaterOrEqual,
+            eLess,
+            eLessOrEqual
+        };
+
+        ThresholdCondition() : comparison(eGreater), threshold(0), samples(1) {}
+
+        bool IsMet(double value) const;
+
+        std::wstring sourceClass;   //!< Class sampled
+        std::wstring name;          //!< Name of the instance (empty for all instances)
+        std::wstring property;      //!< Property compared
+        Comparison comparison;      //!< Comparison
+        double threshold;           //!< Threshold
+        unsigned int samples;       //!< Consecutive samples needed to change state
+    };
+
+    /**
+       Value of a property of one instance, in a sample.
+    */
+    struct ThresholdValue
+    {
+        ThresholdValue(const std::wstring& name_, const std::wstring& property_, double value_)
+            : name(name_), property(property_), value(value_) {}
+
+        std::wstring name;          //!< Name of the instance
+        std::wstring property;      //!< Property
+        double value;               //!< Value of the property
+    };
+
+    /**
+       An instance that entered or left the exceeded state of a subscription.
+    */
+    struct ThresholdChange
+    {
+        std::wstring sourceClass;   //!< Class sampled
+        std::wstring name;          //!< Name of the instance
+        std::wstring property;      //!< Property compared
+        double threshold;           //!< Threshold
+        double value;               //!< Value of the sample that changed the state
+        unsigned int samples;       //!< Consecutive samples needed to change state
+        bool exceeded;              //!< Entered (true) or left (false) the exceeded state
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Receives the state changes of a ThresholdMonitor.  Called on the
+       sampler scheduler thread with the monitor locked, so it must not call
+       back into the monitor.
+    */
+    class ThresholdSink
+    {
+    public:
+        virtual ~ThresholdSink() { }
+        virtual void PostChange(scxulong subscriptionID, const ThresholdChange& change) = 0;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Samples the subscribed classes, and reports threshold state changes.
+    */
+    class ThresholdMonitor : public SamplerTask, public IndicationSource
+    {
+    public:
+        //! Interval between samples, in ticks of the sampler scheduler
+        static const unsigned int cSampleIntervalTicks = 60;
+        //! Most consecutive samples a subscription may require
+        static const unsigned int cMaxSamples = 60;
+
+        static void ParseFilter(const std::wstring& query, ThresholdCondition& condition);
+
+        ThresholdMonitor(ThresholdSink* sink,
+                         SamplerScheduler& scheduler = g_SamplerScheduler,
+                         unsigned int intervalTicks = cSampleIntervalTicks);
+        virtual ~ThresholdMonitor();
+
+        virtual bool Start();
+        virtual void Stop();
+        bool IsRunning();
+
+        void Subscribe(scxulong subscriptionID, const ThresholdCondition& condition);
+        virtual bool Unsubscribe(scxulong subscriptionID);
+        size_t GetSubscriptionCount();
+
+        virtual void RunSample();
+
+        // Public solely for unit tests (done by RunSample otherwise) ...
+        void Evaluate(const std::wstring& sourceClass, const std::vector<ThresholdValue>& values);
+
+        virtual const std::wstring DumpString() const
+        {
+            return L"ThresholdMonitor";
+        }
+
+    protected:
+        virtual void TakeSample(const std::wstring& sourceClass,
+                                const std::vector<std::wstring>& properties,
+                                std::vector<ThresholdValue>& values);
+
+    private:
+        //! State of one instance for a subscription
+        struct InstanceState
+        {
+            InstanceState() : exceeded(false), count(0) {}
+
+            bool exceeded;              //!< Instance is in the exceeded state
+            unsigned int count;         //!< Consecutive samples contradicting the state
+        };
+
+        //! Subscription to a threshold
+        struct Subscription
+        {
+            scxulong id;                                    //!< Subscription ID
+            ThresholdCondition condition;                   //!< Threshold
+            std::map<std::wstring, InstanceState> states;   //!< States, by instance name
+        };
+
+        SCXCoreLib::SCXLogHandle m_log;                 //!< Log handle
+        SamplerScheduler& m_scheduler;                  //!< Runs the samples
+        unsigned int m_intervalTicks;                   //!< Interval between samples
+        SCXCoreLib::SCXCondition m_cond;                //!< Protects the members below
+        ThresholdSink* m_sink;                          //!< Receives the state changes
+        std::vector<Subscription> m_subscriptions;      //!< Subscriptions
+        scxulong m_taskID;                              //!< Sampling task (0 while stopped)
+    };
+}
+
+#endif /* THRESHOLDMONITOR_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
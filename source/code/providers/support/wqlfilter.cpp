@@ -0,0 +1,161 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        wqlfilter.cpp
+
+    \brief       Tokenizer for the WQL filters of indication subscriptions
+
+    \date        2026-10-19 23:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+
+#include "wqlfilter.h"
+
+#include <stdlib.h>
+#include <wctype.h>
+
+using namespace SCXCoreLib;
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the next token.
+
+       \param[out]  token   Word (upper case), string (without quotes), number or symbol
+       \returns     Type of the token
+       \throws      SCXNotSupportedException for characters not in the grammar
+    */
+    WqlFilterTokenizer::TokenType WqlFilterTokenizer::Next(std::wstring& token)
+    {
+        token.clear();
+        while (m_pos < m_query.size() && iswspace(m_query[m_pos]))
+        {
+            m_pos++;
+        }
+        if (m_pos >= m_query.size())
+        {
+            return eEnd;
+        }
+
+        wchar_t c = m_query[m_pos];
+        if (iswalpha(c) || L'_' == c)
+        {
+            while (m_pos < m_query.size() && (iswalnum(m_query[m_pos]) || L'_' == m_query[m_pos]))
+            {
+                token += static_cast<wchar_t>(towupper(m_query[m_pos++]));
+            }
+            return eWord;
+        }
+        if (iswdigit(c) || ((L'-' == c || L'.' == c) && m_pos + 1 < m_query.size() && iswdigit(m_query[m_pos + 1])))
+        {
+            token += m_query[m_pos++];
+            while (m_pos < m_query.size() && (iswdigit(m_query[m_pos]) || L'.' == m_query[m_pos]))
+            {
+                token += m_query[m_pos++];
+            }
+            return eNumber;
+        }
+        if (L'\'' == c || L'"' == c)
+        {
+            m_pos++;
+            while (m_pos < m_query.size() && m_query[m_pos] != c)
+            {
+                if (L'\\' == m_query[m_pos] && m_pos + 1 < m_query.size()
+                    && (m_query[m_pos + 1] == c || L'\\' == m_query[m_pos + 1]))
+                {
+                    m_pos++;
+                }
+                token += m_query[m_pos++];
+            }
+            if (m_pos >= m_query.size())
+            {
+                throw SCXNotSupportedException(L"WQL filter has unterminated string: " + m_query, SCXSRCLOCATION);
+            }
+            m_pos++;
+            return eString;
+        }
+        if (L'<' == c || L'>' == c)
+        {
+            token = c;
+            m_pos++;
+            if (m_pos < m_query.size() && (L'=' == m_query[m_pos] || (L'<' == c && L'>' == m_query[m_pos])))
+            {
+                token += m_query[m_pos++];
+            }
+            return eSymbol;
+        }
+        if (L'*' == c || L'=' == c || L'(' == c || L')' == c)
+        {
+            token = c;
+            m_pos++;
+            return eSymbol;
+        }
+
+        throw SCXNotSupportedException(L"WQL filter not understood: " + m_query, SCXSRCLOCATION);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the next token, which must be the given word or symbol.
+
+       \param[in]   expected   Word (upper case) or symbol
+       \throws      SCXNotSupportedException if it is something else
+    */
+    void WqlFilterTokenizer::Expect(const std::wstring& expected)
+    {
+        std::wstring token;
+        TokenType type = Next(token);
+        if ((eWord != type && eSymbol != type) || token != expected)
+        {
+            throw SCXNotSupportedException(L"WQL filter expected " + expected + L": " + m_query, SCXSRCLOCATION);
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the next token, which must be a string.
+
+       \returns     The string
+       \throws      SCXNotSupportedException if it is something else
+    */
+    std::wstring WqlFilterTokenizer::ExpectString()
+    {
+        std::wstring token;
+        if (eString != Next(token))
+        {
+            throw SCXNotSupportedException(L"WQL filter expected a string: " + m_query, SCXSRCLOCATION);
+        }
+        return token;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Reads the next token, which must be a number.
+
+       \returns     The number
+       \throws      SCXNotSupportedException if it is something else
+    */
+    double WqlFilterTokenizer::ExpectNumber()
+    {
+        std::wstring token;
+        if (eNumber != Next(token))
+        {
+            throw SCXNotSupportedException(L"WQL filter expected a number: " + m_query, SCXSRCLOCATION);
+        }
+
+        wchar_t* end = NULL;
+        double value = wcstod(token.c_str(), &end);
+        if (NULL == end || L'\0' != *end)
+        {
+            throw SCXNotSupportedException(L"WQL filter has invalid number " + token + L": " + m_query, SCXSRCLOCATION);
+        }
+        return value;
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,61 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation. All rights reserved. See license.txt for license information.
+*/
+/**
+    \file        wqlfilter.h
+
+    \brief       Tokenizer for the WQL filters of indication subscriptions
+
+    The indication providers support one fixed form of filter each; this
+    splits a filter into the tokens those forms are parsed from.
+
+    \date        2026-10-19 23:00:00
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef WQLFILTER_H
+#define WQLFILTER_H
+
+#include <scxcorelib/scxcmn.h>
+
+#include <string>
+
+namespace SCXCore
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Splits a WQL query into words, quoted strings, numbers and the symbols
+       * = ( ) < > <= >= <>.  Within a string, a backslash escapes a quote or a
+       backslash; other backslashes are kept, so regular expressions can be
+       written as is.
+    */
+    class WqlFilterTokenizer
+    {
+    public:
+        enum TokenType
+        {
+            eEnd,
+            eWord,
+            eString,
+            eNumber,
+            eSymbol
+        };
+
+        WqlFilterTokenizer(const std::wstring& query) : m_query(query), m_pos(0) { }
+
+        TokenType Next(std::wstring& token);
+        void Expect(const std::wstring& expected);
+        std::wstring ExpectString();
+        double ExpectNumber();
+
+        const std::wstring& GetQuery() const { return m_query; }
+
+    private:
+        const std::wstring m_query;     //!< Query
+        size_t m_pos;                   //!< Position of the next token
+    };
+}
+
+#endif /* WQLFILTER_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
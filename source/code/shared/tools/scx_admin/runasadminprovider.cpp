@@ -75,7 +75,8 @@ bool SCX_RunAsAdminProvider::Print(std::wostringstream& buf) const
 {
     buf << L"CWD = " << m_Configurator.GetCWD().Get() << std::endl
         << L"ChRootPath = " << m_Configurator.GetChRootPath().Get() << std::endl
-        << L"AllowRoot = " << (m_Configurator.GetAllowRoot() == true ? L"true" : L"false") << std::endl;
+        << L"AllowRoot = " << (m_Configurator.GetAllowRoot() == true ? L"true" : L"false") << std::endl
+        << L"ElevatedHelper = " << (m_Configurator.GetElevatedHelper() == true ? L"true" : L"false") << std::endl;
        
     return true;
 }
@@ -109,11 +110,18 @@ bool SCX_RunAsAdminProvider::Reset( const std::wstring& name )
         m_Configurator.Write();
         return true;
     }
+    else if (L"elevatedhelper" == lowerName)
+    {
+        m_Configurator.SetElevatedHelper(false);
+        m_Configurator.Write();
+        return true;
+    }
     else if (L"" == name)
     {
         m_Configurator.SetAllowRoot(m_AllowRootDefault);
         m_Configurator.ResetChRootPath();
         m_Configurator.ResetCWD();
+        m_Configurator.SetElevatedHelper(false);
         m_Configurator.Write();
         return true;
     }
@@ -156,6 +164,16 @@ bool SCX_RunAsAdminProvider::Set(const std::wstring& name, const std::wstring& v
         m_Configurator.Write();
         return true;
     }
+    else if (L"elevatedhelper" == lowerName)
+    {
+        if (L"true" == lowerValue ||
+            L"false" == lowerValue)
+        {
+            m_Configurator.SetElevatedHelper(L"true" == lowerValue);
+            m_Configurator.Write();
+            return true;
+        }
+    }
     throw SCXAdminException(L"unknown property name " + name + L" or invalid value " + value, SCXSRCLOCATION);
 }
 
@@ -257,8 +257,8 @@ static void usage(char const * const name, int exitValue)
 #if !defined(SCX_STACK_ONLY)
         "\tProviders Management\n" <<
         "scxadmin -config-list {RunAs} \n" <<
-        "scxadmin -config-set {RunAs} {CWD=<directory>|ChRootPath=<directory>|AllowRoot={true|false}}\n" <<
-        "scxadmin -config-reset {RunAs} [CWD|ChRootPath|AllowRoot]\n" <<
+        "scxadmin -config-set {RunAs} {CWD=<directory>|ChRootPath=<directory>|AllowRoot={true|false}|ElevatedHelper={true|false}}\n" <<
+        "scxadmin -config-reset {RunAs} [CWD|ChRootPath|AllowRoot|ElevatedHelper]\n" <<
         "\n" <<
 #endif
         "\tLog Configuration Management\n" <<
@@ -0,0 +1,121 @@
+#!/bin/sh
+
+# Create (or remove) fixtures for providerbench on a Linux build box.
+#
+# The providers read the live /proc and /sys trees through PAL, so fixtures
+# are created on the running system:
+#
+#   - PROCESSES sleeping processes (default 10000)
+#   - a log file of LOG_MB megabytes (default 2048), with one line in 1000
+#     matching "ERROR"
+#   - if run as root: MOUNTS tmpfs mounts (default 500) and NICS dummy
+#     network interfaces (default 200)
+#
+# Usage: createfixtures.sh setup|teardown [directory]
+#
+# State needed for teardown is kept in the directory (default ./benchfixtures).
+
+PROCESSES=${PROCESSES:-10000}
+LOG_MB=${LOG_MB:-2048}
+MOUNTS=${MOUNTS:-500}
+NICS=${NICS:-200}
+
+ACTION=$1
+FIXTURE_DIR=${2:-./benchfixtures}
+
+is_root()
+{
+    [ "`id -u`" -eq 0 ]
+}
+
+setup()
+{
+    mkdir -p $FIXTURE_DIR || exit 1
+
+    echo "Starting $PROCESSES processes ..."
+    i=0
+    while [ $i -lt $PROCESSES ]; do
+        sleep 86400 &
+        echo $! >> $FIXTURE_DIR/pids
+        i=`expr $i + 1`
+    done
+
+    echo "Generating ${LOG_MB}MB log file $FIXTURE_DIR/bench.log ..."
+    awk -v mb=$LOG_MB 'BEGIN {
+        line = 0; bytes = 0; limit = mb * 1024 * 1024;
+        while (bytes < limit) {
+            if (line % 1000 == 0)
+                s = sprintf("%010d ERROR providerbench synthetic failure on request %d", line, line);
+            else
+                s = sprintf("%010d INFO providerbench synthetic message for request %d", line, line);
+            print s;
+            bytes += length(s) + 1;
+            line++;
+        }
+    }' > $FIXTURE_DIR/bench.log
+
+    if is_root; then
+        echo "Mounting $MOUNTS tmpfs file systems ..."
+        i=0
+        while [ $i -lt $MOUNTS ]; do
+            mkdir -p $FIXTURE_DIR/mnt/$i
+            mount -t tmpfs -o size=1m benchfs$i $FIXTURE_DIR/mnt/$i && echo $FIXTURE_DIR/mnt/$i >> $FIXTURE_DIR/mounts
+            i=`expr $i + 1`
+        done
+
+        echo "Creating $NICS dummy network interfaces ..."
+        i=0
+        while [ $i -lt $NICS ]; do
+            ip link add bench$i type dummy && ip link set bench$i up && echo bench$i >> $FIXTURE_DIR/nics
+            i=`expr $i + 1`
+        done
+    else
+        echo "Not root; skipping mounts and network interfaces"
+    fi
+
+    echo "Run: providerbench -l $FIXTURE_DIR/bench.log"
+}
+
+teardown()
+{
+    if [ -f $FIXTURE_DIR/pids ]; then
+        xargs kill < $FIXTURE_DIR/pids 2> /dev/null
+        rm -f $FIXTURE_DIR/pids
+    fi
+
+    if [ -f $FIXTURE_DIR/mounts ]; then
+        for m in `cat $FIXTURE_DIR/mounts`; do
+            umount $m
+        done
+        rm -f $FIXTURE_DIR/mounts
+    fi
+
+    if [ -f $FIXTURE_DIR/nics ]; then
+        for n in `cat $FIXTURE_DIR/nics`; do
+            ip link delete $n
+        done
+        rm -f $FIXTURE_DIR/nics
+    fi
+
+    rm -rf $FIXTURE_DIR
+}
+
+if [ "`uname`" != "Linux" ]; then
+    echo "Fixtures are only supported on Linux" >&2
+    exit 1
+fi
+
+case "$ACTION" in
+    setup)
+        setup
+        ;;
+    teardown)
+        teardown
+        ;;
+    *)
+        echo "Usage: $0 setup|teardown [directory]" >&2
+        exit 1
+        ;;
+esac
+
+exit 0
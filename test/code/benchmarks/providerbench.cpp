@@ -0,0 +1,437 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Microbenchmarks for the provider hot paths
+
+   Runs the EnumerateInstances paths of the process, disk, filesystem,
+   network and CPU providers, and the logfile reader, a number of times and
+   reports per-operation latency, heap allocations, and read and write
+   calls.  The read and write calls come from /proc/self/io, which counts
+   only the read- and write-family system calls (read, pread, readv, write,
+   ...); open, close, stat and other system calls aren't counted.
+
+   The data the providers see is whatever the system has; use
+   createfixtures.sh to populate the system with large numbers of processes,
+   mounts, network interfaces and a large log file first.
+
+   Usage: providerbench [-i iterations] [-o operation-substring] [-l logfile]
+
+   \date        2026-10-19 11:20:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxfile.h>
+#include <scxcorelib/scxhandle.h>
+#include <scxcorelib/scxpersistence.h>
+#include <scxcorelib/scxregex.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/providertestutils.h>
+
+#include "SCX_DiskDrive_Class_Provider.h"
+#include "SCX_DiskDriveStatisticalInformation_Class_Provider.h"
+#include "SCX_EthernetPortStatistics_Class_Provider.h"
+#include "SCX_FileSystem_Class_Provider.h"
+#include "SCX_FileSystemStatisticalInformation_Class_Provider.h"
+#include "SCX_IPProtocolEndpoint_Class_Provider.h"
+#include "SCX_ProcessorStatisticalInformation_Class_Provider.h"
+#include "SCX_UnixProcess_Class_Provider.h"
+#include "SCX_UnixProcessStatisticalInformation_Class_Provider.h"
+#include "logfileutils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdlib.h>
+#include <string>
+#include <sys/time.h>
+#include <unistd.h>
+#include <vector>
+
+// dynamic_cast fix - wi 11220
+#ifdef dynamic_cast
+#undef dynamic_cast
+#endif
+
+using namespace SCXCoreLib;
+
+/*----------------------------------------------------------------------------*/
+// Heap allocation counting
+//
+// Every allocation made through operator new in this process is counted,
+// including those made by PAL and OMI code called from the providers.
+
+namespace
+{
+    volatile scxulong s_allocations = 0;
+    volatile scxulong s_allocatedBytes = 0;
+
+    void* CountedAlloc(size_t size)
+    {
+        __sync_fetch_and_add(&s_allocations, 1);
+        __sync_fetch_and_add(&s_allocatedBytes, static_cast<scxulong>(size));
+
+        void* p = malloc(size ? size : 1);
+        if (NULL == p)
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+}
+
+#if __cplusplus >= 201103L
+#define BENCH_THROW_BAD_ALLOC
+#define BENCH_NOTHROW noexcept
+#else
+#define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define BENCH_NOTHROW throw()
+#endif
+
+void* operator new(size_t size) BENCH_THROW_BAD_ALLOC
+{
+    return CountedAlloc(size);
+}
+
+void* operator new[](size_t size) BENCH_THROW_BAD_ALLOC
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void* p) BENCH_NOTHROW
+{
+    free(p);
+}
+
+void operator delete[](void* p) BENCH_NOTHROW
+{
+    free(p);
+}
+
+namespace
+{
+    /*----------------------------------------------------------------------------*/
+    /**
+       Resource counters sampled before and after each operation.
+    */
+    struct Sample
+    {
+        scxulong microseconds;  //!< Wall clock time
+        scxulong allocations;   //!< Calls to operator new
+        scxulong bytes;         //!< Bytes requested from operator new
+        scxulong readCalls;     //!< read-family system calls ("syscr" of /proc/self/io)
+        scxulong writeCalls;    //!< write-family system calls ("syscw" of /proc/self/io)
+
+        static Sample Take()
+        {
+            Sample s;
+
+            struct timeval tv;
+            gettimeofday(&tv, NULL);
+            s.microseconds = static_cast<scxulong>(tv.tv_sec) * 1000000 + tv.tv_usec;
+            s.allocations = s_allocations;
+            s.bytes = s_allocatedBytes;
+            s.readCalls = 0;
+            s.writeCalls = 0;
+
+            // Reading /proc/self/io costs one open, read and close; that is
+            // constant per sample and cancels out in the deltas
+            std::ifstream io("/proc/self/io");
+            std::string key;
+            scxulong value;
+            while (io >> key >> value)
+            {
+                if (key == "syscr:")
+                {
+                    s.readCalls = value;
+                }
+                else if (key == "syscw:")
+                {
+                    s.writeCalls = value;
+                }
+            }
+
+            return s;
+        }
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Base class for a benchmarked operation.
+    */
+    class Benchmark
+    {
+    public:
+        explicit Benchmark(const std::string& name) : m_name(name) { }
+        virtual ~Benchmark() { }
+
+        const std::string& GetName() const { return m_name; }
+
+        virtual void SetUp() { }
+        virtual void PrepareIteration() { }
+        virtual size_t Run() = 0;          //!< Returns number of instances/rows produced
+        virtual void TearDown() { }
+
+    private:
+        std::string m_name;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Benchmarks EnumerateInstances of a class provider.
+    */
+    template <class T>
+    class EnumerateBenchmark : public Benchmark
+    {
+    public:
+        explicit EnumerateBenchmark(const std::string& name)
+            : Benchmark(name), m_agent(&m_module) { }
+
+        virtual void SetUp()
+        {
+            TestableContext context;
+            m_agent.Load(context);
+            if (MI_RESULT_OK != context.GetResult())
+            {
+                throw SCXInternalErrorException(StrFromUTF8(GetName() + " failed to load"), SCXSRCLOCATION);
+            }
+        }
+
+        virtual size_t Run()
+        {
+            TestableContext context;
+            m_agent.EnumerateInstances(context, NULL, context.GetPropertySet(), false, NULL);
+            if (MI_RESULT_OK != context.GetResult())
+            {
+                throw SCXInternalErrorException(StrFromUTF8(GetName() + " failed to enumerate"), SCXSRCLOCATION);
+            }
+            return context.Size();
+        }
+
+        virtual void TearDown()
+        {
+            TestableContext context;
+            m_agent.Unload(context);
+        }
+
+    private:
+        mi::Module m_module;
+        T m_agent;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Benchmarks reading a log file from the start with the logfile reader.
+
+       State files are kept in the current directory and removed afterwards.
+    */
+    class LogFileBenchmark : public Benchmark
+    {
+    public:
+        explicit LogFileBenchmark(const std::wstring& filename)
+            : Benchmark("LogFileReader::ReadLogFile"),
+              m_filename(filename),
+              m_qid(L"providerbench"),
+              m_reader(new SCXCore::LogFileReader())
+        {
+        }
+
+        virtual void SetUp()
+        {
+            m_persistMedia = GetPersistMedia();
+            SCXFilePersistMedia* m = dynamic_cast<SCXFilePersistMedia*> (m_persistMedia.GetData());
+            if (m != 0)
+            {
+                m->SetBasePath(L"./");
+            }
+            m_reader->SetPersistMedia(m_persistMedia);
+
+            // Lines matching this are written periodically by createfixtures.sh
+            SCXRegexWithIndex regind;
+            regind.regex = new SCXRegex(L"ERROR");
+            regind.index = 0;
+            m_regexps.push_back(regind);
+        }
+
+        virtual void PrepareIteration()
+        {
+            // Rewind so that every iteration reads the whole file
+            m_reader->ResetLogFileState(m_filename, m_qid, true);
+        }
+
+        virtual size_t Run()
+        {
+            std::vector<std::wstring> matchedLines;
+            m_reader->ReadLogFile(m_filename, m_qid, m_regexps, matchedLines);
+            return matchedLines.size();
+        }
+
+        virtual void TearDown()
+        {
+            SCXCore::LogFileReader::LogFilePositionRecord r(m_filename, m_qid, m_persistMedia);
+            r.UnPersist();
+        }
+
+    private:
+        std::wstring m_filename;
+        std::wstring m_qid;
+        SCXHandle<SCXCore::LogFileReader> m_reader;
+        SCXHandle<SCXPersistMedia> m_persistMedia;
+        std::vector<SCXRegexWithIndex> m_regexps;
+    };
+
+    /*----------------------------------------------------------------------------*/
+    /**
+       Runs a benchmark and prints one result line.
+    */
+    void RunBenchmark(Benchmark& bench, unsigned int iterations)
+    {
+        std::vector<scxulong> latencies;
+        scxulong allocations = 0, bytes = 0, readCalls = 0, writeCalls = 0, items = 0;
+
+        bench.SetUp();
+
+        // One warm-up call so that one-time initialization is not measured
+        bench.PrepareIteration();
+        bench.Run();
+
+        for (unsigned int i = 0; i < iterations; i++)
+        {
+            bench.PrepareIteration();
+
+            Sample before = Sample::Take();
+            items += bench.Run();
+            Sample after = Sample::Take();
+
+            latencies.push_back(after.microseconds - before.microseconds);
+            allocations += after.allocations - before.allocations;
+            bytes += after.bytes - before.bytes;
+            readCalls += after.readCalls - before.readCalls;
+            writeCalls += after.writeCalls - before.writeCalls;
+        }
+
+        bench.TearDown();
+
+        std::sort(latencies.begin(), latencies.end());
+        scxulong total = 0;
+        for (size_t i = 0; i < latencies.size(); i++)
+        {
+            total += latencies[i];
+        }
+
+        std::cout << std::left << std::setw(56) << bench.GetName() << std::right
+                  << std::setw(8) << items / iterations
+                  << std::setw(12) << latencies.front()
+                  << std::setw(12) << latencies[latencies.size() / 2]
+                  << std::setw(12) << latencies.back()
+                  << std::setw(12) << total / iterations
+                  << std::setw(12) << allocations / iterations
+                  << std::setw(14) << bytes / iterations
+                  << std::setw(11) << readCalls / iterations
+                  << std::setw(11) << writeCalls / iterations
+                  << std::endl;
+    }
+
+    void Usage(const char* name)
+    {
+        std::cerr << "Usage: " << name << " [-i iterations] [-o operation-substring] [-l logfile]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int iterations = 10;
+    std::string filter;
+    std::string logfile;
+
+    int c;
+    while ((c = getopt(argc, argv, "i:o:l:h")) != -1)
+    {
+        switch (c)
+        {
+            case 'i':
+                iterations = static_cast<unsigned int>(atoi(optarg));
+                break;
+            case 'o':
+                filter = optarg;
+                break;
+            case 'l':
+                logfile = optarg;
+                break;
+            default:
+                Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (0 == iterations)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<SCXHandle<Benchmark> > benchmarks;
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_UnixProcess_Class_Provider>(
+                             "SCX_UnixProcess::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_UnixProcessStatisticalInformation_Class_Provider>(
+                             "SCX_UnixProcessStatisticalInformation::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_DiskDrive_Class_Provider>(
+                             "SCX_DiskDrive::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_DiskDriveStatisticalInformation_Class_Provider>(
+                             "SCX_DiskDriveStatisticalInformation::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_FileSystem_Class_Provider>(
+                             "SCX_FileSystem::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_FileSystemStatisticalInformation_Class_Provider>(
+                             "SCX_FileSystemStatisticalInformation::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_EthernetPortStatistics_Class_Provider>(
+                             "SCX_EthernetPortStatistics::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_IPProtocolEndpoint_Class_Provider>(
+                             "SCX_IPProtocolEndpoint::EnumerateInstances"));
+    benchmarks.push_back(new EnumerateBenchmark<mi::SCX_ProcessorStatisticalInformation_Class_Provider>(
+                             "SCX_ProcessorStatisticalInformation::EnumerateInstances"));
+    if (!logfile.empty())
+    {
+        benchmarks.push_back(new LogFileBenchmark(StrFromUTF8(logfile)));
+    }
+
+    std::cout << std::left << std::setw(56) << "Operation" << std::right
+              << std::setw(8) << "Items"
+              << std::setw(12) << "Min(us)"
+              << std::setw(12) << "Median(us)"
+              << std::setw(12) << "Max(us)"
+              << std::setw(12) << "Mean(us)"
+              << std::setw(12) << "Allocs"
+              << std::setw(14) << "AllocBytes"
+              << std::setw(11) << "ReadCalls"
+              << std::setw(11) << "WriteCalls"
+              << std::endl;
+
+    int status = 0;
+    for (size_t i = 0; i < benchmarks.size(); i++)
+    {
+        if (!filter.empty() && std::string::npos == benchmarks[i]->GetName().find(filter))
+        {
+            continue;
+        }
+
+        try
+        {
+            RunBenchmark(*benchmarks[i], iterations);
+        }
+        catch (SCXException& e)
+        {
+            std::wcerr << StrFromUTF8(benchmarks[i]->GetName()) << L": " << e.What() << L" - " << e.Where() << std::endl;
+            status = 1;
+        }
+    }
+
+    return status;
+}
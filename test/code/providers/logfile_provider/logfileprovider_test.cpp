@@ -29,6 +29,7 @@
 #include <testutils/scxtestutils.h>
 
 #include <stdio.h>  // For fopen() in test testLocale8859_1
+#include <stdlib.h> // For system() in test testReadRotatedCompressedLog
 #include <sys/wait.h>
 #if defined(aix)
 #include <unistd.h>
@@ -94,6 +95,11 @@ class LogFileProviderTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( testInvokeResetAllStateFiles );
     CPPUNIT_TEST( testInvokeResetAllStateFilesWithResetFlag );
     CPPUNIT_TEST( testLocale8859_1 );
+    CPPUNIT_TEST( testRequiredLiteral );
+    CPPUNIT_TEST( testReadLogFileForSeveralQIDs );
+    CPPUNIT_TEST( testReadLogFileLimitsShared );
+    CPPUNIT_TEST( testReadLogFileScanTimeBudget );
+    CPPUNIT_TEST( testReadRotatedCompressedLog );
 
     SCXUNIT_TEST_ATTRIBUTE(testLogFilePositionRecordPersistable, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(testLogFilePositionRecordUnpersist, SLOW);
@@ -104,6 +110,8 @@ class LogFileProviderTest : public CPPUNIT_NS::TestFixture
     SCXUNIT_TEST_ATTRIBUTE(testInvokeResetAllStateFiles, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(testInvokeResetAllStateFilesWithResetFlag, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(testLocale8859_1, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(testReadLogFileScanTimeBudget, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(testReadRotatedCompressedLog, SLOW);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -1088,6 +1096,208 @@ public:
                                      GetValue_MIStringA(CALL_LOCATION(errMsg)).size());
     }
 
+    void testRequiredLiteral()
+    {
+        CPPUNIT_ASSERT(L"ERROR" == LogFileReader::GetRequiredLiteral(L"ERROR"));
+        CPPUNIT_ASSERT(L"OutOfMemory" == LogFileReader::GetRequiredLiteral(L".*OutOfMemory.*"));
+        CPPUNIT_ASSERT(L"segfault at " == LogFileReader::GetRequiredLiteral(L"^kernel: .*segfault at [0-9a-f]+"));
+        CPPUNIT_ASSERT(L": disk" == LogFileReader::GetRequiredLiteral(L"(ERROR|WARN): disk"));
+        CPPUNIT_ASSERT(L"colo" == LogFileReader::GetRequiredLiteral(L"colou?r"));
+        CPPUNIT_ASSERT(L"xab" == LogFileReader::GetRequiredLiteral(L"xab+c"));
+        CPPUNIT_ASSERT(L"bc" == LogFileReader::GetRequiredLiteral(L"a{0,3}bc"));
+        CPPUNIT_ASSERT(L"file.txt" == LogFileReader::GetRequiredLiteral(L"file\\.txt"));
+        CPPUNIT_ASSERT(L"foo" == LogFileReader::GetRequiredLiteral(L"\\wfoo"));
+        CPPUNIT_ASSERT(L" failed" == LogFileReader::GetRequiredLiteral(L"[[:alpha:]]+ failed"));
+
+        // No literal is required (or the expression isn't understood)
+        CPPUNIT_ASSERT(LogFileReader::GetRequiredLiteral(L"").empty());
+        CPPUNIT_ASSERT(LogFileReader::GetRequiredLiteral(L"ERROR|WARN").empty());
+        CPPUNIT_ASSERT(LogFileReader::GetRequiredLiteral(L"[abc").empty());
+        CPPUNIT_ASSERT(LogFileReader::GetRequiredLiteral(L"a**").empty());
+    }
+
+    void AppendToTestLog(const std::wstring& line)
+    {
+        SCXHandle<std::wfstream> stream = SCXFile::OpenWFstream(testlogfilename,
+                    std::ios_base::out | std::ios_base::app);
+        *stream << line << std::endl;
+    }
+
+    void testReadLogFileForSeveralQIDs()
+    {
+        std::vector<LogFileQuery> queries(2);
+        SCXRegexWithIndex regind;
+        queries[0].qid = testQID;
+        regind.regex = new SCXRegex(L"ERROR");
+        regind.index = 0;
+        queries[0].regexps.push_back(regind);
+        queries[1].qid = testQID2;
+        regind.regex = new SCXRegex(L"WARN");
+        regind.index = 0;
+        queries[1].regexps.push_back(regind);
+
+        // First read positions both QIDs at the end of the file
+        AppendToTestLog(L"This is the first row.");
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT(queries[0].matchedLines.empty());
+        CPPUNIT_ASSERT(queries[1].matchedLines.empty());
+
+        // Both QIDs start at the same position and share the read, each with its own regular expressions
+        AppendToTestLog(L"ERROR one");
+        AppendToTestLog(L"WARN two");
+        AppendToTestLog(L"ERROR three");
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), queries[0].matchedLines.size());
+        CPPUNIT_ASSERT(L"0;ERROR one" == queries[0].matchedLines[0]);
+        CPPUNIT_ASSERT(L"0;ERROR three" == queries[0].matchedLines[1]);
+        CPPUNIT_ASSERT(!queries[0].partialRead);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), queries[1].matchedLines.size());
+        CPPUNIT_ASSERT(L"0;WARN two" == queries[1].matchedLines[0]);
+        CPPUNIT_ASSERT(!queries[1].partialRead);
+
+        // Read one QID on its own, so the QIDs continue from different positions
+        AppendToTestLog(L"WARN four");
+        std::vector<std::wstring> matchedLines;
+        CPPUNIT_ASSERT(!m_pReader->ReadLogFile(testlogfilename, testQID, queries[0].regexps, matchedLines));
+        CPPUNIT_ASSERT(matchedLines.empty());
+
+        AppendToTestLog(L"ERROR five");
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), queries[0].matchedLines.size());
+        CPPUNIT_ASSERT(L"0;ERROR five" == queries[0].matchedLines[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), queries[1].matchedLines.size());
+        CPPUNIT_ASSERT(L"0;WARN four" == queries[1].matchedLines[0]);
+
+        // Nothing new for either QID
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT(queries[0].matchedLines.empty());
+        CPPUNIT_ASSERT(queries[1].matchedLines.empty());
+    }
+
+    void testReadLogFileLimitsShared()
+    {
+        std::vector<LogFileQuery> queries(2);
+        SCXRegexWithIndex regind;
+        queries[0].qid = testQID;
+        regind.regex = new SCXRegex(L"ERROR");
+        regind.index = 0;
+        queries[0].regexps.push_back(regind);
+        queries[1].qid = testQID2;
+        regind.regex = new SCXRegex(L"WARN");
+        regind.index = 0;
+        queries[1].regexps.push_back(regind);
+
+        AppendToTestLog(L"This is the first row.");
+        m_pReader->ReadLogFile(testlogfilename, queries);
+
+        // 400 matches for each QID: more than fit in the single instance returned for both
+        {
+            SCXHandle<std::wfstream> stream = SCXFile::OpenWFstream(testlogfilename,
+                        std::ios_base::out | std::ios_base::app);
+            for (int i = 0; i < 400; i++)
+            {
+                *stream << L"ERROR in row " << i << std::endl;
+                *stream << L"WARN in row " << i << std::endl;
+            }
+        }
+
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(500), queries[0].matchedLines.size() + queries[1].matchedLines.size());
+        CPPUNIT_ASSERT(queries[0].partialRead);
+        CPPUNIT_ASSERT(queries[1].partialRead);
+
+        // The rest is returned by the next call, none of it twice
+        m_pReader->ReadLogFile(testlogfilename, queries);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(300), queries[0].matchedLines.size() + queries[1].matchedLines.size());
+        CPPUNIT_ASSERT(!queries[0].partialRead);
+        CPPUNIT_ASSERT(!queries[1].partialRead);
+        CPPUNIT_ASSERT(L"0;ERROR in row 399" == queries[0].matchedLines.back());
+        CPPUNIT_ASSERT(L"0;WARN in row 399" == queries[1].matchedLines.back());
+    }
+
+    void testReadLogFileScanTimeBudget()
+    {
+        std::vector<SCXRegexWithIndex> regexps;
+        SCXRegexWithIndex regind;
+        regind.regex = new SCXRegex(L"ERROR");
+        regind.index = 0;
+        regexps.push_back(regind);
+
+        // First read positions at the end of the file
+        AppendToTestLog(L"This is the first row.");
+        std::vector<std::wstring> matchedLines;
+        m_pReader->ReadLogFile(testlogfilename, testQID, regexps, matchedLines);
+        CPPUNIT_ASSERT(matchedLines.empty());
+
+        // A backlog with few matches
+        {
+            SCXHandle<std::wfstream> stream = SCXFile::OpenWFstream(testlogfilename,
+                        std::ios_base::out | std::ios_base::app);
+            for (int i = 0; i < 100000; i++)
+            {
+                *stream << (0 == i % 1000 ? L"ERROR in row " : L"Nothing to see in row ") << i << std::endl;
+            }
+        }
+
+        // Work through the backlog with a tiny budget: every call returns what it found so far
+        m_pReader->SetScanTimeBudget(1);
+        int calls = 0;
+        bool partial = true;
+        while (partial && calls < 100000)
+        {
+            partial = m_pReader->ReadLogFile(testlogfilename, testQID, regexps, matchedLines);
+            calls++;
+        }
+        m_pReader->SetScanTimeBudget(0);
+
+        CPPUNIT_ASSERT(!partial);
+        CPPUNIT_ASSERT(calls > 1);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(100), matchedLines.size());
+        CPPUNIT_ASSERT(L"0;ERROR in row 0" == matchedLines[0]);
+        CPPUNIT_ASSERT(L"0;ERROR in row 99000" == matchedLines[99]);
+    }
+
+    void testReadRotatedCompressedLog()
+    {
+        if (0 != system("gzip --version > /dev/null 2>&1"))
+        {
+            SCXUNIT_WARNING(L"Unable to run LogFileProviderTest::testReadRotatedCompressedLog without gzip");
+            return;
+        }
+
+        const std::wstring rotated = testlogfilename + L".1.gz";
+        SCXCoreLib::SelfDeletingFilePath rotatedFile(rotated);
+
+        std::vector<SCXRegexWithIndex> regexps;
+        SCXRegexWithIndex regind;
+        regind.regex = new SCXRegex(L"ERROR");
+        regind.index = 0;
+        regexps.push_back(regind);
+
+        // First read positions at the end of the file
+        AppendToTestLog(L"This is the first row.");
+        std::vector<std::wstring> matchedLines;
+        m_pReader->ReadLogFile(testlogfilename, testQID, regexps, matchedLines);
+        CPPUNIT_ASSERT(matchedLines.empty());
+
+        // Rotated (and compressed, like logrotate's compress option) before the new row was read
+        AppendToTestLog(L"ERROR before rotation");
+        std::string command = "gzip -c " + StrToUTF8(testlogfilename) + " > " + StrToUTF8(rotated)
+            + " && rm " + StrToUTF8(testlogfilename);
+        CPPUNIT_ASSERT_EQUAL(0, system(command.c_str()));
+        AppendToTestLog(L"ERROR after rotation");
+
+        // The unread row of the rotated file comes first, then the new file
+        CPPUNIT_ASSERT(!m_pReader->ReadLogFile(testlogfilename, testQID, regexps, matchedLines));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), matchedLines.size());
+        CPPUNIT_ASSERT(L"0;ERROR before rotation" == matchedLines[0]);
+        CPPUNIT_ASSERT(L"0;ERROR after rotation" == matchedLines[1]);
+
+        matchedLines.clear();
+        m_pReader->ReadLogFile(testlogfilename, testQID, regexps, matchedLines);
+        CPPUNIT_ASSERT(matchedLines.empty());
+    }
+
     void testLocale8859_1()
     {
         const std::wstring regexpStr = L"0;";
@@ -0,0 +1,303 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the log file watcher (SCX_LogFileMatchIndication)
+
+   \date        2026-10-19 22:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxfile.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/scxunit.h>
+
+#include <support/logfilewatcher.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+//! Collects the matches of a LogFileWatcher
+class TestLogFileMatchSink : public LogFileMatchSink
+{
+public:
+    virtual void PostMatch(scxulong subscriptionID, const LogFileMatch& match)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"LogFileWatcherTest::Sink"));
+        m_ids.push_back(subscriptionID);
+        m_matches.push_back(match);
+    }
+
+    size_t Count()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"LogFileWatcherTest::Sink"));
+        return m_matches.size();
+    }
+
+    std::vector<scxulong> m_ids;
+    std::vector<LogFileMatch> m_matches;
+};
+
+class LogFileWatcherTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( LogFileWatcherTest );
+
+    CPPUNIT_TEST( testParseFilter );
+    CPPUNIT_TEST( testParseFilterNotSupported );
+    CPPUNIT_TEST( testInvalidRegexp );
+    CPPUNIT_TEST( testTail );
+    CPPUNIT_TEST( testPartialRow );
+    CPPUNIT_TEST( testRotation );
+    CPPUNIT_TEST( testTruncation );
+    CPPUNIT_TEST( testFileCreatedLater );
+    CPPUNIT_TEST( testUnsubscribe );
+    CPPUNIT_TEST( testWatchingThread );
+
+    SCXUNIT_TEST_ATTRIBUTE(testWatchingThread, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    std::wstring m_logfile;
+    std::vector<std::wstring> m_regexps;
+
+    //! Appends bytes to a file, as a logger would
+    void Append(const std::wstring& filename, const std::string& text)
+    {
+        FILE* fp = fopen(StrToUTF8(filename).c_str(), "a");
+        CPPUNIT_ASSERT(NULL != fp);
+        fputs(text.c_str(), fp);
+        fclose(fp);
+    }
+
+public:
+    void setUp(void)
+    {
+        m_logfile = L"./logfilewatcherTest.log";
+        SCXFile::Delete(m_logfile);
+        SCXFile::Delete(m_logfile + L".1");
+        Append(m_logfile, "first row\n");
+
+        m_regexps.clear();
+        m_regexps.push_back(L"ERROR");
+        m_regexps.push_back(L"WARN");
+    }
+
+    void tearDown(void)
+    {
+        SCXFile::Delete(m_logfile);
+        SCXFile::Delete(m_logfile + L".1");
+    }
+
+    void testParseFilter()
+    {
+        std::wstring filename;
+        std::vector<std::wstring> regexps;
+
+        LogFileWatcher::ParseFilter(
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/var/log/messages' AND Regexp = 'ERROR'",
+            filename, regexps);
+        CPPUNIT_ASSERT(L"/var/log/messages" == filename);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), regexps.size());
+        CPPUNIT_ASSERT(L"ERROR" == regexps[0]);
+
+        // Either order, keywords in any case, double quotes, and escapes only for quotes and backslashes
+        LogFileWatcher::ParseFilter(
+            L"select * from SCX_LogFileMatchIndication where (Regexp = 'it\\'s' OR regexp = \"[0-9]+\\.[0-9]\") and FILENAME='/tmp/x.log'",
+            filename, regexps);
+        CPPUNIT_ASSERT(L"/tmp/x.log" == filename);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), regexps.size());
+        CPPUNIT_ASSERT(L"it's" == regexps[0]);
+        CPPUNIT_ASSERT(L"[0-9]+\\.[0-9]" == regexps[1]);
+    }
+
+    void testParseFilterNotSupported()
+    {
+        const wchar_t* queries[] = {
+            L"SELECT * FROM SCX_LogFileMatchIndication",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE Regexp = 'ERROR'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' OR Regexp = 'ERROR'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' AND FileName = '/tmp/y.log' AND Regexp = 'ERROR'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' AND Regexp = 'ERROR' AND Regexp = 'WARN'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' AND (Regexp = 'ERROR' OR Regexp = 'WARN'",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' AND Regexp = 'ERROR",
+            L"SELECT * FROM SCX_LogFileMatchIndication WHERE FileName <> '/tmp/x.log' AND Regexp = 'ERROR'",
+            L"SELECT FileName FROM SCX_LogFileMatchIndication WHERE FileName = '/tmp/x.log' AND Regexp = 'ERROR'",
+            NULL
+        };
+
+        for (int i = 0; NULL != queries[i]; i++)
+        {
+            std::wstring filename;
+            std::vector<std::wstring> regexps;
+            CPPUNIT_ASSERT_THROW(LogFileWatcher::ParseFilter(queries[i], filename, regexps),
+                                 SCXNotSupportedException);
+        }
+    }
+
+    void testInvalidRegexp()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+
+        m_regexps.push_back(L"[");
+        CPPUNIT_ASSERT_THROW(watcher.Subscribe(1, m_logfile, m_regexps), SCXInvalidRegexException);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), watcher.GetFileCount());
+    }
+
+    void testTail()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+
+        // Rows written before the subscription aren't reported
+        Append(m_logfile, "ERROR before\n");
+        watcher.Subscribe(1, m_logfile, m_regexps);
+        CPPUNIT_ASSERT(!watcher.CheckFiles());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), sink.m_matches.size());
+
+        Append(m_logfile, "an ERROR\nnothing\r\nWARN and ERROR\r\n");
+        CPPUNIT_ASSERT(!watcher.CheckFiles());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_matches.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), sink.m_ids[0]);
+        CPPUNIT_ASSERT(m_logfile == sink.m_matches[0].filename);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(23), sink.m_matches[0].position);
+        CPPUNIT_ASSERT(L"ERROR" == sink.m_matches[0].regexp);
+        CPPUNIT_ASSERT(L"an ERROR" == sink.m_matches[0].row);
+
+        // The first expression that matches is reported, without the carriage return
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(41), sink.m_matches[1].position);
+        CPPUNIT_ASSERT(L"ERROR" == sink.m_matches[1].regexp);
+        CPPUNIT_ASSERT(L"WARN and ERROR" == sink.m_matches[1].row);
+
+        CPPUNIT_ASSERT(!watcher.CheckFiles());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_matches.size());
+    }
+
+    void testPartialRow()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+        watcher.Subscribe(1, m_logfile, m_regexps);
+
+        // A row is reported once its newline is written
+        Append(m_logfile, "an ERR");
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), sink.m_matches.size());
+
+        Append(m_logfile, "OR\n");
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_matches.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(10), sink.m_matches[0].position);
+        CPPUNIT_ASSERT(L"an ERROR" == sink.m_matches[0].row);
+    }
+
+    void testRotation()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+        watcher.Subscribe(1, m_logfile, m_regexps);
+
+        // Rotated with rows not read yet, the last of them not terminated
+        Append(m_logfile, "ERROR before rotation\n");
+        CPPUNIT_ASSERT_EQUAL(0, rename(StrToUTF8(m_logfile).c_str(), StrToUTF8(m_logfile + L".1").c_str()));
+        Append(m_logfile + L".1", "WARN late write");
+        Append(m_logfile, "ERROR after rotation\n");
+
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), sink.m_matches.size());
+        CPPUNIT_ASSERT(L"ERROR before rotation" == sink.m_matches[0].row);
+        CPPUNIT_ASSERT(L"WARN late write" == sink.m_matches[1].row);
+        CPPUNIT_ASSERT(L"ERROR after rotation" == sink.m_matches[2].row);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(0), sink.m_matches[2].position);
+    }
+
+    void testTruncation()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+        watcher.Subscribe(1, m_logfile, m_regexps);
+
+        FILE* fp = fopen(StrToUTF8(m_logfile).c_str(), "w");
+        CPPUNIT_ASSERT(NULL != fp);
+        fclose(fp);
+        watcher.CheckFiles();
+        Append(m_logfile, "ERROR\n");
+
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_matches.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(0), sink.m_matches[0].position);
+    }
+
+    void testFileCreatedLater()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+
+        SCXFile::Delete(m_logfile);
+        watcher.Subscribe(1, m_logfile, m_regexps);
+        CPPUNIT_ASSERT(!watcher.CheckFiles());
+
+        // All of a file created after the subscription is new
+        Append(m_logfile, "ERROR one\nERROR two\n");
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_matches.size());
+    }
+
+    void testUnsubscribe()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+        std::vector<std::wstring> warnings(1, L"WARN");
+
+        watcher.Subscribe(1, m_logfile, m_regexps);
+        watcher.Subscribe(2, m_logfile, warnings);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), watcher.GetFileCount());
+
+        Append(m_logfile, "WARN\n");
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_matches.size());
+
+        CPPUNIT_ASSERT(watcher.Unsubscribe(1));
+        CPPUNIT_ASSERT(!watcher.Unsubscribe(1));
+        Append(m_logfile, "WARN\n");
+        watcher.CheckFiles();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), sink.m_matches.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), sink.m_ids[2]);
+
+        CPPUNIT_ASSERT(watcher.Unsubscribe(2));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), watcher.GetFileCount());
+    }
+
+    void testWatchingThread()
+    {
+        TestLogFileMatchSink sink;
+        LogFileWatcher watcher(&sink);
+        watcher.Subscribe(1, m_logfile, m_regexps);
+
+        CPPUNIT_ASSERT(watcher.Start());
+        CPPUNIT_ASSERT(watcher.IsRunning());
+
+        Append(m_logfile, "ERROR pushed\n");
+        for (int i = 0; i < 50 && 0 == sink.Count(); i++)
+        {
+            usleep(100000);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.Count());
+
+        watcher.Stop();
+        CPPUNIT_ASSERT(!watcher.IsRunning());
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( LogFileWatcherTest );
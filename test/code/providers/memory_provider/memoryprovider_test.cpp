@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include <scxcorelib/scxcmn.h>
 #include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthreadlock.h>
 #include <scxsystemlib/scxostypeinfo.h>
 #include <testutils/scxunit.h>
 #include <testutils/providertestutils.h>
@@ -21,6 +22,7 @@
 #include "SCX_Agent.h"
 #include "SCX_Agent_Class_Provider.h"
 #include "SCX_MemoryStatisticalInformation_Class_Provider.h"
+#include "SCX_OperatingSystem_Class_Provider.h"
 
 using namespace SCXCore;
 using namespace SCXCoreLib;
@@ -34,12 +36,14 @@ class MemoryProvider_Test : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( TestEnumerateInstances );
     CPPUNIT_TEST( TestVerifyKeyCompletePartial );
     CPPUNIT_TEST( TestGetInstance );
+    CPPUNIT_TEST( TestSampleIsShared );
 
     SCXUNIT_TEST_ATTRIBUTE(callDumpStringForCoverage, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestEnumerateInstancesKeysOnly, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestEnumerateInstances, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestVerifyKeyCompletePartial, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestGetInstance, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestSampleIsShared, SLOW);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -107,6 +111,47 @@ public:
         ValidateInstance(context, CALL_LOCATION(errMsg));
     }
 
+    void TestSampleIsShared()
+    {
+        std::wstring errMsg;
+        TestableContext loadContext;
+        SetUpAgent<mi::SCX_OperatingSystem_Class_Provider>(loadContext, CALL_LOCATION(errMsg));
+
+        // Take one sample, and reuse it for longer than the test runs
+        {
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+            g_MemoryProvider.UpdateMemoryEnumeration(true);
+            g_MemoryProvider.SetRefreshSecs(3600);
+        }
+
+        std::vector<std::wstring> osKeyNames;
+        osKeyNames.push_back(L"Name");
+        osKeyNames.push_back(L"CSCreationClassName");
+        osKeyNames.push_back(L"CSName");
+        osKeyNames.push_back(L"CreationClassName");
+        TestableContext osContext, memContext;
+        StandardTestEnumerateInstances<mi::SCX_OperatingSystem_Class_Provider>(
+            osKeyNames, osContext, CALL_LOCATION(errMsg));
+        StandardTestEnumerateInstances<mi::SCX_MemoryStatisticalInformation_Class_Provider>(
+            m_keyNames, memContext, CALL_LOCATION(errMsg));
+
+        {
+            SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+            g_MemoryProvider.SetRefreshSecs(cDefaultMemoryRefreshSecs);
+        }
+        TearDownAgent<mi::SCX_OperatingSystem_Class_Provider>(loadContext, CALL_LOCATION(errMsg));
+
+        CPPUNIT_ASSERT_EQUAL(1u, osContext.Size());
+        CPPUNIT_ASSERT_EQUAL(1u, memContext.Size());
+
+        // Both classes report the available memory of the one sample, in kilobytes and megabytes
+        scxulong freePhysicalMemory = osContext[0].GetProperty(L"FreePhysicalMemory", CALL_LOCATION(errMsg)).
+            GetValue_MIUint64(CALL_LOCATION(errMsg));
+        scxulong availableMemory = memContext[0].GetProperty(L"AvailableMemory", CALL_LOCATION(errMsg)).
+            GetValue_MIUint64(CALL_LOCATION(errMsg));
+        SCXUNIT_ASSERT_BETWEEN(availableMemory, freePhysicalMemory / 1024, freePhysicalMemory / 1024 + 1);
+    }
+
     void ValidateInstance(const TestableContext& context, std::wstring errMsg)
     {
         CPPUNIT_ASSERT_EQUAL(1u, context.Size());// This provider has only one instance.
@@ -0,0 +1,135 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the provider operation metrics
+
+   \date        2026-10-19 10:05:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "providermetrics.h"
+
+#include <string>
+#include <vector>
+
+using namespace SCXCore;
+
+class SCXProviderMetricsTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXProviderMetricsTest );
+
+    CPPUNIT_TEST( TestLatencyBucketIndex );
+    CPPUNIT_TEST( TestRecordUpdatesCounters );
+    CPPUNIT_TEST( TestTimerRecordsOnDestruction );
+    CPPUNIT_TEST( TestSameOperationReturnsSameStatistics );
+    CPPUNIT_TEST( TestMetricsFormat );
+    CPPUNIT_TEST( TestCounterFormat );
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestLatencyBucketIndex()
+    {
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), ProviderOperationStatistics::GetLatencyBucketIndex(0));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), ProviderOperationStatistics::GetLatencyBucketIndex(999));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), ProviderOperationStatistics::GetLatencyBucketIndex(1000));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), ProviderOperationStatistics::GetLatencyBucketIndex(999999));
+        CPPUNIT_ASSERT_EQUAL(ProviderOperationStatistics::cLatencyBuckets - 1,
+                             ProviderOperationStatistics::GetLatencyBucketIndex(3600000000ULL));
+
+        CPPUNIT_ASSERT(ProviderOperationStatistics::GetLatencyBucketName(0) == L"<1ms");
+        CPPUNIT_ASSERT(ProviderOperationStatistics::GetLatencyBucketName(ProviderOperationStatistics::cLatencyBuckets) == L"");
+    }
+
+    void TestRecordUpdatesCounters()
+    {
+        ProviderOperationStatistics stats;
+        stats.Record(500, 10, false);
+        stats.Record(20000, 0, true);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), stats.GetCalls());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), stats.GetFailures());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(10), stats.GetInstances());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(20500), stats.GetTotalMicroseconds());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(20000), stats.GetMaxMicroseconds());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), stats.GetLatencyBucket(0));
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), stats.GetLatencyBucket(3));
+    }
+
+    void TestTimerRecordsOnDestruction()
+    {
+        ProviderOperationStatistics stats;
+        {
+            ProviderOperationTimer timer(stats);
+            timer.AddInstances(3);
+            timer.AddInstances(4);
+            CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(0), stats.GetCalls());
+        }
+        {
+            ProviderOperationTimer timer(stats);
+            timer.SetFailed();
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), stats.GetCalls());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), stats.GetFailures());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(7), stats.GetInstances());
+    }
+
+    void TestSameOperationReturnsSameStatistics()
+    {
+        ProviderMetrics metrics;
+        ProviderOperationStatistics& a = metrics.GetStatistics(L"Test_Class_Provider::EnumerateInstances");
+        ProviderOperationStatistics& b = metrics.GetStatistics(L"Test_Class_Provider::EnumerateInstances");
+        ProviderOperationStatistics& c = metrics.GetStatistics(L"Test_Class_Provider::GetInstance");
+
+        CPPUNIT_ASSERT(&a == &b);
+        CPPUNIT_ASSERT(&a != &c);
+    }
+
+    void TestMetricsFormat()
+    {
+        ProviderMetrics metrics;
+        metrics.GetStatistics(L"Test_Class_Provider::GetInstance").Record(2000, 1, false);
+        metrics.GetStatistics(L"Test_Class_Provider::EnumerateInstances").Record(100, 5, true);
+
+        std::vector<std::wstring> lines;
+        metrics.GetMetrics(lines);
+
+        // Sorted by operation name
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lines.size());
+        CPPUNIT_ASSERT_EQUAL(std::wstring(L"Test_Class_Provider::EnumerateInstances;Calls=1;Failures=1;Instances=5;"
+                                          L"TotalMicroseconds=100;MaxMicroseconds=100;"
+                                          L"Histogram=<1ms:1,<5ms:0,<10ms:0,<50ms:0,<100ms:0,<500ms:0,<1s:0,<5s:0,>=5s:0"),
+                             lines[0]);
+        CPPUNIT_ASSERT(lines[1].find(L"Test_Class_Provider::GetInstance;Calls=1;Failures=0;Instances=1;") == 0);
+        CPPUNIT_ASSERT(lines[1].find(L"<5ms:1") != std::wstring::npos);
+    }
+
+    void TestCounterFormat()
+    {
+        ProviderMetrics metrics;
+        metrics.GetStatistics(L"Test_Class_Provider::GetInstance").Record(2000, 1, false);
+        ProviderCounter& counter = metrics.GetCounter(L"Test::Events");
+        CPPUNIT_ASSERT(&counter == &metrics.GetCounter(L"Test::Events"));
+        counter.Increment();
+        counter.Increment(2);
+
+        std::vector<std::wstring> lines;
+        metrics.GetMetrics(lines);
+
+        // Counters follow the operations
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lines.size());
+        CPPUNIT_ASSERT(lines[0].find(L"Test_Class_Provider::GetInstance;") == 0);
+        CPPUNIT_ASSERT_EQUAL(std::wstring(L"Test::Events;Count=3"), lines[1]);
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXProviderMetricsTest );
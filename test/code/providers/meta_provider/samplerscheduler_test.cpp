@@ -0,0 +1,201 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the sampler scheduler
+
+   \date        2026-10-20 00:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <testutils/scxunit.h>
+
+#include "samplerscheduler.h"
+
+#include <stdexcept>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+//! Counts its runs, and optionally fails
+class TestSamplerTask : public SamplerTask
+{
+public:
+    TestSamplerTask(bool fail = false) : m_runs(0), m_fail(fail) { }
+
+    virtual void RunSample()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"SamplerSchedulerTest::Task"));
+        m_runs++;
+        if (m_fail)
+        {
+            throw SCXInternalErrorException(L"Sample failed", SCXSRCLOCATION);
+        }
+    }
+
+    size_t Runs()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"SamplerSchedulerTest::Task"));
+        return m_runs;
+    }
+
+private:
+    size_t m_runs;
+    bool m_fail;
+};
+
+//! Fails with an exception that isn't an SCXException
+class TestThrowingTask : public SamplerTask
+{
+public:
+    virtual void RunSample()
+    {
+        throw std::runtime_error("Sample failed");
+    }
+};
+
+class SCXSamplerSchedulerTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXSamplerSchedulerTest );
+
+    CPPUNIT_TEST( TestIntervals );
+    CPPUNIT_TEST( TestIntervalLongerThanWheel );
+    CPPUNIT_TEST( TestTasksDueOnSameTickRunTogether );
+    CPPUNIT_TEST( TestRemoveTask );
+    CPPUNIT_TEST( TestStatistics );
+    CPPUNIT_TEST( TestSchedulerThread );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestSchedulerThread, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestIntervals()
+    {
+        SamplerScheduler scheduler;
+        TestSamplerTask everyTick, everyThird;
+        scheduler.AddTask(L"TestIntervals::EveryTick", &everyTick, 1);
+        scheduler.AddTask(L"TestIntervals::EveryThird", &everyThird, 3);
+
+        for (int i = 0; i < 9; i++)
+        {
+            scheduler.Tick();
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(9), everyTick.Runs());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), everyThird.Runs());
+    }
+
+    void TestIntervalLongerThanWheel()
+    {
+        SamplerScheduler scheduler;
+        TestSamplerTask task;
+        unsigned int interval = static_cast<unsigned int>(SamplerScheduler::cWheelSlots * 2 + 5);
+        scheduler.AddTask(L"TestIntervalLongerThanWheel", &task, interval);
+
+        for (unsigned int i = 1; i < interval; i++)
+        {
+            scheduler.Tick();
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), task.Runs());
+        scheduler.Tick();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), task.Runs());
+        for (unsigned int i = 0; i < interval; i++)
+        {
+            scheduler.Tick();
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), task.Runs());
+    }
+
+    void TestTasksDueOnSameTickRunTogether()
+    {
+        SamplerScheduler scheduler;
+        TestSamplerTask a, b, c;
+        scheduler.AddTask(L"TestTasksDueOnSameTickRunTogether::A", &a, 2);
+        scheduler.AddTask(L"TestTasksDueOnSameTickRunTogether::B", &b, 2);
+        scheduler.AddTask(L"TestTasksDueOnSameTickRunTogether::C", &c, 4);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.Tick());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), scheduler.Tick());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.Tick());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), scheduler.Tick());
+    }
+
+    void TestRemoveTask()
+    {
+        SamplerScheduler scheduler;
+        TestSamplerTask kept, removed;
+        scheduler.AddTask(L"TestRemoveTask::Kept", &kept, 1);
+        scxulong id = scheduler.AddTask(L"TestRemoveTask::Removed", &removed, 1);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), scheduler.GetTaskCount());
+
+        scheduler.Tick();
+        CPPUNIT_ASSERT(scheduler.RemoveTask(id));
+        CPPUNIT_ASSERT(!scheduler.RemoveTask(id));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), scheduler.GetTaskCount());
+
+        scheduler.Tick();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), kept.Runs());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), removed.Runs());
+    }
+
+    void TestStatistics()
+    {
+        SamplerScheduler scheduler;
+        TestSamplerTask good, bad(true);
+        TestThrowingTask throwing;
+        scheduler.AddTask(L"TestStatistics::Good", &good, 1);
+        scheduler.AddTask(L"TestStatistics::Bad", &bad, 1);
+        scheduler.AddTask(L"TestStatistics::Throwing", &throwing, 1);
+
+        // A failing task doesn't keep the others from running
+        scheduler.Tick();
+        scheduler.Tick();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), good.Runs());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), bad.Runs());
+
+        ProviderOperationStatistics& goodStats = g_ProviderMetrics.GetStatistics(L"SamplerScheduler::TestStatistics::Good");
+        ProviderOperationStatistics& badStats = g_ProviderMetrics.GetStatistics(L"SamplerScheduler::TestStatistics::Bad");
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), goodStats.GetCalls());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(0), goodStats.GetFailures());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), badStats.GetCalls());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), badStats.GetFailures());
+
+        ProviderOperationStatistics& throwingStats = g_ProviderMetrics.GetStatistics(L"SamplerScheduler::TestStatistics::Throwing");
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), throwingStats.GetCalls());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), throwingStats.GetFailures());
+    }
+
+    void TestSchedulerThread()
+    {
+        SamplerScheduler scheduler(20);
+        TestSamplerTask task;
+
+        CPPUNIT_ASSERT(scheduler.Start());
+        CPPUNIT_ASSERT(scheduler.IsRunning());
+        scxulong id = scheduler.AddTask(L"TestSchedulerThread", &task, 1);
+
+        for (int i = 0; i < 50 && task.Runs() < 3; i++)
+        {
+            usleep(100000);
+        }
+        CPPUNIT_ASSERT(task.Runs() >= 3);
+
+        CPPUNIT_ASSERT(scheduler.RemoveTask(id));
+        size_t runs = task.Runs();
+        usleep(100000);
+        CPPUNIT_ASSERT_EQUAL(runs, task.Runs());
+
+        scheduler.Stop();
+        CPPUNIT_ASSERT(!scheduler.IsRunning());
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXSamplerSchedulerTest );
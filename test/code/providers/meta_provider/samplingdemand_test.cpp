@@ -0,0 +1,195 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for suspending idle sampling
+
+   \date        2026-10-20 01:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <testutils/scxunit.h>
+
+#include "samplingdemand.h"
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+//! Counts the suspensions
+class TestSuspendableSampler : public SuspendableSampler
+{
+public:
+    TestSuspendableSampler() : m_suspensions(0) { }
+
+    virtual void SuspendSampling()
+    {
+        m_suspensions++;
+    }
+
+    size_t m_suspensions;
+};
+
+class SCXSamplingDemandTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXSamplingDemandTest );
+
+    CPPUNIT_TEST( TestSuspendAfterIdle );
+    CPPUNIT_TEST( TestQueryResumes );
+    CPPUNIT_TEST( TestWarmUp );
+    CPPUNIT_TEST( TestAnyClassKeepsSampling );
+    CPPUNIT_TEST( TestZeroNeverSuspends );
+    CPPUNIT_TEST( TestClockSteppedBackwards );
+    CPPUNIT_TEST( TestIdleCheckTask );
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestSuspendAfterIdle()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestSuspendAfterIdle", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(600, 1000);
+        CPPUNIT_ASSERT( !demand.CheckIdle(1599) );
+        CPPUNIT_ASSERT( demand.CheckIdle(1600) );
+        CPPUNIT_ASSERT( demand.IsSuspended() );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), sampler.m_suspensions );
+
+        // Suspended once only
+        CPPUNIT_ASSERT( !demand.CheckIdle(5000) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), sampler.m_suspensions );
+        demand.Stop();
+    }
+
+    void TestQueryResumes()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestQueryResumes", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(600, 1000);
+        CPPUNIT_ASSERT( !demand.Query(L"SCX_UnixProcess", 1100) );
+        CPPUNIT_ASSERT( demand.CheckIdle(1700) );
+
+        // Only the first query after idling resumes sampling
+        CPPUNIT_ASSERT( demand.Query(L"SCX_UnixProcess", 2000) );
+        CPPUNIT_ASSERT( !demand.IsSuspended() );
+        CPPUNIT_ASSERT( !demand.Query(L"SCX_UnixProcess", 2001) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<time_t>(2001), demand.GetLastQuery(L"SCX_UnixProcess") );
+
+        // And idling starts over from the last query
+        CPPUNIT_ASSERT( !demand.CheckIdle(2600) );
+        CPPUNIT_ASSERT( demand.CheckIdle(2601) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), sampler.m_suspensions );
+        demand.Stop();
+    }
+
+    void TestWarmUp()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestWarmUp", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(600, 1000);
+        CPPUNIT_ASSERT( !demand.IsWarmingUp() );
+        CPPUNIT_ASSERT( !demand.WarmUpDue(50000) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(0), demand.GetWarmUpWaitMs(50000) );
+
+        demand.StartWarmUp(50000);
+        CPPUNIT_ASSERT( demand.IsWarmingUp() );
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(SamplingDemand::cWarmUpMs - 100), demand.GetWarmUpWaitMs(50100) );
+        CPPUNIT_ASSERT( !demand.WarmUpDue(50000 + SamplingDemand::cWarmUpMs - 1) );
+
+        // The second sample is due once, and then the warm-up is over
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(0), demand.GetWarmUpWaitMs(50000 + SamplingDemand::cWarmUpMs) );
+        CPPUNIT_ASSERT( demand.WarmUpDue(50000 + SamplingDemand::cWarmUpMs) );
+        CPPUNIT_ASSERT( !demand.IsWarmingUp() );
+        CPPUNIT_ASSERT( !demand.WarmUpDue(60000) );
+
+        // Suspending ends a warm-up
+        demand.StartWarmUp(70000);
+        CPPUNIT_ASSERT( demand.CheckIdle(1600) );
+        CPPUNIT_ASSERT( !demand.IsWarmingUp() );
+        demand.Stop();
+    }
+
+    void TestAnyClassKeepsSampling()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestAnyClassKeepsSampling", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(600, 1000);
+        demand.Query(L"SCX_UnixProcess", 1100);
+        demand.Query(L"SCX_UnixProcessStatisticalInformation", 1500);
+        CPPUNIT_ASSERT( !demand.CheckIdle(1800) );
+        CPPUNIT_ASSERT( demand.CheckIdle(2100) );
+
+        CPPUNIT_ASSERT_EQUAL( static_cast<time_t>(1100), demand.GetLastQuery(L"SCX_UnixProcess") );
+        CPPUNIT_ASSERT_EQUAL( static_cast<time_t>(1500), demand.GetLastQuery(L"SCX_UnixProcessStatisticalInformation") );
+        CPPUNIT_ASSERT_EQUAL( static_cast<time_t>(0), demand.GetLastQuery(L"SCX_ProcessorStatisticalInformation") );
+        demand.Stop();
+    }
+
+    void TestZeroNeverSuspends()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestZeroNeverSuspends", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(0, 1000);
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler.GetTaskCount() );
+        CPPUNIT_ASSERT( !demand.CheckIdle(1000000) );
+        CPPUNIT_ASSERT( !demand.Query(L"SCX_UnixProcess", 1000001) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), sampler.m_suspensions );
+        demand.Stop();
+    }
+
+    void TestClockSteppedBackwards()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestClockSteppedBackwards", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        demand.Start(600, 5000);
+        CPPUNIT_ASSERT( !demand.CheckIdle(1000) );
+        CPPUNIT_ASSERT( !demand.CheckIdle(1599) );
+        CPPUNIT_ASSERT( demand.CheckIdle(1600) );
+        demand.Stop();
+    }
+
+    void TestIdleCheckTask()
+    {
+        SamplerScheduler scheduler;
+        TestSuspendableSampler sampler;
+        SamplingDemand demand(L"TestIdleCheckTask", L"SamplingDemandTest::Lock", &sampler, scheduler);
+
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SamplingDemandTest::Lock"));
+            demand.Start(1, time(NULL) - 10);
+        }
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), scheduler.GetTaskCount() );
+
+        for (unsigned int i = 0; i < SamplingDemand::cCheckIntervalTicks; i++)
+        {
+            scheduler.Tick();
+        }
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), sampler.m_suspensions );
+
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SamplingDemandTest::Lock"));
+            demand.Stop();
+        }
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler.GetTaskCount() );
+        scheduler.Stop();
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXSamplingDemandTest );
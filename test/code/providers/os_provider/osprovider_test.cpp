@@ -19,10 +19,13 @@
 #include <cppunit/extensions/HelperMacros.h>
 #include <testutils/scxunit.h>
 #include "support/osprovider.h"
+#include "support/systemsnapshot.h"
 #include "SCX_OperatingSystem_Class_Provider.h"
 
 #include "testutilities.h"
 
+#include <algorithm>
+
 #if defined(TRAVIS)
 const bool s_fTravis = true;
 #else
@@ -33,6 +36,38 @@ using namespace SCXCore;
 using namespace SCXCoreLib;
 using namespace SCXSystemLib;
 
+// Records the order in which a system snapshot hands out its instances
+class RecordingSnapshotSink : public SystemSnapshotSink
+{
+public:
+    void AddOperatingSystem(SCXHandle<OSInstance> osinst, SCXHandle<MemoryInstance> meminst)
+    {
+        m_added.push_back(L"OperatingSystem");
+    }
+
+    void AddMemory(SCXHandle<MemoryInstance> meminst)
+    {
+        m_added.push_back(L"Memory");
+    }
+
+    void AddProcessor(SCXHandle<CPUInstance> cpuinst)
+    {
+        m_added.push_back(cpuinst->IsTotal() ? L"Processor total" : L"Processor");
+    }
+
+    void AddDiskDrive(SCXHandle<StatisticalPhysicalDiskInstance> diskinst)
+    {
+        m_added.push_back(diskinst->IsTotal() ? L"DiskDrive total" : L"DiskDrive");
+    }
+
+    void AddFileSystem(SCXHandle<StatisticalLogicalDiskInstance> diskinst)
+    {
+        m_added.push_back(diskinst->IsTotal() ? L"FileSystem total" : L"FileSystem");
+    }
+
+    std::vector<std::wstring> m_added;
+};
+
 class OSProvider_Test : public CPPUNIT_NS::TestFixture
 {
     CPPUNIT_TEST_SUITE( OSProvider_Test  );
@@ -41,12 +76,16 @@ class OSProvider_Test : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( TestEnumerateInstances );
     CPPUNIT_TEST( TestGetInstance );
     CPPUNIT_TEST( TestVerifyKeyCompletePartial );
+    CPPUNIT_TEST( TestGetSystemSnapshot );
+    CPPUNIT_TEST( TestSystemSnapshotOrder );
 
     SCXUNIT_TEST_ATTRIBUTE(callDumpStringForCoverage, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestEnumerateInstancesKeysOnly, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestEnumerateInstances, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestGetInstance, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestVerifyKeyCompletePartial, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestGetSystemSnapshot, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestSystemSnapshotOrder, SLOW);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -119,6 +158,44 @@ public:
                 mi::SCX_OperatingSystem_Class>(m_keyNames, CALL_LOCATION(errMsg));
     }
 
+    void TestGetSystemSnapshot()
+    {
+        std::wstring errMsg;
+        TestableContext context;
+        mi::SCX_OperatingSystem_Class instanceName;
+        mi::SCX_OperatingSystem_GetSystemSnapshot_Class param;
+        mi::Module Module;
+        mi::SCX_OperatingSystem_Class_Provider agent(&Module);
+        agent.Invoke_GetSystemSnapshot(context, NULL, instanceName, param);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, MI_RESULT_OK, context.GetResult());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1u, context.Size());
+
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, context[0].GetProperty("MIReturn",
+            CALL_LOCATION(errMsg)).GetValue_MIBoolean(CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, !context[0].GetProperty("Timestamp",
+            CALL_LOCATION(errMsg)).GetValue_MIString(CALL_LOCATION(errMsg)).empty());
+    }
+
+    void TestSystemSnapshotOrder()
+    {
+        RecordingSnapshotSink sink;
+        g_SystemSnapshot.Take(L"SCX_OperatingSystem", sink);
+
+        // The operating system and memory come first, then each processor with the total last
+        CPPUNIT_ASSERT(sink.m_added.size() >= 3);
+        CPPUNIT_ASSERT(L"OperatingSystem" == sink.m_added[0]);
+        CPPUNIT_ASSERT(L"Memory" == sink.m_added[1]);
+        CPPUNIT_ASSERT(L"Processor" == sink.m_added[2] || L"Processor total" == sink.m_added[2]);
+
+        std::vector<std::wstring>::const_iterator total =
+            std::find(sink.m_added.begin(), sink.m_added.end(), L"Processor total");
+        CPPUNIT_ASSERT(total != sink.m_added.end());
+        for (std::vector<std::wstring>::const_iterator it = sink.m_added.begin() + 2; it != total; ++it)
+        {
+            CPPUNIT_ASSERT(L"Processor" == *it);
+        }
+    }
+
     void ValidateInstance(const TestableContext &context, std::wstring errMsg)
     {
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1u, context.Size());
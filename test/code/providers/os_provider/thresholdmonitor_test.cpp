@@ -0,0 +1,330 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the threshold monitor (SCX_StatisticalThresholdIndication)
+
+   \date        2026-10-19 23:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthreadlock.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/scxunit.h>
+
+#include "memoryprovider.h"
+#include "thresholdmonitor.h"
+
+#include <algorithm>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+static const std::wstring cCPU(L"SCX_ProcessorStatisticalInformation");
+
+//! Collects the state changes of a ThresholdMonitor
+class TestThresholdSink : public ThresholdSink
+{
+public:
+    virtual void PostChange(scxulong subscriptionID, const ThresholdChange& change)
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"ThresholdMonitorTest::Sink"));
+        m_ids.push_back(subscriptionID);
+        m_changes.push_back(change);
+    }
+
+    size_t Count()
+    {
+        SCXThreadLock lock(ThreadLockHandleGet(L"ThresholdMonitorTest::Sink"));
+        return m_changes.size();
+    }
+
+    std::vector<scxulong> m_ids;
+    std::vector<ThresholdChange> m_changes;
+};
+
+//! Samples a fixed processor value instead of the system
+class TestableThresholdMonitor : public ThresholdMonitor
+{
+public:
+    TestableThresholdMonitor(ThresholdSink* sink, SamplerScheduler& scheduler) : ThresholdMonitor(sink, scheduler, 1) { }
+
+    std::vector<std::wstring> m_sampled;
+
+protected:
+    virtual void TakeSample(const std::wstring& sourceClass,
+                            const std::vector<std::wstring>& properties,
+                            std::vector<ThresholdValue>& values)
+    {
+        m_sampled.push_back(sourceClass);
+        values.clear();
+        if (L"SCX_ProcessorStatisticalInformation" == sourceClass)
+        {
+            values.push_back(ThresholdValue(L"_Total", L"PercentProcessorTime", 95));
+        }
+    }
+};
+
+//! Exposes the sampling of the system
+class SamplingThresholdMonitor : public ThresholdMonitor
+{
+public:
+    SamplingThresholdMonitor(ThresholdSink* sink) : ThresholdMonitor(sink) { }
+
+    using ThresholdMonitor::TakeSample;
+};
+
+class ThresholdMonitorTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( ThresholdMonitorTest );
+
+    CPPUNIT_TEST( testParseFilter );
+    CPPUNIT_TEST( testParseFilterNotSupported );
+    CPPUNIT_TEST( testHysteresis );
+    CPPUNIT_TEST( testEachInstance );
+    CPPUNIT_TEST( testMissingProperty );
+    CPPUNIT_TEST( testUnsubscribe );
+    CPPUNIT_TEST( testSamplingThread );
+    CPPUNIT_TEST( testTakeSample );
+
+    SCXUNIT_TEST_ATTRIBUTE(testSamplingThread, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    //! Makes a processor sample with the values of processor 0 and the total
+    std::vector<ThresholdValue> CPUValues(double total, double cpu0 = 0)
+    {
+        std::vector<ThresholdValue> values;
+        values.push_back(ThresholdValue(L"0", L"PercentIdleTime", 100 - cpu0));
+        values.push_back(ThresholdValue(L"0", L"PercentProcessorTime", cpu0));
+        values.push_back(ThresholdValue(L"_Total", L"PercentProcessorTime", total));
+        return values;
+    }
+
+    ThresholdCondition CPUCondition(const std::wstring& name, unsigned int samples)
+    {
+        ThresholdCondition condition;
+        condition.sourceClass = L"SCX_ProcessorStatisticalInformation";
+        condition.name = name;
+        condition.property = L"PercentProcessorTime";
+        condition.comparison = ThresholdCondition::eGreater;
+        condition.threshold = 90;
+        condition.samples = samples;
+        return condition;
+    }
+
+public:
+    void testParseFilter()
+    {
+        ThresholdCondition condition;
+
+        ThresholdMonitor::ParseFilter(
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_ProcessorStatisticalInformation'"
+            L" AND PropertyName = 'PercentProcessorTime' AND Value > 90 AND Samples = 3",
+            condition);
+        CPPUNIT_ASSERT(L"SCX_ProcessorStatisticalInformation" == condition.sourceClass);
+        CPPUNIT_ASSERT(condition.name.empty());
+        CPPUNIT_ASSERT(L"PercentProcessorTime" == condition.property);
+        CPPUNIT_ASSERT_EQUAL(ThresholdCondition::eGreater, condition.comparison);
+        CPPUNIT_ASSERT_EQUAL(90.0, condition.threshold);
+        CPPUNIT_ASSERT_EQUAL(3u, condition.samples);
+
+        // Any order, keywords in any case, and Samples defaults to 1
+        ThresholdMonitor::ParseFilter(
+            L"select * from SCX_StatisticalThresholdIndication where value <= 10.5 and name = '/'"
+            L" and propertyname = \"PercentFreeSpace\" and sourceclass = 'SCX_FileSystemStatisticalInformation'",
+            condition);
+        CPPUNIT_ASSERT(L"SCX_FileSystemStatisticalInformation" == condition.sourceClass);
+        CPPUNIT_ASSERT(L"/" == condition.name);
+        CPPUNIT_ASSERT(L"PercentFreeSpace" == condition.property);
+        CPPUNIT_ASSERT_EQUAL(ThresholdCondition::eLessOrEqual, condition.comparison);
+        CPPUNIT_ASSERT_EQUAL(10.5, condition.threshold);
+        CPPUNIT_ASSERT_EQUAL(1u, condition.samples);
+    }
+
+    void testParseFilterNotSupported()
+    {
+        const wchar_t* queries[] = {
+            L"SELECT * FROM SCX_StatisticalThresholdIndication",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE PropertyName = 'PercentProcessorTime' AND Value > 90",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND Value > 90",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory'",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value = 90",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value > '90'",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value > 90 AND Samples = 0",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value > 90 AND Samples = 1.5",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value > 90 OR Value < 10",
+            L"SELECT * FROM SCX_StatisticalThresholdIndication WHERE SourceClass = 'SCX_MemoryStatisticalInformation' AND PropertyName = 'UsedMemory' AND Value > 90 AND Value < 10",
+            NULL
+        };
+
+        for (int i = 0; NULL != queries[i]; i++)
+        {
+            ThresholdCondition condition;
+            CPPUNIT_ASSERT_THROW(ThresholdMonitor::ParseFilter(queries[i], condition), SCXNotSupportedException);
+        }
+    }
+
+    void testHysteresis()
+    {
+        TestThresholdSink sink;
+        ThresholdMonitor monitor(&sink);
+        monitor.Subscribe(1, CPUCondition(L"_Total", 3));
+
+        // Two samples over the threshold aren't enough, and a sample below starts over
+        monitor.Evaluate(cCPU, CPUValues(95));
+        monitor.Evaluate(cCPU, CPUValues(95));
+        monitor.Evaluate(cCPU, CPUValues(50));
+        monitor.Evaluate(cCPU, CPUValues(95));
+        monitor.Evaluate(cCPU, CPUValues(95));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), sink.m_changes.size());
+
+        monitor.Evaluate(cCPU, CPUValues(97));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), sink.m_ids[0]);
+        CPPUNIT_ASSERT(L"SCX_ProcessorStatisticalInformation" == sink.m_changes[0].sourceClass);
+        CPPUNIT_ASSERT(L"_Total" == sink.m_changes[0].name);
+        CPPUNIT_ASSERT(L"PercentProcessorTime" == sink.m_changes[0].property);
+        CPPUNIT_ASSERT_EQUAL(90.0, sink.m_changes[0].threshold);
+        CPPUNIT_ASSERT_EQUAL(97.0, sink.m_changes[0].value);
+        CPPUNIT_ASSERT_EQUAL(3u, sink.m_changes[0].samples);
+        CPPUNIT_ASSERT(sink.m_changes[0].exceeded);
+
+        // Only changes are reported
+        monitor.Evaluate(cCPU, CPUValues(99));
+        monitor.Evaluate(cCPU, CPUValues(10));
+        monitor.Evaluate(cCPU, CPUValues(10));
+        monitor.Evaluate(cCPU, CPUValues(99));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+
+        monitor.Evaluate(cCPU, CPUValues(10));
+        monitor.Evaluate(cCPU, CPUValues(20));
+        monitor.Evaluate(cCPU, CPUValues(30));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_changes.size());
+        CPPUNIT_ASSERT_EQUAL(30.0, sink.m_changes[1].value);
+        CPPUNIT_ASSERT(!sink.m_changes[1].exceeded);
+    }
+
+    void testEachInstance()
+    {
+        TestThresholdSink sink;
+        ThresholdMonitor monitor(&sink);
+        monitor.Subscribe(1, CPUCondition(L"", 1));
+
+        monitor.Evaluate(cCPU, CPUValues(95, 50));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+        CPPUNIT_ASSERT(L"_Total" == sink.m_changes[0].name);
+
+        // Values of other classes don't count
+        std::vector<ThresholdValue> values(1, ThresholdValue(L"0", L"PercentProcessorTime", 99));
+        monitor.Evaluate(L"SCX_MemoryStatisticalInformation", values);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+
+        monitor.Evaluate(cCPU, CPUValues(95, 91));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), sink.m_changes.size());
+        CPPUNIT_ASSERT(L"0" == sink.m_changes[1].name);
+        CPPUNIT_ASSERT(sink.m_changes[1].exceeded);
+    }
+
+    void testMissingProperty()
+    {
+        TestThresholdSink sink;
+        ThresholdMonitor monitor(&sink);
+        ThresholdCondition condition = CPUCondition(L"_Total", 2);
+        monitor.Subscribe(1, condition);
+        condition.property = L"PercentNiceTime";
+        monitor.Subscribe(2, condition);
+
+        // A sample without the value neither counts nor starts over
+        std::vector<ThresholdValue> values(1, ThresholdValue(L"_Total", L"PercentIdleTime", 100));
+        monitor.Evaluate(cCPU, CPUValues(95));
+        monitor.Evaluate(cCPU, values);
+        monitor.Evaluate(cCPU, CPUValues(95));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(1), sink.m_ids[0]);
+    }
+
+    void testUnsubscribe()
+    {
+        TestThresholdSink sink;
+        ThresholdMonitor monitor(&sink);
+        monitor.Subscribe(1, CPUCondition(L"_Total", 1));
+        monitor.Subscribe(2, CPUCondition(L"_Total", 1));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), monitor.GetSubscriptionCount());
+
+        CPPUNIT_ASSERT(monitor.Unsubscribe(1));
+        CPPUNIT_ASSERT(!monitor.Unsubscribe(1));
+        monitor.Evaluate(cCPU, CPUValues(95));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.m_changes.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(2), sink.m_ids[0]);
+
+        CPPUNIT_ASSERT(monitor.Unsubscribe(2));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), monitor.GetSubscriptionCount());
+    }
+
+    void testSamplingThread()
+    {
+        TestThresholdSink sink;
+        SamplerScheduler scheduler(50);
+        TestableThresholdMonitor monitor(&sink, scheduler);
+        monitor.Subscribe(1, CPUCondition(L"_Total", 3));
+
+        CPPUNIT_ASSERT(monitor.Start());
+        CPPUNIT_ASSERT(monitor.IsRunning());
+
+        for (int i = 0; i < 50 && 0 == sink.Count(); i++)
+        {
+            usleep(100000);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), sink.Count());
+
+        monitor.Stop();
+        CPPUNIT_ASSERT(!monitor.IsRunning());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.GetTaskCount());
+
+        // Only the subscribed class is sampled
+        CPPUNIT_ASSERT(!monitor.m_sampled.empty());
+        CPPUNIT_ASSERT(monitor.m_sampled.end() == std::find(monitor.m_sampled.begin(), monitor.m_sampled.end(),
+                                                            L"SCX_MemoryStatisticalInformation"));
+    }
+
+    void testTakeSample()
+    {
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+            g_MemoryProvider.Load();
+        }
+
+        TestThresholdSink sink;
+        SamplingThresholdMonitor monitor(&sink);
+        std::vector<std::wstring> properties;
+        properties.push_back(L"UsedMemory");
+        properties.push_back(L"NoSuchProperty");
+        std::vector<ThresholdValue> values;
+
+        // Only the properties asked for, and only the ones the instance has
+        monitor.TakeSample(L"SCX_MemoryStatisticalInformation", properties, values);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), values.size());
+        CPPUNIT_ASSERT(L"Memory" == values[0].name);
+        CPPUNIT_ASSERT(L"UsedMemory" == values[0].property);
+        CPPUNIT_ASSERT(values[0].value > 0);
+
+        monitor.TakeSample(L"SCX_NoSuchClass", properties, values);
+        CPPUNIT_ASSERT(values.empty());
+
+        {
+            SCXThreadLock lock(ThreadLockHandleGet(L"SCXCore::MemoryProvider::Lock"));
+            g_MemoryProvider.Unload();
+        }
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( ThresholdMonitorTest );
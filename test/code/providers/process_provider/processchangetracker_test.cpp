@@ -0,0 +1,198 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the change tokens of process delta enumeration
+
+   \date        2026-10-19 23:30:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/scxunit.h>
+
+#include "processchangetracker.h"
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+class SCXProcessChangeTrackerTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXProcessChangeTrackerTest );
+
+    CPPUNIT_TEST( TestFirstCallIsFullResync );
+    CPPUNIT_TEST( TestAddedRemovedChanged );
+    CPPUNIT_TEST( TestReusedPIDIsExitAndStart );
+    CPPUNIT_TEST( TestUnchangedListReusesToken );
+    CPPUNIT_TEST( TestUnknownTokenIsFullResync );
+    CPPUNIT_TEST( TestTokenCountIsBounded );
+    CPPUNIT_TEST( TestOldTokenIsFullResync );
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    std::vector<ProcessRecord> m_processes;
+
+    void AddProcess(scxulong pid, const std::wstring& startTime, const std::string& name, unsigned short state = 6)
+    {
+        ProcessRecord process;
+        process.pid = pid;
+        process.startTime = startTime;
+        process.name = name;
+        process.executionState = state;
+        m_processes.push_back(process);
+    }
+
+public:
+    void setUp()
+    {
+        m_processes.clear();
+        AddProcess(1, L"2026-10-19T08:00:00", "init");
+        AddProcess(100, L"2026-10-19T08:00:05", "sshd");
+        AddProcess(200, L"2026-10-19T09:00:00", "bash");
+    }
+
+    void TestFirstCallIsFullResync()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token;
+
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, L"", 1000, changes, token) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), changes.size() );
+        for (size_t i = 0; i < changes.size(); i++)
+        {
+            CPPUNIT_ASSERT_EQUAL( ProcessChange::eAdded, changes[i].type );
+        }
+        CPPUNIT_ASSERT( !token.empty() );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), tracker.GetTokenCount() );
+    }
+
+    void TestAddedRemovedChanged()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token, nextToken;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, token);
+
+        // sshd exits, bash stops, vi starts
+        m_processes.erase(m_processes.begin() + 1);
+        m_processes[1].executionState = 5;
+        AddProcess(300, L"2026-10-19T09:10:00", "vi");
+
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1010, changes, nextToken) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), changes.size() );
+        CPPUNIT_ASSERT_EQUAL( ProcessChange::eRemoved, changes[0].type );
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(100), changes[0].process.pid );
+        CPPUNIT_ASSERT_EQUAL( std::string("sshd"), changes[0].process.name );
+        CPPUNIT_ASSERT_EQUAL( ProcessChange::eChanged, changes[1].type );
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(200), changes[1].process.pid );
+        CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>(5), changes[1].process.executionState );
+        CPPUNIT_ASSERT_EQUAL( ProcessChange::eAdded, changes[2].type );
+        CPPUNIT_ASSERT_EQUAL( static_cast<scxulong>(300), changes[2].process.pid );
+        CPPUNIT_ASSERT( token != nextToken );
+
+        // The first token still works, and the new one has no changes yet
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1020, changes, nextToken) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), changes.size() );
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, nextToken, 1020, changes, nextToken) );
+        CPPUNIT_ASSERT( changes.empty() );
+    }
+
+    void TestReusedPIDIsExitAndStart()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, token);
+
+        m_processes[2].startTime = L"2026-10-19T09:30:00";
+        m_processes[2].name = "make";
+
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1010, changes, token) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), changes.size() );
+        CPPUNIT_ASSERT_EQUAL( ProcessChange::eRemoved, changes[0].type );
+        CPPUNIT_ASSERT_EQUAL( std::string("bash"), changes[0].process.name );
+        CPPUNIT_ASSERT_EQUAL( ProcessChange::eAdded, changes[1].type );
+        CPPUNIT_ASSERT_EQUAL( std::string("make"), changes[1].process.name );
+    }
+
+    void TestUnchangedListReusesToken()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token, nextToken;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, token);
+        for (int i = 0; i < 100; i++)
+        {
+            CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1000 + i, changes, nextToken) );
+            CPPUNIT_ASSERT( changes.empty() );
+            CPPUNIT_ASSERT( token == nextToken );
+        }
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), tracker.GetTokenCount() );
+    }
+
+    void TestUnknownTokenIsFullResync()
+    {
+        ProcessChangeTracker tracker;
+        ProcessChangeTracker otherTracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token, otherToken;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, token);
+
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, L"garbage", 1010, changes, token) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), changes.size() );
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, token + L"x", 1010, changes, token) );
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, token + L"0", 1010, changes, token) );
+
+        // Another tracker (like one created after the provider was loaded again, in the same second) doesn't know the token
+        otherTracker.GetChanges(m_processes, L"", 1000, changes, otherToken);
+        CPPUNIT_ASSERT( otherToken != token );
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, otherToken, 1010, changes, token) );
+    }
+
+    void TestTokenCountIsBounded()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring first, token;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, first);
+        for (scxulong pid = 1000; pid < 1000 + 2 * ProcessChangeTracker::cMaxTokens; pid++)
+        {
+            AddProcess(pid, L"2026-10-19T10:00:00", "worker");
+            tracker.GetChanges(m_processes, L"", 1000, changes, token);
+            CPPUNIT_ASSERT( tracker.GetTokenCount() <= ProcessChangeTracker::cMaxTokens );
+        }
+
+        // The oldest lists are forgotten first
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, first, 1000, changes, token) );
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1000, changes, token) );
+    }
+
+    void TestOldTokenIsFullResync()
+    {
+        ProcessChangeTracker tracker;
+        std::vector<ProcessChange> changes;
+        std::wstring token, nextToken;
+
+        tracker.GetChanges(m_processes, L"", 1000, changes, token);
+        CPPUNIT_ASSERT( !tracker.GetChanges(m_processes, token, 1000 + ProcessChangeTracker::cMaxTokenAgeSecs, changes, nextToken) );
+
+        // Issuing the token again kept it; not using it for longer than the limit forgets it
+        time_t later = 1000 + 2 * ProcessChangeTracker::cMaxTokenAgeSecs + 1;
+        CPPUNIT_ASSERT( tracker.GetChanges(m_processes, token, later, changes, nextToken) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), changes.size() );
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXProcessChangeTrackerTest );
@@ -0,0 +1,97 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the process event tracker
+
+   \date        2026-10-19 18:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "processeventtracker.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+class SCXProcessEventTrackerTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXProcessEventTrackerTest );
+
+    CPPUNIT_TEST( TestNotRunningReportsChanges );
+    CPPUNIT_TEST( TestProcessEvents );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestProcessEvents, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    //! Waits up to a few seconds for the tracker to report changes
+    bool WaitForChanges(ProcessEventTracker& tracker)
+    {
+        for (int i = 0; i < 50; i++)
+        {
+            size_t changedCount = 0;
+            if (tracker.TakeChanges(changedCount))
+            {
+                return true;
+            }
+            usleep(100000);
+        }
+        return false;
+    }
+
+public:
+    void TestNotRunningReportsChanges()
+    {
+        ProcessEventTracker tracker;
+        size_t changedCount = 1;
+
+        // Without events, processes always have to be walked
+        CPPUNIT_ASSERT( ! tracker.IsRunning() );
+        CPPUNIT_ASSERT( tracker.TakeChanges(changedCount) );
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), changedCount );
+        CPPUNIT_ASSERT( tracker.TakeChanges(changedCount) );
+    }
+
+    void TestProcessEvents()
+    {
+        ProcessEventTracker tracker;
+        if ( ! tracker.Start() )
+        {
+#if defined(linux)
+            CPPUNIT_ASSERT( 0 != geteuid() );
+            SCXUNIT_WARNING(L"Unable to run ProcessEventTrackerTest::TestProcessEvents without CAP_NET_ADMIN");
+#endif
+            size_t changedCount = 0;
+            CPPUNIT_ASSERT( tracker.TakeChanges(changedCount) );
+            return;
+        }
+
+        CPPUNIT_ASSERT( tracker.IsRunning() );
+
+        // Drain whatever happened on the system so far
+        size_t changedCount = 0;
+        tracker.TakeChanges(changedCount);
+
+        scxulong events = tracker.GetEventCount();
+        CPPUNIT_ASSERT_EQUAL( 0, system("/bin/true") );
+        CPPUNIT_ASSERT( WaitForChanges(tracker) );
+        CPPUNIT_ASSERT( tracker.GetEventCount() > events );
+
+        tracker.Stop();
+        CPPUNIT_ASSERT( ! tracker.IsRunning() );
+        CPPUNIT_ASSERT( tracker.TakeChanges(changedCount) );
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXProcessEventTrackerTest );
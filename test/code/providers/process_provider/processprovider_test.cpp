@@ -21,6 +21,9 @@
 #include <testutils/providertestutils.h>
 #include "SCX_UnixProcess_Class_Provider.h"
 #include "SCX_UnixProcessStatisticalInformation_Class_Provider.h"
+#include "processprovider.h"
+
+#include <unistd.h>
 
 #include "testutilities.h"
 
@@ -45,6 +48,11 @@ class SCXProcessProviderTest : public CPPUNIT_NS::TestFixture
 
     CPPUNIT_TEST( TestUnixProcessInvokeTopResourceConsumers );
     CPPUNIT_TEST( TestUnixProcessInvokeTopResourceConsumersFail );
+    CPPUNIT_TEST( TestUnixProcessInvokeTopResourceConsumerValues );
+    CPPUNIT_TEST( TestUnixProcessInvokeTopResourceConsumerValuesFail );
+    CPPUNIT_TEST( TestUnixProcessInvokeAggregateProcesses );
+    CPPUNIT_TEST( TestUnixProcessInvokeAggregateProcessesFail );
+    CPPUNIT_TEST( TestUnixProcessInvokeEnumerateChanges );
 
 
     SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessEnumerateInstances, SLOW);
@@ -58,6 +66,11 @@ class SCXProcessProviderTest : public CPPUNIT_NS::TestFixture
 
     SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeTopResourceConsumers, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeTopResourceConsumersFail, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeTopResourceConsumerValues, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeTopResourceConsumerValuesFail, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeAggregateProcesses, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeAggregateProcessesFail, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestUnixProcessInvokeEnumerateChanges, SLOW);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -226,6 +239,200 @@ public:
             GetTopResourceConsumers("InvalidResource", CALL_LOCATION(errMsg)));
     }
 
+    bool GetTopResourceConsumerValues(const char* resourceName, std::wstring errMsg)
+    {
+        TestableContext context;
+        mi::SCX_UnixProcess_Class instanceName;
+        mi::SCX_UnixProcess_TopResourceConsumerValues_Class param;
+        param.resource_value(resourceName);
+        param.count_value(5);
+        param.threshold_value(0);
+
+        mi::Module Module;
+        mi::SCX_UnixProcess_Class_Provider agent(&Module);
+        agent.Invoke_TopResourceConsumerValues(context, NULL, instanceName, param);
+        if (context.GetResult() == MI_RESULT_OK)
+        {
+            const std::vector<TestableInstance> &instances = context.GetInstances();
+            // We expect one instance to be returned.
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1u, instances.size());
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, instances[0].GetProperty("MIReturn",
+                CALL_LOCATION(errMsg)).GetValue_MIBoolean(CALL_LOCATION(errMsg)));
+
+            // There is always at least one process (ourselves), and never more than requested
+            std::vector<std::wstring> names = instances[0].GetProperty("Names",
+                CALL_LOCATION(errMsg)).GetValue_MIStringA(CALL_LOCATION(errMsg));
+            CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, names.size() >= 1 && names.size() <= 5);
+            return true;
+        }
+        return false;
+    }
+
+    void TestUnixProcessInvokeTopResourceConsumerValues()
+    {
+        std::wstring errMsg;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, GetTopResourceConsumerValues("UsedMemory", CALL_LOCATION(errMsg)));
+
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        std::vector<SCXCore::ProcessProvider::ResourceConsumer> consumers;
+
+        // The processes using the most memory use some, so take the value in the middle of the list as threshold
+        SCXCore::g_ProcessProvider.GetTopResourceConsumers(L"UsedMemory", 20, 0, consumers);
+        CPPUNIT_ASSERT(consumers.size() >= 2);
+        scxulong threshold = consumers[consumers.size() / 2].value;
+        CPPUNIT_ASSERT(threshold > 0);
+
+        SCXCore::g_ProcessProvider.GetTopResourceConsumers(L"UsedMemory", 20, threshold, consumers);
+        CPPUNIT_ASSERT(consumers.size() >= 1);
+        for (size_t i = 0; i < consumers.size(); i++)
+        {
+            CPPUNIT_ASSERT(consumers[i].value >= threshold);
+            if (i > 0)
+            {
+                CPPUNIT_ASSERT(consumers[i - 1].value >= consumers[i].value);
+            }
+        }
+    }
+
+    void TestUnixProcessInvokeTopResourceConsumerValuesFail()
+    {
+        std::wstring errMsg;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, false,
+            GetTopResourceConsumerValues("InvalidResource", CALL_LOCATION(errMsg)));
+    }
+
+    bool AggregateProcesses(const char* groupBy, std::wstring errMsg)
+    {
+        TestableContext context;
+        mi::SCX_UnixProcess_Class instanceName;
+        mi::SCX_UnixProcess_AggregateProcesses_Class param;
+        param.groupBy_value(groupBy);
+
+        mi::Module Module;
+        mi::SCX_UnixProcess_Class_Provider agent(&Module);
+        agent.Invoke_AggregateProcesses(context, NULL, instanceName, param);
+        if (context.GetResult() == MI_RESULT_OK)
+        {
+            const std::vector<TestableInstance> &instances = context.GetInstances();
+            // We expect one instance to be returned.
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1u, instances.size());
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, instances[0].GetProperty("MIReturn",
+                CALL_LOCATION(errMsg)).GetValue_MIBoolean(CALL_LOCATION(errMsg)));
+
+            // There is always at least one group (ours), and each group is returned once
+            std::vector<std::wstring> groups = instances[0].GetProperty("Groups",
+                CALL_LOCATION(errMsg)).GetValue_MIStringA(CALL_LOCATION(errMsg));
+            CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, groups.size() >= 1);
+            for (size_t i = 1; i < groups.size(); i++)
+            {
+                CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, groups[i - 1] != groups[i]);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void TestUnixProcessInvokeAggregateProcesses()
+    {
+        std::wstring errMsg;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, AggregateProcesses("Name", CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, AggregateProcesses("RealUserID", CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, AggregateProcesses("ProcessGroupID", CALL_LOCATION(errMsg)));
+
+        SCXCoreLib::SCXThreadLock lock(SCXCoreLib::ThreadLockHandleGet(L"SCXCore::ProcessProvider::Lock"));
+        CheckProcessGroups(L"RealUserID", StrToUTF8(StrFrom(getuid())));
+        CheckProcessGroups(L"ProcessGroupID", StrToUTF8(StrFrom(getpgrp())));
+
+        SCXHandle<SCXSystemLib::ProcessInstance> self =
+            SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcess")->GetInstance(StrFrom(getpid()));
+        CPPUNIT_ASSERT(NULL != self);
+        std::string name;
+        CPPUNIT_ASSERT(self->GetName(name));
+        CheckProcessGroups(L"Name", name);
+    }
+
+    /**
+       Groups the processes, and checks that every process is counted once,
+       and that the group of this process is returned.  Called with the
+       ProcessProvider lock held.
+    */
+    void CheckProcessGroups(const std::wstring& groupBy, const std::string& ownKey)
+    {
+        std::vector<SCXCore::ProcessProvider::ProcessGroup> groups;
+        SCXCore::g_ProcessProvider.AggregateProcesses(groupBy, groups);
+
+        // The groups are made from the processes AggregateProcesses just walked
+        scxulong total = 0;
+        bool ownFound = false;
+        for (size_t i = 0; i < groups.size(); i++)
+        {
+            total += groups[i].count;
+            if (groups[i].key == ownKey)
+            {
+                CPPUNIT_ASSERT(groups[i].count >= 1);
+                ownFound = true;
+            }
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(SCXCore::g_ProcessProvider.GetProcessEnumerator(L"SCX_UnixProcess")->Size()), total);
+        CPPUNIT_ASSERT(ownFound);
+    }
+
+    void TestUnixProcessInvokeAggregateProcessesFail()
+    {
+        std::wstring errMsg;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, false, AggregateProcesses("InvalidGrouping", CALL_LOCATION(errMsg)));
+    }
+
+    bool EnumerateChanges(const std::wstring& token, std::wstring& nextToken, size_t& count, std::wstring errMsg)
+    {
+        TestableContext context;
+        mi::SCX_UnixProcess_Class instanceName;
+        mi::SCX_UnixProcess_EnumerateChanges_Class param;
+        param.token_value(StrToUTF8(token).c_str());
+
+        mi::Module Module;
+        mi::SCX_UnixProcess_Class_Provider agent(&Module);
+        agent.Invoke_EnumerateChanges(context, NULL, instanceName, param);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, MI_RESULT_OK, context.GetResult());
+
+        const std::vector<TestableInstance> &instances = context.GetInstances();
+        // We expect one instance to be returned.
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1u, instances.size());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, instances[0].GetProperty("MIReturn",
+            CALL_LOCATION(errMsg)).GetValue_MIBoolean(CALL_LOCATION(errMsg)));
+
+        nextToken = instances[0].GetProperty("NextToken", CALL_LOCATION(errMsg)).GetValue_MIString(CALL_LOCATION(errMsg));
+        bool fullResync = instances[0].GetProperty("FullResync", CALL_LOCATION(errMsg)).GetValue_MIBoolean(CALL_LOCATION(errMsg));
+
+        // The arrays are only set when there are changes, which a full resync always has (ourselves)
+        count = 0;
+        if (fullResync)
+        {
+            count = instances[0].GetProperty("Names", CALL_LOCATION(errMsg)).GetValue_MIStringA(CALL_LOCATION(errMsg)).size();
+        }
+        return fullResync;
+    }
+
+    void TestUnixProcessInvokeEnumerateChanges()
+    {
+        std::wstring errMsg;
+        std::wstring token, nextToken;
+        size_t count;
+
+        // Without a token, every process is returned (at least ourselves)
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, EnumerateChanges(L"", token, count, CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, count >= 1);
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, !token.empty());
+
+        // With it, only the changes are returned
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, false, EnumerateChanges(token, nextToken, count, CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, !nextToken.empty());
+
+        // An unknown token gets a full resync
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, true, EnumerateChanges(L"unknown.1", nextToken, count, CALL_LOCATION(errMsg)));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, count >= 1);
+    }
+
     void ValidateInstance(const TestableContext& context, std::wstring errMsg)
     {
         for (size_t n = 0; n < context.Size(); n++)
@@ -0,0 +1,158 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests the batched snapshot enumeration helper
+
+   \date        2026-10-19 09:12:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "snapshotenumeration.h"
+
+#include <vector>
+
+using namespace SCXCoreLib;
+
+namespace
+{
+    //! Minimal stand-in for a CIM instance
+    struct TestInstance
+    {
+        TestInstance() : value(-1) { }
+        int value;
+    };
+
+    //! Minimal stand-in for an OMI context; records what was posted
+    class TestContext
+    {
+    public:
+        void Post(const TestInstance& inst) { m_posted.push_back(inst.value); }
+        const std::vector<int>& GetPosted() const { return m_posted; }
+
+    private:
+        std::vector<int> m_posted;
+    };
+
+    //! Builder that counts how many instances it has built
+    class TestBuilder
+    {
+    public:
+        explicit TestBuilder(size_t& built) : m_built(built) { }
+
+        void operator()(const SCXCore::SnapshotValue<int>& snap, TestInstance& inst) const
+        {
+            m_built++;
+            if (snap.exists)
+            {
+                inst.value = snap.value;
+            }
+        }
+
+    private:
+        size_t& m_built;
+    };
+}
+
+class SCXSnapshotEnumerationTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXSnapshotEnumerationTest );
+
+    CPPUNIT_TEST( TestPostsAllSnapshotsInOrder );
+    CPPUNIT_TEST( TestSnapshotsDiscardedAfterPost );
+    CPPUNIT_TEST( TestMissingValuesNotSet );
+    CPPUNIT_TEST( TestZeroBatchSizeIsAdjusted );
+    CPPUNIT_TEST( TestEmptyEnumeration );
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    void AddSnapshots(SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> >& snapshots, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            SCXCore::SnapshotValue<int>& snap = snapshots.Add();
+            snap.value = i;
+            snap.exists = true;
+        }
+    }
+
+public:
+    void TestPostsAllSnapshotsInOrder()
+    {
+        SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> > snapshots(3);
+        AddSnapshots(snapshots, 7);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), snapshots.Size());
+
+        TestContext context;
+        size_t built = 0;
+        size_t posted = snapshots.Post<TestInstance>(context, TestBuilder(built));
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), posted);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), built);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), context.GetPosted().size());
+        for (int i = 0; i < 7; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(i, context.GetPosted()[i]);
+        }
+    }
+
+    void TestSnapshotsDiscardedAfterPost()
+    {
+        SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> > snapshots(2);
+        AddSnapshots(snapshots, 5);
+
+        TestContext context;
+        size_t built = 0;
+        snapshots.Post<TestInstance>(context, TestBuilder(built));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), snapshots.Size());
+
+        // A second post has nothing left to send
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), snapshots.Post<TestInstance>(context, TestBuilder(built)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), context.GetPosted().size());
+    }
+
+    void TestMissingValuesNotSet()
+    {
+        SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> > snapshots(10);
+        snapshots.Add();
+
+        TestContext context;
+        size_t built = 0;
+        snapshots.Post<TestInstance>(context, TestBuilder(built));
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), context.GetPosted().size());
+        CPPUNIT_ASSERT_EQUAL(-1, context.GetPosted()[0]);
+    }
+
+    void TestZeroBatchSizeIsAdjusted()
+    {
+        SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> > snapshots(0);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), snapshots.GetBatchSize());
+        AddSnapshots(snapshots, 3);
+
+        TestContext context;
+        size_t built = 0;
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), snapshots.Post<TestInstance>(context, TestBuilder(built)));
+    }
+
+    void TestEmptyEnumeration()
+    {
+        SCXCore::SnapshotEnumeration<SCXCore::SnapshotValue<int> > snapshots;
+        CPPUNIT_ASSERT(snapshots.GetBatchSize() > 0);
+
+        TestContext context;
+        size_t built = 0;
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), snapshots.Post<TestInstance>(context, TestBuilder(built)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), built);
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXSnapshotEnumerationTest );
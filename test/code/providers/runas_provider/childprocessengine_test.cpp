@@ -0,0 +1,232 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the RunAs child process engine
+
+   \date        2026-10-19 16:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxfilepath.h>
+#include <scxcorelib/scxthread.h>
+#include <testutils/scxunit.h>
+
+#include "childprocessengine.h"
+
+#include <sstream>
+#include <time.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+namespace
+{
+    class RunThreadParam : public SCXThreadParam
+    {
+    public:
+        RunThreadParam(ChildProcessEngine& engine) : m_engine(engine), m_returncode(-1) { }
+
+        ChildProcessEngine& m_engine;
+        int m_returncode;
+        std::string m_output;
+    };
+
+    void RunThreadBody(SCXThreadParamHandle& param)
+    {
+        RunThreadParam* p = static_cast<RunThreadParam*>(param.GetData());
+        std::istringstream input;
+        std::ostringstream output, error;
+        p->m_returncode = p->m_engine.Run(L"/bin/sh -c 'sleep 1; echo done'", input, output, error, 0,
+                                          SCXFilePath(L""), SCXFilePath(L""));
+        p->m_output = output.str();
+    }
+}
+
+class SCXChildProcessEngineTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXChildProcessEngineTest );
+
+    CPPUNIT_TEST( TestSplitCommand );
+    CPPUNIT_TEST( TestOutputAndReturnCode );
+    CPPUNIT_TEST( TestInput );
+    CPPUNIT_TEST( TestWorkingDirectory );
+    CPPUNIT_TEST( TestCommandNotFound );
+    CPPUNIT_TEST( TestKilledBySignal );
+    CPPUNIT_TEST( TestTimeoutKillsProcessGroup );
+    CPPUNIT_TEST( TestBackgroundChildDoesNotBlock );
+    CPPUNIT_TEST( TestConcurrentRuns );
+    CPPUNIT_TEST( TestResourceLimits );
+    CPPUNIT_TEST( TestResourceLimitFailure );
+    CPPUNIT_TEST( TestResourceUsage );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestTimeoutKillsProcessGroup, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestBackgroundChildDoesNotBlock, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestConcurrentRuns, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    ChildProcessEngine m_engine;
+
+    int Run(const std::wstring& command, std::string& output, std::string& error,
+            unsigned int timeoutMilliseconds = 0, const std::string& input = "")
+    {
+        std::istringstream in(input);
+        std::ostringstream out, err;
+        int returncode = m_engine.Run(command, in, out, err, timeoutMilliseconds, SCXFilePath(L""), SCXFilePath(L""));
+        output = out.str();
+        error = err.str();
+        return returncode;
+    }
+
+public:
+    void tearDown()
+    {
+        m_engine.Shutdown();
+    }
+
+    void TestSplitCommand()
+    {
+        std::vector<std::string> args = ChildProcessEngine::SplitCommand(L"/bin/sh -c 'echo \"a  b\"' x\\ y \"c\\\"d\" ''");
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), args.size());
+        CPPUNIT_ASSERT_EQUAL(std::string("/bin/sh"), args[0]);
+        CPPUNIT_ASSERT_EQUAL(std::string("-c"), args[1]);
+        CPPUNIT_ASSERT_EQUAL(std::string("echo \"a  b\""), args[2]);
+        CPPUNIT_ASSERT_EQUAL(std::string("x y"), args[3]);
+        CPPUNIT_ASSERT_EQUAL(std::string("c\"d"), args[4]);
+        CPPUNIT_ASSERT_EQUAL(std::string(""), args[5]);
+
+        CPPUNIT_ASSERT(ChildProcessEngine::SplitCommand(L"  \t ").empty());
+    }
+
+    void TestOutputAndReturnCode()
+    {
+        std::string out, err;
+        CPPUNIT_ASSERT_EQUAL(3, Run(L"/bin/sh -c 'echo hello; echo oops >&2; exit 3'", out, err));
+        CPPUNIT_ASSERT_EQUAL(std::string("hello\n"), out);
+        CPPUNIT_ASSERT_EQUAL(std::string("oops\n"), err);
+    }
+
+    void TestInput()
+    {
+        // More than a pipe buffer, so writing stdin has to be interleaved with reading stdout
+        std::string input(1024*1024, 'x');
+        std::string out, err;
+        CPPUNIT_ASSERT_EQUAL(0, Run(L"cat", out, err, 0, input));
+        CPPUNIT_ASSERT(input == out);
+    }
+
+    void TestWorkingDirectory()
+    {
+        std::istringstream in;
+        std::ostringstream out, err;
+        CPPUNIT_ASSERT_EQUAL(0, m_engine.Run(L"pwd", in, out, err, 0, SCXFilePath(L"/"), SCXFilePath(L"")));
+        CPPUNIT_ASSERT_EQUAL(std::string("/\n"), out.str());
+    }
+
+    void TestCommandNotFound()
+    {
+        std::string out, err;
+        CPPUNIT_ASSERT_THROW(Run(L"/non-existing-directory/non-existing-command", out, err), SCXErrnoException);
+        CPPUNIT_ASSERT_THROW(Run(L"", out, err), SCXInvalidArgumentException);
+    }
+
+    void TestKilledBySignal()
+    {
+        std::string out, err;
+        CPPUNIT_ASSERT_EQUAL(128 + 9, Run(L"/bin/sh -c 'kill -9 $$'", out, err));
+    }
+
+    void TestTimeoutKillsProcessGroup()
+    {
+        std::string out, err;
+        time_t start = time(NULL);
+        CPPUNIT_ASSERT_THROW(Run(L"/bin/sh -c 'echo started; sleep 60 & sleep 60'", out, err, 1000),
+                             SCXInternalErrorException);
+        CPPUNIT_ASSERT(time(NULL) - start < 10);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), m_engine.GetRunningCount());
+    }
+
+    void TestBackgroundChildDoesNotBlock()
+    {
+        // The command exits, but leaves a child holding its stdout open
+        std::string out, err;
+        time_t start = time(NULL);
+        CPPUNIT_ASSERT_EQUAL(0, Run(L"/bin/sh -c 'sleep 5 & echo started'", out, err));
+        CPPUNIT_ASSERT(time(NULL) - start < 4);
+        CPPUNIT_ASSERT_EQUAL(std::string("started\n"), out);
+    }
+
+    void TestConcurrentRuns()
+    {
+        const size_t count = 10;
+        std::vector<SCXThreadParamHandle> params;
+        std::vector<SCXHandle<SCXThread> > threads;
+        time_t start = time(NULL);
+        for (size_t i = 0; i < count; i++)
+        {
+            params.push_back(SCXThreadParamHandle(new RunThreadParam(m_engine)));
+            threads.push_back(SCXHandle<SCXThread>(new SCXThread(RunThreadBody, params.back())));
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            threads[i]->Wait();
+            RunThreadParam* p = static_cast<RunThreadParam*>(params[i].GetData());
+            CPPUNIT_ASSERT_EQUAL(0, p->m_returncode);
+            CPPUNIT_ASSERT_EQUAL(std::string("done\n"), p->m_output);
+        }
+
+        // The children ran side by side
+        CPPUNIT_ASSERT(time(NULL) - start < 5);
+    }
+
+    void TestResourceLimits()
+    {
+        RunAsResourceLimits limits;
+        limits.openFiles = 64;
+        limits.cpuSeconds = 30;
+        limits.nice = 5;
+        std::istringstream in;
+        std::ostringstream out, err;
+        CPPUNIT_ASSERT_EQUAL(0, m_engine.Run(L"/bin/sh -c 'ulimit -n; ulimit -t'", in, out, err, 0,
+                                             SCXFilePath(L""), SCXFilePath(L""), limits));
+        CPPUNIT_ASSERT_EQUAL(std::string("64\n30\n"), out.str());
+    }
+
+    void TestResourceLimitFailure()
+    {
+        // A cgroup that can't be joined is an error, rather than running the command unconfined
+        RunAsResourceLimits limits;
+        limits.cgroup = L"/non-existing-directory/";
+        std::istringstream in;
+        std::ostringstream out, err;
+        CPPUNIT_ASSERT_THROW(m_engine.Run(L"/bin/echo hello", in, out, err, 0, SCXFilePath(L""), SCXFilePath(L""), limits),
+                             SCXErrnoException);
+        CPPUNIT_ASSERT_EQUAL(std::string(""), out.str());
+    }
+
+    void TestResourceUsage()
+    {
+        std::istringstream in;
+        std::ostringstream out, err;
+        ChildResourceUsage usage;
+        CPPUNIT_ASSERT_EQUAL(0, m_engine.Run(L"/bin/sh -c 'i=0; while [ $i -lt 100000 ]; do i=$((i+1)); done'", in, out, err,
+                                             0, SCXFilePath(L""), SCXFilePath(L""), RunAsResourceLimits(), &usage));
+#if defined(linux)
+        CPPUNIT_ASSERT(usage.known);
+        CPPUNIT_ASSERT(usage.userMilliseconds + usage.systemMilliseconds > 0);
+        CPPUNIT_ASSERT(usage.maxResidentKB > 0);
+        CPPUNIT_ASSERT(usage.Format().find(L"MaxResidentKB=") != std::wstring::npos);
+#endif
+        CPPUNIT_ASSERT_EQUAL(usage.known, !usage.Format().empty());
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXChildProcessEngineTest );
@@ -0,0 +1,221 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the ExecuteCommand result cache
+
+   \date        2026-10-19 15:00:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthread.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/scxunit.h>
+
+#include "commandresultcache.h"
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+namespace
+{
+    //! Cache with a clock controlled by the test
+    class TestableCommandResultCache : public CommandResultCache
+    {
+    public:
+        TestableCommandResultCache(size_t maxEntries = cDefaultCommandResultCacheEntries)
+            : CommandResultCache(maxEntries), m_now(1000000) { }
+
+        void Advance(time_t seconds) { m_now += seconds; }
+
+    protected:
+        virtual time_t GetTime() const { return m_now; }
+
+    private:
+        time_t m_now;
+    };
+
+    //! Counts executions, optionally sleeping or throwing
+    class CountingExecutor : public CommandResultExecutor
+    {
+    public:
+        CountingExecutor(scxulong sleepMilliseconds = 0, bool fail = false)
+            : m_executions(0), m_sleepMilliseconds(sleepMilliseconds), m_fail(fail) { }
+
+        virtual void Execute(CommandResult& result)
+        {
+            m_executions++;
+            if (m_sleepMilliseconds > 0)
+            {
+                SCXThread::Sleep(m_sleepMilliseconds);
+            }
+            if (m_fail)
+            {
+                throw SCXInternalErrorException(L"Execution failed", SCXSRCLOCATION);
+            }
+            result.succeeded = true;
+            result.returncode = 0;
+            result.out = StrFrom(m_executions);
+        }
+
+        int m_executions;
+
+    private:
+        scxulong m_sleepMilliseconds;
+        bool m_fail;
+    };
+
+    class ExecuteThreadParam : public SCXThreadParam
+    {
+    public:
+        ExecuteThreadParam(CommandResultCache& cache, CommandResultExecutor& executor)
+            : m_cache(cache), m_executor(executor), m_shared(false) { }
+
+        CommandResultCache& m_cache;
+        CommandResultExecutor& m_executor;
+        CommandResult m_result;
+        bool m_shared;
+    };
+
+    void ExecuteThreadBody(SCXThreadParamHandle& param)
+    {
+        ExecuteThreadParam* p = static_cast<ExecuteThreadParam*>(param.GetData());
+        p->m_shared = p->m_cache.Execute(L"key", 60, p->m_executor, p->m_result);
+    }
+}
+
+class SCXCommandResultCacheTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXCommandResultCacheTest );
+
+    CPPUNIT_TEST( TestKeyIncludesContext );
+    CPPUNIT_TEST( TestResultIsReusedWithinMaxAge );
+    CPPUNIT_TEST( TestResultExpires );
+    CPPUNIT_TEST( TestMaxAgeIsPerCall );
+    CPPUNIT_TEST( TestEntryLimit );
+    CPPUNIT_TEST( TestFailureIsNotCached );
+    CPPUNIT_TEST( TestConcurrentCallsShareExecution );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestConcurrentCallsShareExecution, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestKeyIncludesContext()
+    {
+        std::wstring key = CommandResultCache::MakeKey(L"df", L"", L"/", L"", 60);
+        CPPUNIT_ASSERT(key == CommandResultCache::MakeKey(L"df", L"", L"/", L"", 60));
+        CPPUNIT_ASSERT(key != CommandResultCache::MakeKey(L"df", L"sudo", L"/", L"", 60));
+        CPPUNIT_ASSERT(key != CommandResultCache::MakeKey(L"df", L"", L"/tmp/", L"", 60));
+        CPPUNIT_ASSERT(key != CommandResultCache::MakeKey(L"df", L"", L"/", L"/jail/", 60));
+        CPPUNIT_ASSERT(key != CommandResultCache::MakeKey(L"df -k", L"", L"/", L"", 60));
+        CPPUNIT_ASSERT(key != CommandResultCache::MakeKey(L"df", L"", L"/", L"", 0));
+    }
+
+    void TestResultIsReusedWithinMaxAge()
+    {
+        TestableCommandResultCache cache;
+        CountingExecutor executor;
+        CommandResult result;
+
+        CPPUNIT_ASSERT(!cache.Execute(L"key", 10, executor, result));
+        cache.Advance(10);
+        CPPUNIT_ASSERT(cache.Execute(L"key", 10, executor, result));
+
+        CPPUNIT_ASSERT_EQUAL(1, executor.m_executions);
+        CPPUNIT_ASSERT(result.succeeded);
+        CPPUNIT_ASSERT(L"1" == result.out);
+    }
+
+    void TestResultExpires()
+    {
+        TestableCommandResultCache cache;
+        CountingExecutor executor;
+        CommandResult result;
+
+        cache.Execute(L"key", 10, executor, result);
+        cache.Advance(11);
+        CPPUNIT_ASSERT(!cache.Execute(L"key", 10, executor, result));
+
+        CPPUNIT_ASSERT_EQUAL(2, executor.m_executions);
+        CPPUNIT_ASSERT(L"2" == result.out);
+    }
+
+    void TestMaxAgeIsPerCall()
+    {
+        TestableCommandResultCache cache;
+        CountingExecutor executor;
+        CommandResult result;
+
+        cache.Execute(L"key", 60, executor, result);
+        cache.Advance(5);
+
+        // A caller needing fresher data than the stored result runs the command
+        CPPUNIT_ASSERT(!cache.Execute(L"key", 2, executor, result));
+        CPPUNIT_ASSERT(cache.Execute(L"key", 60, executor, result));
+        CPPUNIT_ASSERT_EQUAL(2, executor.m_executions);
+    }
+
+    void TestEntryLimit()
+    {
+        TestableCommandResultCache cache(2);
+        CountingExecutor executor;
+        CommandResult result;
+
+        cache.Execute(L"a", 60, executor, result);
+        cache.Advance(1);
+        cache.Execute(L"b", 60, executor, result);
+        cache.Advance(1);
+        cache.Execute(L"c", 60, executor, result);
+        cache.Advance(1);
+
+        // The oldest result ("a") was evicted when "c" was stored
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), cache.GetEntryCount());
+        CPPUNIT_ASSERT(!cache.Execute(L"a", 60, executor, result));
+        CPPUNIT_ASSERT(cache.Execute(L"c", 60, executor, result));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), cache.GetEntryCount());
+    }
+
+    void TestFailureIsNotCached()
+    {
+        TestableCommandResultCache cache;
+        CountingExecutor failing(0, true);
+        CountingExecutor executor;
+        CommandResult result;
+
+        CPPUNIT_ASSERT_THROW(cache.Execute(L"key", 60, failing, result), SCXInternalErrorException);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cache.GetEntryCount());
+
+        CPPUNIT_ASSERT(!cache.Execute(L"key", 60, executor, result));
+        CPPUNIT_ASSERT_EQUAL(1, executor.m_executions);
+    }
+
+    void TestConcurrentCallsShareExecution()
+    {
+        CommandResultCache cache;
+        CountingExecutor executor(1000);
+
+        SCXThreadParamHandle param(new ExecuteThreadParam(cache, executor));
+        SCXThread thread(ExecuteThreadBody, param);
+
+        // Let the thread start the (slow) execution, then make the same call
+        SCXThread::Sleep(200);
+        CommandResult result;
+        bool shared = cache.Execute(L"key", 60, executor, result);
+        thread.Wait();
+
+        ExecuteThreadParam* p = static_cast<ExecuteThreadParam*>(param.GetData());
+        CPPUNIT_ASSERT_EQUAL(1, executor.m_executions);
+        CPPUNIT_ASSERT(!p->m_shared);
+        CPPUNIT_ASSERT(shared);
+        CPPUNIT_ASSERT(p->m_result.out == result.out);
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXCommandResultCacheTest );
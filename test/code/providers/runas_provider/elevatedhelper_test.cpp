@@ -0,0 +1,260 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the elevated helper used by the RunAs provider
+
+   \date        2026-10-19 15:30:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxfilepath.h>
+#include <scxcorelib/scxthread.h>
+#include <testutils/scxunit.h>
+
+#include "elevatedhelper.h"
+#include "outputcapture.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+namespace
+{
+    class HelperThreadParam : public SCXThreadParam
+    {
+    public:
+        HelperThreadParam(int fd) : m_fd(fd), m_exitStatus(-1) { }
+
+        int m_fd;
+        int m_exitStatus;
+    };
+
+    void HelperThreadBody(SCXThreadParamHandle& param)
+    {
+        HelperThreadParam* p = static_cast<HelperThreadParam*>(param.GetData());
+        p->m_exitStatus = RunElevatedHelper(p->m_fd, SCXFilePath(L"/"), SCXFilePath(L""));
+        close(p->m_fd);
+    }
+
+    //! Runs the helper in a thread of the test process instead of through sudo
+    class TestableElevatedHelper : public ElevatedHelper
+    {
+    public:
+        TestableElevatedHelper(bool startFails = false) : m_startFails(startFails), m_starts(0) { }
+
+        ~TestableElevatedHelper()
+        {
+            Stop();
+            Join();
+        }
+
+        void Join()
+        {
+            if (NULL != m_thread)
+            {
+                m_thread->Wait();
+            }
+        }
+
+        int GetExitStatus()
+        {
+            return static_cast<HelperThreadParam*>(m_param.GetData())->m_exitStatus;
+        }
+
+        int m_starts;
+
+    protected:
+        virtual bool IsElevated() const
+        {
+            // The tests run as root too
+            return false;
+        }
+
+        virtual bool StartHelper(int& fd, pid_t& pid)
+        {
+            m_starts++;
+            int sv[2];
+            if (m_startFails || socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+            {
+                return false;
+            }
+
+            Join();
+            m_param = new HelperThreadParam(sv[1]);
+            m_thread = new SCXThread(HelperThreadBody, m_param);
+            fd = sv[0];
+            pid = 0;
+            return true;
+        }
+
+    private:
+        bool m_startFails;
+        SCXThreadParamHandle m_param;
+        SCXHandle<SCXThread> m_thread;
+    };
+}
+
+class SCXElevatedHelperTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXElevatedHelperTest );
+
+    CPPUNIT_TEST( TestChannelRoundTrip );
+    CPPUNIT_TEST( TestChannelEndOfFile );
+    CPPUNIT_TEST( TestExecute );
+    CPPUNIT_TEST( TestExecuteInput );
+    CPPUNIT_TEST( TestExecuteLimit );
+    CPPUNIT_TEST( TestExecuteFailure );
+    CPPUNIT_TEST( TestStopEndsHelper );
+    CPPUNIT_TEST( TestStartFailureFallsBack );
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestChannelRoundTrip()
+    {
+        int sv[2];
+        CPPUNIT_ASSERT_EQUAL(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+
+        ElevatedHelperChannel writer(sv[0]);
+        ElevatedHelperChannel reader(sv[1]);
+        writer.Write(std::string("hello"));
+        writer.Write(std::string(""));
+        writer.Write(static_cast<scxlong>(-42));
+        writer.Write(static_cast<scxlong>(0x123456789LL));
+
+        std::string text;
+        scxlong value;
+        CPPUNIT_ASSERT(reader.WaitReadable(1000));
+        CPPUNIT_ASSERT(reader.Read(text));
+        CPPUNIT_ASSERT_EQUAL(std::string("hello"), text);
+        CPPUNIT_ASSERT(reader.Read(text));
+        CPPUNIT_ASSERT_EQUAL(std::string(""), text);
+        CPPUNIT_ASSERT(reader.Read(value));
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxlong>(-42), value);
+        CPPUNIT_ASSERT(reader.Read(value));
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxlong>(0x123456789LL), value);
+        CPPUNIT_ASSERT(!reader.WaitReadable(0));
+
+        close(sv[0]);
+        close(sv[1]);
+    }
+
+    void TestChannelEndOfFile()
+    {
+        int sv[2];
+        CPPUNIT_ASSERT_EQUAL(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+
+        // A field cut short is an error, end of file between fields is not
+        const char partial[] = { 0, 0, 0, 10, 'a' };
+        CPPUNIT_ASSERT_EQUAL(static_cast<ssize_t>(sizeof(partial)), write(sv[0], partial, sizeof(partial)));
+        close(sv[0]);
+
+        ElevatedHelperChannel reader(sv[1]);
+        std::string text;
+        CPPUNIT_ASSERT_THROW(reader.Read(text), SCXInternalErrorException);
+        CPPUNIT_ASSERT(!reader.Read(text));
+
+        close(sv[1]);
+    }
+
+    void TestExecute()
+    {
+        TestableElevatedHelper helper;
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/sh -c 'echo hello; echo oops >&2; exit 3'", "", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(3, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::string("hello\n"), out.GetData());
+        CPPUNIT_ASSERT_EQUAL(std::string("oops\n"), err.GetData());
+
+        // The same helper runs the next command
+        OutputCaptureBuffer out2(100);
+        OutputCaptureBuffer err2(100);
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/echo again", "", 0, 100, out2, err2, returncode));
+        CPPUNIT_ASSERT_EQUAL(0, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::string("again\n"), out2.GetData());
+        CPPUNIT_ASSERT_EQUAL(1, helper.m_starts);
+    }
+
+    void TestExecuteInput()
+    {
+        TestableElevatedHelper helper;
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/sh -s -- one two", "echo \"$2 $1\"\n", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(0, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::string("two one\n"), out.GetData());
+    }
+
+    void TestExecuteLimit()
+    {
+        TestableElevatedHelper helper;
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/echo hello", "", 0, 3, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(std::string("hel"), out.GetData());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(6), out.GetTotalBytes());
+        CPPUNIT_ASSERT(out.IsTruncated());
+    }
+
+    void TestExecuteFailure()
+    {
+        TestableElevatedHelper helper;
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        // Errors running a command are passed on; the helper keeps running
+        CPPUNIT_ASSERT_THROW(helper.Execute(L"", "", 0, 100, out, err, returncode), SCXInternalErrorException);
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/echo hello", "", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(1, helper.m_starts);
+    }
+
+    void TestStopEndsHelper()
+    {
+        TestableElevatedHelper helper;
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/echo hello", "", 0, 100, out, err, returncode));
+        helper.Stop();
+        helper.Join();
+        CPPUNIT_ASSERT_EQUAL(0, helper.GetExitStatus());
+
+        // A new helper is started when needed
+        CPPUNIT_ASSERT(helper.Execute(L"/bin/echo hello", "", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(2, helper.m_starts);
+    }
+
+    void TestStartFailureFallsBack()
+    {
+        TestableElevatedHelper helper(true);
+        OutputCaptureBuffer out(100);
+        OutputCaptureBuffer err(100);
+        int returncode = -1;
+
+        CPPUNIT_ASSERT(!helper.Execute(L"/bin/echo hello", "", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(0), out.GetTotalBytes());
+
+        // Starting isn't retried right away
+        CPPUNIT_ASSERT(!helper.Execute(L"/bin/echo hello", "", 0, 100, out, err, returncode));
+        CPPUNIT_ASSERT_EQUAL(1, helper.m_starts);
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXElevatedHelperTest );
@@ -0,0 +1,108 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the bounded RunAs output capture
+
+   \date        2026-10-19 14:30:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "outputcapture.h"
+
+#include <ostream>
+
+using namespace SCXCore;
+
+class SCXOutputCaptureTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXOutputCaptureTest );
+
+    CPPUNIT_TEST( TestBelowLimit );
+    CPPUNIT_TEST( TestAboveLimitIsCounted );
+    CPPUNIT_TEST( TestSingleCharacters );
+    CPPUNIT_TEST( TestGetTextLimit );
+    CPPUNIT_TEST( TestUTF8Boundary );
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestBelowLimit()
+    {
+        OutputCaptureBuffer buffer(100);
+        std::ostream stream(&buffer);
+        stream << "hello world";
+
+        CPPUNIT_ASSERT_EQUAL(std::string("hello world"), buffer.GetData());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(11), buffer.GetTotalBytes());
+        CPPUNIT_ASSERT(!buffer.IsTruncated());
+        CPPUNIT_ASSERT(L"hello world" == buffer.GetText(100));
+    }
+
+    void TestAboveLimitIsCounted()
+    {
+        OutputCaptureBuffer buffer(10);
+        std::ostream stream(&buffer);
+        std::string block(4096, 'x');
+        for (int i = 0; i < 100; i++)
+        {
+            stream.write(block.data(), block.size());
+        }
+
+        // The stream never fails, so the process pipe keeps being drained
+        CPPUNIT_ASSERT(stream.good());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(10), buffer.GetData().size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(409600), buffer.GetTotalBytes());
+        CPPUNIT_ASSERT(buffer.IsTruncated());
+    }
+
+    void TestSingleCharacters()
+    {
+        OutputCaptureBuffer buffer(3);
+        std::ostream stream(&buffer);
+        stream.put('a').put('b').put('c').put('d');
+
+        CPPUNIT_ASSERT(stream.good());
+        CPPUNIT_ASSERT_EQUAL(std::string("abc"), buffer.GetData());
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(4), buffer.GetTotalBytes());
+    }
+
+    void TestGetTextLimit()
+    {
+        OutputCaptureBuffer buffer(100);
+        std::ostream stream(&buffer);
+        stream << "0123456789";
+
+        CPPUNIT_ASSERT(L"01234" == buffer.GetText(5));
+        CPPUNIT_ASSERT(L"0123456789" == buffer.GetText(10));
+    }
+
+    void TestUTF8Boundary()
+    {
+        // "a", then U+00E9 (2 bytes), then U+20AC (3 bytes)
+        std::string data("a\xC3\xA9\xE2\x82\xAC");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), OutputCaptureBuffer::GetUTF8Boundary(data, 0));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), OutputCaptureBuffer::GetUTF8Boundary(data, 1));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), OutputCaptureBuffer::GetUTF8Boundary(data, 2));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), OutputCaptureBuffer::GetUTF8Boundary(data, 3));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), OutputCaptureBuffer::GetUTF8Boundary(data, 4));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), OutputCaptureBuffer::GetUTF8Boundary(data, 5));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), OutputCaptureBuffer::GetUTF8Boundary(data, 6));
+
+        // A capture limit that splits a character drops it
+        OutputCaptureBuffer buffer(2);
+        std::ostream stream(&buffer);
+        stream << data;
+        CPPUNIT_ASSERT(L"a" == buffer.GetText(2));
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXOutputCaptureTest );
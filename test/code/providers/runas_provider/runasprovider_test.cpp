@@ -18,6 +18,7 @@
 #include <scxcorelib/scxcmn.h>
 #include <scxcorelib/scxdirectoryinfo.h>
 #include <scxcorelib/scxexception.h>
+#include <scxcorelib/scxthread.h>
 #include <scxcorelib/strerror.h>
 #include <scxcorelib/stringaid.h>
 #include <scxcorelib/scxprocess.h>
@@ -27,13 +28,77 @@
 #include <testutils/providertestutils.h>
 #include "support/scxrunasconfigurator.h"
 #include "support/runasprovider.h"
+#include "support/elevatedhelper.h"
 #include <list>
+#include <sys/socket.h>
 #include <unistd.h>
+#include <time.h>
 #include <sstream>
 #include "SCX_OperatingSystem_Class_Provider.h"
 
 using namespace SCXCoreLib;
 
+namespace
+{
+    class HelperThreadParam : public SCXThreadParam
+    {
+    public:
+        HelperThreadParam(int fd) : m_fd(fd) { }
+
+        int m_fd;
+    };
+
+    void HelperThreadBody(SCXThreadParamHandle& param)
+    {
+        HelperThreadParam* p = static_cast<HelperThreadParam*>(param.GetData());
+        SCXCore::RunElevatedHelper(p->m_fd, SCXFilePath(L"/"), SCXFilePath(L""));
+        close(p->m_fd);
+    }
+
+    //! Runs the elevated helper in a thread of the test process instead of through sudo
+    class TestableElevatedHelper : public SCXCore::ElevatedHelper
+    {
+    public:
+        TestableElevatedHelper() : m_starts(0) { }
+
+        ~TestableElevatedHelper()
+        {
+            Stop();
+            if (NULL != m_thread)
+            {
+                m_thread->Wait();
+            }
+        }
+
+        int m_starts;
+
+    protected:
+        virtual bool IsElevated() const
+        {
+            // The tests run as root too
+            return false;
+        }
+
+        virtual bool StartHelper(int& fd, pid_t& pid)
+        {
+            m_starts++;
+            int sv[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+            {
+                return false;
+            }
+
+            m_thread = new SCXThread(HelperThreadBody, new HelperThreadParam(sv[1]));
+            fd = sv[0];
+            pid = 0;
+            return true;
+        }
+
+    private:
+        SCXHandle<SCXThread> m_thread;
+    };
+}
+
 // If you want to see extra information from executed commands/scripts
 // set "c_EnableDebugOutput" to 1.
 const int c_EnableDebugOutput = 0;
@@ -49,8 +114,11 @@ class SCXRunAsProviderTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( TestDoInvokeMethodCommandOKWithUppercaseElevationType );
     CPPUNIT_TEST( TestDoInvokeMethodCommandOKWithInvalidElevationType );
     CPPUNIT_TEST( TestDoInvokeMethodCommandFailed );
+    CPPUNIT_TEST( TestDoInvokeMethodCommandMaxResultAge );
     CPPUNIT_TEST( TestDoInvokeMethodShellCommandOK );
     CPPUNIT_TEST( TestDoInvokeMethodShellCommandOKWithBase64 );
+    CPPUNIT_TEST( TestDoInvokeMethodShellCommandLargeOutput );
+    CPPUNIT_TEST( TestDoInvokeMethodShellCommandTimeout );
     CPPUNIT_TEST( TestDoInvokeMethodShellCommandOKWithSudoElevationType );
     CPPUNIT_TEST( TestDoInvokeMethodShellCommandOKWithEmptyElevationType );
     CPPUNIT_TEST( TestDoInvokeMethodShellCommandOKWithInvalidElevationType );
@@ -62,11 +130,16 @@ class SCXRunAsProviderTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( TestDoInvokeMethodScriptFailed );
     CPPUNIT_TEST( TestDoInvokeMethodScriptNonSH );
     CPPUNIT_TEST( TestDoInvokeMethodScriptNoHashBang );
+    CPPUNIT_TEST( TestDoInvokeMethodScriptHashBangOption );
+    CPPUNIT_TEST( TestDoInvokeMethodScriptSingleQuotes );
+    CPPUNIT_TEST( TestDoInvokeMethodScriptNotOnCommandLine );
     CPPUNIT_TEST( TestDoInvokeMethodScriptTmpDir );
     CPPUNIT_TEST( TestDoInvokeMethodScriptDefaultTmpDir );
     CPPUNIT_TEST( TestDoInvokeMethodScriptNonDefaultTmpDir );
     CPPUNIT_TEST( TestChRoot );
     CPPUNIT_TEST( TestCWD );
+    CPPUNIT_TEST( TestResourceLimits );
+    CPPUNIT_TEST( TestElevatedHelper );
 
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandOK, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandOKWithEmptyElevationType, SLOW);
@@ -74,8 +147,11 @@ class SCXRunAsProviderTest : public CPPUNIT_NS::TestFixture
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandOKWithUppercaseElevationType, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandOKWithInvalidElevationType, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandFailed, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodCommandMaxResultAge, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandOK, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandOKWithBase64, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandLargeOutput, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandTimeout, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandOKWithSudoElevationType, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandOKWithEmptyElevationType, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodShellCommandOKWithInvalidElevationType, SLOW);
@@ -87,8 +163,13 @@ class SCXRunAsProviderTest : public CPPUNIT_NS::TestFixture
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptFailed, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptNonSH, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptNoHashBang, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptHashBangOption, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptSingleQuotes, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestDoInvokeMethodScriptNotOnCommandLine, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestChRoot, SLOW);
     SCXUNIT_TEST_ATTRIBUTE(TestCWD, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestResourceLimits, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestElevatedHelper, SLOW);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -146,6 +227,7 @@ public:
         MI_Sint32 returnCode;
         std::wstring stdOut;
         std::wstring stdErr;
+        std::wstring resourceUsage;
         InvokeReturnData(): returnCode(-55555555){}
     };
 
@@ -171,6 +253,8 @@ public:
                 GetValue_MIString(CALL_LOCATION(errMsg));
             returnData.stdErr = context[0].GetProperty(L"StdErr", CALL_LOCATION(errMsg)).
                 GetValue_MIString(CALL_LOCATION(errMsg));
+            returnData.resourceUsage = context[0].GetProperty(L"ResourceUsage", CALL_LOCATION(errMsg)).
+                GetValue_MIString(CALL_LOCATION(errMsg));
                 
             // Some common sense basic tests.
             if (!miRet)
@@ -317,6 +401,26 @@ public:
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, false, returnData.stdErr.empty());
     }
 
+    void TestDoInvokeMethodCommandMaxResultAge()
+    {
+        std::wstring errMsg;
+        // Output differs on every run (nanoseconds), unless the result is reused
+        mi::SCX_OperatingSystem_ExecuteCommand_Class param;
+        param.Command_value("date +%s%N");
+        param.timeout_value(0);
+        param.MaxResultAge_value(60);
+        InvokeReturnData first, second, uncached;
+        ExecuteCommand(param, MI_RESULT_OK, first, CALL_LOCATION(errMsg));
+        ExecuteCommand(param, MI_RESULT_OK, second, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 0, second.returnCode);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, first.stdOut, second.stdOut);
+
+        // Commands not marked cacheable always run
+        param.MaxResultAge_clear();
+        ExecuteCommand(param, MI_RESULT_OK, uncached, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, first.stdOut != uncached.stdOut);
+    }
+
     void TestDoInvokeMethodShellCommandOK()
     {
         std::wstring errMsg;
@@ -330,6 +434,36 @@ public:
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"", returnData.stdErr);
     }
 
+    void TestDoInvokeMethodShellCommandLargeOutput()
+    {
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteShellCommand_Class param;
+        // Far more output than is returned; the rest must still be drained
+        param.Command_value("yes | head -c 10000000; echo done >&2");
+        param.timeout_value(0);
+        InvokeReturnData returnData;
+        ExecuteShellCommand(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 0, returnData.returnCode);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, static_cast<size_t>(60*1024 - 1 - 1024), returnData.stdOut.size());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"y\ny\n", returnData.stdOut.substr(0, 4));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"done\n", returnData.stdErr);
+    }
+
+    void TestDoInvokeMethodShellCommandTimeout()
+    {
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteShellCommand_Class param;
+        // The background sleep keeps the pipes open; the whole process group is killed
+        param.Command_value("echo started; sleep 60 & sleep 60");
+        param.timeout_value(1);
+        InvokeReturnData returnData;
+        time_t start = time(NULL);
+        ExecuteShellCommand(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, time(NULL) - start < 10);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, -1, returnData.returnCode);
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, returnData.stdErr.find(L"Timeout") != std::wstring::npos);
+    }
+
 
     void TestDoInvokeMethodShellCommandOKWithBase64()
     {
@@ -546,6 +680,61 @@ public:
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"-test-\n", returnData.stdErr);
     }
     
+    void TestDoInvokeMethodScriptHashBangOption()
+    {
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteScript_Class param;
+        param.Script_value(
+            "#!/bin/sh -e\n"
+            "echo \"$3-$2-$1\"\n"
+            "# -e makes the script stop here\n"
+            "false\n"
+            "echo \"not reached\"\n");
+        param.Arguments_value("unit test run");
+        param.timeout_value(0);
+        InvokeReturnData returnData;
+        ExecuteScript(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 1, returnData.returnCode);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"run-test-unit\n", returnData.stdOut);
+    }
+
+    void TestDoInvokeMethodScriptSingleQuotes()
+    {
+        // Scripts are passed on stdin, so single quotes need no quoting
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteScript_Class param;
+        param.Script_value(
+            "#!/bin/sh\n"
+            "echo '$3-$2-$1' \"$3-$2-$1\"\n"
+            "exit 0\n");
+        param.Arguments_value("unit test run");
+        param.timeout_value(0);
+        InvokeReturnData returnData;
+        ExecuteScript(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 0, returnData.returnCode);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"$3-$2-$1 run-test-unit\n", returnData.stdOut);
+    }
+
+    void TestDoInvokeMethodScriptNotOnCommandLine()
+    {
+        // The script isn't on the command line of the shell, and reads an empty stdin
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteScript_Class param;
+        param.Script_value(
+            "#!/bin/sh\n"
+            "ps -o args= -p $$\n"
+            "read line && echo \"read: $line\"\n"
+            "exit 0\n");
+        param.Arguments_value("unit test run");
+        param.timeout_value(0);
+        InvokeReturnData returnData;
+        ExecuteScript(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 0, returnData.returnCode);
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, std::wstring::npos != returnData.stdOut.find(L"unit test run"));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, std::wstring::npos == returnData.stdOut.find(L"ps -o"));
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, std::wstring::npos == returnData.stdOut.find(L"read:"));
+    }
+
     void TestDoInvokeMethodScriptTmpDir()
     {
         std::wstring errMsg;
@@ -705,6 +894,65 @@ public:
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"", returnData.stdOut);
         CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"", returnData.stdErr);
     }    
+
+    void TestResourceLimits()
+    {
+        SCXCoreLib::SCXHandle<SCXCore::RunAsConfigurator> configurator(new SCXCore::RunAsConfigurator());
+        configurator->SetCWD(SCXCoreLib::SCXFilePath(L"./"));
+        if (0 == geteuid() && ! configurator->GetAllowRoot())
+        {
+            configurator->SetAllowRoot(true);
+        }
+        SCXCore::RunAsResourceLimits limits;
+        limits.openFiles = 64;
+        configurator->SetResourceLimits(limits);
+        SCXCore::g_RunAsProvider.SetConfigurator(configurator);
+
+        std::wstring errMsg;
+        mi::SCX_OperatingSystem_ExecuteShellCommand_Class param;
+        param.Command_value("ulimit -n");
+        param.timeout_value(0);
+        InvokeReturnData returnData;
+        ExecuteShellCommand(param, MI_RESULT_OK, returnData, CALL_LOCATION(errMsg));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, 0, returnData.returnCode);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(ERROR_MESSAGE, L"64\n", returnData.stdOut);
+#if defined(linux)
+        CPPUNIT_ASSERT_MESSAGE(ERROR_MESSAGE, returnData.resourceUsage.find(L"MaxResidentKB=") != std::wstring::npos);
+#endif
+    }
+
+    void TestElevatedHelper()
+    {
+        SCXCoreLib::SCXHandle<SCXCore::RunAsConfigurator> configurator(new SCXCore::RunAsConfigurator());
+        configurator->SetCWD(SCXCoreLib::SCXFilePath(L"./"));
+        configurator->SetAllowRoot(true);
+        configurator->SetElevatedHelper(true);
+        SCXCore::g_RunAsProvider.SetConfigurator(configurator);
+
+        TestableElevatedHelper helper;
+        SCXCore::g_RunAsProvider.SetElevatedHelper(&helper);
+
+        std::wstring resultOut, resultErr;
+        int returncode = -1;
+
+        // Run directly, as through sudo; there is no shell expanding $HOME
+        CPPUNIT_ASSERT(SCXCore::g_RunAsProvider.ExecuteCommand(L"/bin/echo $HOME", resultOut, resultErr, returncode, 0, L"sudo"));
+        CPPUNIT_ASSERT_EQUAL(0, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::wstring(L"$HOME\n"), resultOut);
+
+        // Single quotes aren't quoted again
+        CPPUNIT_ASSERT(SCXCore::g_RunAsProvider.ExecuteShellCommand(L"echo 'a b' | tr ' ' -", resultOut, resultErr, returncode, 0, L"sudo"));
+        CPPUNIT_ASSERT_EQUAL(0, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::wstring(L"a-b\n"), resultOut);
+
+        // The script is passed on stdin
+        CPPUNIT_ASSERT(SCXCore::g_RunAsProvider.ExecuteScript(L"#!/bin/sh\necho '$1' \"$1\"\n", L"x", resultOut, resultErr, returncode, 0, L"sudo"));
+        CPPUNIT_ASSERT_EQUAL(0, returncode);
+        CPPUNIT_ASSERT_EQUAL(std::wstring(L"$1 x\n"), resultOut);
+
+        SCXCore::g_RunAsProvider.SetElevatedHelper(NULL);
+        CPPUNIT_ASSERT_EQUAL(1, helper.m_starts);
+    }
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION( SCXRunAsProviderTest );
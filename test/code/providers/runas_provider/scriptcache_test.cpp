@@ -0,0 +1,244 @@
+/*--------------------------------------------------------------------------------
+  Copyright (c) Microsoft Corporation.  All rights reserved.
+
+*/
+/**
+   \file
+
+   \brief       Tests for the ExecuteScript script file cache
+
+   \date        2026-10-19 13:20:00
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <scxcorelib/scxdirectoryinfo.h>
+#include <scxcorelib/scxfile.h>
+#include <scxcorelib/stringaid.h>
+#include <testutils/scxunit.h>
+
+#include "scriptcache.h"
+#include "providermetrics.h"
+
+#include <fstream>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SCXCoreLib;
+using namespace SCXCore;
+
+class SCXScriptCacheTest : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( SCXScriptCacheTest );
+
+    CPPUNIT_TEST( TestHash );
+    CPPUNIT_TEST( TestSameScriptIsReused );
+    CPPUNIT_TEST( TestLeastRecentlyUsedIsEvicted );
+    CPPUNIT_TEST( TestEntryInUseIsNotEvicted );
+    CPPUNIT_TEST( TestSizeLimit );
+    CPPUNIT_TEST( TestChangedFileIsRewritten );
+    CPPUNIT_TEST( TestUntrustedDirectoryIsNotUsed );
+    CPPUNIT_TEST( TestLeaseWithoutCache );
+    CPPUNIT_TEST( TestCounters );
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    std::wstring m_directory;
+
+public:
+    void setUp(void)
+    {
+        m_directory = L"./testScriptCache/";
+        SCXDirectory::CreateDirectory(m_directory);
+    }
+
+    void tearDown(void)
+    {
+        system("rm -rf ./testScriptCache");
+    }
+
+    void TestHash()
+    {
+        CPPUNIT_ASSERT_EQUAL(ScriptCache::Hash(L"echo hello"), ScriptCache::Hash(L"echo hello"));
+        CPPUNIT_ASSERT(ScriptCache::Hash(L"echo hello") != ScriptCache::Hash(L"echo hellp"));
+        // FNV-1a offset basis
+        CPPUNIT_ASSERT_EQUAL(14695981039346656037ULL, ScriptCache::Hash(L""));
+    }
+
+    void TestSameScriptIsReused()
+    {
+        ScriptCache cache;
+        SCXFilePath path1 = cache.Acquire(L"echo hello\n", m_directory);
+        cache.Release(L"echo hello\n");
+        SCXFilePath path2 = cache.Acquire(L"echo hello\n", m_directory);
+        cache.Release(L"echo hello\n");
+
+        CPPUNIT_ASSERT(SCXFile::Exists(path1));
+        CPPUNIT_ASSERT_EQUAL(path1.Get(), path2.Get());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), cache.GetEntryCount());
+
+        cache.Clear();
+        CPPUNIT_ASSERT(!SCXFile::Exists(path1));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cache.GetEntryCount());
+    }
+
+    void TestLeastRecentlyUsedIsEvicted()
+    {
+        ScriptCache cache(2);
+        SCXFilePath path1 = cache.Acquire(L"echo 1\n", m_directory);
+        cache.Release(L"echo 1\n");
+        SCXFilePath path2 = cache.Acquire(L"echo 2\n", m_directory);
+        cache.Release(L"echo 2\n");
+
+        // Use 1 again, so 2 is the least recently used
+        cache.Acquire(L"echo 1\n", m_directory);
+        cache.Release(L"echo 1\n");
+
+        SCXFilePath path3 = cache.Acquire(L"echo 3\n", m_directory);
+        cache.Release(L"echo 3\n");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), cache.GetEntryCount());
+        CPPUNIT_ASSERT(SCXFile::Exists(path1));
+        CPPUNIT_ASSERT(!SCXFile::Exists(path2));
+        CPPUNIT_ASSERT(SCXFile::Exists(path3));
+        cache.Clear();
+    }
+
+    void TestEntryInUseIsNotEvicted()
+    {
+        ScriptCache cache(1);
+        SCXFilePath path1 = cache.Acquire(L"echo 1\n", m_directory);
+        SCXFilePath path2 = cache.Acquire(L"echo 2\n", m_directory);
+
+        // Both in use, so the cache is over its limit for now
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), cache.GetEntryCount());
+        CPPUNIT_ASSERT(SCXFile::Exists(path1));
+
+        cache.Release(L"echo 1\n");
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), cache.GetEntryCount());
+        CPPUNIT_ASSERT(!SCXFile::Exists(path1));
+        CPPUNIT_ASSERT(SCXFile::Exists(path2));
+
+        cache.Release(L"echo 2\n");
+        cache.Clear();
+    }
+
+    void TestSizeLimit()
+    {
+        ScriptCache cache(10, 20);
+        cache.Acquire(L"echo 1234567890\n", m_directory);
+        cache.Release(L"echo 1234567890\n");
+        cache.Acquire(L"echo abcdefghij\n", m_directory);
+        cache.Release(L"echo abcdefghij\n");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), cache.GetEntryCount());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(16), cache.GetSize());
+        cache.Clear();
+    }
+
+    void TestChangedFileIsRewritten()
+    {
+        ScriptCache cache;
+        SCXFilePath path = cache.Acquire(L"echo hello\n", m_directory);
+        cache.Release(L"echo hello\n");
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(16), path.GetFilename().size());
+
+        // Changed contents
+        std::string fileName = StrToMultibyte(path.Get());
+        {
+            std::ofstream file(fileName.c_str());
+            file << "echo changed" << std::endl;
+        }
+        CPPUNIT_ASSERT_EQUAL(path.Get(), cache.Acquire(L"echo hello\n", m_directory).Get());
+        cache.Release(L"echo hello\n");
+        {
+            std::ifstream file(fileName.c_str());
+            std::string line;
+            std::getline(file, line);
+            CPPUNIT_ASSERT_EQUAL(std::string("echo hello"), line);
+        }
+
+        // Changed mode
+        CPPUNIT_ASSERT_EQUAL(0, chmod(fileName.c_str(), 0777));
+        CPPUNIT_ASSERT_EQUAL(path.Get(), cache.Acquire(L"echo hello\n", m_directory).Get());
+        cache.Release(L"echo hello\n");
+        struct stat st;
+        CPPUNIT_ASSERT_EQUAL(0, lstat(fileName.c_str(), &st));
+        CPPUNIT_ASSERT_EQUAL(static_cast<mode_t>(S_IRWXU), st.st_mode & 07777);
+
+        // Replaced by a link
+        CPPUNIT_ASSERT_EQUAL(0, unlink(fileName.c_str()));
+        CPPUNIT_ASSERT_EQUAL(0, symlink("/bin/true", fileName.c_str()));
+        CPPUNIT_ASSERT_EQUAL(path.Get(), cache.Acquire(L"echo hello\n", m_directory).Get());
+        cache.Release(L"echo hello\n");
+        CPPUNIT_ASSERT_EQUAL(0, lstat(fileName.c_str(), &st));
+        CPPUNIT_ASSERT(S_ISREG(st.st_mode));
+
+        cache.Clear();
+    }
+
+    void TestUntrustedDirectoryIsNotUsed()
+    {
+        SCXFilePath cacheDirectory;
+        cacheDirectory.SetDirectory(m_directory);
+        cacheDirectory.AppendDirectory(StrAppend(L"scriptcache-", static_cast<unsigned int>(geteuid())));
+        std::string directoryName = StrToMultibyte(cacheDirectory.GetDirectory());
+        CPPUNIT_ASSERT_EQUAL(0, mkdir(directoryName.c_str(), S_IRWXU));
+        CPPUNIT_ASSERT_EQUAL(0, chmod(directoryName.c_str(), 0777));
+
+        // Not cached; the lease falls back to a temp file
+        ScriptCache cache;
+        CPPUNIT_ASSERT(cache.Acquire(L"echo hello\n", m_directory).Get().empty());
+        {
+            ScriptCacheLease lease(cache, L"echo hello\n", m_directory);
+            CPPUNIT_ASSERT(SCXFile::Exists(lease.GetPath()));
+            CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cache.GetEntryCount());
+        }
+
+        CPPUNIT_ASSERT_EQUAL(0, chmod(directoryName.c_str(), S_IRWXU));
+        CPPUNIT_ASSERT(!cache.Acquire(L"echo hello\n", m_directory).Get().empty());
+        cache.Release(L"echo hello\n");
+        cache.Clear();
+    }
+
+    void TestLeaseWithoutCache()
+    {
+        ScriptCache cache;
+        SCXFilePath path;
+        {
+            ScriptCacheLease lease(cache, L"echo hello\n", m_directory, false);
+            path = lease.GetPath();
+            CPPUNIT_ASSERT(SCXFile::Exists(path));
+            CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cache.GetEntryCount());
+        }
+        CPPUNIT_ASSERT(!SCXFile::Exists(path));
+    }
+
+    void TestCounters()
+    {
+        scxulong hits = g_ProviderMetrics.GetCounter(L"ScriptCache::Hits").Get();
+        scxulong misses = g_ProviderMetrics.GetCounter(L"ScriptCache::Misses").Get();
+        scxulong evictions = g_ProviderMetrics.GetCounter(L"ScriptCache::Evictions").Get();
+
+        ScriptCache cache(1);
+        {
+            ScriptCacheLease lease(cache, L"echo 1\n", m_directory);
+        }
+        {
+            ScriptCacheLease lease(cache, L"echo 1\n", m_directory);
+        }
+        {
+            ScriptCacheLease lease(cache, L"echo 2\n", m_directory);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(hits + 1, g_ProviderMetrics.GetCounter(L"ScriptCache::Hits").Get());
+        CPPUNIT_ASSERT_EQUAL(misses + 2, g_ProviderMetrics.GetCounter(L"ScriptCache::Misses").Get());
+        CPPUNIT_ASSERT_EQUAL(evictions + 1, g_ProviderMetrics.GetCounter(L"ScriptCache::Evictions").Get());
+        cache.Clear();
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( SCXScriptCacheTest );
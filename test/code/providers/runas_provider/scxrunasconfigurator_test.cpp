@@ -74,6 +74,8 @@ class SCXRunAsConfiguratorTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST( testCommentsAreIgnored );
     CPPUNIT_TEST( testInvalidRowsAreIgnored );
     CPPUNIT_TEST( testAllowRoot );
+    CPPUNIT_TEST( testElevatedHelper );
+    CPPUNIT_TEST( testResourceLimits );
     CPPUNIT_TEST( testGetChRootPath );
     CPPUNIT_TEST( testGetCWD );
     CPPUNIT_TEST( testUnexistingEnvVar );
@@ -101,6 +103,8 @@ public:
         CPPUNIT_ASSERT(p.GetAllowRoot() == true);
         CPPUNIT_ASSERT(p.GetChRootPath() == SCXFilePath(L""));
         CPPUNIT_ASSERT(p.GetCWD() == SCXFilePath(L"/var/opt/microsoft/scx/tmp/"));
+        CPPUNIT_ASSERT(p.GetElevatedHelper() == false);
+        CPPUNIT_ASSERT(p.GetResourceLimits() == RunAsResourceLimits());
     }
 
     void testCommentsAreIgnored()
@@ -151,6 +155,56 @@ public:
         CPPUNIT_ASSERT(p3.GetAllowRoot() == false);
     }
 
+    void testElevatedHelper()
+    {
+        RunAsConfigurator p1 = RunAsConfigurator(
+            SCXCoreLib::SCXHandle<ConfigurationParser>(new ConfigurationStringParser(L"ElevatedHelper = true")),
+            SCXCoreLib::SCXHandle<ConfigurationWriter>(0)).Parse();
+
+        CPPUNIT_ASSERT(p1.GetElevatedHelper() == true);
+
+        RunAsConfigurator p2 = RunAsConfigurator(
+            SCXCoreLib::SCXHandle<ConfigurationParser>(new ConfigurationStringParser(L"ElevatedHelper = invalidvalue")),
+            SCXCoreLib::SCXHandle<ConfigurationWriter>(0)).Parse();
+
+        CPPUNIT_ASSERT(p2.GetElevatedHelper() == false);
+    }
+
+    void testResourceLimits()
+    {
+        std::wstring configData(L"MaxCPUSeconds = 60\n"
+                                L"MaxMemoryMB = 512\n"
+                                L"MaxFileSizeMB = 10\n"
+                                L"MaxProcesses = 100\n"
+                                L"MaxOpenFiles = 256\n"
+                                L"Nice = 10\n"
+                                L"IOClass = best-effort\n"
+                                L"IOPriority = 7\n"
+                                L"CGroup = /sys/fs/cgroup/scx/\n");
+        RunAsConfigurator p1 = RunAsConfigurator(
+            SCXCoreLib::SCXHandle<ConfigurationParser>(new ConfigurationStringParser(configData)),
+            SCXCoreLib::SCXHandle<ConfigurationWriter>(0)).Parse();
+
+        const RunAsResourceLimits& limits = p1.GetResourceLimits();
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(60), limits.cpuSeconds);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(512), limits.memoryMB);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(10), limits.fileSizeMB);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(100), limits.processes);
+        CPPUNIT_ASSERT_EQUAL(static_cast<scxulong>(256), limits.openFiles);
+        CPPUNIT_ASSERT_EQUAL(10, limits.nice);
+        CPPUNIT_ASSERT_EQUAL(2, limits.ioClass);
+        CPPUNIT_ASSERT_EQUAL(7, limits.ioPriority);
+        CPPUNIT_ASSERT(L"/sys/fs/cgroup/scx/" == limits.cgroup);
+
+        // Invalid values leave the limit unset
+        RunAsConfigurator p2 = RunAsConfigurator(
+            SCXCoreLib::SCXHandle<ConfigurationParser>(new ConfigurationStringParser(
+                L"MaxCPUSeconds = lots\nNice = 100\nIOClass = realtime\nIOPriority = 8\n")),
+            SCXCoreLib::SCXHandle<ConfigurationWriter>(0)).Parse();
+
+        CPPUNIT_ASSERT(p2.GetResourceLimits() == RunAsResourceLimits());
+    }
+
     void testGetChRootPath()
     {
         RunAsConfigurator p = RunAsConfigurator(
@@ -254,6 +308,14 @@ public:
         c1.SetAllowRoot(false);
         c1.SetChRootPath(L"/what/ever/");
         c1.SetCWD(L"/foo/bar/");
+        c1.SetElevatedHelper(true);
+        RunAsResourceLimits limits;
+        limits.cpuSeconds = 60;
+        limits.memoryMB = 512;
+        limits.nice = 10;
+        limits.ioClass = 3;
+        limits.cgroup = L"/sys/fs/cgroup/scx/";
+        c1.SetResourceLimits(limits);
         c1.Write();
 
         SCXHandle<ConfigurationParser> parser( new ConfigurationStringParser(writer->GetString()));
@@ -264,6 +326,8 @@ public:
         CPPUNIT_ASSERT(c2.GetAllowRoot() == false);
         CPPUNIT_ASSERT(c2.GetChRootPath() == SCXFilePath(L"/what/ever/"));
         CPPUNIT_ASSERT(c2.GetCWD() == SCXFilePath(L"/foo/bar/"));
+        CPPUNIT_ASSERT(c2.GetElevatedHelper() == true);
+        CPPUNIT_ASSERT(c2.GetResourceLimits() == limits);
     }
 
 };
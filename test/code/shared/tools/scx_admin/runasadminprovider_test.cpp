@@ -120,7 +120,7 @@ public:
         SCX_RunAsAdminProvider conf = GivenAdminProviderWithEmptyConfiguration();
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
-        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\n" == buf.str());
+        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\nElevatedHelper = false\n" == buf.str());
     }
 
     void TestWriteAndRead()
@@ -130,6 +130,7 @@ public:
         CPPUNIT_ASSERT(conf.Set(L"AllowRoot", L"false"));
         CPPUNIT_ASSERT(conf.Set(L"ChRootPath", L"/what/ever/"));
         CPPUNIT_ASSERT(conf.Set(L"CWD", L"/foo/bar/"));
+        CPPUNIT_ASSERT(conf.Set(L"ElevatedHelper", L"true"));
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
         
@@ -141,6 +142,7 @@ public:
         CPPUNIT_ASSERT(c2.GetAllowRoot() == false);
         CPPUNIT_ASSERT(c2.GetChRootPath() == SCXFilePath(L"/what/ever/"));
         CPPUNIT_ASSERT(c2.GetCWD() == SCXFilePath(L"/foo/bar/"));
+        CPPUNIT_ASSERT(c2.GetElevatedHelper() == true);
     }
 
     void TestUnsupportedValues()
@@ -173,7 +175,7 @@ public:
         
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
-        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\n" == buf.str());
+        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\nElevatedHelper = false\n" == buf.str());
     }
 
     void TestResetAllowRootWithNoSSHConfFile()
@@ -184,7 +186,7 @@ public:
         CPPUNIT_ASSERT(conf.Reset(L"AllowRoot"));
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
-        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\n" == buf.str());
+        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\nElevatedHelper = false\n" == buf.str());
     }
 
     void TestResetAllowRootWithNoSSHConf()
@@ -203,7 +205,7 @@ public:
         CPPUNIT_ASSERT(conf.Reset(L"AllowRoot"));
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
-        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\n" == buf.str());
+        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\nElevatedHelper = false\n" == buf.str());
     }
 
     void TestResetAllowRootWithSSHConfTrue()
@@ -219,7 +221,7 @@ public:
         CPPUNIT_ASSERT(conf.Reset(L"AllowRoot"));
         std::wostringstream buf;
         CPPUNIT_ASSERT(conf.Print(buf));
-        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\n" == buf.str());
+        CPPUNIT_ASSERT(L"CWD = /var/opt/microsoft/scx/tmp/\nChRootPath = \nAllowRoot = true\nElevatedHelper = false\n" == buf.str());
     }
 
     void TestResetAllowRootWithSSHConfFalse()